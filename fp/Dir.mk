@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2025, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 .SECONDEXPANSION:
@@ -24,7 +24,14 @@ all-fp-testnames := test-f2d test-d2f \
 	test-i2f test-ui2f test-l2f test-ul2f \
 	test-dmul test-daddsub test-ddiv test-dcmp \
 	test-d2uiz test-d2iz test-d2ulz test-d2lz \
-	test-i2d test-ui2d test-l2d test-ul2d
+	test-i2d test-ui2d test-l2d test-ul2d \
+	test-fsqrt test-dsqrt test-ffma test-dfma \
+	test-fmul_ftz test-faddsub_ftz test-dmul_ftz \
+	test-h2f test-f2h test-h2d test-d2h \
+	test-haddsub test-hmul test-hcmp \
+	test-funpack test-fpack test-fumul test-fuaddsub test-fudiv \
+	test-fdot test-faxpy \
+	test-lmul test-uldivmod32
 
 # Filter the list down to only the tests of functions present in this FP_SUBDIR
 fp-tests-available := $(foreach obj,$(fp-lib-objs),$(patsubst %.o,test-%,$(notdir $(obj))))
@@ -34,6 +41,9 @@ endif
 ifneq ($(findstring dcmp_,$(fp-tests-available)),)
 fp-tests-available += test-dcmp
 endif
+ifneq ($(findstring hcmp_,$(fp-tests-available)),)
+fp-tests-available += test-hcmp
+endif
 ifneq ($(findstring l2f,$(fp-tests-available)),)
 fp-tests-available += test-ul2f
 endif
@@ -42,6 +52,15 @@ fp-testnames := $(filter $(all-fp-testnames), $(fp-tests-available))
 fp-tests := $(patsubst %,$(fp-build-dir)/%,$(fp-testnames))
 fp-test-objs := $(patsubst %,$(fp-build-dir)/test/%.o,$(fp-testnames))
 
+fp-bench := $(fp-build-dir)/fpbench
+fp-bench-objs := $(fp-build-dir)/bench/fpbench.o
+
+fp-difftest := $(fp-build-dir)/difftest
+fp-difftest-objs := $(fp-build-dir)/test/difftest.o
+
+# Programs that use system headers, and test whichever routines exist
+fp-host-objs := $(fp-bench-objs) $(fp-difftest-objs)
+
 fp-target-objs := $(fp-lib-objs) $(fp-test-objs)
 fp-objs := $(fp-target-objs)
 
@@ -53,15 +72,30 @@ $(fp-build-dir)/at32/ddiv-diagnostics.o: $(fp-src-dir)/at32/ddiv.S
 	$(CC) $(CFLAGS_ALL) -c -o $@ $^ -DDIAGNOSTICS
 
 fp-aux += $(fp-build-dir)/ddiv-diagnostics
+
+# ddiv and fdiv again, with their debug statements calling div-verify.c
+fp-div-verify-objs := \
+	$(fp-build-dir)/at32/ddiv-verify.o \
+	$(fp-build-dir)/at32/fdiv-verify.o \
+
+fp-objs += $(fp-div-verify-objs)
+$(fp-div-verify-objs): $(fp-build-dir)/at32/%-verify.o: $(fp-src-dir)/at32/%.S
+	$(CC) $(CFLAGS_ALL) -c -o $@ $< -DDIAGNOSTICS \
+		-DDIAGNOSTICS_PRINTF=div_verify_record
+
+fp-aux += $(fp-build-dir)/div-verify
 endif
 
 fp-files := \
 	$(fp-objs) \
+	$(fp-host-objs) \
 	$(fp-libs) \
 	$(fp-tests) \
+	$(fp-bench) \
+	$(fp-difftest) \
 	$(fp-aux) \
 
-all-fp: $(fp-libs) $(fp-tests) $(fp-aux)
+all-fp: $(fp-libs) $(fp-tests) $(fp-bench) $(fp-difftest) $(fp-aux)
 
 $(fp-objs): $(fp-includes) $(fp-test-includes)
 $(fp-objs): CFLAGS_ALL += $(fp-cflags)
@@ -70,6 +104,12 @@ ifeq ($(FP_SUBDIR),at32)
 $(fp-objs): CFLAGS_ALL += -Wa,-mimplicit-it=always
 endif
 
+# The benchmark and the differential tester use system headers, so they
+# can't have fp/include (with its own endian.h) on the include path. They
+# are told which routines this FP_SUBDIR provides instead.
+$(fp-host-objs): CFLAGS_ALL += $(fp-cflags)
+$(fp-host-objs): CFLAGS_ALL += $(patsubst %.o,-DHAVE_%=1,$(notdir $(fp-lib-objs)))
+
 build/lib/libfplib.a: $(fp-lib-objs)
 	rm -f $@
 	$(AR) rc $@ $^
@@ -78,15 +118,43 @@ build/lib/libfplib.a: $(fp-lib-objs)
 $(fp-tests): $(fp-build-dir)/%: $(fp-build-dir)/test/%.o $(fp-libs)
 	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(fp-libs)
 
+$(fp-bench): $(fp-bench-objs) $(fp-libs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(fp-libs) $(libm-libs)
+
+$(fp-difftest): $(fp-difftest-objs) $(fp-libs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(fp-libs) $(libm-libs) -lpthread
+
 ifeq ($(FP_SUBDIR),at32)
 
 $(fp-build-dir)/ddiv-diagnostics: $(fp-src-dir)/auxiliary/ddiv-diagnostics.c \
 	$(fp-build-dir)/at32/ddiv-diagnostics.o $(fp-libs)
 	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(fp-libs)
 
+$(fp-build-dir)/div-verify: $(fp-src-dir)/auxiliary/div-verify.c \
+	$(fp-div-verify-objs) $(fp-libs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(fp-libs) $(libm-libs) -lpthread
+
+# Check the intermediate values of ddiv and fdiv against the models of their
+# algorithms, over random inputs and then every fdiv denominator.
+check-fp-div-verify: $(fp-build-dir)/div-verify
+	$(EMULATOR) $(fp-build-dir)/div-verify
+	$(EMULATOR) $(fp-build-dir)/div-verify -x
+
 endif
 
 clean-fp:
 	rm -f $(fp-files)
 
-.PHONY: all-fp clean-fp
+check-fp: $(fp-tests)
+	@for t in $^; do echo $$t; $(EMULATOR) $$t || exit 1; done
+
+# Much slower than check-fp: a million random inputs per routine, and then
+# every input of each routine that takes one 32-bit input.
+check-fp-difftest: $(fp-difftest)
+	$(EMULATOR) $(fp-difftest)
+	$(EMULATOR) $(fp-difftest) -x
+
+bench-fp: $(fp-bench)
+	$(EMULATOR) $(fp-bench)
+
+.PHONY: all-fp bench-fp check-fp check-fp-difftest check-fp-div-verify clean-fp
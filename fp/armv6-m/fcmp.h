@@ -1,6 +1,6 @@
 // Shared code between most of the single-precision comparison functions.
 //
-// Copyright (c) 1994-1998,2025, Arm Limited.
+// Copyright (c) 1994-1998,2025-2026, Arm Limited.
 // SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 // --------------------------------------------------
@@ -33,6 +33,15 @@
 // this header. Called when at least one input is a NaN, and sets up the
 // appropriate return value for that case.
 
+// The half-precision comparisons in hcmp.h reuse this code, by shifting their
+// inputs to the top of the word and overriding the two macros below: the
+// position of the low exponent bit, and the top byte of an infinity once its
+// sign bit is shifted off.
+#ifndef FCMP_EXP_LSB_SHIFT
+#define FCMP_EXP_LSB_SHIFT 23
+#define FCMP_INF_TOP 0xFF
+#endif
+
 // --------------------------------------------------
 // The actual entry point of the compare function.
 //
@@ -46,7 +55,7 @@
   // Set up the constant 1 << 23 in a register, which we'll need on all
   // branches.
   MOVS    r3, #1
-  LSLS    r3, r3, #23
+  LSLS    r3, r3, #FCMP_EXP_LSB_SHIFT
 
   // Diverge control for the negative-numbers case.
   MOVS    r2, op0
@@ -102,7 +111,7 @@ fcmp_NaN_check_positive:
   // test immediately. But that would cost an extra instruction in the case
   // where there are no infinities or NaNs, and we assume that that is so much
   // more common that it's worth optimizing for.
-  MOVS    r2, #0xFF
+  MOVS    r2, #FCMP_INF_TOP
   LSLS    r2, r2, #24
   LSLS    r3, op0, #1
   CMP     r3, r2
@@ -167,7 +176,7 @@ fcmp_NaNInf_check_negative:
   // On this path we've already branched twice (once for negative numbers and
   // once for the first-tier NaN check), so we'll just go straight to the
   // precise check for NaNs.
-  MOVS    r2, #0xFF
+  MOVS    r2, #FCMP_INF_TOP
   LSLS    r2, r2, #24
   LSLS    r3, op0, #1
   CMP     r3, r2
@@ -1,6 +1,6 @@
 // Shared code between most of the single-precision comparison functions.
 //
-// Copyright (c) 1994-1998,2025, Arm Limited.
+// Copyright (c) 1994-1998,2025-2026, Arm Limited.
 // SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 // --------------------------------------------------
@@ -33,6 +33,15 @@
 // this header. Called when at least one input is a NaN, and sets up the
 // appropriate return value for that case.
 
+// The half-precision comparisons in hcmp.h reuse this code, by shifting their
+// inputs to the top of the word and overriding the two macros below: the
+// position of the low exponent bit, and the top byte of an infinity once its
+// sign bit is shifted off.
+#ifndef FCMP_EXP_LSB_SHIFT
+#define FCMP_EXP_LSB_SHIFT 23
+#define FCMP_INF_TOP 0xFF
+#endif
+
 // --------------------------------------------------
 // The actual entry point of the compare function.
 //
@@ -50,7 +59,7 @@
   // Here, both inputs are positive. Try adding 1<<23 to their bitwise OR in
   // r12. This will carry all the way into the top bit, setting the N flag, if
   // all 8 exponent bits were set.
-  CMN     r12, #1 << 23
+  CMN     r12, #1 << FCMP_EXP_LSB_SHIFT
   BMI     fcmp_NaNInf_check_positive // need to look harder for NaNs
 
   // The fastest fast path: both inputs positive and we could easily tell there
@@ -75,8 +84,8 @@ fcmp_NaNInf_check_positive:
   // Test each exponent individually for 0xFF, using the same CMN idiom as
   // above. If neither one carries into the sign bit then we have no NaNs _or_
   // infinities and can compare the registers and return again.
-  CMN     op0, #1 << 23
-  CMNPL   op1, #1 << 23
+  CMN     op0, #1 << FCMP_EXP_LSB_SHIFT
+  CMNPL   op1, #1 << FCMP_EXP_LSB_SHIFT
   BMI     fcmp_NaN_check_positive
 
   // Second-tier return path, now we've ruled out anything difficult.
@@ -95,7 +104,7 @@ fcmp_NaN_check_positive:
   // test immediately. But that would cost an extra instruction in the case
   // where there are no infinities or NaNs, and we assume that that is so much
   // more common that it's worth optimizing for.
-  MOV     r12, #0xFF << 24
+  MOV     r12, #FCMP_INF_TOP << 24
   CMP     r12, op0, LSL #1   // if LO, then r12 < (op0 << 1), so op0 is a NaN
   CMPHS   r12, op1, LSL #1   // if not LO, then do the same check for op1
   BLO     fcmp_NaN           // now, if LO, there's definitely a NaN
@@ -116,7 +125,7 @@ fcmp_negative:
   // exponent bit carries all the way through into the sign bit, it will
   // _clear_ the sign bit rather than setting it. So we expect MI to be the
   // "definitely no NaNs" result, where it was PL on the positive branch.
-  CMN     r12, #1 << 23
+  CMN     r12, #1 << FCMP_EXP_LSB_SHIFT
   BPL     fcmp_NaNInf_check_negative
 
   // Now we have no NaNs, but at least one negative number. This gives us two
@@ -154,7 +163,7 @@ fcmp_NaNInf_check_negative:
   // On this path we've already branched twice (once for negative numbers and
   // once for the first-tier NaN check), so we'll just go straight to the
   // precise check for NaNs.
-  MOV     r12, #0xFF << 24
+  MOV     r12, #FCMP_INF_TOP << 24
   CMP     r12, op0, LSL #1   // if LO, then r12 < (op0 << 1), so op0 is a NaN
   CMPHS   r12, op1, LSL #1   // if not LO, then do the same check for op1
   BLO     fcmp_NaN
@@ -0,0 +1,107 @@
+// Shared code between arm_fp_fpack and the vector functions that pack their
+// results inline.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// --------------------------------------------------
+// How to use this header file:
+//
+// The code below converts the unpacked value in xh:xl, as defined in
+// endian.h, into a single-precision value in r0. r2, r3 and r12 are
+// corrupted.
+//
+// This header file is expected to be #included from inside a function
+// definition in a .S file, after endian.h. The source file including this
+// header should provide the following:
+//
+// FpackReturn: an assembly macro taking an optional condition code, which
+// finishes with the output in r0 if that condition holds. For arm_fp_fpack
+// itself this is just a return.
+
+// --------------------------------------------------
+// The code itself.
+
+  // Shift the sign off the exponent word and rebias it, so that r2 is twice
+  // the value of (output exponent - 1). That is in the range [0,508) exactly
+  // when the output is a normalized number before rounding. Everything else
+  // (zeroes, infinities, NaNs, overflow and denormal outputs) goes out of
+  // line.
+  LSL     r2, xh, #1
+  SUB     r2, r2, #0x60000000
+  SUB     r2, r2, #2
+  CMP     r2, #254 << 1
+  BHS     fpack_uncommon
+
+  // Combine the sign, the exponent and the top 24 bits of the mantissa
+  // including its leading bit. Shift the round bit of the mantissa into C,
+  // setting Z if everything below it is zero, and use C to round up. A carry
+  // out of the mantissa correctly increments the exponent, and makes an
+  // infinity if that overflows.
+  AND     r3, xh, #0x80000000
+  ADD     r3, r3, r2, LSL #22
+  LSLS    r12, xl, #25
+  ADC     r0, r3, xl, LSR #8
+
+  // If C=1 and Z=1, we rounded up from an exact halfway case, so round to
+  // even instead.
+  FpackReturn ne
+  BICCS   r0, r0, #1
+  FpackReturn
+
+fpack_uncommon:
+  // Keep the sign in r3. If the exponent is within the window that the
+  // arithmetic functions use for finite nonzero values, then r2 is still
+  // meaningful, and tells us whether the output overflows or is denormal.
+  AND     r3, xh, #0x80000000
+  AND     r12, xh, #0x60000000
+  CMP     r12, #0x20000000
+  BEQ     fpack_outofrange
+
+  // Otherwise the input is a zero (if its exponent is below the window), or
+  // an infinity or a NaN (if it is above). Return a NaN's mantissa as its
+  // fraction field, which is zero for the canonical infinity.
+  TST     xh, #0x40000000
+  MOVEQ   r0, r3
+  FpackReturn eq
+  LSL     r12, xh, #1
+  CMN     r12, #2
+  ORR     r3, r3, #0x7F000000
+  ORR     r3, r3, #0x00800000
+  ORREQ   r0, r3, xl, LSR #9
+  MOVNE   r0, r3
+  FpackReturn
+
+fpack_outofrange:
+  // If r2 is positive, the output overflows, so return an infinity.
+  CMP     r2, #0
+  ORRGT   r0, r3, #0x7F000000
+  ORRGT   r0, r0, #0x00800000
+  FpackReturn gt
+
+  // Otherwise the output is denormal (or zero). r2/2 is the output exponent
+  // minus 1, i.e. -1 or less. The mantissa must be shifted right so that its
+  // leading bit goes to bit 22 for an exponent of 0, which is a shift of 9;
+  // so the shift is 8-r2/2. If that's more than 32 bits, the output is zero
+  // even when rounded.
+  MOV     r2, r2, ASR #1
+  RSB     r2, r2, #8
+  CMP     r2, #32
+  MOVHI   r0, r3
+  FpackReturn hi
+
+  // Shift the mantissa down, setting C to the round bit, and add it to the
+  // sign, rounding up if C is set. Leave the result in r12 for the moment,
+  // because r0 might be xl.
+  LSRS    r12, xl, r2
+  ADC     r12, r3, r12
+  MOVCC   r0, r12
+  FpackReturn cc
+
+  // If we rounded up, check for a halfway case, and if so, round to even.
+  RSB     r2, r2, #32
+  LSL     r2, xl, r2
+  CMP     r2, #0x80000000
+  BICEQ   r12, r12, #1
+  MOV     r0, r12
+  FpackReturn
@@ -0,0 +1,281 @@
+// Shared code between arm_fp_fuadd and the vector functions built on it.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// --------------------------------------------------
+// How to use this header file:
+//
+// The code below adds two values in the unpacked-operand format (described in
+// fp/README.md) in xh:xl and yh:yl, as defined in endian.h, and leaves the sum
+// in xh:xl, rounded to odd at 32 bits. yh, yl and r12 are corrupted.
+//
+// This header file is expected to be #included from inside a function
+// definition in a .S file, after endian.h. The source file including this
+// header should provide the following:
+//
+// FuaddReturn: an assembly macro taking an optional condition code, which
+// finishes with the sum in xh:xl if that condition holds. For arm_fp_fuadd
+// itself this is just a return; a vector function might branch back into its
+// loop instead.
+//
+// FuaddSpecial: an assembly macro used when the larger input exponent is
+// outside the window [0x20000000,0x40000000) of finite nonzero values, so
+// that the inputs are infinities, NaNs or two zeroes. The inputs have been
+// restored to xh:xl and yh:yl unchanged.
+//
+// Only the input with the larger exponent is checked against the window. If
+// it's inside, then the other input is either finite too, or a canonical zero
+// (with X = 0 and a zero mantissa), which behaves exactly like a finite value
+// that's much too small to affect the sum, even when it's the first input.
+// So the fast path doesn't need to treat zeroes specially.
+//
+// If FUADD_FINITE is defined to 1, the caller guarantees that both inputs are
+// finite nonzero values whose exponents are far enough inside the window that
+// the sum can't leave it either, such as values unpacked from single
+// precision, or products of two of them. Then the window checks are left out,
+// and FuaddSpecial isn't needed.
+
+// --------------------------------------------------
+// The code itself.
+//
+// General structure: each input in turn might have the larger exponent, and
+// we might be adding or subtracting magnitudes, so there are four similar
+// paths. On each, the mantissa of the input with the smaller exponent is
+// shifted right by the exponent difference d, into a word lined up with the
+// other mantissa, and a second word of the bits shifted off the bottom. Then
+// the aligned mantissas are added or subtracted as 64-bit integers, which
+// gives the exact result. That's renormalized if necessary, and rounded to odd
+// by setting the low bit of the top word if anything is left in the bottom
+// one.
+//
+// If d >= 32, we saturate it to 32, so that the smaller mantissa ends up
+// entirely in the bottom word. Its exact value there doesn't matter, only
+// whether it's nonzero.
+
+  // If the signs differ, we're subtracting magnitudes.
+  TEQ     xh, yh
+  BMI     fuadd_sub
+
+  // The signs are the same, so subtracting the exponent words gives
+  // d = X(x) - X(y), and sets LO if it's negative.
+  SUBS    r12, xh, yh
+  BLO     fuadd_add_yx
+
+  // x has the larger exponent, so check that it's in the window. yh isn't
+  // needed any more, because y's sign is the same as x's.
+#if !FUADD_FINITE
+  AND     yh, xh, #0x60000000
+  CMP     yh, #0x20000000
+  BNE     fuadd_special_add_xy
+#endif
+
+  // Align y's mantissa, putting the bits shifted off the bottom in yh, and
+  // add it to x's.
+  CMP     r12, #32
+  MOVHI   r12, #32
+  RSB     yh, r12, #32
+  LSL     yh, yl, yh
+#if !__thumb__
+  ADDS    xl, xl, yl, LSR r12
+#else
+  LSR     yl, yl, r12
+  ADDS    xl, xl, yl
+#endif
+  BCS     fuadd_carry
+
+  // Round to odd, and we're done.
+  CMP     yh, #0
+  ORRNE   xl, xl, #1
+  FuaddReturn
+
+fuadd_carry:
+  // The sum of the mantissas carried off the top. Fold the bits below the
+  // sum into its low bit, then shift it right by one, bringing the carry back
+  // in at the top and rounding to odd with the bit shifted off. An exponent
+  // that reaches 0x40000000 has left the window.
+  CMP     yh, #0
+  ORRNE   xl, xl, #1
+  LSRS    xl, xl, #1
+  ORR     xl, xl, #0x80000000
+  ORRCS   xl, xl, #1
+  ADD     xh, xh, #1
+#if !FUADD_FINITE
+  TST     xh, #0x40000000
+  BNE     fuadd_saturate
+#endif
+  FuaddReturn
+
+fuadd_add_yx:
+  // The same as above, with y having the larger exponent. The output's
+  // exponent word is y's, so copy it into xh, and then the rest is the same
+  // with the roles of x and y swapped.
+  RSB     r12, r12, #0
+#if !FUADD_FINITE
+  AND     xh, yh, #0x60000000
+  CMP     xh, #0x20000000
+  BNE     fuadd_special_add_yx
+#endif
+  MOV     xh, yh
+  CMP     r12, #32
+  MOVHI   r12, #32
+  RSB     yh, r12, #32
+  LSL     yh, xl, yh
+#if !__thumb__
+  ADDS    xl, yl, xl, LSR r12
+#else
+  LSR     xl, xl, r12
+  ADDS    xl, yl, xl
+#endif
+  BCS     fuadd_carry
+  CMP     yh, #0
+  ORRNE   xl, xl, #1
+  FuaddReturn
+
+fuadd_sub:
+  // The signs differ, so subtracting the exponent words gives d with its top
+  // bit flipped. Flip it back, setting MI if y has the larger exponent.
+  SUB     r12, xh, yh
+  EORS    r12, r12, #0x80000000
+  BMI     fuadd_sub_yx
+
+  // x has the larger exponent, so check that it's in the window, and then
+  // subtract y's aligned mantissa from x's, treating x's as the high word of a
+  // 64-bit value whose low word is zero. The result can only be negative if
+  // d = 0.
+#if !FUADD_FINITE
+  AND     yh, xh, #0x60000000
+  CMP     yh, #0x20000000
+  BNE     fuadd_special_sub_xy
+#endif
+  CMP     r12, #32
+  MOVHI   r12, #32
+  RSB     yh, r12, #32
+  LSL     yh, yl, yh
+#if !__thumb__
+  RSBS    yh, yh, #0
+  SBCS    xl, xl, yl, LSR r12
+#else
+  LSR     yl, yl, r12
+  RSBS    yh, yh, #0
+  SBCS    xl, xl, yl
+#endif
+  BCC     fuadd_sub_negative
+
+fuadd_sub_check:
+  // If the top bit of the difference is still set, round to odd and finish.
+  // Otherwise it needs renormalizing.
+  BPL     fuadd_sub_renorm
+  CMP     yh, #0
+  ORRNE   xl, xl, #1
+  FuaddReturn
+
+fuadd_sub_yx:
+  // The same, with y having the larger exponent. That means d > 0, so the
+  // difference can't be negative.
+  RSB     r12, r12, #0
+#if !FUADD_FINITE
+  AND     xh, yh, #0x60000000
+  CMP     xh, #0x20000000
+  BNE     fuadd_special_sub_yx
+#endif
+  MOV     xh, yh
+  CMP     r12, #32
+  MOVHI   r12, #32
+  RSB     yh, r12, #32
+  LSL     yh, xl, yh
+#if !__thumb__
+  RSBS    yh, yh, #0
+  SBCS    xl, yl, xl, LSR r12
+#else
+  LSR     xl, xl, r12
+  RSBS    yh, yh, #0
+  SBCS    xl, yl, xl
+#endif
+  B       fuadd_sub_check
+
+fuadd_sub_negative:
+  // The exponents were equal, and y's mantissa was the larger, so the
+  // difference is exact, and the low word of it is zero. Negate it and flip
+  // the output sign. That leaves Z clear and the top bit of xl clear, ready
+  // for renormalization.
+  RSBS    xl, xl, #0
+  EOR     xh, xh, #0x80000000
+
+fuadd_sub_renorm:
+  // The top bit of the 64-bit difference in xl:yh is clear. If the whole high
+  // word is zero (and so Z is still set from the subtraction), then there was
+  // a lot of cancellation, which is handled separately. Otherwise, shift the
+  // difference left to bring its leading bit to the top, and adjust the
+  // exponent to match. Then round to odd, using whatever is left in the low
+  // word.
+  BEQ     fuadd_sub_bigcancel
+  CLZ     r12, xl
+  LSL     xl, xl, r12
+  RSB     yl, r12, #32
+#if !__thumb__
+  ORR     xl, xl, yh, LSR yl
+#else
+  LSR     yl, yh, yl
+  ORR     xl, xl, yl
+#endif
+  LSLS    yh, yh, r12
+  ORRNE   xl, xl, #1
+  SUB     xh, xh, r12
+
+fuadd_check_underflow:
+  // The exponent was in the window, and has been reduced by less than 64. So
+  // it's still in the window if and only if bit 29 is still set.
+#if !FUADD_FINITE
+  TST     xh, #0x20000000
+  FuaddReturn ne
+  B       fuadd_saturate
+#else
+  FuaddReturn
+#endif
+
+fuadd_sub_bigcancel:
+  // The high word of the difference is zero. This can only happen if the
+  // exponents differed by at most 1, so the low word holds at most one bit of
+  // the smaller input's mantissa, and the result is exact. If that is zero
+  // too, the inputs cancelled exactly, and the output is +0. Otherwise,
+  // normalize the low word.
+  CMP     yh, #0
+  MOVEQ   xh, #0
+  FuaddReturn eq
+  CLZ     r12, yh
+  LSL     xl, yh, r12
+  SUB     xh, xh, r12
+  SUB     xh, xh, #32
+  B       fuadd_check_underflow
+
+#if !FUADD_FINITE
+fuadd_saturate:
+  // The output overflowed or underflowed the window by such a huge amount
+  // that it can only be represented as an infinity or a zero. Keep the sign,
+  // and make an all-ones exponent if the exponent was too large.
+  TST     xh, #0x40000000
+  AND     xh, xh, #0x80000000
+  EORNE   xh, xh, #0x80000000
+  SUBNE   xh, xh, #1
+  MOV     xl, #0
+  FuaddReturn
+
+  // Restore whichever exponent word we overwrote with the result of the window
+  // check, before handing off to FuaddSpecial. r12 still contains the
+  // absolute difference between the exponents.
+fuadd_special_add_xy:
+  SUB     yh, xh, r12
+  FuaddSpecial
+fuadd_special_add_yx:
+  SUB     xh, yh, r12
+  FuaddSpecial
+fuadd_special_sub_xy:
+  SUB     yh, xh, r12
+  EOR     yh, yh, #0x80000000
+  FuaddSpecial
+fuadd_special_sub_yx:
+  SUB     xh, yh, r12
+  EOR     xh, xh, #0x80000000
+  FuaddSpecial
+#endif
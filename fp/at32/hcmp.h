@@ -0,0 +1,21 @@
+// Shared code between most of the half-precision comparison functions.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// This header file is used in exactly the same way as fcmp.h, and provides the
+// same interface: op0, op1, SetReturnRegister and fcmp_NaN.
+//
+// The input half-precision values are in the low 16 bits of op0 and op1, and
+// the upper bits are ignored. Shifting each one left by 16 bits makes it look
+// just like a single-precision value, except that its exponent field is 5 bits
+// wide instead of 8. So the single-precision code in fcmp.h works unchanged,
+// once it's told where the low exponent bit is, and what an infinity looks
+// like.
+
+  LSL     op0, op0, #16
+  LSL     op1, op1, #16
+
+#define FCMP_EXP_LSB_SHIFT 26
+#define FCMP_INF_TOP 0xF8
+#include "fcmp.h"
@@ -0,0 +1,701 @@
+/*
+ * Batched checker for the mantissa division in arm_fp_ddiv and arm_fp_fdiv
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/*
+ * ddiv-diagnostics.c and ddiv-prove.py check one pair of mantissas at a
+ * time, by printing the intermediate values of the calculation from both
+ * the machine code and the Python model, for a human to compare. This
+ * program does the same comparison automatically, over millions of pairs,
+ * so that changes to the reciprocal tables or the Newton-Raphson steps can
+ * be revalidated quickly.
+ *
+ * fp/Dir.mk builds fp/at32/ddiv.S and fp/at32/fdiv.S with -DDIAGNOSTICS,
+ * and with DIAGNOSTICS_PRINTF set so that their debug statements call
+ * div_verify_record() below instead of printf. That records each value in
+ * a per-thread trace. After each division, the trace is compared step by
+ * step with a C port of the model:
+ *
+ *  - for ddiv, the calculations() function in ddiv-prove.py, starting from
+ *    the table entry given by its approx_reciprocal(). The normalized
+ *    quotient must also lie within the error bound proved by Gappa: the
+ *    true quotient is in [nquot, nquot + 64).
+ *
+ *  - for fdiv, the Newton-Raphson step and two long division steps
+ *    described in the comments in fdiv.S, starting from the table entry
+ *    given by the Python code there. The 16-bit reciprocal must
+ *    underestimate the true one by less than 7, and the quotient and
+ *    remainder must be exact.
+ *
+ * The final result of each division is also compared with the toolchain's
+ * own arithmetic. The work is divided between threads as in
+ * fp/test/difftest.c, so a run is reproducible for a given seed and thread
+ * count.
+ */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Failures reported in detail per routine and thread, before only
+ * counting them */
+#define MAXREPORT 10
+
+/* Upper bound on the error of ddiv's normalized quotient, in units of its
+ * last place, from ddiv-prove.py --prove-error=-63.9 */
+#define DDIV_ERRBOUND 64
+
+extern uint64_t arm_fp_ddiv (uint64_t, uint64_t);
+extern uint32_t arm_fp_fdiv (uint32_t, uint32_t);
+
+/* ------------------------------------------------------------------
+ * Traces of intermediate values. */
+
+#define MAXSTEPS 16
+
+struct step
+{
+  char name[16];
+  uint64_t value;
+};
+
+struct trace
+{
+  int n;
+  bool overflow;
+  struct step steps[MAXSTEPS];
+};
+
+static __thread struct trace asm_trace;
+
+static void
+add_step (struct trace *t, const char *name, size_t len, uint64_t value)
+{
+  if (t->n == MAXSTEPS)
+    {
+      t->overflow = true;
+      return;
+    }
+  struct step *s = &t->steps[t->n++];
+  if (len >= sizeof (s->name))
+    len = sizeof (s->name) - 1;
+  memcpy (s->name, name, len);
+  s->name[len] = '\0';
+  s->value = value;
+}
+
+/* Called by the debug32 and debug64 macros in diagnostics.h, in place of
+ * printf. The name of each value is the part of the format string before
+ * " = ". */
+int
+div_verify_record (const char *fmt, ...)
+{
+  va_list ap;
+  uint64_t value;
+
+  va_start (ap, fmt);
+  if (strstr (fmt, "ll"))
+    value = va_arg (ap, unsigned long long);
+  else
+    value = va_arg (ap, unsigned int);
+  va_end (ap);
+
+  const char *eq = strstr (fmt, " =");
+  add_step (&asm_trace, fmt, eq ? (size_t) (eq - fmt) : strlen (fmt), value);
+  return 0;
+}
+
+static void
+model_step (struct trace *t, const char *name, uint64_t value)
+{
+  add_step (t, name, strlen (name), value);
+}
+
+/* ------------------------------------------------------------------
+ * 128-bit arithmetic, for the ddiv model, without relying on a 128-bit
+ * integer type (which 32-bit Arm doesn't have). */
+
+struct u128
+{
+  uint64_t hi, lo;
+};
+
+static struct u128
+mul64 (uint64_t a, uint64_t b)
+{
+  uint64_t al = (uint32_t) a, ah = a >> 32;
+  uint64_t bl = (uint32_t) b, bh = b >> 32;
+  uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+  uint64_t mid = (ll >> 32) + (uint32_t) lh + (uint32_t) hl;
+  struct u128 r;
+  r.lo = (mid << 32) | (uint32_t) ll;
+  r.hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  return r;
+}
+
+static struct u128
+sub128 (struct u128 a, struct u128 b)
+{
+  struct u128 r;
+  r.lo = a.lo - b.lo;
+  r.hi = a.hi - b.hi - (a.lo < b.lo);
+  return r;
+}
+
+static bool
+lt128 (struct u128 a, struct u128 b)
+{
+  return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+/* The top 64 bits of the 96-bit product of a 32-bit and a 64-bit value */
+static uint64_t
+mul32x64_hi (uint32_t a, uint64_t b)
+{
+  uint64_t lo = (uint64_t) a * (uint32_t) b;
+  return (uint64_t) a * (b >> 32) + (lo >> 32);
+}
+
+/* ------------------------------------------------------------------
+ * The ddiv model, ported from calculations() in ddiv-prove.py. */
+
+/* approx_reciprocal() in ddiv-prove.py: the reciprocal of the midpoint of
+ * the mantissas whose top 8 bits are TOPBITS, rounded to 8 bits */
+static uint32_t
+ddiv_approx_reciprocal (uint32_t topbits)
+{
+  return (2 * 0x10000 + (2 * topbits + 1)) / (2 * (2 * topbits + 1));
+}
+
+struct ddiv_result
+{
+  uint64_t nquot;
+  int renorm;
+};
+
+/* Compute the normalized approximate quotient of the mantissas X and Y,
+ * each in [2^63,2^64), recording every intermediate value in T. */
+static struct ddiv_result
+ddiv_model (struct trace *t, uint64_t x, uint64_t y)
+{
+  model_step (t, "x", x);
+  model_step (t, "y", y);
+
+  uint64_t recip08 = ddiv_approx_reciprocal (y >> 56);
+  model_step (t, "recip08", recip08);
+
+  /* First Newton-Raphson iteration, using the top 16 bits of y */
+  uint64_t recip16 = (recip08 * ((1 << 24) - recip08 * (y >> 48))) >> 14;
+  model_step (t, "recip16", recip16);
+
+  /* Second iteration, using the top 31 bits of y. The product of recip16
+   * and (2^48 - recip16 * (y >> 33)) can need 65 bits. */
+  uint64_t e32 = ((uint64_t) 1 << 48) - recip16 * (y >> 33);
+  uint64_t recip32
+      = recip16 * (e32 >> 32) + ((recip16 * (uint32_t) e32) >> 32);
+  model_step (t, "recip32", recip32);
+
+  /* Third iteration, using all of y. 2^64 - ceil((recip32 * y + 1) / 2^32)
+   * is the one's complement of the top 64 bits of recip32 * y. */
+  uint64_t e64 = ~mul32x64_hi (recip32, y);
+  uint64_t recip64 = mul32x64_hi (recip32, e64);
+  model_step (t, "recip64", recip64);
+
+  /* The top 64 bits of x * recip64, omitting the product of the low words
+   * and the low halves of the two middle products. */
+  uint64_t xh = x >> 32, xl = (uint32_t) x;
+  uint64_t rh = recip64 >> 32, rl = (uint32_t) recip64;
+  uint64_t quot = xh * rh + ((xh * rl) >> 32) + ((xl * rh) >> 32);
+  model_step (t, "quot", quot);
+
+  struct ddiv_result r;
+  r.renorm = x > y ? 0 : 1;
+  r.nquot = quot << r.renorm;
+  model_step (t, "nquot", r.nquot);
+  return r;
+}
+
+/* Return true if the true quotient x/y, scaled like NQUOT, lies in
+ * [nquot, nquot + DDIV_ERRBOUND). Store the error in *ERR, as a fraction
+ * of a unit in the last place. */
+static bool
+ddiv_in_bound (uint64_t x, uint64_t y, struct ddiv_result r, double *err)
+{
+  int sh = 62 + r.renorm;
+  struct u128 num = { x >> (64 - sh), x << sh };
+  struct u128 prod = mul64 (r.nquot, y);
+  if (lt128 (num, prod))
+    {
+      *err = -1;
+      return false;
+    }
+  struct u128 diff = sub128 (num, prod);
+  *err = ldexp ((double) diff.hi, 64) + (double) diff.lo;
+  *err /= (double) y;
+  return lt128 (diff, mul64 (DDIV_ERRBOUND, y));
+}
+
+/* ------------------------------------------------------------------
+ * The fdiv model, from the comments in fdiv.S. */
+
+/* The Python code in fdiv.S that generates its table: among the 8-bit
+ * values that could be a reciprocal of a mantissa with the 7-bit prefix
+ * PREFIX, choose the one that minimizes the worst error after the
+ * Newton-Raphson step. */
+static uint32_t
+fdiv_table_entry (uint32_t prefix)
+{
+  int64_t mmin = (int64_t) prefix << 17;
+  int64_t mmax = ((int64_t) (prefix + 1) << 17) - 1;
+  int64_t gmin = ((1LL << 31) + mmin - 1) / mmax;
+  int64_t gmax = (1LL << 31) / mmin;
+  if (gmin < 128)
+    gmin = 128;
+  if (gmax > 255)
+    gmax = 255;
+
+  int64_t best = gmin;
+  double besterr = -INFINITY;
+  for (int64_t g = gmin; g <= gmax; g++)
+    {
+      double err = INFINITY;
+      for (int i = 0; i < 2; i++)
+	{
+	  int64_t d = i ? mmax : mmin;
+	  double e = (double) (g * ((1LL << 32) - d * g)) / (1 << 23)
+		     - ldexp (1, 39) / (double) d;
+	  if (e < err)
+	    err = e;
+	}
+      /* Python's max() keeps the first of equal keys. */
+      if (err > besterr)
+	best = g, besterr = err;
+    }
+  return best;
+}
+
+static uint32_t fdiv_table[64];
+
+/* Model the division of the mantissa N by the mantissa D, both in
+ * [2^23,2^24), recording every intermediate value in T. Return false if an
+ * invariant stated in fdiv.S doesn't hold, and store the error of the 16-bit
+ * reciprocal in *RECIPERR. */
+static bool
+fdiv_model (struct trace *t, uint32_t n, uint32_t d, int64_t *reciperr)
+{
+  bool ok = true;
+
+  model_step (t, "n", n);
+  model_step (t, "d", d);
+  if (n < d)
+    n <<= 1;
+
+  int64_t recip08 = fdiv_table[(d >> 17) - 64];
+  model_step (t, "recip08", recip08);
+
+  /* recip16 = 2^9 x - dx^2 / 2^23, with dx truncated to 24 bits and then
+   * incremented, so that the result is an underestimate. */
+  int64_t dx = (int64_t) d * recip08;
+  int64_t sq = -((dx >> 8) + 1) * recip08;
+  int64_t recip16 = (recip08 << 9) + (sq >> 15);
+  model_step (t, "recip16", recip16);
+
+  /* The true reciprocal, 2^39/d, is in [recip16, recip16 + 7). */
+  int64_t rerr = (1LL << 39) - recip16 * d;
+  *reciperr = rerr;
+  if (rerr < 0 || rerr >= 7 * (int64_t) d || recip16 >= 0x10000)
+    ok = false;
+
+  /* Two steps of long division, producing 12 and then 11 quotient bits. */
+  int64_t q1 = ((int64_t) (n >> 8) * recip16) >> 20;
+  model_step (t, "q1", q1);
+  int64_t n1 = ((int64_t) n << 11) - q1 * d;
+  if (n1 < 0 || n1 >= (1LL << 32))
+    ok = false;
+  int64_t q2 = ((n1 >> 8) * recip16) >> 19;
+  model_step (t, "q2", q2);
+  int64_t n2 = (n1 << 12) - q2 * d;
+  if (n2 < 0 || n2 >= 2 * (int64_t) d)
+    ok = false;
+
+  /* At most one more subtraction of d. */
+  int64_t quot = (q1 << 12) + q2, rem = n2;
+  if (rem >= d)
+    quot++, rem -= d;
+  model_step (t, "quot", quot);
+  model_step (t, "rem", rem);
+
+  /* The quotient and remainder must be exact. */
+  uint64_t num = (uint64_t) n << 23;
+  if ((uint64_t) quot != num / d || (uint64_t) rem != num % d)
+    ok = false;
+  return ok;
+}
+
+/* ------------------------------------------------------------------
+ * Input generation. */
+
+/* A per-thread 64-bit generator (xorshift64*) */
+static uint64_t
+rand64 (uint64_t *state)
+{
+  uint64_t x = *state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *state = x;
+  return x * 0x2545f4914f6cdd1dULL;
+}
+
+static uint32_t
+rand_below (uint64_t *state, uint32_t n)
+{
+  return (uint32_t) (rand64 (state) >> 32) % n;
+}
+
+/* A random mantissa of MBITS bits, without its leading bit, often with a
+ * run of identical bits at the top or bottom, which makes the quotient or
+ * the reciprocal approximations extreme. */
+static uint64_t
+gen_mantissa (uint64_t *rng, int mbits)
+{
+  uint64_t mask = ((uint64_t) 1 << mbits) - 1;
+  uint64_t m = rand64 (rng);
+  uint64_t run = ((uint64_t) 1 << rand_below (rng, mbits + 1)) - 1;
+  switch (rand_below (rng, 4))
+    {
+    case 0:
+      m |= run;
+      break;
+    case 1:
+      m &= ~run;
+      break;
+    case 2:
+      m = (m & run) | (rand_below (rng, 2) ? ~run : 0);
+      break;
+    }
+  return m & mask;
+}
+
+/* ------------------------------------------------------------------
+ * Running the checks. */
+
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+
+struct job
+{
+  bool exhaustive;
+  uint64_t start, count;	/* denominators, or random seed and count */
+  uint64_t failures;
+  double worst;			/* largest error seen in the approximation */
+};
+
+/* Report a failure, with both traces. */
+static void
+report (struct job *job, const char *routine, uint64_t a, uint64_t b,
+	const char *why, const struct trace *model)
+{
+  if (job->failures++ >= MAXREPORT)
+    return;
+  pthread_mutex_lock (&report_lock);
+  printf ("FAIL: %s(%" PRIx64 ", %" PRIx64 "): %s\n", routine, a, b, why);
+  for (int i = 0; i < model->n || i < asm_trace.n; i++)
+    {
+      printf ("  %-8s", i < model->n ? model->steps[i].name : "");
+      if (i < model->n)
+	printf (" model %016" PRIX64, model->steps[i].value);
+      else
+	printf ("%22s", "");
+      if (i < asm_trace.n)
+	printf ("  %s %016" PRIX64, asm_trace.steps[i].name,
+		asm_trace.steps[i].value);
+      printf ("\n");
+    }
+  pthread_mutex_unlock (&report_lock);
+}
+
+/* Compare the recorded trace of the machine code with the model's. */
+static bool
+same_trace (const struct trace *model)
+{
+  if (asm_trace.overflow || asm_trace.n != model->n)
+    return false;
+  for (int i = 0; i < model->n; i++)
+    if (strcmp (asm_trace.steps[i].name, model->steps[i].name)
+	|| asm_trace.steps[i].value != model->steps[i].value)
+      return false;
+  return true;
+}
+
+static double
+mkd (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint64_t
+unmkd (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static float
+mkf (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint32_t
+unmkf (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+/* Divide 1.X by 1.Y, where X and Y are the 52-bit fractions. */
+static void
+check_ddiv (struct job *job, uint64_t x, uint64_t y)
+{
+  uint64_t a = 0x3ff0000000000000 | x, b = 0x3ff0000000000000 | y;
+  uint64_t xm = (1ULL << 63) | (x << 11), ym = (1ULL << 63) | (y << 11);
+  struct trace model = { 0 };
+  struct ddiv_result r = { 0, 0 };
+  double err;
+
+  asm_trace.n = 0;
+  asm_trace.overflow = false;
+  uint64_t got = arm_fp_ddiv (a, b);
+
+  /* Equal mantissas take a shortcut before the debug statements. */
+  if (x != y)
+    r = ddiv_model (&model, xm, ym);
+  if (!same_trace (&model))
+    report (job, "ddiv", a, b, "intermediate values differ", &model);
+  else if (x != y && !ddiv_in_bound (xm, ym, r, &err))
+    report (job, "ddiv", a, b, "quotient outside the error bound", &model);
+  else if (got != unmkd (mkd (a) / mkd (b)))
+    report (job, "ddiv", a, b, "wrong result", &model);
+  else if (x != y && err > job->worst)
+    job->worst = err;
+}
+
+/* Divide 1.X by 1.Y, where X and Y are the 23-bit fractions. */
+static void
+check_fdiv (struct job *job, uint32_t x, uint32_t y)
+{
+  uint32_t a = 0x3f800000 | x, b = 0x3f800000 | y;
+  struct trace model = { 0 };
+  int64_t reciperr;
+
+  asm_trace.n = 0;
+  asm_trace.overflow = false;
+  uint32_t got = arm_fp_fdiv (a, b);
+
+  bool ok = fdiv_model (&model, (1 << 23) | x, (1 << 23) | y, &reciperr);
+  if (!same_trace (&model))
+    report (job, "fdiv", a, b, "intermediate values differ", &model);
+  else if (!ok)
+    report (job, "fdiv", a, b, "model invariant doesn't hold", &model);
+  else if (got != unmkf (mkf (a) / mkf (b)))
+    report (job, "fdiv", a, b, "wrong result", &model);
+  else
+    {
+      double err = (double) reciperr / ((1 << 23) | y);
+      if (err > job->worst)
+	job->worst = err;
+    }
+}
+
+/* Pairs of ddiv mantissas, as in ddiv-diagnostics.c: with and without
+ * renormalization, and with the bottom 32 bits of recip32 * y zero. */
+static const uint64_t ddiv_cases[][2] = {
+  { 0xc34f0d52f2478800, 0xace0971c2073f800 },
+  { 0xace0971c2073f800, 0xc34f0d52f2478800 },
+  { 0x8000000000000000, 0x89abcdef00000000 },
+};
+
+static void *
+run_ddiv (void *arg)
+{
+  struct job *job = arg;
+  uint64_t rng = job->start;
+
+  if (job->start & 2)
+    for (size_t i = 0; i < sizeof ddiv_cases / sizeof *ddiv_cases; i++)
+      check_ddiv (job, (ddiv_cases[i][0] >> 11) & 0xfffffffffffff,
+		  (ddiv_cases[i][1] >> 11) & 0xfffffffffffff);
+  for (uint64_t i = 0; i < job->count; i++)
+    {
+      uint64_t y = gen_mantissa (&rng, 52);
+      uint64_t x = gen_mantissa (&rng, 52);
+      /* Often make the numerator close to the denominator, where the
+       * renormalization decision is made. */
+      if (rand_below (&rng, 4) == 0)
+	x = (y + (rand64 (&rng) >> (12 + rand_below (&rng, 52))) - 1)
+	    & 0xfffffffffffff;
+      check_ddiv (job, x, y);
+    }
+  return NULL;
+}
+
+static void *
+run_fdiv (void *arg)
+{
+  struct job *job = arg;
+  uint64_t rng = (job->start ^ 0x5851f42d4c957f2dULL) | 1;
+
+  if (job->exhaustive)
+    /* Every denominator, with numerators just below and above it. */
+    for (uint64_t i = 0; i < job->count; i++)
+      {
+	uint32_t y = job->start + i;
+	check_fdiv (job, (y - 1 - rand_below (&rng, 256)) & 0x7fffff, y);
+	check_fdiv (job, (y + rand_below (&rng, 256)) & 0x7fffff, y);
+      }
+  else
+    for (uint64_t i = 0; i < job->count; i++)
+      check_fdiv (job, gen_mantissa (&rng, 23), gen_mantissa (&rng, 23));
+  return NULL;
+}
+
+/* Check ROUTINE with NTHREADS threads, and return the number of
+ * failures. */
+static uint64_t
+check_routine (const char *routine, bool exhaustive, uint64_t count,
+	       uint64_t seed, int nthreads)
+{
+  bool is_fdiv = strcmp (routine, "fdiv") == 0;
+  struct job jobs[nthreads];
+  pthread_t threads[nthreads];
+  uint64_t total = exhaustive ? (uint64_t) 1 << 23 : count;
+  uint64_t failures = 0;
+  double worst = 0;
+
+  for (int t = 0; t < nthreads; t++)
+    {
+      uint64_t lo = total * t / nthreads, hi = total * (t + 1) / nthreads;
+      jobs[t].exhaustive = exhaustive;
+      jobs[t].count = hi - lo;
+      jobs[t].failures = 0;
+      jobs[t].worst = 0;
+      /* The generator state must never be zero. Only the first thread
+       * has bit 1 set, and tries the fixed cases. */
+      jobs[t].start = exhaustive ? lo
+				 : ((seed * 0x9e3779b97f4a7c15ULL + t) & ~2ULL)
+				     | (t == 0 ? 3 : 1);
+      void *(*run) (void *) = is_fdiv ? run_fdiv : run_ddiv;
+      if (pthread_create (&threads[t], NULL, run, &jobs[t]) != 0)
+	{
+	  perror ("pthread_create");
+	  exit (EXIT_FAILURE);
+	}
+    }
+  for (int t = 0; t < nthreads; t++)
+    {
+      pthread_join (threads[t], NULL);
+      failures += jobs[t].failures;
+      if (jobs[t].worst > worst)
+	worst = jobs[t].worst;
+    }
+
+  printf ("%-4s %s: ", routine,
+	  exhaustive ? "every denominator" : "random inputs");
+  if (failures)
+    printf ("%" PRIu64 " FAILED\n", failures);
+  else if (is_fdiv)
+    printf ("passed, reciprocal error below %.4f (bound 7)\n", worst);
+  else
+    printf ("passed, quotient error below %.4f (bound %d)\n", worst,
+	    DDIV_ERRBOUND);
+  return failures;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint64_t count = 1000000;
+  uint64_t seed = 1;
+  bool exhaustive = false;
+  long nthreads = sysconf (_SC_NPROCESSORS_ONLN);
+  int c;
+
+  setvbuf (stdout, NULL, _IOLBF, 0);
+  while ((c = getopt (argc, argv, "j:n:s:x")) != -1)
+    switch (c)
+      {
+      case 'j':
+	nthreads = atol (optarg);
+	if (nthreads < 1 || nthreads > 1024)
+	  {
+	    fprintf (stderr, "Invalid number of threads %s\n", optarg);
+	    return EXIT_FAILURE;
+	  }
+	break;
+      case 'n':
+	count = strtoull (optarg, NULL, 0);
+	break;
+      case 's':
+	seed = strtoull (optarg, NULL, 0);
+	break;
+      case 'x':
+	exhaustive = true;
+	break;
+      default:
+	fprintf (stderr,
+		 "Usage: div-verify [options] [ddiv|fdiv...]\n"
+		 "-j <threads>    Number of threads (default: one per CPU)\n"
+		 "-n <count>      Random inputs per routine (default: %" PRIu64
+		 ")\n"
+		 "-s <seed>       Random seed\n"
+		 "-x              Try every fdiv denominator, each with two\n"
+		 "                numerators close to it\n",
+		 count);
+	return EXIT_FAILURE;
+      }
+  if (nthreads < 1)
+    nthreads = 1;
+
+  for (uint32_t prefix = 64; prefix < 128; prefix++)
+    fdiv_table[prefix - 64] = fdiv_table_entry (prefix);
+
+  const char *all[] = { "ddiv", "fdiv" };
+  char **names = argv + optind;
+  int nnames = argc - optind;
+  if (nnames == 0)
+    names = (char **) all, nnames = 2;
+
+  uint64_t failures = 0;
+  for (int i = 0; i < nnames; i++)
+    {
+      if (strcmp (names[i], "ddiv") && strcmp (names[i], "fdiv"))
+	{
+	  fprintf (stderr, "Unknown routine %s\n", names[i]);
+	  return EXIT_FAILURE;
+	}
+      if (exhaustive && strcmp (names[i], "fdiv"))
+	continue;
+      failures += check_routine (names[i], exhaustive, count, seed, nthreads);
+    }
+
+  if (!failures)
+    printf ("all passed\n");
+  return failures != 0;
+}
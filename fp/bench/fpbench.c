@@ -0,0 +1,787 @@
+/*
+ * Benchmark of the IEEE 754 soft-float routines
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Each routine is timed separately over several classes of operand,
+ * because the soft-float routines have a fast path for normal numbers
+ * and slower paths for denormals, zeroes, infinities and NaNs, and for
+ * additions that cancel. A regression in one of the slow paths would
+ * be invisible in a benchmark of random normal operands only.
+ *
+ * Next to every result, the same operations are timed using the
+ * toolchain's built in float arithmetic (in the same way as compiling
+ * the tests with USE_NATIVE_ARITHMETIC). On a soft-float target this
+ * is the compiler's runtime library; on a hard-float target it is the
+ * FPU, which is a useful lower bound.
+ *
+ * The vector routines (fdot and faxpy) are called on the whole pool of
+ * operands at once, and timed per element, so that their results can be
+ * compared with the cost of one multiplication plus one addition.
+ *
+ * Which routines are available depends on FP_SUBDIR, so fp/Dir.mk
+ * defines HAVE_<object> for every object in the library. */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+/* Number of sets of operands per class, cycled through during timing.
+ * Small enough to stay in the L1 cache. */
+#define POOLSIZE 1024
+
+static uint64_t
+clock_get_ns (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
+}
+
+/* CPU cycles of this thread in user space from the perf cycle counter,
+ * where available. */
+static int perf_fd = -1;
+
+static bool
+cycles_open (void)
+{
+#if defined(__linux__)
+  struct perf_event_attr attr;
+  memset (&attr, 0, sizeof attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof attr;
+  attr.config = PERF_COUNT_HW_CPU_CYCLES;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  perf_fd = syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  return perf_fd >= 0;
+}
+
+static uint64_t
+cycles_get (void)
+{
+  uint64_t count = 0;
+  if (perf_fd >= 0 && read (perf_fd, &count, sizeof count) != sizeof count)
+    {
+      perror ("read");
+      exit (EXIT_FAILURE);
+    }
+  return count;
+}
+
+/* Fast 32-bit random number generator, as in string/include/benchlib.h. */
+static uint32_t
+rand32 (void)
+{
+  static uint64_t state = 0xb707be451df0bb19ULL;
+  uint32_t res = state >> 32;
+  state = state * 6364136223846793005ULL + 1;
+  return res;
+}
+
+static uint64_t
+rand64 (void)
+{
+  uint64_t hi = rand32 ();
+  return hi << 32 | rand32 ();
+}
+
+/* ------------------------------------------------------------------
+ * Native versions of each routine, using the toolchain's arithmetic.
+ * They are kept out of line so that they pay the same call overhead
+ * as the routines under test, and are unused if a routine is missing
+ * from this FP_SUBDIR. */
+
+#define NATIVE static __attribute__ ((noinline, unused))
+
+static float
+mkf (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint32_t
+unmkf (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static double
+mkd (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint64_t
+unmkd (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+NATIVE uint32_t
+native_fadd (uint32_t a, uint32_t b)
+{
+  return unmkf (mkf (a) + mkf (b));
+}
+
+NATIVE uint32_t
+native_fsub (uint32_t a, uint32_t b)
+{
+  return unmkf (mkf (a) - mkf (b));
+}
+
+NATIVE uint32_t
+native_fmul (uint32_t a, uint32_t b)
+{
+  return unmkf (mkf (a) * mkf (b));
+}
+
+NATIVE uint32_t
+native_fdiv (uint32_t a, uint32_t b)
+{
+  return unmkf (mkf (a) / mkf (b));
+}
+
+NATIVE uint32_t
+native_fsqrt (uint32_t a)
+{
+  return unmkf (sqrtf (mkf (a)));
+}
+
+NATIVE uint32_t
+native_ffma (uint32_t a, uint32_t b, uint32_t c)
+{
+  return unmkf (fmaf (mkf (a), mkf (b), mkf (c)));
+}
+
+NATIVE uint32_t
+native_fcmp (uint32_t a, uint32_t b)
+{
+  float x = mkf (a), y = mkf (b);
+  return x < y ? -1 : x == y ? 0 : 1;
+}
+
+NATIVE uint64_t
+native_f2d (uint32_t a)
+{
+  return unmkd (mkf (a));
+}
+
+NATIVE uint32_t
+native_f2iz (uint32_t a)
+{
+  return (int32_t) mkf (a);
+}
+
+NATIVE uint32_t
+native_i2f (uint32_t a)
+{
+  return unmkf ((int32_t) a);
+}
+
+NATIVE uint64_t
+native_dadd (uint64_t a, uint64_t b)
+{
+  return unmkd (mkd (a) + mkd (b));
+}
+
+NATIVE uint64_t
+native_dsub (uint64_t a, uint64_t b)
+{
+  return unmkd (mkd (a) - mkd (b));
+}
+
+NATIVE uint64_t
+native_dmul (uint64_t a, uint64_t b)
+{
+  return unmkd (mkd (a) * mkd (b));
+}
+
+NATIVE uint64_t
+native_ddiv (uint64_t a, uint64_t b)
+{
+  return unmkd (mkd (a) / mkd (b));
+}
+
+NATIVE uint64_t
+native_dsqrt (uint64_t a)
+{
+  return unmkd (sqrt (mkd (a)));
+}
+
+NATIVE uint64_t
+native_dfma (uint64_t a, uint64_t b, uint64_t c)
+{
+  return unmkd (fma (mkd (a), mkd (b), mkd (c)));
+}
+
+NATIVE uint32_t
+native_dcmp (uint64_t a, uint64_t b)
+{
+  double x = mkd (a), y = mkd (b);
+  return x < y ? -1 : x == y ? 0 : 1;
+}
+
+NATIVE uint32_t
+native_d2f (uint64_t a)
+{
+  return unmkf (mkd (a));
+}
+
+NATIVE uint32_t
+native_d2iz (uint64_t a)
+{
+  return (int32_t) mkd (a);
+}
+
+NATIVE uint64_t
+native_i2d (uint32_t a)
+{
+  return unmkd ((int32_t) a);
+}
+
+NATIVE uint32_t
+native_fdot (const uint32_t *x, const uint32_t *y, size_t n)
+{
+  float acc = 0;
+  for (size_t i = 0; i < n; i++)
+    acc += mkf (x[i]) * mkf (y[i]);
+  return unmkf (acc);
+}
+
+NATIVE void
+native_faxpy (uint32_t a, const uint32_t *x, uint32_t *y, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    y[i] = unmkf (mkf (a) * mkf (x[i]) + mkf (y[i]));
+}
+
+/* The flush-to-zero variants are compared with the same native
+ * arithmetic, which is only equivalent if the FPU flushes too. */
+#define native_fadd_ftz native_fadd
+#define native_fsub_ftz native_fsub
+#define native_fmul_ftz native_fmul
+#define native_dmul_ftz native_dmul
+
+/* ------------------------------------------------------------------
+ * The routines under test. */
+
+/* Function types, named after the widths of the output and inputs. */
+enum kind
+{
+  K_F_F, K_F_FF, K_F_FFF, K_D_D, K_D_DD, K_D_DDD, K_D_F, K_F_D,
+  K_DOT, K_AXPY,
+};
+
+typedef uint32_t (*f_f) (uint32_t);
+typedef uint32_t (*f_ff) (uint32_t, uint32_t);
+typedef uint32_t (*f_fff) (uint32_t, uint32_t, uint32_t);
+typedef uint64_t (*d_d) (uint64_t);
+typedef uint64_t (*d_dd) (uint64_t, uint64_t);
+typedef uint64_t (*d_ddd) (uint64_t, uint64_t, uint64_t);
+typedef uint64_t (*d_f) (uint32_t);
+typedef uint32_t (*f_d) (uint64_t);
+typedef uint32_t (*f_dot) (const uint32_t *, const uint32_t *, size_t);
+typedef void (*v_axpy) (uint32_t, const uint32_t *, uint32_t *, size_t);
+typedef void (*anyfn) (void);
+
+/* Flags saying how to generate operands for a routine */
+#define OPS_DOUBLE 1	/* input operands are double precision */
+#define OPS_ADD 2	/* an addition: all inputs denormal, and cancellation */
+#define OPS_POS 4	/* only positive inputs are interesting */
+#define OPS_INT 8	/* input is an integer */
+#define OPS_TOINT 16	/* output is an integer: keep inputs in range */
+#define OPS_NARROW 32	/* output is single precision: keep inputs in range */
+#define OPS_SUB 64	/* a subtraction */
+#define OPS_FMA 128	/* a fused multiply-add */
+#define OPS_VEC 256	/* a vector routine, timed per element */
+
+struct routine
+{
+  const char *name;
+  enum kind kind;
+  unsigned ops;
+  anyfn fn, native;
+};
+
+#define ROUTINE(name, fn, kind, ops)                                      \
+  { #name, kind, ops, (anyfn) fn, (anyfn) native_##name },
+
+extern uint32_t arm_fp_fadd (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsub (uint32_t, uint32_t);
+extern uint32_t arm_fp_fmul (uint32_t, uint32_t);
+extern uint32_t arm_fp_fdiv (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsqrt (uint32_t);
+extern uint32_t arm_fp_ffma (uint32_t, uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_gnu_cmp (uint32_t, uint32_t);
+extern uint64_t arm_fp_f2d (uint32_t);
+extern uint32_t arm_fp_f2iz (uint32_t);
+extern uint32_t arm_fp_i2f (uint32_t);
+extern uint64_t arm_fp_dadd (uint64_t, uint64_t);
+extern uint64_t arm_fp_dsub (uint64_t, uint64_t);
+extern uint64_t arm_fp_dmul (uint64_t, uint64_t);
+extern uint64_t arm_fp_ddiv (uint64_t, uint64_t);
+extern uint64_t arm_fp_dsqrt (uint64_t);
+extern uint64_t arm_fp_dfma (uint64_t, uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_gnu_cmp (uint64_t, uint64_t);
+extern uint32_t arm_fp_d2f (uint64_t);
+extern uint32_t arm_fp_d2iz (uint64_t);
+extern uint64_t arm_fp_i2d (uint32_t);
+extern uint32_t arm_fp_fadd_ftz (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsub_ftz (uint32_t, uint32_t);
+extern uint32_t arm_fp_fmul_ftz (uint32_t, uint32_t);
+extern uint32_t arm_fp_fdot (const uint32_t *, const uint32_t *, size_t);
+extern void arm_fp_faxpy (uint32_t, const uint32_t *, uint32_t *, size_t);
+extern uint64_t arm_fp_dmul_ftz (uint64_t, uint64_t);
+
+static const struct routine routines[] = {
+#if HAVE_faddsub
+  ROUTINE (fadd, arm_fp_fadd, K_F_FF, OPS_ADD)
+  ROUTINE (fsub, arm_fp_fsub, K_F_FF, OPS_ADD | OPS_SUB)
+#endif
+#if HAVE_fmul
+  ROUTINE (fmul, arm_fp_fmul, K_F_FF, 0)
+#endif
+#if HAVE_fdiv
+  ROUTINE (fdiv, arm_fp_fdiv, K_F_FF, 0)
+#endif
+#if HAVE_fsqrt
+  ROUTINE (fsqrt, arm_fp_fsqrt, K_F_F, OPS_POS)
+#endif
+#if HAVE_ffma
+  ROUTINE (ffma, arm_fp_ffma, K_F_FFF, OPS_FMA)
+#endif
+#if HAVE_fcmp_gnu_cmp
+  ROUTINE (fcmp, arm_fp_fcmp_gnu_cmp, K_F_FF, 0)
+#endif
+#if HAVE_f2d
+  ROUTINE (f2d, arm_fp_f2d, K_D_F, 0)
+#endif
+#if HAVE_f2iz
+  ROUTINE (f2iz, arm_fp_f2iz, K_F_F, OPS_TOINT)
+#endif
+#if HAVE_i2f
+  ROUTINE (i2f, arm_fp_i2f, K_F_F, OPS_INT)
+#endif
+#if HAVE_daddsub
+  ROUTINE (dadd, arm_fp_dadd, K_D_DD, OPS_DOUBLE | OPS_ADD)
+  ROUTINE (dsub, arm_fp_dsub, K_D_DD, OPS_DOUBLE | OPS_ADD | OPS_SUB)
+#endif
+#if HAVE_dmul
+  ROUTINE (dmul, arm_fp_dmul, K_D_DD, OPS_DOUBLE)
+#endif
+#if HAVE_ddiv
+  ROUTINE (ddiv, arm_fp_ddiv, K_D_DD, OPS_DOUBLE)
+#endif
+#if HAVE_dsqrt
+  ROUTINE (dsqrt, arm_fp_dsqrt, K_D_D, OPS_DOUBLE | OPS_POS)
+#endif
+#if HAVE_dfma
+  ROUTINE (dfma, arm_fp_dfma, K_D_DDD, OPS_DOUBLE | OPS_FMA)
+#endif
+#if HAVE_dcmp_gnu_cmp
+  ROUTINE (dcmp, arm_fp_dcmp_gnu_cmp, K_F_D, OPS_DOUBLE)
+#endif
+#if HAVE_d2f
+  ROUTINE (d2f, arm_fp_d2f, K_F_D, OPS_DOUBLE | OPS_NARROW)
+#endif
+#if HAVE_d2iz
+  ROUTINE (d2iz, arm_fp_d2iz, K_F_D, OPS_DOUBLE | OPS_TOINT)
+#endif
+#if HAVE_i2d
+  ROUTINE (i2d, arm_fp_i2d, K_D_F, OPS_INT)
+#endif
+#if HAVE_faddsub_ftz
+  ROUTINE (fadd_ftz, arm_fp_fadd_ftz, K_F_FF, OPS_ADD)
+  ROUTINE (fsub_ftz, arm_fp_fsub_ftz, K_F_FF, OPS_ADD | OPS_SUB)
+#endif
+#if HAVE_fmul_ftz
+  ROUTINE (fmul_ftz, arm_fp_fmul_ftz, K_F_FF, 0)
+#endif
+#if HAVE_dmul_ftz
+  ROUTINE (dmul_ftz, arm_fp_dmul_ftz, K_D_DD, OPS_DOUBLE)
+#endif
+#if HAVE_fdot
+  ROUTINE (fdot, arm_fp_fdot, K_DOT, OPS_VEC)
+#endif
+#if HAVE_faxpy
+  ROUTINE (faxpy, arm_fp_faxpy, K_AXPY, OPS_VEC)
+#endif
+  { NULL, 0, 0, NULL, NULL }
+};
+
+/* ------------------------------------------------------------------
+ * Operand generation. */
+
+enum class
+{
+  C_NORMAL, C_DENORMAL, C_ZERO, C_INFNAN, C_CANCEL, NCLASSES
+};
+
+static const char *const class_names[NCLASSES] = {
+  "normal", "denormal", "zero", "infnan", "cancel",
+};
+
+/* Whether a class of operands means anything for a routine */
+static bool
+class_applies (const struct routine *r, enum class c)
+{
+  if (r->ops & OPS_INT)
+    return c == C_NORMAL || c == C_ZERO;
+  if (c == C_CANCEL)
+    return (r->ops & (OPS_ADD | OPS_FMA)) != 0;
+  return true;
+}
+
+/* Description of a floating-point format */
+struct format
+{
+  int mbits, ebits, bias;
+};
+
+static const struct format fmt_single = { 23, 8, 127 };
+static const struct format fmt_double = { 52, 11, 1023 };
+
+static uint64_t
+signbit (const struct format *f)
+{
+  return (uint64_t) 1 << (f->mbits + f->ebits);
+}
+
+static uint64_t
+make (const struct format *f, uint64_t sign, int exp, uint64_t mant)
+{
+  uint64_t mmask = ((uint64_t) 1 << f->mbits) - 1;
+  return (sign ? signbit (f) : 0) | (uint64_t) exp << f->mbits
+	 | (mant & mmask);
+}
+
+/* A random normal number with unbiased exponent in [lo,hi] */
+static uint64_t
+gen_normal (const struct format *f, int lo, int hi, bool pos)
+{
+  int exp = f->bias + lo + (int) (rand32 () % (uint32_t) (hi - lo + 1));
+  return make (f, pos ? 0 : rand32 () & 1, exp, rand64 ());
+}
+
+/* A random denormal, with a random number of leading zero bits */
+static uint64_t
+gen_denormal (const struct format *f, bool pos)
+{
+  uint64_t mant = rand64 () & (((uint64_t) 1 << f->mbits) - 1);
+  mant >>= rand32 () % f->mbits;
+  return make (f, pos ? 0 : rand32 () & 1, 0, mant | 1);
+}
+
+static uint64_t
+gen_zero (const struct format *f, bool pos)
+{
+  return make (f, pos ? 0 : rand32 () & 1, 0, 0);
+}
+
+/* An infinity or a quiet NaN, alternately */
+static uint64_t
+gen_infnan (const struct format *f, bool pos)
+{
+  static unsigned n;
+  uint64_t mant = 0;
+  if (n++ & 1)
+    mant = (uint64_t) 1 << (f->mbits - 1) | rand64 ();
+  return make (f, pos ? 0 : rand32 () & 1, (1 << f->ebits) - 1, mant);
+}
+
+/* A random signed integer with a random number of significant bits */
+static uint64_t
+gen_int (void)
+{
+  return (uint32_t) ((int32_t) rand32 () >> (rand32 () % 32));
+}
+
+/* A number close to -x: same or adjacent exponent, and only the low bits
+ * of the mantissa differ, so that x + y loses many leading bits. */
+static uint64_t
+gen_cancel (const struct format *f, uint64_t x)
+{
+  uint64_t y = x ^ signbit (f);
+  y ^= rand64 () & (((uint64_t) 1 << (rand32 () % f->mbits)) - 1);
+  if ((rand32 () & 3) == 0)
+    y += (rand32 () & 1) ? (uint64_t) 1 << f->mbits
+			 : -((uint64_t) 1 << f->mbits);
+  return y;
+}
+
+/* Fill in operand POOL for routine R and class C. The first operand of
+ * each set is the one given the special value; the others are normal.
+ * Additions get special values in all operands, because adding a normal
+ * number to a denormal or a zero mostly exercises the normal path. */
+static void
+generate (const struct routine *r, enum class c, uint64_t pool[][3])
+{
+  const struct format *f = (r->ops & OPS_DOUBLE) ? &fmt_double : &fmt_single;
+  bool pos = (r->ops & OPS_POS) != 0;
+  int range = (r->ops & OPS_NARROW) ? 100 : (r->ops & OPS_TOINT) ? 30 : 60;
+  int lo = (r->ops & OPS_TOINT) ? 0 : -range;
+
+  for (size_t i = 0; i < POOLSIZE; i++)
+    {
+      uint64_t *op = pool[i];
+      for (int j = 0; j < 3; j++)
+	op[j] = gen_normal (f, lo, range, pos);
+
+      if (r->ops & OPS_INT)
+	{
+	  op[0] = c == C_ZERO ? 0 : gen_int ();
+	  continue;
+	}
+
+      switch (c)
+	{
+	case C_NORMAL:
+	  break;
+	case C_DENORMAL:
+	  op[0] = gen_denormal (f, pos);
+	  if (r->ops & OPS_ADD)
+	    op[1] = gen_denormal (f, pos);
+	  break;
+	case C_ZERO:
+	  op[0] = gen_zero (f, pos);
+	  if (r->ops & OPS_ADD)
+	    op[1] = gen_zero (f, pos);
+	  break;
+	case C_INFNAN:
+	  op[0] = gen_infnan (f, pos);
+	  break;
+	case C_CANCEL:
+	  if (r->ops & OPS_FMA)
+	    {
+	      /* Make the addend cancel the rounded product. */
+	      if (r->ops & OPS_DOUBLE)
+		op[2] = gen_cancel (f, unmkd (mkd (op[0]) * mkd (op[1])));
+	      else
+		op[2] = gen_cancel (f, unmkf (mkf (op[0]) * mkf (op[1])));
+	    }
+	  else
+	    op[1] = gen_cancel (f, op[0]);
+	  /* Subtraction cancels when the signs are equal. */
+	  if (r->ops & OPS_SUB)
+	    op[1] ^= signbit (f);
+	  break;
+	default:
+	  break;
+	}
+    }
+}
+
+/* ------------------------------------------------------------------
+ * Timing. */
+
+static volatile uint64_t sink;
+
+#define LOOP(type, call)                                                  \
+  do                                                                      \
+    {                                                                     \
+      type fp = (type) fn;                                                \
+      for (uint32_t i = 0; i < numops; i++)                               \
+	{                                                                 \
+	  const uint64_t *op = pool[i & (POOLSIZE - 1)];                  \
+	  acc += call;                                                    \
+	}                                                                 \
+    }                                                                     \
+  while (0)
+
+/* Call FN (of type KIND) NUMOPS times on operands from POOL, and return
+ * the elapsed time in ns and, in *CYCLES, in cycles. A vector routine is
+ * called on vectors made of the first and second operands of each set,
+ * until it has processed NUMOPS elements. */
+static uint64_t
+measure (enum kind kind, anyfn fn, uint64_t pool[][3], uint32_t numops,
+	 uint64_t cpufreq, uint64_t *cycles)
+{
+  static uint32_t vx[POOLSIZE], vy[POOLSIZE];
+  uint32_t a = pool[0][2];
+  uint64_t acc = 0;
+  for (size_t i = 0; i < POOLSIZE; i++)
+    {
+      vx[i] = pool[i][0];
+      vy[i] = pool[i][1];
+    }
+
+  uint64_t start = clock_get_ns ();
+  uint64_t start_cycles = cycles_get ();
+  switch (kind)
+    {
+    case K_F_F:
+      LOOP (f_f, fp ((uint32_t) op[0]));
+      break;
+    case K_F_FF:
+      LOOP (f_ff, fp ((uint32_t) op[0], (uint32_t) op[1]));
+      break;
+    case K_F_FFF:
+      LOOP (f_fff, fp ((uint32_t) op[0], (uint32_t) op[1], (uint32_t) op[2]));
+      break;
+    case K_D_D:
+      LOOP (d_d, fp (op[0]));
+      break;
+    case K_D_DD:
+      LOOP (d_dd, fp (op[0], op[1]));
+      break;
+    case K_D_DDD:
+      LOOP (d_ddd, fp (op[0], op[1], op[2]));
+      break;
+    case K_D_F:
+      LOOP (d_f, fp ((uint32_t) op[0]));
+      break;
+    case K_F_D:
+      LOOP (f_d, fp (op[0]));
+      break;
+    case K_DOT:
+      for (uint32_t i = 0; i < numops; i += POOLSIZE)
+	{
+	  uint32_t n = numops - i < POOLSIZE ? numops - i : POOLSIZE;
+	  acc += ((f_dot) fn) (vx, vy, n);
+	}
+      break;
+    case K_AXPY:
+      /* Alternate the sign of a, so that y stays about the same size
+       * instead of overflowing after many passes. */
+      for (uint32_t i = 0; i < numops; i += POOLSIZE)
+	{
+	  uint32_t n = numops - i < POOLSIZE ? numops - i : POOLSIZE;
+	  ((v_axpy) fn) (a, vx, vy, n);
+	  a ^= 0x80000000;
+	}
+      acc = vy[0];
+      break;
+    }
+  *cycles = cycles_get () - start_cycles;
+  uint64_t elapsed_ns = clock_get_ns () - start;
+  sink = acc;
+  if (cpufreq != 0)
+    *cycles = (double) elapsed_ns * cpufreq / 1000000000;
+  return elapsed_ns;
+}
+
+static void
+print_result (uint64_t ns, uint64_t cycles, uint32_t numops, bool have_cycles)
+{
+  printf (" %9.2f", (double) ns / numops);
+  if (have_cycles)
+    printf (" %9.1f", (double) cycles / numops);
+  else
+    printf (" %9s", "-");
+}
+
+static bool
+selected (const char *name, char **names, int nnames)
+{
+  if (nnames == 0)
+    return true;
+  for (int i = 0; i < nnames; i++)
+    if (strcmp (name, names[i]) == 0)
+      return true;
+  return false;
+}
+
+int
+main (int argc, char *argv[])
+{
+  static uint64_t pool[POOLSIZE][3];
+  uint32_t numops = 1000000;
+  uint64_t cpufreq = 0;
+  const char *only_class = NULL;
+  int c;
+
+  while ((c = getopt (argc, argv, "c:f:n:")) != -1)
+    switch (c)
+      {
+      case 'c':
+	only_class = optarg;
+	break;
+      case 'f':
+	{
+	  long long freq = atoll (optarg);
+	  if (freq < 1)
+	    {
+	      fprintf (stderr, "Invalid CPU frequency %s\n", optarg);
+	      return EXIT_FAILURE;
+	    }
+	  cpufreq = freq;
+	  break;
+	}
+      case 'n':
+	{
+	  int n = atoi (optarg);
+	  if (n < 1)
+	    {
+	      fprintf (stderr, "Invalid number of operations %s\n", optarg);
+	      return EXIT_FAILURE;
+	    }
+	  numops = n;
+	  break;
+	}
+      default:
+	fprintf (stderr,
+		 "Usage: fpbench [options] [routine...]\n"
+		 "-c <class>      Only operands of this class: normal,\n"
+		 "                denormal, zero, infnan or cancel\n"
+		 "-f <cpufreq>    CPU frequency (Hz), instead of\n"
+		 "                reading the cycle counter\n"
+		 "-n <numops>     Number of operations per measurement\n");
+	printf ("Routines:");
+	for (const struct routine *r = routines; r->name; r++)
+	  printf (" %s", r->name);
+	printf ("\n");
+	return EXIT_FAILURE;
+      }
+
+  bool have_cycles = cpufreq != 0 || cycles_open ();
+
+  printf ("%-8s %-9s %9s %9s %9s %9s\n", "routine", "operands", "ns/op",
+	  "cyc/op", "native", "cyc/op");
+  for (const struct routine *r = routines; r->name; r++)
+    {
+      if (!selected (r->name, argv + optind, argc - optind))
+	continue;
+      for (int cl = 0; cl < NCLASSES; cl++)
+	{
+	  if (!class_applies (r, cl)
+	      || (only_class && strcmp (only_class, class_names[cl]) != 0))
+	    continue;
+	  generate (r, cl, pool);
+
+	  uint64_t cycles, native_cycles;
+	  uint64_t ns = measure (r->kind, r->fn, pool, numops, cpufreq,
+				 &cycles);
+	  uint64_t native_ns = measure (r->kind, r->native, pool, numops,
+					cpufreq, &native_cycles);
+	  printf ("%-8s %-9s", r->name, class_names[cl]);
+	  print_result (ns, cycles, numops, have_cycles);
+	  print_result (native_ns, native_cycles, numops, have_cycles);
+	  printf ("\n");
+	}
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,45 @@
+// Helper function for handling double-precision fused multiply-add NaNs.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// This helper function is available for use by double-precision fused
+// multiply-add implementations, computing a*b+c, to handle propagating NaNs
+// from the input operands to the output, in a way that matches Arm hardware FP.
+//
+// On input, a, b and c are floating-point numbers in IEEE 754 encoding, and at
+// least one of them must be a NaN. The return value is the correct output NaN.
+//
+// The priority order is the same as in __fnan3: a signalling NaN in c, then
+// one in a or b, then a quiet NaN in c (unless a*b is infinity times zero, in
+// which case the output is the default NaN), then a quiet NaN in a or b.
+
+#include <stdint.h>
+
+uint64_t
+__dnan3 (uint64_t a, uint64_t b, uint64_t c)
+{
+  // The same adjustment as in __dnan2: signalling NaNs end up greater than
+  // 0xfff0000000000000, and quiet NaNs less than 0x0010000000000000.
+  uint64_t aadj = (a << 1) + 0x0010000000000000;
+  uint64_t badj = (b << 1) + 0x0010000000000000;
+  uint64_t cadj = (c << 1) + 0x0010000000000000;
+
+  if (cadj > 0xfff0000000000000)
+    return c | 0x0008000000000000;
+  if (aadj > 0xfff0000000000000)
+    return a | 0x0008000000000000;
+  if (badj > 0xfff0000000000000)
+    return b | 0x0008000000000000;
+  if (cadj < 0x0010000000000000)
+    {
+      if (((a << 1) == 0xffe0000000000000 && (b << 1) == 0)
+	  || ((a << 1) == 0 && (b << 1) == 0xffe0000000000000))
+	return 0x7ff8000000000000;
+      return c;
+    }
+  if (aadj < 0x0010000000000000)
+    return a;
+  else /* expect (badj < 0x0010000000000000) */
+    return b;
+}
@@ -0,0 +1,45 @@
+// Helper function for handling single-precision fused multiply-add NaNs.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// This helper function is available for use by single-precision fused
+// multiply-add implementations, computing a*b+c, to handle propagating NaNs
+// from the input operands to the output, in a way that matches Arm hardware FP.
+//
+// On input, a, b and c are floating-point numbers in IEEE 754 encoding, and at
+// least one of them must be a NaN. The return value is the correct output NaN.
+//
+// As in the Arm architecture's FPMulAdd pseudocode, the addend c is checked
+// first: a signalling NaN in c takes priority over one in a or b, and a quiet
+// NaN in c takes priority over quiet NaNs in a or b. The one exception is that
+// if c is a quiet NaN and a*b is infinity times zero, the output is the default
+// NaN, because the multiplication is an invalid operation in its own right.
+
+unsigned
+__fnan3 (unsigned a, unsigned b, unsigned c)
+{
+  // The same adjustment as in __fnan2: signalling NaNs end up greater than
+  // 0xff800000, and quiet NaNs less than 0x00800000.
+  unsigned aadj = (a << 1) + 0x00800000;
+  unsigned badj = (b << 1) + 0x00800000;
+  unsigned cadj = (c << 1) + 0x00800000;
+
+  if (cadj > 0xff800000)
+    return c | 0x00400000;
+  if (aadj > 0xff800000)
+    return a | 0x00400000;
+  if (badj > 0xff800000)
+    return b | 0x00400000;
+  if (cadj < 0x00800000)
+    {
+      if (((a << 1) == 0xff000000 && (b << 1) == 0)
+	  || ((a << 1) == 0 && (b << 1) == 0xff000000))
+	return 0x7fc00000;
+      return c;
+    }
+  if (aadj < 0x00800000)
+    return a;
+  else /* expect (badj < 0x00800000) */
+    return b;
+}
@@ -0,0 +1,114 @@
+// Helper functions for handling special values in the unpacked-operand
+// single-precision API.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// These helper functions are tail-called by the assembly language
+// implementations of arm_fp_fumul, arm_fp_fuadd and arm_fp_fudiv, with their
+// original inputs, if either input is not a finite nonzero number whose
+// exponent lies in the window that the fast paths handle. The return value is
+// the output of the operation.
+//
+// An unpacked value is a 64-bit word whose high half contains the sign in bit
+// 31 and an exponent field X in bits 0-30, and whose low half is a mantissa m.
+// See fp/README.md for the full description. The cases handled here are:
+//
+//  - X = 0x7FFFFFFF and m != 0: a NaN, with m holding the IEEE fraction field
+//    shifted left by 9 bits
+//  - X >= 0x40000000: an infinity (canonically X = 0x7FFFFFFF and m = 0)
+//  - X < 0x20000000: a zero (canonically X = 0 and m = 0)
+//
+// The functions never need to do any arithmetic on finite values: if one
+// input is special, the output is either a special value or the other input.
+
+#include <stdint.h>
+
+unsigned __fnan2 (unsigned a, unsigned b);
+
+#define SIGN 0x8000000000000000ULL
+#define INF 0x7FFFFFFF00000000ULL
+#define DEFAULT_NAN 0x7FFFFFFF80000000ULL
+
+static int
+is_nan (uint64_t x)
+{
+  return (x & ~SIGN) > INF;
+}
+
+static int
+is_inf (uint64_t x)
+{
+  return !is_nan (x) && (x & 0x4000000000000000ULL);
+}
+
+static int
+is_zero (uint64_t x)
+{
+  return (x & 0x6000000000000000ULL) == 0;
+}
+
+// Convert each input to single precision if it's a NaN (and to something
+// which isn't a NaN otherwise), let __fnan2 choose the output NaN, and unpack
+// it again.
+static uint64_t
+nan2 (uint64_t x, uint64_t y)
+{
+  unsigned a = 0, b = 0;
+  if (is_nan (x))
+    a = (x >> 32 & 0x80000000) | 0x7F800000 | (unsigned) x >> 9;
+  if (is_nan (y))
+    b = (y >> 32 & 0x80000000) | 0x7F800000 | (unsigned) y >> 9;
+  unsigned r = __fnan2 (a, b);
+  return ((uint64_t) (r & 0x80000000) << 32) | INF | (r << 9);
+}
+
+uint64_t
+__fumul_special (uint64_t x, uint64_t y)
+{
+  uint64_t sign = (x ^ y) & SIGN;
+
+  if (is_nan (x) || is_nan (y))
+    return nan2 (x, y);
+  if (is_inf (x) || is_inf (y))
+    {
+      if (is_zero (x) || is_zero (y))
+        return DEFAULT_NAN;             // infinity * zero
+      return sign | INF;
+    }
+  return sign;                          // at least one input is zero
+}
+
+uint64_t
+__fuadd_special (uint64_t x, uint64_t y)
+{
+  if (is_nan (x) || is_nan (y))
+    return nan2 (x, y);
+  if (is_inf (x))
+    {
+      if (is_inf (y) && ((x ^ y) & SIGN))
+        return DEFAULT_NAN;             // infinities of opposite sign
+      return (x & SIGN) | INF;
+    }
+  if (is_inf (y))
+    return (y & SIGN) | INF;
+  if (is_zero (x) && is_zero (y))
+    return x & y & SIGN;                // -0 only if both inputs are -0
+  return is_zero (x) ? y : x;
+}
+
+uint64_t
+__fudiv_special (uint64_t x, uint64_t y)
+{
+  uint64_t sign = (x ^ y) & SIGN;
+
+  if (is_nan (x) || is_nan (y))
+    return nan2 (x, y);
+  if (is_inf (x))
+    return is_inf (y) ? DEFAULT_NAN : sign | INF;
+  if (is_inf (y))
+    return sign;                        // finite / infinity
+  if (is_zero (y))
+    return is_zero (x) ? DEFAULT_NAN : sign | INF;
+  return sign;                          // zero / finite
+}
@@ -0,0 +1,28 @@
+// Helper function for handling half-precision input NaNs.
+//
+// Copyright (c) 2026, Arm Limited.
+// SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+// This helper function is available for use by half-precision arithmetic
+// implementations to handle propagating NaNs from the input operands to the
+// output, in a way that matches Arm hardware FP.
+//
+// On input, a and b are half-precision numbers in IEEE 754 encoding, in the
+// low 16 bits of the word, and at least one of them must be a NaN. The upper
+// bits are ignored. The return value is the correct output NaN, with the upper
+// bits clear.
+
+unsigned
+__hnan2 (unsigned a, unsigned b)
+{
+  unsigned aadj = (a << 17) + 0x04000000;
+  unsigned badj = (b << 17) + 0x04000000;
+  if (aadj > 0xfc000000)
+    return (a | 0x0200) & 0xffff;
+  if (badj > 0xfc000000)
+    return (b | 0x0200) & 0xffff;
+  if (aadj < 0x04000000)
+    return a & 0xffff;
+  else /* expect (badj < 0x04000000) */
+    return b & 0xffff;
+}
@@ -1,6 +1,6 @@
 // Diagnostic macros for printing out registers in assembly language functions
 //
-// Copyright (c) 2025, Arm Limited.
+// Copyright (c) 2025-2026, Arm Limited.
 // SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 #ifndef AOR_FP_DIAGNOSTICS_H
@@ -21,12 +21,23 @@
 // efficient stack usage. In particular, debug64 transfers the two input
 // registers into the right places by storing them into temporary stack slots
 // and then reloading, which is slow, but the easiest way to avoid ordering
-// problems if the input registers alias r2 and r3.
+// problems if the input registers alias r2 and r3. They also preserve the
+// flags, so that they can be placed where a condition is still live.
+//
+// The function called can be changed by defining DIAGNOSTICS_PRINTF to the
+// name of another function with the same signature as printf, so that a test
+// program can capture the values instead of printing them. That function may
+// assume that each format string contains a single conversion, which is for a
+// 64-bit integer if it contains "ll".
 
 #include "endian.h" // for register aliases yh and yl
 
 #ifdef DIAGNOSTICS
 
+#ifndef DIAGNOSTICS_PRINTF
+#define DIAGNOSTICS_PRINTF printf
+#endif
+
 #if __thumb__ && __ARM_ARCH_ISA_THUMB == 1
 #error These diagnostic macros do not currently support Thumb-1
 #endif
@@ -39,8 +50,12 @@
   .macro  debug32 text,reg
   push    {r0,r1,r2,r3,r12,lr} // save all the registers we're going to clobber
   mov     r1,\reg              // copy the reg to be printed into r1
+  mrs     r12, APSR            // save the flags, keeping the stack aligned
+  push    {r12,lr}
   adr     r0, 1f               // address of the format string in r0
-  bl      printf               // call out to printf
+  bl      DIAGNOSTICS_PRINTF   // call out to printf
+  pop     {r12,lr}             // restore the flags
+  msr     APSR_nzcvq, r12
   pop     {r0,r1,r2,r3,r12,lr} // and pop all the registers again
   B       0f                   // jump over the format string
 1: .asciz "\text"
@@ -63,8 +78,12 @@
   ldr     yh,[sp,#0]           // reload into yh,yl to pass to printf
   ldr     yl,[sp,#4]
   add     sp,sp,#8             // we've finished with those 2 words of stack
+  mrs     r12, APSR            // save the flags, keeping the stack aligned
+  push    {r12,lr}
   adr     r0, 1f               // address of the format string in r0
-  bl      printf               // call out to printf
+  bl      DIAGNOSTICS_PRINTF   // call out to printf
+  pop     {r12,lr}             // restore the flags
+  msr     APSR_nzcvq, r12
   pop     {r0,r1,r2,r3,r12,lr} // and pop all the registers again
   B       0f                   // jump over the format string
 1: .asciz "\text"
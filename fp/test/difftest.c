@@ -0,0 +1,1315 @@
+/*
+ * Randomized differential tester for the IEEE 754 soft-float routines
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* The test-*.c programs check a few hundred chosen inputs per routine.
+ * This program compares the routines bit for bit against the toolchain's
+ * own float arithmetic over far more inputs: either random operands,
+ * biased towards exponent and rounding boundaries, or (for routines with
+ * one single-precision or 32-bit integer input, or only half-precision
+ * inputs) every possible input.
+ *
+ * The reference results are adjusted to the semantics documented in
+ * fp/README.md wherever IEEE 754 or C leaves them open: NaN propagation,
+ * the default NaN, and out-of-range conversions to integer. So the
+ * reference can be any IEEE 754 implementation that doesn't flush
+ * denormals, whether an FPU or another soft-float library. The
+ * flush-to-zero variants (*_ftz) are checked against the same arithmetic
+ * on flushed inputs, with the output flushed and NaNs replaced after.
+ * The unpacked-operand routines (fu*) are checked one operation at a
+ * time: unpacking the operands, doing the operation and packing the
+ * result must give the same answer as the single-precision operation.
+ *
+ * The work is divided between threads, each with its own random number
+ * generator, so a run is reproducible for a given seed and thread count.
+ *
+ * Which routines are available depends on FP_SUBDIR, so fp/Dir.mk
+ * defines HAVE_<object> for every object in the library. */
+
+#define _GNU_SOURCE
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Failures reported in detail per routine and thread, before only
+ * counting them */
+#define MAXREPORT 10
+
+static float
+mkf (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint32_t
+unmkf (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static double
+mkd (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+static uint64_t
+unmkd (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+/* ------------------------------------------------------------------
+ * Floating-point formats, and the Arm NaN policy. */
+
+struct format
+{
+  int mbits, ebits, bias;
+};
+
+static const struct format fmt_half = { 10, 5, 15 };
+static const struct format fmt_single = { 23, 8, 127 };
+static const struct format fmt_double = { 52, 11, 1023 };
+
+static uint64_t
+signbit (const struct format *f)
+{
+  return (uint64_t) 1 << (f->mbits + f->ebits);
+}
+
+static uint64_t
+expmask (const struct format *f)
+{
+  return (((uint64_t) 1 << f->ebits) - 1) << f->mbits;
+}
+
+static uint64_t
+quietbit (const struct format *f)
+{
+  return (uint64_t) 1 << (f->mbits - 1);
+}
+
+static bool
+is_nan (const struct format *f, uint64_t x)
+{
+  return (x & ~signbit (f)) > expmask (f);
+}
+
+static bool
+is_snan (const struct format *f, uint64_t x)
+{
+  return is_nan (f, x) && !(x & quietbit (f));
+}
+
+static bool
+is_inf (const struct format *f, uint64_t x)
+{
+  return (x & ~signbit (f)) == expmask (f);
+}
+
+static bool
+is_zero (const struct format *f, uint64_t x)
+{
+  return (x & ~signbit (f)) == 0;
+}
+
+static uint64_t
+default_nan (const struct format *f)
+{
+  return expmask (f) | quietbit (f);
+}
+
+/* The output NaN for inputs A and B, at least one of which is a NaN */
+static uint64_t
+nan2 (const struct format *f, uint64_t a, uint64_t b)
+{
+  if (is_snan (f, a))
+    return a | quietbit (f);
+  if (is_snan (f, b))
+    return b | quietbit (f);
+  return is_nan (f, a) ? a : b;
+}
+
+/* Result of an arithmetic operation on A and B whose IEEE 754 result is
+ * R. Adjusts R where either input is a NaN, or the operation is
+ * invalid. */
+static uint64_t
+fix2 (const struct format *f, uint64_t a, uint64_t b, uint64_t r)
+{
+  if (is_nan (f, a) || is_nan (f, b))
+    return nan2 (f, a, b);
+  if (is_nan (f, r))
+    return default_nan (f);
+  return r;
+}
+
+/* The same for fused multiply-add a*b+c, which gives c priority, and
+ * treats inf*0 as invalid even if c is a quiet NaN. */
+static uint64_t
+fix3 (const struct format *f, uint64_t a, uint64_t b, uint64_t c,
+      uint64_t r)
+{
+  if (is_snan (f, c))
+    return c | quietbit (f);
+  if (is_snan (f, a) || is_snan (f, b))
+    return nan2 (f, a, b);
+  if (is_nan (f, c))
+    {
+      if ((is_inf (f, a) && is_zero (f, b))
+	  || (is_zero (f, a) && is_inf (f, b)))
+	return default_nan (f);
+      return c;
+    }
+  if (is_nan (f, a) || is_nan (f, b))
+    return nan2 (f, a, b);
+  if (is_nan (f, r))
+    return default_nan (f);
+  return r;
+}
+
+/* Flush-to-zero semantics, as in Arm hardware with FZ and DN set: a
+ * denormal input counts as a zero of the same sign ... These helpers are
+ * unused if FP_SUBDIR has no flush-to-zero variants. */
+#define FTZ static __attribute__ ((unused))
+
+FTZ uint64_t
+ftz_in (const struct format *f, uint64_t x)
+{
+  return (x & expmask (f)) ? x : x & signbit (f);
+}
+
+/* ... an output which was TINY (below the smallest normalized number)
+ * before rounding becomes a zero of the same sign, and a NaN output is
+ * the default NaN. A denormal or zero R is taken to be tiny anyway. */
+FTZ uint64_t
+ftz_out (const struct format *f, uint64_t r, bool tiny)
+{
+  if (is_nan (f, r))
+    return default_nan (f);
+  if (tiny || !(r & expmask (f)))
+    return r & signbit (f);
+  return r;
+}
+
+/* Whether the exact product of A and B was tiny, where their product
+ * rounded to double precision is R. That's only in doubt if R is the
+ * smallest normalized number: then scale the smaller operand so that the
+ * error term computed by fma is exact, and see which side it's on. */
+FTZ bool
+dmul_tiny (double a, double b, double r)
+{
+  if (fabs (r) != DBL_MIN)
+    return fabs (r) < DBL_MIN;
+  if (fabs (a) < fabs (b))
+    {
+      double t = a;
+      a = b;
+      b = t;
+    }
+  double e = fma (a, b * 0x1p64, -r * 0x1p64);
+  return r > 0 ? e < 0 : e > 0;
+}
+
+/* Half precision has no portable C type, so its references work in
+ * double precision, which represents every half-precision value exactly,
+ * and also every sum, difference or product of two of them. */
+static double
+mkh (uint64_t x)
+{
+  int e = x >> 10 & 0x1f;
+  double m = x & 0x3ff;
+  double r = e == 0x1f ? (m ? NAN : INFINITY)
+	     : e ? ldexp (m + 0x400, e - 25) : ldexp (m, -24);
+  return x & 0x8000 ? -r : r;
+}
+
+/* Round X to half precision. A NaN keeps its sign and the top of its
+ * mantissa, and is made quiet. */
+static uint64_t
+unmkh (double x)
+{
+  uint64_t sign = unmkd (x) >> 63 << 15;
+  double a = fabs (x);
+  int e;
+  if (isnan (x))
+    return sign | 0x7e00 | (unmkd (x) >> 42 & 0x3ff);
+  if (a >= 0x1.ffep15)
+    return sign | 0x7c00;
+  if (a < 0x1p-14)
+    return sign | (uint64_t) rint (a * 0x1p24);
+  /* A carry out of the mantissa when rounding increments the exponent. */
+  frexp (a, &e);
+  return sign
+	 | (((uint64_t) (e + 14) << 10) + (uint64_t) rint (ldexp (a, 11 - e))
+	    - 0x400);
+}
+
+/* ------------------------------------------------------------------
+ * Reference implementations. Each takes the operands in op[] and
+ * returns the expected output. */
+
+typedef uint64_t (*reffn) (const uint64_t *op);
+
+/* Unused if a routine is missing from this FP_SUBDIR */
+#define REF static __attribute__ ((unused)) uint64_t
+
+#define H (&fmt_half)
+#define F (&fmt_single)
+#define D (&fmt_double)
+
+REF
+ref_fadd (const uint64_t *op)
+{
+  return fix2 (F, op[0], op[1], unmkf (mkf (op[0]) + mkf (op[1])));
+}
+
+REF
+ref_fsub (const uint64_t *op)
+{
+  return fix2 (F, op[0], op[1], unmkf (mkf (op[0]) - mkf (op[1])));
+}
+
+REF
+ref_fmul (const uint64_t *op)
+{
+  return fix2 (F, op[0], op[1], unmkf (mkf (op[0]) * mkf (op[1])));
+}
+
+REF
+ref_fdiv (const uint64_t *op)
+{
+  return fix2 (F, op[0], op[1], unmkf (mkf (op[0]) / mkf (op[1])));
+}
+
+REF
+ref_fsqrt (const uint64_t *op)
+{
+  return fix2 (F, op[0], op[0], unmkf (sqrtf (mkf (op[0]))));
+}
+
+REF
+ref_ffma (const uint64_t *op)
+{
+  return fix3 (F, op[0], op[1], op[2],
+	       unmkf (fmaf (mkf (op[0]), mkf (op[1]), mkf (op[2]))));
+}
+
+REF
+ref_fadd_ftz (const uint64_t *op)
+{
+  /* A sum or difference that is tiny is exact, so no rounding to worry
+   * about, and likewise below. */
+  uint64_t a = ftz_in (F, op[0]), b = ftz_in (F, op[1]);
+  return ftz_out (F, unmkf (mkf (a) + mkf (b)), false);
+}
+
+REF
+ref_fsub_ftz (const uint64_t *op)
+{
+  uint64_t a = ftz_in (F, op[0]), b = ftz_in (F, op[1]);
+  return ftz_out (F, unmkf (mkf (a) - mkf (b)), false);
+}
+
+REF
+ref_fmul_ftz (const uint64_t *op)
+{
+  /* The product of two floats is exact in double precision */
+  double p = (double) mkf (ftz_in (F, op[0])) * mkf (ftz_in (F, op[1]));
+  return ftz_out (F, unmkf ((float) p), fabs (p) < FLT_MIN);
+}
+
+REF
+ref_dadd (const uint64_t *op)
+{
+  return fix2 (D, op[0], op[1], unmkd (mkd (op[0]) + mkd (op[1])));
+}
+
+REF
+ref_dsub (const uint64_t *op)
+{
+  return fix2 (D, op[0], op[1], unmkd (mkd (op[0]) - mkd (op[1])));
+}
+
+REF
+ref_dmul (const uint64_t *op)
+{
+  return fix2 (D, op[0], op[1], unmkd (mkd (op[0]) * mkd (op[1])));
+}
+
+REF
+ref_dmul_ftz (const uint64_t *op)
+{
+  double a = mkd (ftz_in (D, op[0])), b = mkd (ftz_in (D, op[1]));
+  double r = a * b;
+  return ftz_out (D, unmkd (r), dmul_tiny (a, b, r));
+}
+
+REF
+ref_ddiv (const uint64_t *op)
+{
+  return fix2 (D, op[0], op[1], unmkd (mkd (op[0]) / mkd (op[1])));
+}
+
+REF
+ref_dsqrt (const uint64_t *op)
+{
+  return fix2 (D, op[0], op[0], unmkd (sqrt (mkd (op[0]))));
+}
+
+REF
+ref_dfma (const uint64_t *op)
+{
+  return fix3 (D, op[0], op[1], op[2],
+	       unmkd (fma (mkd (op[0]), mkd (op[1]), mkd (op[2]))));
+}
+
+REF
+ref_hadd (const uint64_t *op)
+{
+  return fix2 (H, op[0], op[1], unmkh (mkh (op[0]) + mkh (op[1])));
+}
+
+REF
+ref_hsub (const uint64_t *op)
+{
+  return fix2 (H, op[0], op[1], unmkh (mkh (op[0]) - mkh (op[1])));
+}
+
+REF
+ref_hmul (const uint64_t *op)
+{
+  return fix2 (H, op[0], op[1], unmkh (mkh (op[0]) * mkh (op[1])));
+}
+
+REF
+ref_h2f (const uint64_t *op)
+{
+  if (is_nan (H, op[0]))
+    return (op[0] & 0x8000) << 16 | 0x7fc00000 | (op[0] & 0x3ff) << 13;
+  return unmkf (mkh (op[0]));
+}
+
+REF
+ref_f2h (const uint64_t *op)
+{
+  return unmkh (mkf (op[0]));
+}
+
+REF
+ref_h2d (const uint64_t *op)
+{
+  if (is_nan (H, op[0]))
+    return (op[0] & 0x8000) << 48 | 0x7ff8000000000000 | (op[0] & 0x3ff) << 42;
+  return unmkd (mkh (op[0]));
+}
+
+REF
+ref_d2h (const uint64_t *op)
+{
+  return unmkh (mkd (op[0]));
+}
+
+REF
+ref_f2d (const uint64_t *op)
+{
+  if (is_nan (F, op[0]))
+    return (op[0] & 0x80000000) << 32 | 0x7ff8000000000000
+	   | (op[0] & 0x007fffff) << 29;
+  return unmkd (mkf (op[0]));
+}
+
+REF
+ref_d2f (const uint64_t *op)
+{
+  if (is_nan (D, op[0]))
+    return (op[0] >> 32 & 0x80000000) | 0x7fc00000
+	   | (op[0] >> 29 & 0x007fffff);
+  return unmkf (mkd (op[0]));
+}
+
+/* Conversions to integer truncate, saturate out-of-range inputs, and
+ * return 0 for NaN. The limits are powers of two, so the comparisons
+ * against them are exact in either format. */
+#define TOINT(name, ftype, mk, fmt, itype, imin, imax, lo, hi)            \
+  REF ref_##name (const uint64_t *op)                                     \
+  {                                                                       \
+    ftype x = mk (op[0]);                                                 \
+    if (is_nan (fmt, op[0]))                                              \
+      return 0;                                                           \
+    if (x >= (hi))                                                        \
+      return (itype) (imax);                                              \
+    if (x <= (lo))                                                        \
+      return (itype) (imin);                                              \
+    return (itype) x;                                                     \
+  }
+
+TOINT (f2iz, float, mkf, F, uint32_t, INT32_MIN, INT32_MAX, -0x1p31f, 0x1p31f)
+TOINT (f2uiz, float, mkf, F, uint32_t, 0, UINT32_MAX, -1.0f, 0x1p32f)
+TOINT (f2lz, float, mkf, F, uint64_t, INT64_MIN, INT64_MAX, -0x1p63f, 0x1p63f)
+TOINT (f2ulz, float, mkf, F, uint64_t, 0, UINT64_MAX, -1.0f, 0x1p64f)
+TOINT (d2iz, double, mkd, D, uint32_t, INT32_MIN, INT32_MAX, -0x1p31, 0x1p31)
+TOINT (d2uiz, double, mkd, D, uint32_t, 0, UINT32_MAX, -1.0, 0x1p32)
+TOINT (d2lz, double, mkd, D, uint64_t, INT64_MIN, INT64_MAX, -0x1p63, 0x1p63)
+TOINT (d2ulz, double, mkd, D, uint64_t, 0, UINT64_MAX, -1.0, 0x1p64)
+
+/* Conversions from integer are always defined in C. */
+REF
+ref_i2f (const uint64_t *op)
+{
+  return unmkf ((int32_t) op[0]);
+}
+
+REF
+ref_ui2f (const uint64_t *op)
+{
+  return unmkf ((uint32_t) op[0]);
+}
+
+REF
+ref_l2f (const uint64_t *op)
+{
+  return unmkf ((int64_t) op[0]);
+}
+
+REF
+ref_ul2f (const uint64_t *op)
+{
+  return unmkf (op[0]);
+}
+
+REF
+ref_i2d (const uint64_t *op)
+{
+  return unmkd ((int32_t) op[0]);
+}
+
+REF
+ref_ui2d (const uint64_t *op)
+{
+  return unmkd ((uint32_t) op[0]);
+}
+
+REF
+ref_l2d (const uint64_t *op)
+{
+  return unmkd ((int64_t) op[0]);
+}
+
+REF
+ref_ul2d (const uint64_t *op)
+{
+  return unmkd (op[0]);
+}
+
+/* Comparisons: the bool functions return 0 or 1, and the gnu ones have
+ * the semantics of __cmpsf2 and __gesf2, treating unordered as greater
+ * or less respectively. */
+#define CMP(p, mk)                                                        \
+  REF ref_##p##cmp_bool_eq (const uint64_t *op)                           \
+  {                                                                       \
+    return mk (op[0]) == mk (op[1]);                                      \
+  }                                                                       \
+  REF ref_##p##cmp_bool_lt (const uint64_t *op)                           \
+  {                                                                       \
+    return mk (op[0]) < mk (op[1]);                                       \
+  }                                                                       \
+  REF ref_##p##cmp_bool_le (const uint64_t *op)                           \
+  {                                                                       \
+    return mk (op[0]) <= mk (op[1]);                                      \
+  }                                                                       \
+  REF ref_##p##cmp_bool_gt (const uint64_t *op)                           \
+  {                                                                       \
+    return mk (op[0]) > mk (op[1]);                                       \
+  }                                                                       \
+  REF ref_##p##cmp_bool_ge (const uint64_t *op)                           \
+  {                                                                       \
+    return mk (op[0]) >= mk (op[1]);                                      \
+  }                                                                       \
+  REF ref_##p##cmp_bool_un (const uint64_t *op)                           \
+  {                                                                       \
+    return isunordered (mk (op[0]), mk (op[1]));                          \
+  }                                                                       \
+  REF ref_##p##cmp_gnu_cmp (const uint64_t *op)                           \
+  {                                                                       \
+    if (isless (mk (op[0]), mk (op[1])))                                  \
+      return (uint32_t) -1;                                               \
+    return islessequal (mk (op[0]), mk (op[1])) ? 0 : 1;                  \
+  }                                                                       \
+  REF ref_##p##cmp_gnu_rcmp (const uint64_t *op)                          \
+  {                                                                       \
+    if (isgreater (mk (op[0]), mk (op[1])))                               \
+      return 1;                                                           \
+    return isgreaterequal (mk (op[0]), mk (op[1])) ? 0 : (uint32_t) -1;   \
+  }
+
+CMP (h, mkh)
+CMP (f, mkf)
+CMP (d, mkd)
+
+/* ------------------------------------------------------------------
+ * The routines under test. */
+
+/* Function types, named after the widths of the output and inputs. */
+enum kind
+{
+  K_F_F, K_F_FF, K_F_FFF, K_D_D, K_D_DD, K_D_DDD, K_D_F, K_F_D, K_F_DD,
+};
+
+typedef uint32_t (*f_f) (uint32_t);
+typedef uint32_t (*f_ff) (uint32_t, uint32_t);
+typedef uint32_t (*f_fff) (uint32_t, uint32_t, uint32_t);
+typedef uint64_t (*d_d) (uint64_t);
+typedef uint64_t (*d_dd) (uint64_t, uint64_t);
+typedef uint64_t (*d_ddd) (uint64_t, uint64_t, uint64_t);
+typedef uint64_t (*d_f) (uint32_t);
+typedef uint32_t (*f_d) (uint64_t);
+typedef uint32_t (*f_dd) (uint64_t, uint64_t);
+typedef void (*anyfn) (void);
+
+/* How to generate the operands of a routine */
+enum operands
+{
+  O_HALF,	/* half precision */
+  O_FLOAT,	/* single precision */
+  O_DOUBLE,	/* double precision */
+  O_INT32,	/* 32-bit integer */
+  O_INT64,	/* 64-bit integer */
+};
+
+/* How to relate the operands to each other, to bias the result towards
+ * the interesting cases */
+enum relation
+{
+  R_NONE, R_ADD, R_MUL, R_DIV, R_FMA,
+};
+
+struct routine
+{
+  const char *name;
+  enum kind kind;
+  enum operands ops;
+  enum relation rel;
+  anyfn fn;
+  reffn ref;
+};
+
+#define ROUTINE(name, kind, ops, rel)                                     \
+  { #name, kind, ops, rel, (anyfn) arm_fp_##name, ref_##name },
+
+#define CMP_ROUTINES(p, kind, ops)                                        \
+  ROUTINE (p##cmp_bool_eq, kind, ops, R_ADD)                              \
+  ROUTINE (p##cmp_bool_lt, kind, ops, R_ADD)                              \
+  ROUTINE (p##cmp_bool_le, kind, ops, R_ADD)                              \
+  ROUTINE (p##cmp_bool_gt, kind, ops, R_ADD)                              \
+  ROUTINE (p##cmp_bool_ge, kind, ops, R_ADD)                              \
+  ROUTINE (p##cmp_bool_un, kind, ops, R_ADD)
+
+extern uint32_t arm_fp_fadd (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsub (uint32_t, uint32_t);
+extern uint32_t arm_fp_fmul (uint32_t, uint32_t);
+extern uint32_t arm_fp_fdiv (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsqrt (uint32_t);
+extern uint32_t arm_fp_ffma (uint32_t, uint32_t, uint32_t);
+extern uint64_t arm_fp_dadd (uint64_t, uint64_t);
+extern uint64_t arm_fp_dsub (uint64_t, uint64_t);
+extern uint64_t arm_fp_dmul (uint64_t, uint64_t);
+extern uint64_t arm_fp_ddiv (uint64_t, uint64_t);
+extern uint64_t arm_fp_dsqrt (uint64_t);
+extern uint64_t arm_fp_dfma (uint64_t, uint64_t, uint64_t);
+extern uint64_t arm_fp_f2d (uint32_t);
+extern uint32_t arm_fp_d2f (uint64_t);
+extern uint32_t arm_fp_f2iz (uint32_t);
+extern uint32_t arm_fp_f2uiz (uint32_t);
+extern uint64_t arm_fp_f2lz (uint32_t);
+extern uint64_t arm_fp_f2ulz (uint32_t);
+extern uint32_t arm_fp_d2iz (uint64_t);
+extern uint32_t arm_fp_d2uiz (uint64_t);
+extern uint64_t arm_fp_d2lz (uint64_t);
+extern uint64_t arm_fp_d2ulz (uint64_t);
+extern uint32_t arm_fp_i2f (uint32_t);
+extern uint32_t arm_fp_ui2f (uint32_t);
+extern uint32_t arm_fp_l2f (uint64_t);
+extern uint32_t arm_fp_ul2f (uint64_t);
+extern uint64_t arm_fp_i2d (uint32_t);
+extern uint64_t arm_fp_ui2d (uint32_t);
+extern uint64_t arm_fp_l2d (uint64_t);
+extern uint64_t arm_fp_ul2d (uint64_t);
+extern uint32_t arm_fp_fcmp_bool_eq (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_bool_lt (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_bool_le (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_bool_gt (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_bool_ge (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_bool_un (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_gnu_cmp (uint32_t, uint32_t);
+extern uint32_t arm_fp_fcmp_gnu_rcmp (uint32_t, uint32_t);
+extern uint32_t arm_fp_dcmp_bool_eq (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_bool_lt (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_bool_le (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_bool_gt (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_bool_ge (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_bool_un (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_gnu_cmp (uint64_t, uint64_t);
+extern uint32_t arm_fp_dcmp_gnu_rcmp (uint64_t, uint64_t);
+extern uint32_t arm_fp_hadd (uint32_t, uint32_t);
+extern uint32_t arm_fp_hsub (uint32_t, uint32_t);
+extern uint32_t arm_fp_hmul (uint32_t, uint32_t);
+extern uint32_t arm_fp_h2f (uint32_t);
+extern uint32_t arm_fp_f2h (uint32_t);
+extern uint64_t arm_fp_h2d (uint32_t);
+extern uint32_t arm_fp_d2h (uint64_t);
+extern uint32_t arm_fp_hcmp_bool_eq (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_bool_lt (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_bool_le (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_bool_gt (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_bool_ge (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_bool_un (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_gnu_cmp (uint32_t, uint32_t);
+extern uint32_t arm_fp_hcmp_gnu_rcmp (uint32_t, uint32_t);
+extern uint64_t arm_fp_funpack (uint32_t);
+extern uint32_t arm_fp_fpack (uint64_t);
+extern uint64_t arm_fp_fumul (uint64_t, uint64_t);
+extern uint64_t arm_fp_fuadd (uint64_t, uint64_t);
+extern uint64_t arm_fp_fusub (uint64_t, uint64_t);
+extern uint64_t arm_fp_fudiv (uint64_t, uint64_t);
+
+#define PACKED(op)                                                        \
+  static uint32_t                                                         \
+  op##_packed (uint32_t a, uint32_t b)                                    \
+  {                                                                       \
+    return arm_fp_fpack (arm_fp_##op (arm_fp_funpack (a),                 \
+				      arm_fp_funpack (b)));               \
+  }
+
+#if HAVE_funpack && HAVE_fpack
+#if HAVE_fumul
+PACKED (fumul)
+#endif
+#if HAVE_fuaddsub
+PACKED (fuadd)
+PACKED (fusub)
+#endif
+#if HAVE_fudiv
+PACKED (fudiv)
+#endif
+#endif
+
+/* An unpacked-operand routine, checked against the reference for the
+ * single-precision operation REF */
+#define PACKED_ROUTINE(name, ref, rel)                                    \
+  { #name, K_F_FF, O_FLOAT, rel, (anyfn) name##_packed, ref_##ref },
+extern uint32_t arm_fp_fadd_ftz (uint32_t, uint32_t);
+extern uint32_t arm_fp_fsub_ftz (uint32_t, uint32_t);
+extern uint32_t arm_fp_fmul_ftz (uint32_t, uint32_t);
+extern uint64_t arm_fp_dmul_ftz (uint64_t, uint64_t);
+
+static const struct routine routines[] = {
+#if HAVE_faddsub
+  ROUTINE (fadd, K_F_FF, O_FLOAT, R_ADD)
+  ROUTINE (fsub, K_F_FF, O_FLOAT, R_ADD)
+#endif
+#if HAVE_fmul
+  ROUTINE (fmul, K_F_FF, O_FLOAT, R_MUL)
+#endif
+#if HAVE_fdiv
+  ROUTINE (fdiv, K_F_FF, O_FLOAT, R_DIV)
+#endif
+#if HAVE_fsqrt
+  ROUTINE (fsqrt, K_F_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_ffma
+  ROUTINE (ffma, K_F_FFF, O_FLOAT, R_FMA)
+#endif
+#if HAVE_daddsub
+  ROUTINE (dadd, K_D_DD, O_DOUBLE, R_ADD)
+  ROUTINE (dsub, K_D_DD, O_DOUBLE, R_ADD)
+#endif
+#if HAVE_dmul
+  ROUTINE (dmul, K_D_DD, O_DOUBLE, R_MUL)
+#endif
+#if HAVE_ddiv
+  ROUTINE (ddiv, K_D_DD, O_DOUBLE, R_DIV)
+#endif
+#if HAVE_dsqrt
+  ROUTINE (dsqrt, K_D_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_dfma
+  ROUTINE (dfma, K_D_DDD, O_DOUBLE, R_FMA)
+#endif
+#if HAVE_f2d
+  ROUTINE (f2d, K_D_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_d2f
+  ROUTINE (d2f, K_F_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_f2iz
+  ROUTINE (f2iz, K_F_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_f2uiz
+  ROUTINE (f2uiz, K_F_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_f2lz
+  ROUTINE (f2lz, K_D_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_f2ulz
+  ROUTINE (f2ulz, K_D_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_d2iz
+  ROUTINE (d2iz, K_F_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_d2uiz
+  ROUTINE (d2uiz, K_F_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_d2lz
+  ROUTINE (d2lz, K_D_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_d2ulz
+  ROUTINE (d2ulz, K_D_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_i2f
+  ROUTINE (i2f, K_F_F, O_INT32, R_NONE)
+#endif
+#if HAVE_ui2f
+  ROUTINE (ui2f, K_F_F, O_INT32, R_NONE)
+#endif
+#if HAVE_l2f
+  ROUTINE (l2f, K_F_D, O_INT64, R_NONE)
+  ROUTINE (ul2f, K_F_D, O_INT64, R_NONE)
+#endif
+#if HAVE_i2d
+  ROUTINE (i2d, K_D_F, O_INT32, R_NONE)
+#endif
+#if HAVE_ui2d
+  ROUTINE (ui2d, K_D_F, O_INT32, R_NONE)
+#endif
+#if HAVE_l2d
+  ROUTINE (l2d, K_D_D, O_INT64, R_NONE)
+#endif
+#if HAVE_ul2d
+  ROUTINE (ul2d, K_D_D, O_INT64, R_NONE)
+#endif
+#if HAVE_fcmp_bool_eq
+  CMP_ROUTINES (f, K_F_FF, O_FLOAT)
+#endif
+#if HAVE_fcmp_gnu_cmp
+  ROUTINE (fcmp_gnu_cmp, K_F_FF, O_FLOAT, R_ADD)
+  ROUTINE (fcmp_gnu_rcmp, K_F_FF, O_FLOAT, R_ADD)
+#endif
+#if HAVE_dcmp_bool_eq
+  CMP_ROUTINES (d, K_F_DD, O_DOUBLE)
+#endif
+#if HAVE_dcmp_gnu_cmp
+  ROUTINE (dcmp_gnu_cmp, K_F_DD, O_DOUBLE, R_ADD)
+  ROUTINE (dcmp_gnu_rcmp, K_F_DD, O_DOUBLE, R_ADD)
+#endif
+#if HAVE_faddsub_ftz
+  ROUTINE (fadd_ftz, K_F_FF, O_FLOAT, R_ADD)
+  ROUTINE (fsub_ftz, K_F_FF, O_FLOAT, R_ADD)
+#endif
+#if HAVE_fmul_ftz
+  ROUTINE (fmul_ftz, K_F_FF, O_FLOAT, R_MUL)
+#endif
+#if HAVE_dmul_ftz
+  ROUTINE (dmul_ftz, K_D_DD, O_DOUBLE, R_MUL)
+#endif
+#if HAVE_haddsub
+  ROUTINE (hadd, K_F_FF, O_HALF, R_ADD)
+  ROUTINE (hsub, K_F_FF, O_HALF, R_ADD)
+#endif
+#if HAVE_hmul
+  ROUTINE (hmul, K_F_FF, O_HALF, R_MUL)
+#endif
+#if HAVE_h2f
+  ROUTINE (h2f, K_F_F, O_HALF, R_NONE)
+#endif
+#if HAVE_f2h
+  ROUTINE (f2h, K_F_F, O_FLOAT, R_NONE)
+#endif
+#if HAVE_h2d
+  ROUTINE (h2d, K_D_F, O_HALF, R_NONE)
+#endif
+#if HAVE_d2h
+  ROUTINE (d2h, K_F_D, O_DOUBLE, R_NONE)
+#endif
+#if HAVE_hcmp_bool_eq
+  CMP_ROUTINES (h, K_F_FF, O_HALF)
+#endif
+#if HAVE_hcmp_gnu_cmp
+  ROUTINE (hcmp_gnu_cmp, K_F_FF, O_HALF, R_ADD)
+  ROUTINE (hcmp_gnu_rcmp, K_F_FF, O_HALF, R_ADD)
+#endif
+#if HAVE_funpack && HAVE_fpack
+#if HAVE_fumul
+  PACKED_ROUTINE (fumul, fmul, R_MUL)
+#endif
+#if HAVE_fuaddsub
+  PACKED_ROUTINE (fuadd, fadd, R_ADD)
+  PACKED_ROUTINE (fusub, fsub, R_ADD)
+#endif
+#if HAVE_fudiv
+  PACKED_ROUTINE (fudiv, fdiv, R_DIV)
+#endif
+#endif
+  { NULL, 0, 0, 0, NULL, NULL }
+};
+
+static uint64_t
+call (const struct routine *r, const uint64_t *op)
+{
+  switch (r->kind)
+    {
+    case K_F_F:
+      return ((f_f) r->fn) (op[0]);
+    case K_F_FF:
+      return ((f_ff) r->fn) (op[0], op[1]);
+    case K_F_FFF:
+      return ((f_fff) r->fn) (op[0], op[1], op[2]);
+    case K_D_D:
+      return ((d_d) r->fn) (op[0]);
+    case K_D_DD:
+      return ((d_dd) r->fn) (op[0], op[1]);
+    case K_D_DDD:
+      return ((d_ddd) r->fn) (op[0], op[1], op[2]);
+    case K_D_F:
+      return ((d_f) r->fn) (op[0]);
+    case K_F_D:
+      return ((f_d) r->fn) (op[0]);
+    case K_F_DD:
+      return ((f_dd) r->fn) (op[0], op[1]);
+    }
+  return 0;
+}
+
+static int
+num_inputs (const struct routine *r)
+{
+  switch (r->kind)
+    {
+    case K_F_FF:
+    case K_D_DD:
+    case K_F_DD:
+      return 2;
+    case K_F_FFF:
+    case K_D_DDD:
+      return 3;
+    default:
+      return 1;
+    }
+}
+
+/* Whether every input of R can be tried, i.e. it has one 32-bit input,
+ * or up to two half-precision inputs */
+static bool
+exhaustible (const struct routine *r)
+{
+  if (r->ops == O_HALF)
+    return true;
+  return num_inputs (r) == 1 && (r->ops == O_FLOAT || r->ops == O_INT32);
+}
+
+/* The number of inputs of an exhaustible routine. Input number I
+ * consists of consecutive 16-bit fields of I for half precision. */
+static uint64_t
+all_inputs (const struct routine *r)
+{
+  if (r->ops == O_HALF)
+    return (uint64_t) 1 << 16 * num_inputs (r);
+  return (uint64_t) 1 << 32;
+}
+
+/* ------------------------------------------------------------------
+ * Operand generation. */
+
+/* A per-thread 64-bit generator (xorshift64*) */
+static uint64_t
+rand64 (uint64_t *state)
+{
+  uint64_t x = *state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *state = x;
+  return x * 0x2545f4914f6cdd1dULL;
+}
+
+static uint32_t
+rand_below (uint64_t *state, uint32_t n)
+{
+  return (uint32_t) (rand64 (state) >> 32) % n;
+}
+
+/* A random mantissa of MBITS bits, often with runs of identical bits at
+ * the bottom or top, so that results land near rounding boundaries. */
+static uint64_t
+gen_mantissa (uint64_t *rng, int mbits)
+{
+  uint64_t mask = ((uint64_t) 1 << mbits) - 1;
+  uint64_t m = rand64 (rng);
+  uint64_t run = ((uint64_t) 1 << rand_below (rng, mbits + 1)) - 1;
+  switch (rand_below (rng, 6))
+    {
+    case 0:
+      m &= ~run;
+      break;
+    case 1:
+      m |= run;
+      break;
+    case 2:
+      m = run ^ mask;
+      break;
+    case 3:
+      m = (uint64_t) 1 << rand_below (rng, mbits);
+      break;
+    default:
+      break;
+    }
+  return m & mask;
+}
+
+/* A random biased exponent, often at or near one of the extremes, or
+ * near where conversions to integer saturate */
+static int
+gen_exponent (uint64_t *rng, const struct format *f)
+{
+  static const int near_bias[] = { -2, -1, 0, 1, 2, 23, 24, 31, 32, 52, 53,
+				   63, 64 };
+  int emax = (1 << f->ebits) - 1;
+  switch (rand_below (rng, 4))
+    {
+    case 0:
+      {
+	int e = rand_below (rng, 4);
+	return rand_below (rng, 2) ? e : emax - e;
+      }
+    case 1:
+      {
+	int e = f->bias
+		+ near_bias[rand_below (rng, sizeof near_bias / sizeof *near_bias)];
+	return e < emax ? e : emax;
+      }
+    default:
+      return rand_below (rng, emax + 1);
+    }
+}
+
+static uint64_t
+make (const struct format *f, uint64_t sign, int exp, uint64_t mant)
+{
+  return (sign ? signbit (f) : 0) | (uint64_t) exp << f->mbits
+	 | (mant & (((uint64_t) 1 << f->mbits) - 1));
+}
+
+/* A random floating-point operand */
+static uint64_t
+gen_float (uint64_t *rng, const struct format *f)
+{
+  uint64_t sign = rand_below (rng, 2);
+  if (rand_below (rng, 8) == 0)
+    return rand64 (rng) & (signbit (f) * 2 - 1);
+  return make (f, sign, gen_exponent (rng, f), gen_mantissa (rng, f->mbits));
+}
+
+/* An operand with exponent E relative to the bias, clamped to the
+ * representable range */
+static uint64_t
+gen_float_exp (uint64_t *rng, const struct format *f, int e)
+{
+  int emax = (1 << f->ebits) - 1;
+  e += f->bias;
+  if (e < 0)
+    e = 0;
+  if (e > emax)
+    e = emax;
+  return make (f, rand_below (rng, 2), e, gen_mantissa (rng, f->mbits));
+}
+
+static int
+unbiased (const struct format *f, uint64_t x)
+{
+  return (int) ((x & expmask (f)) >> f->mbits) - f->bias;
+}
+
+/* A result exponent for a multiplication or division: near underflow,
+ * overflow, or 0. */
+static int
+gen_target (uint64_t *rng, const struct format *f)
+{
+  int delta = (int) rand_below (rng, 2 * f->mbits + 5) - f->mbits - 2;
+  switch (rand_below (rng, 3))
+    {
+    case 0:
+      return 1 - f->bias + delta;
+    case 1:
+      return f->bias + delta;
+    default:
+      return delta;
+    }
+}
+
+/* An exponent difference for operands of an addition: small, or about
+ * the width of the mantissa, where sticky bits matter. */
+static int
+gen_shift (uint64_t *rng, const struct format *f)
+{
+  int d = rand_below (rng, 2) ? (int) rand_below (rng, 4)
+			      : f->mbits - 2 + (int) rand_below (rng, 6);
+  return rand_below (rng, 2) ? d : -d;
+}
+
+/* A random integer with a random number of significant bits, often
+ * with runs of identical bits where conversions round. */
+static uint64_t
+gen_int (uint64_t *rng, int bits)
+{
+  int width = 1 + rand_below (rng, bits);
+  uint64_t x = gen_mantissa (rng, width);
+  x |= (uint64_t) 1 << (width - 1);
+  if (rand_below (rng, 2))
+    x = -x;
+  if (bits == 32)
+    x = (uint32_t) x;
+  return x;
+}
+
+static void
+generate (uint64_t *rng, const struct routine *r, uint64_t *op)
+{
+  if (r->ops == O_INT32 || r->ops == O_INT64)
+    {
+      op[0] = gen_int (rng, r->ops == O_INT32 ? 32 : 64);
+      return;
+    }
+
+  const struct format *f = r->ops == O_DOUBLE ? &fmt_double
+			   : r->ops == O_HALF ? &fmt_half : &fmt_single;
+  for (int i = 0; i < 3; i++)
+    op[i] = gen_float (rng, f);
+
+  /* Half of the time, use the operands as they are. */
+  if (rand_below (rng, 2) == 0)
+    return;
+
+  switch (r->rel)
+    {
+    case R_NONE:
+      break;
+    case R_ADD:
+      op[1] = gen_float_exp (rng, f, unbiased (f, op[0]) + gen_shift (rng, f));
+      break;
+    case R_MUL:
+      op[1] = gen_float_exp (rng, f, gen_target (rng, f) - unbiased (f, op[0]));
+      break;
+    case R_DIV:
+      op[1] = gen_float_exp (rng, f, unbiased (f, op[0]) - gen_target (rng, f));
+      break;
+    case R_FMA:
+      {
+	int p = gen_target (rng, f);
+	op[1] = gen_float_exp (rng, f, p - unbiased (f, op[0]));
+	p = unbiased (f, op[0]) + unbiased (f, op[1]);
+	op[2] = gen_float_exp (rng, f, p + gen_shift (rng, f));
+	break;
+      }
+    }
+}
+
+/* ------------------------------------------------------------------
+ * Running the tests. */
+
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+
+struct job
+{
+  const struct routine *r;
+  bool exhaustive;
+  uint64_t start, count;	/* operands, or random seed and count */
+  uint64_t failures;
+};
+
+static bool
+check (struct job *job, const uint64_t *op)
+{
+  const struct routine *r = job->r;
+  uint64_t got = call (r, op);
+  uint64_t expected = r->ref (op);
+  if (r->kind == K_F_F || r->kind == K_F_FF || r->kind == K_F_FFF
+      || r->kind == K_F_D || r->kind == K_F_DD)
+    got = (uint32_t) got, expected = (uint32_t) expected;
+  if (got == expected)
+    return true;
+
+  if (job->failures++ < MAXREPORT)
+    {
+      pthread_mutex_lock (&report_lock);
+      printf ("FAIL: %s(", r->name);
+      for (int i = 0; i < num_inputs (r); i++)
+	printf (i ? ", %" PRIx64 : "%" PRIx64, op[i]);
+      printf (") -> %" PRIx64 ", expected %" PRIx64 "\n", got, expected);
+      pthread_mutex_unlock (&report_lock);
+    }
+  return false;
+}
+
+static void *
+run_job (void *arg)
+{
+  struct job *job = arg;
+  uint64_t op[3] = { 0, 0, 0 };
+
+  if (job->exhaustive)
+    for (uint64_t i = 0; i < job->count; i++)
+      {
+	op[0] = job->start + i;
+	if (job->r->ops == O_HALF)
+	  {
+	    op[1] = op[0] >> 16;
+	    op[0] &= 0xffff;
+	  }
+	check (job, op);
+      }
+  else
+    {
+      uint64_t rng = job->start;
+      for (uint64_t i = 0; i < job->count; i++)
+	{
+	  generate (&rng, job->r, op);
+	  check (job, op);
+	}
+    }
+  return NULL;
+}
+
+/* Test routine R with NTHREADS threads, and return the number of
+ * failures. */
+static uint64_t
+test_routine (const struct routine *r, bool exhaustive, uint64_t count,
+	      uint64_t seed, int nthreads)
+{
+  struct job jobs[nthreads];
+  pthread_t threads[nthreads];
+  uint64_t total = exhaustive ? all_inputs (r) : count;
+  uint64_t failures = 0;
+
+  for (int t = 0; t < nthreads; t++)
+    {
+      uint64_t lo = total * t / nthreads, hi = total * (t + 1) / nthreads;
+      jobs[t].r = r;
+      jobs[t].exhaustive = exhaustive;
+      jobs[t].count = hi - lo;
+      jobs[t].failures = 0;
+      /* The generator state must never be zero. */
+      jobs[t].start = exhaustive ? lo
+				 : (seed * 0x9e3779b97f4a7c15ULL + t) | 1;
+      if (pthread_create (&threads[t], NULL, run_job, &jobs[t]) != 0)
+	{
+	  perror ("pthread_create");
+	  exit (EXIT_FAILURE);
+	}
+    }
+  for (int t = 0; t < nthreads; t++)
+    {
+      pthread_join (threads[t], NULL);
+      failures += jobs[t].failures;
+    }
+
+  printf ("%-16s %s %" PRIu64 " inputs: ", r->name,
+	  exhaustive ? "all" : "random", total);
+  if (failures)
+    printf ("%" PRIu64 " FAILED\n", failures);
+  else
+    printf ("passed\n");
+  return failures;
+}
+
+static bool
+selected (const char *name, char **names, int nnames)
+{
+  if (nnames == 0)
+    return true;
+  for (int i = 0; i < nnames; i++)
+    if (strcmp (name, names[i]) == 0)
+      return true;
+  return false;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint64_t count = 1000000;
+  uint64_t seed = 1;
+  bool exhaustive = false;
+  long nthreads = sysconf (_SC_NPROCESSORS_ONLN);
+  int c;
+
+  setvbuf (stdout, NULL, _IOLBF, 0);
+  while ((c = getopt (argc, argv, "j:n:s:x")) != -1)
+    switch (c)
+      {
+      case 'j':
+	nthreads = atol (optarg);
+	if (nthreads < 1 || nthreads > 1024)
+	  {
+	    fprintf (stderr, "Invalid number of threads %s\n", optarg);
+	    return EXIT_FAILURE;
+	  }
+	break;
+      case 'n':
+	count = strtoull (optarg, NULL, 0);
+	break;
+      case 's':
+	seed = strtoull (optarg, NULL, 0);
+	break;
+      case 'x':
+	exhaustive = true;
+	break;
+      default:
+	fprintf (stderr,
+		 "Usage: difftest [options] [routine...]\n"
+		 "-j <threads>    Number of threads (default: one per CPU)\n"
+		 "-n <count>      Random inputs per routine (default: %" PRIu64
+		 ")\n"
+		 "-s <seed>       Random seed\n"
+		 "-x              Try every input, for the routines that\n"
+		 "                take one 32-bit input or only half-\n"
+		 "                precision inputs\n",
+		 count);
+	printf ("Routines:");
+	for (const struct routine *r = routines; r->name; r++)
+	  printf (" %s", r->name);
+	printf ("\n");
+	return EXIT_FAILURE;
+      }
+  if (nthreads < 1)
+    nthreads = 1;
+
+  uint64_t failures = 0;
+  for (const struct routine *r = routines; r->name; r++)
+    {
+      if (!selected (r->name, argv + optind, argc - optind))
+	continue;
+      if (exhaustive && !exhaustible (r))
+	continue;
+      failures += test_routine (r, exhaustive, count, seed, nthreads);
+    }
+
+  if (!failures)
+    printf ("all passed\n");
+  return failures != 0;
+}
@@ -0,0 +1,306 @@
+/*
+ * Tests of IEEE 754 double-precision to half-precision conversion
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint64_t in;
+  uint32_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000000000000000, 0x0000 },
+  { 0x0000000000000001, 0x0000 },
+  { 0x3d70000000000000, 0x0000 },
+  { 0x3e5fffffffffffff, 0x0000 },
+  { 0x3e60000000000000, 0x0000 },
+  { 0x3e60000000000001, 0x0001 },
+  { 0x3e68000000000000, 0x0001 },
+  { 0x3e68000000000001, 0x0001 },
+  { 0x3e696616b9ea62f6, 0x0001 },
+  { 0x3e70000000000000, 0x0001 },
+  { 0x3e70000000000001, 0x0001 },
+  { 0x3e78000000000000, 0x0002 },
+  { 0x3e78000000000001, 0x0002 },
+  { 0x3e7b14d4463a3b4b, 0x0002 },
+  { 0x3e80000000000000, 0x0002 },
+  { 0x3e80000000000001, 0x0002 },
+  { 0x3e88000000000000, 0x0003 },
+  { 0x3e88000000000001, 0x0003 },
+  { 0x3e8af87b4f822c19, 0x0003 },
+  { 0x3e90000000000000, 0x0004 },
+  { 0x3e90000000000001, 0x0004 },
+  { 0x3e9770330fc7a8eb, 0x0006 },
+  { 0x3e98000000000000, 0x0006 },
+  { 0x3e98000000000001, 0x0006 },
+  { 0x3ea0000000000000, 0x0008 },
+  { 0x3ea0000000000001, 0x0008 },
+  { 0x3ea5af4a4061490d, 0x000b },
+  { 0x3ea8000000000000, 0x000c },
+  { 0x3ea8000000000001, 0x000c },
+  { 0x3eb0000000000000, 0x0010 },
+  { 0x3eb0000000000001, 0x0010 },
+  { 0x3eb75236cd6fb4d1, 0x0017 },
+  { 0x3eb8000000000000, 0x0018 },
+  { 0x3eb8000000000001, 0x0018 },
+  { 0x3ec0000000000000, 0x0020 },
+  { 0x3ec0000000000001, 0x0020 },
+  { 0x3ec8000000000000, 0x0030 },
+  { 0x3ec8000000000001, 0x0030 },
+  { 0x3ecdcabf0cdaade2, 0x003c },
+  { 0x3ed0000000000000, 0x0040 },
+  { 0x3ed0000000000001, 0x0040 },
+  { 0x3ed8000000000000, 0x0060 },
+  { 0x3ed8000000000001, 0x0060 },
+  { 0x3eda810b066eec5b, 0x006a },
+  { 0x3ee0000000000000, 0x0080 },
+  { 0x3ee0000000000001, 0x0080 },
+  { 0x3ee105c5e69e6319, 0x0088 },
+  { 0x3ee8000000000000, 0x00c0 },
+  { 0x3ee8000000000001, 0x00c0 },
+  { 0x3ef0000000000000, 0x0100 },
+  { 0x3ef0000000000001, 0x0100 },
+  { 0x3ef8000000000000, 0x0180 },
+  { 0x3ef8000000000001, 0x0180 },
+  { 0x3eff8c7939e09b81, 0x01f9 },
+  { 0x3f00000000000000, 0x0200 },
+  { 0x3f00000000000001, 0x0200 },
+  { 0x3f08000000000000, 0x0300 },
+  { 0x3f08000000000001, 0x0300 },
+  { 0x3f0fdcff2225d8b1, 0x03fc },
+  { 0x3f0ffe0000000000, 0x0400 },
+  { 0x3f0fffffffffffff, 0x0400 },
+  { 0x3f10000000000000, 0x0400 },
+  { 0x3f1001ffffffffff, 0x0400 },
+  { 0x3f10020000000000, 0x0400 },
+  { 0x3f10020000000001, 0x0401 },
+  { 0x3f10040000000000, 0x0401 },
+  { 0x3f10060000000000, 0x0402 },
+  { 0x3f1074fa511efa8a, 0x041d },
+  { 0x3f1ffe0000000000, 0x0800 },
+  { 0x3f1fffffffffffff, 0x0800 },
+  { 0x3fe0000000000000, 0x3800 },
+  { 0x3fe001ffffffffff, 0x3800 },
+  { 0x3fe0020000000000, 0x3800 },
+  { 0x3fe0020000000001, 0x3801 },
+  { 0x3fe0040000000000, 0x3801 },
+  { 0x3fe0060000000000, 0x3802 },
+  { 0x3fe3a926f69ada1c, 0x38ea },
+  { 0x3feffe0000000000, 0x3c00 },
+  { 0x3fefffffffffffff, 0x3c00 },
+  { 0x3ff0000000000000, 0x3c00 },
+  { 0x3ff001ffffffffff, 0x3c00 },
+  { 0x3ff0020000000000, 0x3c00 },
+  { 0x3ff0020000000001, 0x3c01 },
+  { 0x3ff0040000000000, 0x3c01 },
+  { 0x3ff0060000000000, 0x3c02 },
+  { 0x3ff1ad65d19bb33a, 0x3c6b },
+  { 0x3ffffe0000000000, 0x4000 },
+  { 0x3fffffffffffffff, 0x4000 },
+  { 0x4000000000000000, 0x4000 },
+  { 0x400001ffffffffff, 0x4000 },
+  { 0x4000020000000000, 0x4000 },
+  { 0x4000020000000001, 0x4001 },
+  { 0x4000040000000000, 0x4001 },
+  { 0x4000060000000000, 0x4002 },
+  { 0x4005e3ec8bed3b60, 0x4179 },
+  { 0x400ffe0000000000, 0x4400 },
+  { 0x400fffffffffffff, 0x4400 },
+  { 0x40e0000000000000, 0x7800 },
+  { 0x40e001ffffffffff, 0x7800 },
+  { 0x40e0020000000000, 0x7800 },
+  { 0x40e0020000000001, 0x7801 },
+  { 0x40e0040000000000, 0x7801 },
+  { 0x40e0060000000000, 0x7802 },
+  { 0x40ee8c6e072c6eba, 0x7ba3 },
+  { 0x40effc0000000000, 0x7bff },
+  { 0x40effdffffffffff, 0x7bff },
+  { 0x40effe0000000000, 0x7c00 },
+  { 0x40efffffffffffff, 0x7c00 },
+  { 0x40f0000000000000, 0x7c00 },
+  { 0x7fefffffffffffff, 0x7c00 },
+  { 0x7ff0000000000000, 0x7c00 },
+  { 0x8000000000000000, 0x8000 },
+  { 0x8000000000000001, 0x8000 },
+  { 0xbd70000000000000, 0x8000 },
+  { 0xbe5fffffffffffff, 0x8000 },
+  { 0xbe60000000000000, 0x8000 },
+  { 0xbe60000000000001, 0x8001 },
+  { 0xbe68000000000000, 0x8001 },
+  { 0xbe68000000000001, 0x8001 },
+  { 0xbe6a7f292bb68aca, 0x8001 },
+  { 0xbe70000000000000, 0x8001 },
+  { 0xbe70000000000001, 0x8001 },
+  { 0xbe78000000000000, 0x8002 },
+  { 0xbe78000000000001, 0x8002 },
+  { 0xbe7dd981b6adb7a3, 0x8002 },
+  { 0xbe80000000000000, 0x8002 },
+  { 0xbe80000000000001, 0x8002 },
+  { 0xbe820817ee8f4c29, 0x8002 },
+  { 0xbe88000000000000, 0x8003 },
+  { 0xbe88000000000001, 0x8003 },
+  { 0xbe90000000000000, 0x8004 },
+  { 0xbe90000000000001, 0x8004 },
+  { 0xbe98000000000000, 0x8006 },
+  { 0xbe98000000000001, 0x8006 },
+  { 0xbe98e700b37e28e5, 0x8006 },
+  { 0xbea0000000000000, 0x8008 },
+  { 0xbea0000000000001, 0x8008 },
+  { 0xbea8000000000000, 0x800c },
+  { 0xbea8000000000001, 0x800c },
+  { 0xbeab260736ffbe73, 0x800e },
+  { 0xbeb0000000000000, 0x8010 },
+  { 0xbeb0000000000001, 0x8010 },
+  { 0xbeb8000000000000, 0x8018 },
+  { 0xbeb8000000000001, 0x8018 },
+  { 0xbeb892c686e4db2a, 0x8019 },
+  { 0xbec0000000000000, 0x8020 },
+  { 0xbec0000000000001, 0x8020 },
+  { 0xbec7f13d3ae73d0f, 0x8030 },
+  { 0xbec8000000000000, 0x8030 },
+  { 0xbec8000000000001, 0x8030 },
+  { 0xbed0000000000000, 0x8040 },
+  { 0xbed0000000000001, 0x8040 },
+  { 0xbed8000000000000, 0x8060 },
+  { 0xbed8000000000001, 0x8060 },
+  { 0xbeded76ef047a818, 0x807b },
+  { 0xbee0000000000000, 0x8080 },
+  { 0xbee0000000000001, 0x8080 },
+  { 0xbee4663d4f83754e, 0x80a3 },
+  { 0xbee8000000000000, 0x80c0 },
+  { 0xbee8000000000001, 0x80c0 },
+  { 0xbef0000000000000, 0x8100 },
+  { 0xbef0000000000001, 0x8100 },
+  { 0xbef291ee09950279, 0x8129 },
+  { 0xbef8000000000000, 0x8180 },
+  { 0xbef8000000000001, 0x8180 },
+  { 0xbf00000000000000, 0x8200 },
+  { 0xbf00000000000001, 0x8200 },
+  { 0xbf03e0181af97f51, 0x827c },
+  { 0xbf08000000000000, 0x8300 },
+  { 0xbf08000000000001, 0x8300 },
+  { 0xbf0ffe0000000000, 0x8400 },
+  { 0xbf0fffffffffffff, 0x8400 },
+  { 0xbf10000000000000, 0x8400 },
+  { 0xbf1001ffffffffff, 0x8400 },
+  { 0xbf10020000000000, 0x8400 },
+  { 0xbf10020000000001, 0x8401 },
+  { 0xbf10040000000000, 0x8401 },
+  { 0xbf10060000000000, 0x8402 },
+  { 0xbf1f2ae96259dba4, 0x87cb },
+  { 0xbf1ffe0000000000, 0x8800 },
+  { 0xbf1fffffffffffff, 0x8800 },
+  { 0xbfe0000000000000, 0xb800 },
+  { 0xbfe001ffffffffff, 0xb800 },
+  { 0xbfe0020000000000, 0xb800 },
+  { 0xbfe0020000000001, 0xb801 },
+  { 0xbfe0040000000000, 0xb801 },
+  { 0xbfe0060000000000, 0xb802 },
+  { 0xbfefc29ea32df656, 0xbbf1 },
+  { 0xbfeffe0000000000, 0xbc00 },
+  { 0xbfefffffffffffff, 0xbc00 },
+  { 0xbff0000000000000, 0xbc00 },
+  { 0xbff001ffffffffff, 0xbc00 },
+  { 0xbff0020000000000, 0xbc00 },
+  { 0xbff0020000000001, 0xbc01 },
+  { 0xbff0040000000000, 0xbc01 },
+  { 0xbff0060000000000, 0xbc02 },
+  { 0xbff9e717d1883cff, 0xbe7a },
+  { 0xbffffe0000000000, 0xc000 },
+  { 0xbfffffffffffffff, 0xc000 },
+  { 0xc000000000000000, 0xc000 },
+  { 0xc00001ffffffffff, 0xc000 },
+  { 0xc000020000000000, 0xc000 },
+  { 0xc000020000000001, 0xc001 },
+  { 0xc000040000000000, 0xc001 },
+  { 0xc000060000000000, 0xc002 },
+  { 0xc00cc1daaf82f2c8, 0xc330 },
+  { 0xc00ffe0000000000, 0xc400 },
+  { 0xc00fffffffffffff, 0xc400 },
+  { 0xc0e0000000000000, 0xf800 },
+  { 0xc0e001ffffffffff, 0xf800 },
+  { 0xc0e0020000000000, 0xf800 },
+  { 0xc0e0020000000001, 0xf801 },
+  { 0xc0e0040000000000, 0xf801 },
+  { 0xc0e0060000000000, 0xf802 },
+  { 0xc0ef12b8bc4518e6, 0xfbc5 },
+  { 0xc0effc0000000000, 0xfbff },
+  { 0xc0effdffffffffff, 0xfbff },
+  { 0xc0effe0000000000, 0xfc00 },
+  { 0xc0efffffffffffff, 0xfc00 },
+  { 0xc0f0000000000000, 0xfc00 },
+  { 0xffefffffffffffff, 0xfc00 },
+  { 0xfff0000000000000, 0xfc00 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7ff0000000000001, 0x7e00 },
+  { 0x7ff4000000001234, 0x7f00 },
+  { 0x7ff8000000000000, 0x7e00 },
+  { 0x7ffaa80000000005, 0x7eaa },
+  { 0x7fffffffffffffff, 0x7fff },
+  { 0xfff0000000000001, 0xfe00 },
+  { 0xfff4000000001234, 0xff00 },
+  { 0xfff8000000000000, 0xfe00 },
+  { 0xfffaa80000000005, 0xfeaa },
+  { 0xffffffffffffffff, 0xffff },
+};
+
+double
+make_double (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_half (_Float16 x)
+{
+  uint16_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_d2h. */
+      _Float16 out = (_Float16)make_double(t->in);
+      uint32_t outbits = unmake_half(out);
+#else
+      extern uint32_t arm_fp_d2h(uint64_t);
+      uint32_t outbits = arm_fp_d2h(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: d2h(%016" PRIx64 ") -> %04" PRIx32
+		  ", expected %04" PRIx32 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -1,7 +1,7 @@
 /*
  * Tests of IEEE 754 double-precision division
  *
- * Copyright (c) 1999-2025, Arm Limited.
+ * Copyright (c) 1999-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -239,6 +239,8 @@ static const struct test tests[] = {
   { 0x8000000000000003, 0x7ff0000000000000, 0x8000000000000000 },
   { 0x8000000000000004, 0x8000000000000000, 0x7ff0000000000000 },
   { 0x8000000000000004, 0xfff0000000000000, 0x0000000000000000 },
+  { 0x80021fffffffffff, 0x3fe7fe5c493fffff, 0x8002d586e567a588 },
+  { 0x8009802afebbc00e, 0xbffffffffffffff0, 0x0004c0157f5de009 },
   { 0x800ffffffffffff8, 0x3feffffffffffffe, 0x800ffffffffffff9 },
   { 0x800fffffffffffff, 0x0000000000000000, 0xfff0000000000000 },
   { 0x800fffffffffffff, 0x7ff0000000000000, 0x8000000000000000 },
@@ -255,6 +257,7 @@ static const struct test tests[] = {
   { 0x8020000000000000, 0x7ff0000000000000, 0x8000000000000000 },
   { 0x8020000000000001, 0x0010000000000001, 0xc000000000000000 },
   { 0x8020000000000005, 0x0010000000000005, 0xc000000000000000 },
+  { 0x81049b38dfcaa11c, 0xc17fffffff800000, 0x00000526ce380743 },
   { 0xbff0000000000000, 0x3ff0000000000000, 0xbff0000000000000 },
   { 0xbff0000000000000, 0xbff0000000000000, 0x3ff0000000000000 },
   { 0xc000000000000000, 0x0000000000000000, 0xfff0000000000000 },
@@ -0,0 +1,484 @@
+/*
+ * Tests of IEEE 754 double-precision fused multiply-add
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint64_t in1, in2, in3, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0x3ff0000000000000,
+    0x4000000000000000 },
+  { 0x4000000000000000, 0x4008000000000000, 0x3ff0000000000000,
+    0x401c000000000000 },
+  { 0x4008000000000000, 0x4008000000000000, 0xc020000000000000,
+    0x3ff0000000000000 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0xbff0000000000000,
+    0x0000000000000000 },
+  { 0xbff0000000000000, 0x3ff0000000000000, 0x3ff0000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000000, 0x3ff0000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x3ff0000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000000, 0x3ff0000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0x3ff0000000000000, 0x0000000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000000, 0xbff0000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x3ff0000000000000, 0x8000000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000000, 0xbff0000000000000, 0x8000000000000000,
+    0x8000000000000000 },
+  { 0x3ff0000000000000, 0x8000000000000000, 0x8000000000000000,
+    0x8000000000000000 },
+  { 0x8000000000000000, 0x3ff0000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0xbff0000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x8000000000000000, 0x3ff0000000000000, 0x8000000000000000,
+    0x8000000000000000 },
+  { 0xbff0000000000000, 0x0000000000000000, 0x8000000000000000,
+    0x8000000000000000 },
+  { 0x8000000000000000, 0xbff0000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0xbff0000000000000, 0x8000000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x8000000000000000, 0xbff0000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0xbff0000000000000, 0x8000000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000000, 0x0000000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0x8000000000000000, 0x0000000000000000, 0x8000000000000000,
+    0x8000000000000000 },
+  { 0x0000000000000000, 0x7fefffffffffffff, 0x4008000000000000,
+    0x4008000000000000 },
+  { 0x8000000000000000, 0x0000000000000001, 0xbff0000000000005,
+    0xbff0000000000005 },
+  { 0x4008000000000000, 0x4000000000000000, 0x0000000000000000,
+    0x4018000000000000 },
+  { 0x4008000000000000, 0x4000000000000000, 0x8000000000000000,
+    0x4018000000000000 },
+  { 0xc030000000000007, 0x0000000000000001, 0x8000000000000000,
+    0x8000000000000010 },
+  { 0x7ff0000000000000, 0x4000000000000000, 0x3ff0000000000000,
+    0x7ff0000000000000 },
+  { 0xfff0000000000000, 0x4000000000000000, 0x3ff0000000000000,
+    0xfff0000000000000 },
+  { 0x7ff0000000000000, 0xbff0000000000000, 0x7fefffffffffffff,
+    0xfff0000000000000 },
+  { 0x4000000000000000, 0x7ff0000000000000, 0x7ff0000000000000,
+    0x7ff0000000000000 },
+  { 0x7ff0000000000000, 0x7ff0000000000000, 0x7ff0000000000000,
+    0x7ff0000000000000 },
+  { 0x3ff0000000000000, 0x4000000000000000, 0x7ff0000000000000,
+    0x7ff0000000000000 },
+  { 0x3ff0000000000000, 0x4000000000000000, 0xfff0000000000000,
+    0xfff0000000000000 },
+  { 0x0000000000000000, 0x4000000000000000, 0xfff0000000000000,
+    0xfff0000000000000 },
+  { 0x7fefffffffffffff, 0x7fefffffffffffff, 0xfff0000000000000,
+    0xfff0000000000000 },
+  { 0x0000000000000001, 0x0000000000000001, 0x7ff0000000000000,
+    0x7ff0000000000000 },
+  { 0x3ff0000000000001, 0x3ff0000000000001, 0xbff0000000000002,
+    0x3970000000000000 },
+  { 0x3ff0000000000001, 0xbff0000000000001, 0x3ff0000000000002,
+    0xb970000000000000 },
+  { 0x3fffffffffffffff, 0x3fffffffffffffff, 0xc00ffffffffffffe,
+    0x3970000000000000 },
+  { 0x413d9c28a9741a02, 0x3eb0000000003039, 0xbff0000000000000,
+    0x3feb385152e8e680 },
+  { 0xbead14d4430c32b6, 0x4169312058b39663, 0x4026e4eb1ed8f23f,
+    0xbcc75a2a316080c4 },
+  { 0xbec665ed06c80221, 0xbdefea2e8b1c5e3b, 0xbcc656a787b6ab18,
+    0x39736914277c9b9b },
+  { 0x3ded875f5b54b44f, 0x40cb009688e68137, 0xbec8eac35df27dbe,
+    0xbb62529f75eee80e },
+  { 0xbf4edd7dd2b6ac75, 0x40ac50c2ec0d44aa, 0x400b4fb3d567b930,
+    0xbcb7dc73110e99b2 },
+  { 0xbde6453c5b4fe5bc, 0xbd810703599615ea, 0xbb77b353151a2f7e,
+    0xb81a99d00bde58a0 },
+  { 0xc175e9fb9f4bdbd7, 0x402b3ddacc72d755, 0x41b2a7c82c14206b,
+    0xbe5dacc3a71f1ec6 },
+  { 0xbe8cf094e864d77f, 0x41032e1ec8217869, 0x3fa1588e16937274,
+    0x3c61dae035208a74 },
+  { 0x3fc7de7ceef9cbe2, 0x3ff9c97ea0095a8d, 0xbfd33c1d8edb9012,
+    0xbc726f764796810c },
+  { 0x413a649a13e77732, 0x40f8e36d7c63537e, 0xc2448707812f604e,
+    0x3ed17b4c9f9f8270 },
+  { 0x3e8abbddb8ebc5ea, 0xbe72f608634fa0c1, 0x3d0fae6fe4e2bc39,
+    0x39bb015152af152c },
+  { 0xbfa2cb0e4693dfdc, 0x3f07586b88d83cc0, 0x3ebb6bbfa2a42d0b,
+    0xbb6fdfcab1feea00 },
+  { 0x3e853cae51253d6b, 0x4084b6085eaf82a4, 0xbf1b7d77404e322a,
+    0xbbcef189a99ea2e8 },
+  { 0x3fa3c1a4270ad171, 0x3fe9bdd4c0bb1fb8, 0x3e9a6f4a91097a56,
+    0x3f9fc91103126d91 },
+  { 0xbfc147518f7d6157, 0xbf721249d49b41d3, 0xbf0272ce042f0079,
+    0x3f425cced7e84bdd },
+  { 0x3fc8821d0b8c6996, 0xc019bb2c3642fd40, 0xbfcfea650d70eb13,
+    0xbff7b24d88e61b9f },
+  { 0x3f7143ac0cbd9a74, 0xc028579cd550cc53, 0xbf6be9d9466e029a,
+    0xbfac02a8d9021c46 },
+  { 0x3f86b3d898062973, 0xbf7a2ddac93920d1, 0x3f10ec7e48af4b9d,
+    0xbeda629d3613a819 },
+  { 0x40005dc0acb1be94, 0xc02ee7298dbf0c82, 0xbfc4e83272948bd2,
+    0xc03fc60db7ab0d0d },
+  { 0x3fbbeac0d2ee2feb, 0xc047e711fd59531b, 0x3e857b6afc95f5ba,
+    0xc014da50de8c8657 },
+  { 0x3ffa1af77ee75d32, 0xc02a45edb5d034e2, 0xc0035398ad6f023d,
+    0xc037d9683e7ee515 },
+  { 0x403023903e1d939b, 0xbfb65fb13eb4af7a, 0x3f925d6c7af810a3,
+    0xbff647f69499597e },
+  { 0x405992329c1ae5c5, 0x404bc81468784415, 0xbed4406f0f01f8b7,
+    0x40b6333cbe9038ef },
+  { 0x400be84eaf0669ea, 0xc0648b8110d9dfd0, 0xbfbefd8faaa5b136,
+    0xc081ebd2bed8f6ab },
+  { 0xbfbb13e8d2b94c5c, 0xbfeec9f68547f9d4, 0x3e844e987d0b7dea,
+    0x3fba0d9277a1de4f },
+  { 0x40672d85b76899ac, 0x3fee38164dc6fcfe, 0x3ee1987d7c41de8a,
+    0x4065e34d3f2d1d5e },
+  { 0xbff228276687d828, 0xbf7964da1c67f1b3, 0xbf37a8b36155484c,
+    0x3f7b56a4d3b4ccf5 },
+  { 0xbfa73ff22c9388c2, 0x3f9df4c121b7c1e1, 0x3f54f36a31808f40,
+    0xbf0a0ba5f4a3590f },
+  { 0x401957df504bb908, 0xc04c4f9a16821586, 0x3f890011be54dc79,
+    0xc0766bbc5e232229 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0x3ca0000000000000,
+    0x3ff0000000000000 },
+  { 0x3ff0000000000001, 0x3ff0000000000000, 0x3ca0000000000000,
+    0x3ff0000000000002 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0xbc90000000000000,
+    0x3ff0000000000000 },
+  { 0x3ff0000000000001, 0x3ff0000000000000, 0xbc90000000000000,
+    0x3ff0000000000001 },
+  { 0x3ff0000000000001, 0x3ca0000000000000, 0x3ff0000000000000,
+    0x3ff0000000000001 },
+  { 0x3ca0000000000001, 0x3ff0000000000000, 0x3ff0000000000000,
+    0x3ff0000000000001 },
+  { 0xbca0000000000001, 0x3ff0000000000000, 0x3ff0000000000000,
+    0x3fefffffffffffff },
+  { 0x3ca0000000000001, 0xbff0000000000000, 0x3ff0000000000001,
+    0x3ff0000000000000 },
+  { 0x0000000000000001, 0x0000000000000001, 0x3ff0000000000000,
+    0x3ff0000000000000 },
+  { 0x0000000000000001, 0x8000000000000001, 0x3ff0000000000000,
+    0x3ff0000000000000 },
+  { 0x0000000000000001, 0x8000000000000001, 0x0010000000000000,
+    0x0010000000000000 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0x0000000000000001,
+    0x3ff0000000000000 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0x8000000000000001,
+    0x3ff0000000000000 },
+  { 0x7fefffffffffffff, 0x3ff0000000000000, 0x8010000000000003,
+    0x7fefffffffffffff },
+  { 0x43b0000000000000, 0x43b0000000000000, 0xbc30000000000000,
+    0x4770000000000000 },
+  { 0x3ff8dcd5532d0660, 0xbfffa38e101fe2e4, 0x3e1cf75ff8097fa9,
+    0xc0089501e7732ebe },
+  { 0x3ff82b238d9addc5, 0xbff0a2dc68c852cc, 0x3c1299761e9486cb,
+    0xbff9212545047842 },
+  { 0x3ffce3ea18bee5c3, 0x3fff8fa3354b87d9, 0x3ac708fa67ba8c9b,
+    0x400c7e789f259e3f },
+  { 0xbfffd48ad627b5cc, 0x3ffb9451f750a274, 0x3c75e332fc30e20c,
+    0xc00b6eddaed02bb9 },
+  { 0xbff87f9f9ee7e0c6, 0xbff2fffb3e95f6fa, 0x42061fc2ce16ee10,
+    0x42061fc2ce2579d3 },
+  { 0xbff7abe38fef2155, 0x3ffd49483e750783, 0xc4593d1e272cfe96,
+    0xc4593d1e272cfe96 },
+  { 0x3ff737b6f723d6cb, 0x3ff29586089430a1, 0x3a719c4399860aa1,
+    0x3ffaf7a72cf50a9a },
+  { 0xbff6e96bb72e1e13, 0x3ff075b1c7604a62, 0x414aafe42d00b752,
+    0x414aafe370710ddd },
+  { 0x7fefffffffffffff, 0x4000000000000000, 0xffefffffffffffff,
+    0x7fefffffffffffff },
+  { 0x7fefffffffffffff, 0x4000000000000000, 0xffd0000000000000,
+    0x7ff0000000000000 },
+  { 0x7fefffffffffffff, 0x7fefffffffffffff, 0x3ff0000000000000,
+    0x7ff0000000000000 },
+  { 0x7fefffffffffffff, 0xc000000000000000, 0x7fe0000000000000,
+    0xfff0000000000000 },
+  { 0x7fefffffffffffff, 0x3ff0000000000000, 0x7fefffffffffffff,
+    0x7ff0000000000000 },
+  { 0x7fefffffffffffff, 0x3ff0000000000001, 0xfca0000000000000,
+    0x7ff0000000000000 },
+  { 0x7fefffffffffffff, 0x3ff0000000000000, 0x7c90000000000000,
+    0x7ff0000000000000 },
+  { 0x7fefffffffffffff, 0x3ff0000000000000, 0x7c90000000000001,
+    0x7ff0000000000000 },
+  { 0x0010000000000000, 0x3fe0000000000000, 0x0000000000000000,
+    0x0008000000000000 },
+  { 0x0010000000000000, 0x3fe0000000000000, 0x8000000000000000,
+    0x0008000000000000 },
+  { 0x8010000000000001, 0x3fe0000000000000, 0x0000000000000000,
+    0x8008000000000000 },
+  { 0x0010000000000000, 0x0010000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x0010000000000000, 0x0010000000000000, 0x8000000000000000,
+    0x0000000000000000 },
+  { 0x0010000000000000, 0x0010000000000000, 0x0000000000000001,
+    0x0000000000000001 },
+  { 0x0010000000000000, 0x0010000000000000, 0x8000000000000001,
+    0x8000000000000001 },
+  { 0x0000000000000001, 0x3fe0000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x0000000000000003, 0x3fe0000000000000, 0x0000000000000000,
+    0x0000000000000002 },
+  { 0x0000000000000003, 0x3fe0000000000000, 0x8000000000000000,
+    0x0000000000000002 },
+  { 0x000fffffffffffff, 0x3ff0000000000000, 0x0000000000000001,
+    0x0010000000000000 },
+  { 0x0010000000000000, 0x3ff0000000000000, 0x8000000000000001,
+    0x000fffffffffffff },
+  { 0x0010000000000000, 0x3ff0000000000001, 0x8010000000000000,
+    0x0000000000000001 },
+  { 0x3cb0000000000000, 0x0010000000000000, 0x0000000000000001,
+    0x0000000000000002 },
+  { 0x3ca0000000000000, 0x0010000000000000, 0x0000000000000000,
+    0x0000000000000000 },
+  { 0x3ca0000000000001, 0x0010000000000000, 0x0000000000000000,
+    0x0000000000000001 },
+  { 0x3ca0000000000000, 0x0010000000000000, 0x0000000000000001,
+    0x0000000000000002 },
+  { 0x4330000000000000, 0x0000000000000001, 0x8010000000000000,
+    0x0000000000000000 },
+  { 0x0278ce6631e5c7f9, 0xbd15047e7c29963e, 0x800808f2c310d60b,
+    0x80082988a0e5c4f6 },
+  { 0x03502a0cf9baf48d, 0xbf0ac5514e609b82, 0x0012290a442b3cb4,
+    0x826b0bacf9a252ec },
+  { 0x81bf76bee8fac528, 0xbdce1c40f3f017de, 0x80315b5a8349a1d6,
+    0x803153f3bc99ee31 },
+  { 0x02d14cccd63cc681, 0xbd89d097c809bfce, 0x00012e5079e5b102,
+    0x806be0180ee88fa0 },
+  { 0x00298c9993b5f615, 0x3cbeea91eaf20f9b, 0x800356d734603825,
+    0x800356d73460381f },
+  { 0x81f60b2050bee4f7, 0xbd34fe39e39fcc50, 0x80011edaff2f3535,
+    0x80011e674e8c187f },
+  { 0x833449745b17e8d3, 0xbe8d6849d1be8475, 0x801c8dba98eeadf6,
+    0x01d2a4aef776d4e8 },
+  { 0x0119b6aba37dac38, 0xbcef3f99523cb90d, 0x0036efb1743dffc2,
+    0x0036efb17437b8be },
+  { 0x000fffffffffffff, 0x4330000000000000, 0x3ff0000000000000,
+    0x3ff0000000000000 },
+  { 0x0000000000000001, 0x7fd0000000000000, 0xbff0000000000000,
+    0xbfeffffffffffffe },
+  { 0x4630000000000000, 0x0000000000003039, 0x0000000000000001,
+    0x03e81c8000000000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7ff0000000000000, 0x0000000000000000, 0x3ff0000000000000,
+    0x7ff8000000000000 },
+  { 0x0000000000000000, 0xfff0000000000000, 0x3ff0000000000000,
+    0x7ff8000000000000 },
+  { 0x8000000000000000, 0x7ff0000000000000, 0xfff0000000000000,
+    0x7ff8000000000000 },
+  { 0x7ff0000000000000, 0x3ff0000000000000, 0xfff0000000000000,
+    0x7ff8000000000000 },
+  { 0xfff0000000000000, 0xbff0000000000000, 0xfff0000000000000,
+    0x7ff8000000000000 },
+  { 0x7fefffffffffffff, 0x7fefffffffffffff, 0xfff0000000000000,
+    0xfff0000000000000 },
+  { 0x7ff0000000000000, 0x7ff0000000000000, 0xfff0000000000000,
+    0x7ff8000000000000 },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x3ff0000000000000, 0x3ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x3ff0000000000000, 0x0000000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x3ff0000000000000, 0x0000000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x3ff0000000000000, 0x7ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x3ff0000000000000, 0x7ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x3ff0000000000000, 0xfff8000000005678, 0x3ff0000000000000,
+    0xfff8000000005678 },
+  { 0x3ff0000000000000, 0xfff8000000005678, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x3ff0000000000000, 0xfff8000000005678, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x3ff0000000000000, 0x7ff0000000008765, 0x3ff0000000000000,
+    0x7ff8000000008765 },
+  { 0x3ff0000000000000, 0x7ff0000000008765, 0x7ff8000000009abc,
+    0x7ff8000000008765 },
+  { 0x3ff0000000000000, 0x7ff0000000008765, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x0000000000000000, 0x3ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x0000000000000000, 0x3ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x0000000000000000, 0x0000000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x0000000000000000, 0x0000000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x0000000000000000, 0x7ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000000000 },
+  { 0x0000000000000000, 0x7ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x0000000000000000, 0xfff8000000005678, 0x3ff0000000000000,
+    0xfff8000000005678 },
+  { 0x0000000000000000, 0xfff8000000005678, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x0000000000000000, 0xfff8000000005678, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x0000000000000000, 0x7ff0000000008765, 0x3ff0000000000000,
+    0x7ff8000000008765 },
+  { 0x0000000000000000, 0x7ff0000000008765, 0x7ff8000000009abc,
+    0x7ff8000000008765 },
+  { 0x0000000000000000, 0x7ff0000000008765, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff0000000000000, 0x3ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff0000000000000, 0x3ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff0000000000000, 0x0000000000000000, 0x7ff8000000009abc,
+    0x7ff8000000000000 },
+  { 0x7ff0000000000000, 0x0000000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff0000000000000, 0x7ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff0000000000000, 0x7ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff0000000000000, 0xfff8000000005678, 0x3ff0000000000000,
+    0xfff8000000005678 },
+  { 0x7ff0000000000000, 0xfff8000000005678, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff0000000000000, 0xfff8000000005678, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff0000000000000, 0x7ff0000000008765, 0x3ff0000000000000,
+    0x7ff8000000008765 },
+  { 0x7ff0000000000000, 0x7ff0000000008765, 0x7ff8000000009abc,
+    0x7ff8000000008765 },
+  { 0x7ff0000000000000, 0x7ff0000000008765, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff8000000001234, 0x3ff0000000000000, 0x3ff0000000000000,
+    0x7ff8000000001234 },
+  { 0x7ff8000000001234, 0x3ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff8000000001234, 0x3ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff8000000001234, 0x0000000000000000, 0x3ff0000000000000,
+    0x7ff8000000001234 },
+  { 0x7ff8000000001234, 0x0000000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff8000000001234, 0x0000000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff8000000001234, 0x7ff0000000000000, 0x3ff0000000000000,
+    0x7ff8000000001234 },
+  { 0x7ff8000000001234, 0x7ff0000000000000, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff8000000001234, 0x7ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff8000000001234, 0xfff8000000005678, 0x3ff0000000000000,
+    0x7ff8000000001234 },
+  { 0x7ff8000000001234, 0xfff8000000005678, 0x7ff8000000009abc,
+    0x7ff8000000009abc },
+  { 0x7ff8000000001234, 0xfff8000000005678, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0x7ff8000000001234, 0x7ff0000000008765, 0x3ff0000000000000,
+    0x7ff8000000008765 },
+  { 0x7ff8000000001234, 0x7ff0000000008765, 0x7ff8000000009abc,
+    0x7ff8000000008765 },
+  { 0x7ff8000000001234, 0x7ff0000000008765, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0xfff0000000004321, 0x3ff0000000000000, 0x3ff0000000000000,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x3ff0000000000000, 0x7ff8000000009abc,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x3ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0xfff0000000004321, 0x0000000000000000, 0x3ff0000000000000,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x0000000000000000, 0x7ff8000000009abc,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x0000000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0xfff0000000004321, 0x7ff0000000000000, 0x3ff0000000000000,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x7ff0000000000000, 0x7ff8000000009abc,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x7ff0000000000000, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0xfff0000000004321, 0xfff8000000005678, 0x3ff0000000000000,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0xfff8000000005678, 0x7ff8000000009abc,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0xfff8000000005678, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+  { 0xfff0000000004321, 0x7ff0000000008765, 0x3ff0000000000000,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x7ff0000000008765, 0x7ff8000000009abc,
+    0xfff8000000004321 },
+  { 0xfff0000000004321, 0x7ff0000000008765, 0xfff000000000cba9,
+    0xfff800000000cba9 },
+};
+
+double
+make_double (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint64_t
+unmake_double (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in double
+       * arithmetic, instead of calling arm_fp_dfma. */
+      double in1 = make_double (t->in1);
+      double in2 = make_double (t->in2);
+      double in3 = make_double (t->in3);
+      double out = fma (in1, in2, in3);
+      uint64_t outbits = unmake_double (out);
+#else
+      extern uint64_t arm_fp_dfma(uint64_t, uint64_t, uint64_t);
+      uint64_t outbits = arm_fp_dfma(t->in1, t->in2, t->in3);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: dfma(%016" PRIx64 ", %016" PRIx64 ", %016" PRIx64
+		  ") -> %016" PRIx64 ", expected %016" PRIx64 "\n",
+		  t->in1, t->in2, t->in3, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
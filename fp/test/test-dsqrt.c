@@ -0,0 +1,185 @@
+/*
+ * Tests of IEEE 754 double-precision square root
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint64_t in, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000000000000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0x8000000000000000 },
+  { 0x0000000000000001, 0x1e60000000000000 },
+  { 0x0000000000000002, 0x1e66a09e667f3bcd },
+  { 0x0000000000000003, 0x1e6bb67ae8584caa },
+  { 0x0000000000000004, 0x1e70000000000000 },
+  { 0x0000000000000009, 0x1e78000000000000 },
+  { 0x00000000ffffffff, 0x1f5ffffffff00000 },
+  { 0x0000000100000000, 0x1f60000000000000 },
+  { 0x0000000123456789, 0x1f611111110c0889 },
+  { 0x0008000000000000, 0x1ff6a09e667f3bcd },
+  { 0x000fffffffffffff, 0x1fffffffffffffff },
+  { 0x0010000000000000, 0x2000000000000000 },
+  { 0x0010000000000001, 0x2000000000000000 },
+  { 0x001fffffffffffff, 0x2006a09e667f3bcc },
+  { 0x0020000000000000, 0x2006a09e667f3bcd },
+  { 0x0020000000000001, 0x2006a09e667f3bcd },
+  { 0x3fd0000000000000, 0x3fe0000000000000 },
+  { 0x3fe0000000000000, 0x3fe6a09e667f3bcd },
+  { 0x3fefffffffffffff, 0x3fefffffffffffff },
+  { 0x3ff0000000000000, 0x3ff0000000000000 },
+  { 0x3ff0000000000001, 0x3ff0000000000000 },
+  { 0x3ff0000000000002, 0x3ff0000000000001 },
+  { 0x3fffffffffffffff, 0x3ff6a09e667f3bcc },
+  { 0x4000000000000000, 0x3ff6a09e667f3bcd },
+  { 0x4000000000000001, 0x3ff6a09e667f3bcd },
+  { 0x4008000000000000, 0x3ffbb67ae8584caa },
+  { 0x4010000000000000, 0x4000000000000000 },
+  { 0x4010000000000001, 0x4000000000000000 },
+  { 0x4022000000000000, 0x4008000000000000 },
+  { 0x4039000000000000, 0x4014000000000000 },
+  { 0x4059000000000000, 0x4024000000000000 },
+  { 0x408f400000000000, 0x403f9f6e4990f227 },
+  { 0x40c3880000000000, 0x4059000000000000 },
+  { 0x433fffffffffffff, 0x4196a09e667f3bcc },
+  { 0x43f0000000000000, 0x41f0000000000000 },
+  { 0x7fdfffffffffffff, 0x5fe6a09e667f3bcc },
+  { 0x7fe0000000000000, 0x5fe6a09e667f3bcd },
+  { 0x7feffffffffffffe, 0x5fefffffffffffff },
+  { 0x7fefffffffffffff, 0x5fefffffffffffff },
+  { 0x7ff0000000000000, 0x7ff0000000000000 },
+  { 0x3ff6a09e667f3bcc, 0x3ff306fe0a31b715 },
+  { 0x3ff6a09e667f3bcd, 0x3ff306fe0a31b715 },
+  { 0x3fc5555555555555, 0x3fda20bd700c2c3e },
+  { 0x3fd5555555555555, 0x3fe279a74590331c },
+  { 0x400921fb54442d18, 0x3ffc5bf891b4ef6a },
+  { 0x4005bf0a8b145769, 0x3ffa61298e1e069c },
+  { 0x1fd0000000000000, 0x2fe0000000000000 },
+  { 0x5fe6eb50c7b537a9, 0x4feb14e569c9a603 },
+  { 0x2000000000000001, 0x2ff6a09e667f3bcd },
+  { 0x7c0fffffffffffff, 0x5dffffffffffffff },
+  { 0x3ff0000100000000, 0x3ff000007ffffe00 },
+  { 0x3ff00000ffffffff, 0x3ff000007ffffe00 },
+  { 0x4330000000000001, 0x4190000000000000 },
+  { 0x4c23686c12fb5af2, 0x4608ebc217c36353 },
+  { 0x3723686c12fb5af3, 0x3b88ebc217c36354 },
+  { 0x5c67ef79f4e23624, 0x4e2bacef0bf1d304 },
+  { 0x3727ef79f4e23625, 0x3b8bacef0bf1d305 },
+  { 0x2dee0392421bbe96, 0x36eefdb6c237f127 },
+  { 0x2f2e0392421bbe97, 0x378efdb6c237f128 },
+  { 0x20a0cf7fe3eb62c0, 0x30473187cf21da8b },
+  { 0x4680cf7fe3eb62c1, 0x43373187cf21da8c },
+  { 0x5eacd62f5fa553b0, 0x4f4e608ef0cdde03 },
+  { 0x49ecd62f5fa553b1, 0x44ee608ef0cdde03 },
+  { 0x316932cf8670a702, 0x38ac65759f029bd3 },
+  { 0x522932cf8670a703, 0x490c65759f029bd4 },
+  { 0x61c80b9d8867797a, 0x50dbbd2eddf01d11 },
+  { 0x46a80b9d8867797b, 0x434bbd2eddf01d12 },
+  { 0x57aa10d7df6fa439, 0x4bcce1818d75a3f8 },
+  { 0x268a10d7df6fa43a, 0x333ce1818d75a3f8 },
+  { 0x1c66a4bd6ea00281, 0x2e2aeb12d02993ea },
+  { 0x4fc6a4bd6ea00282, 0x47daeb12d02993ea },
+  { 0x46a07a4ac962fdce, 0x4346f674d3fde2d3 },
+  { 0x35807a4ac962fdcf, 0x3ab6f674d3fde2d3 },
+  { 0x57c561c6c01b0401, 0x4bda285afd4e2c3e },
+  { 0x24e561c6c01b0402, 0x326a285afd4e2c3f },
+  { 0x58825cb3d272424a, 0x4c383d7e6efa681b },
+  { 0x30625cb3d272424b, 0x38283d7e6efa681c },
+  { 0x3acbb29060aff736, 0x3d5dc5691f7498dd },
+  { 0x2dcbb29060aff737, 0x36ddc5691f7498dd },
+  { 0x2c85db69cb213658, 0x363a725957243f0a },
+  { 0x2d45db69cb213659, 0x369a725957243f0a },
+  { 0x554aa6ee56b305b0, 0x4a9d34313884365c },
+  { 0x400aa6ee56b305b1, 0x3ffd34313884365c },
+  { 0x21e3a52284b6eb8f, 0x30e9129e84ae566f },
+  { 0x29e3a52284b6eb90, 0x34e9129e84ae5670 },
+  { 0x2b669aab81e72a43, 0x35aae515d94ffa37 },
+  { 0x37669aab81e72a44, 0x3baae515d94ffa37 },
+  { 0x5223f35765d8450a, 0x490944556cbc3997 },
+  { 0x3ae3f35765d8450b, 0x3d6944556cbc3998 },
+  { 0x4d41e6a422a38484, 0x4697ef121e912829 },
+  { 0x5ec1e6a422a38485, 0x4f57ef121e91282a },
+  { 0x1dae855a5c8bec8b, 0x2ecf406fcc4c75d3 },
+  { 0x59ee855a5c8bec8c, 0x4cef406fcc4c75d4 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x8000000000000001, 0x7ff8000000000000 },
+  { 0x800fffffffffffff, 0x7ff8000000000000 },
+  { 0x8010000000000000, 0x7ff8000000000000 },
+  { 0xbff0000000000000, 0x7ff8000000000000 },
+  { 0xffefffffffffffff, 0x7ff8000000000000 },
+  { 0xfff0000000000000, 0x7ff8000000000000 },
+  { 0x7ff0000000000001, 0x7ff8000000000001 },
+  { 0x7ff4000000000000, 0x7ffc000000000000 },
+  { 0x7ff7ffffffffffff, 0x7fffffffffffffff },
+  { 0x7ff8000000000000, 0x7ff8000000000000 },
+  { 0x7ff8000000000001, 0x7ff8000000000001 },
+  { 0x7fffffffffffffff, 0x7fffffffffffffff },
+  { 0xfff0000000000001, 0xfff8000000000001 },
+  { 0xfff5555555555555, 0xfffd555555555555 },
+  { 0xfff8000000000000, 0xfff8000000000000 },
+  { 0xfffaaaaaaaaaaaaa, 0xfffaaaaaaaaaaaaa },
+};
+
+double
+make_double (uint64_t x)
+{
+  double r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint64_t
+unmake_double (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in double
+       * arithmetic, instead of calling arm_fp_dsqrt. */
+      double in = make_double (t->in);
+      double out = sqrt (in);
+      uint64_t outbits = unmake_double (out);
+#else
+      extern uint64_t arm_fp_dsqrt(uint64_t);
+      uint64_t outbits = arm_fp_dsqrt(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: dsqrt(%016" PRIx64 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,306 @@
+/*
+ * Tests of IEEE 754 single-precision to half-precision conversion
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in;
+  uint32_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x00000000, 0x0000 },
+  { 0x00000001, 0x0000 },
+  { 0x2b800000, 0x0000 },
+  { 0x32ffffff, 0x0000 },
+  { 0x33000000, 0x0000 },
+  { 0x33000001, 0x0001 },
+  { 0x330ff046, 0x0001 },
+  { 0x33400000, 0x0001 },
+  { 0x33400001, 0x0001 },
+  { 0x33800000, 0x0001 },
+  { 0x33800001, 0x0001 },
+  { 0x33c00000, 0x0002 },
+  { 0x33c00001, 0x0002 },
+  { 0x33c81548, 0x0002 },
+  { 0x34000000, 0x0002 },
+  { 0x34000001, 0x0002 },
+  { 0x340d6b2a, 0x0002 },
+  { 0x34400000, 0x0003 },
+  { 0x34400001, 0x0003 },
+  { 0x34800000, 0x0004 },
+  { 0x34800001, 0x0004 },
+  { 0x34c00000, 0x0006 },
+  { 0x34c00001, 0x0006 },
+  { 0x34fdcd9f, 0x0008 },
+  { 0x35000000, 0x0008 },
+  { 0x35000001, 0x0008 },
+  { 0x35249b6e, 0x000a },
+  { 0x35400000, 0x000c },
+  { 0x35400001, 0x000c },
+  { 0x35800000, 0x0010 },
+  { 0x35800001, 0x0010 },
+  { 0x35af1f62, 0x0016 },
+  { 0x35c00000, 0x0018 },
+  { 0x35c00001, 0x0018 },
+  { 0x36000000, 0x0020 },
+  { 0x36000001, 0x0020 },
+  { 0x36072c6e, 0x0022 },
+  { 0x36400000, 0x0030 },
+  { 0x36400001, 0x0030 },
+  { 0x36800000, 0x0040 },
+  { 0x36800001, 0x0040 },
+  { 0x36c00000, 0x0060 },
+  { 0x36c00001, 0x0060 },
+  { 0x36f46370, 0x007a },
+  { 0x37000000, 0x0080 },
+  { 0x37000001, 0x0080 },
+  { 0x37400000, 0x00c0 },
+  { 0x37400001, 0x00c0 },
+  { 0x374b30b0, 0x00cb },
+  { 0x37800000, 0x0100 },
+  { 0x37800001, 0x0100 },
+  { 0x37bfd552, 0x0180 },
+  { 0x37c00000, 0x0180 },
+  { 0x37c00001, 0x0180 },
+  { 0x38000000, 0x0200 },
+  { 0x38000001, 0x0200 },
+  { 0x38314c78, 0x02c5 },
+  { 0x38400000, 0x0300 },
+  { 0x38400001, 0x0300 },
+  { 0x387ff000, 0x0400 },
+  { 0x387fffff, 0x0400 },
+  { 0x38800000, 0x0400 },
+  { 0x38800fff, 0x0400 },
+  { 0x38801000, 0x0400 },
+  { 0x38801001, 0x0401 },
+  { 0x38802000, 0x0401 },
+  { 0x38803000, 0x0402 },
+  { 0x388c96e9, 0x0465 },
+  { 0x38fff000, 0x0800 },
+  { 0x38ffffff, 0x0800 },
+  { 0x3f000000, 0x3800 },
+  { 0x3f000fff, 0x3800 },
+  { 0x3f001000, 0x3800 },
+  { 0x3f001001, 0x3801 },
+  { 0x3f002000, 0x3801 },
+  { 0x3f003000, 0x3802 },
+  { 0x3f39b3cb, 0x39ce },
+  { 0x3f7ff000, 0x3c00 },
+  { 0x3f7fffff, 0x3c00 },
+  { 0x3f800000, 0x3c00 },
+  { 0x3f800fff, 0x3c00 },
+  { 0x3f801000, 0x3c00 },
+  { 0x3f801001, 0x3c01 },
+  { 0x3f802000, 0x3c01 },
+  { 0x3f803000, 0x3c02 },
+  { 0x3fd11efa, 0x3e89 },
+  { 0x3ffff000, 0x4000 },
+  { 0x3fffffff, 0x4000 },
+  { 0x40000000, 0x4000 },
+  { 0x40000fff, 0x4000 },
+  { 0x40001000, 0x4000 },
+  { 0x40001001, 0x4001 },
+  { 0x40002000, 0x4001 },
+  { 0x40003000, 0x4002 },
+  { 0x4003a7d6, 0x401d },
+  { 0x407ff000, 0x4400 },
+  { 0x407fffff, 0x4400 },
+  { 0x47000000, 0x7800 },
+  { 0x47000fff, 0x7800 },
+  { 0x47001000, 0x7800 },
+  { 0x47001001, 0x7801 },
+  { 0x47002000, 0x7801 },
+  { 0x47003000, 0x7802 },
+  { 0x471d4932, 0x78ea },
+  { 0x477fe000, 0x7bff },
+  { 0x477fefff, 0x7bff },
+  { 0x477ff000, 0x7c00 },
+  { 0x477fffff, 0x7c00 },
+  { 0x47800000, 0x7c00 },
+  { 0x7f7fffff, 0x7c00 },
+  { 0x7f800000, 0x7c00 },
+  { 0x80000000, 0x8000 },
+  { 0x80000001, 0x8000 },
+  { 0xab800000, 0x8000 },
+  { 0xb2ffffff, 0x8000 },
+  { 0xb3000000, 0x8000 },
+  { 0xb3000001, 0x8001 },
+  { 0xb33b819a, 0x8001 },
+  { 0xb3400000, 0x8001 },
+  { 0xb3400001, 0x8001 },
+  { 0xb3800000, 0x8001 },
+  { 0xb3800001, 0x8001 },
+  { 0xb3c00000, 0x8002 },
+  { 0xb3c00001, 0x8002 },
+  { 0xb3c06149, 0x8002 },
+  { 0xb4000000, 0x8002 },
+  { 0xb4000001, 0x8002 },
+  { 0xb42d7a53, 0x8003 },
+  { 0xb4400000, 0x8003 },
+  { 0xb4400001, 0x8003 },
+  { 0xb4800000, 0x8004 },
+  { 0xb4800001, 0x8004 },
+  { 0xb4ba91b3, 0x8006 },
+  { 0xb4c00000, 0x8006 },
+  { 0xb4c00001, 0x8006 },
+  { 0xb5000000, 0x8008 },
+  { 0xb5000001, 0x8008 },
+  { 0xb5400000, 0x800c },
+  { 0xb5400001, 0x800c },
+  { 0xb54d5f4e, 0x800d },
+  { 0xb5800000, 0x8010 },
+  { 0xb5800001, 0x8010 },
+  { 0xb58cdaad, 0x8012 },
+  { 0xb5c00000, 0x8018 },
+  { 0xb5c00001, 0x8018 },
+  { 0xb6000000, 0x8020 },
+  { 0xb6000001, 0x8020 },
+  { 0xb6400000, 0x8030 },
+  { 0xb6400001, 0x8030 },
+  { 0xb66e55f9, 0x803c },
+  { 0xb6800000, 0x8040 },
+  { 0xb6800001, 0x8040 },
+  { 0xb6879d8e, 0x8044 },
+  { 0xb6c00000, 0x8060 },
+  { 0xb6c00001, 0x8060 },
+  { 0xb7000000, 0x8080 },
+  { 0xb7000001, 0x8080 },
+  { 0xb7400000, 0x80c0 },
+  { 0xb7400001, 0x80c0 },
+  { 0xb75ed634, 0x80df },
+  { 0xb7800000, 0x8100 },
+  { 0xb7800001, 0x8100 },
+  { 0xb7c00000, 0x8180 },
+  { 0xb7c00001, 0x8180 },
+  { 0xb7c26316, 0x8185 },
+  { 0xb8000000, 0x8200 },
+  { 0xb8000001, 0x8200 },
+  { 0xb8066eec, 0x821a },
+  { 0xb8400000, 0x8300 },
+  { 0xb8400001, 0x8300 },
+  { 0xb87ff000, 0x8400 },
+  { 0xb87fffff, 0x8400 },
+  { 0xb8800000, 0x8400 },
+  { 0xb8800fff, 0x8400 },
+  { 0xb8801000, 0x8400 },
+  { 0xb8801001, 0x8401 },
+  { 0xb8802000, 0x8401 },
+  { 0xb8803000, 0x8402 },
+  { 0xb8c63a3b, 0x8632 },
+  { 0xb8fff000, 0x8800 },
+  { 0xb8ffffff, 0x8800 },
+  { 0xbf000000, 0xb800 },
+  { 0xbf000fff, 0xb800 },
+  { 0xbf001000, 0xb800 },
+  { 0xbf001001, 0xb801 },
+  { 0xbf002000, 0xb801 },
+  { 0xbf003000, 0xb802 },
+  { 0xbf58a6a6, 0xbac5 },
+  { 0xbf7ff000, 0xbc00 },
+  { 0xbf7fffff, 0xbc00 },
+  { 0xbf800000, 0xbc00 },
+  { 0xbf800fff, 0xbc00 },
+  { 0xbf801000, 0xbc00 },
+  { 0xbf801001, 0xbc01 },
+  { 0xbf802000, 0xbc01 },
+  { 0xbf803000, 0xbc02 },
+  { 0xbfcf822c, 0xbe7c },
+  { 0xbffff000, 0xc000 },
+  { 0xbfffffff, 0xc000 },
+  { 0xc0000000, 0xc000 },
+  { 0xc0000fff, 0xc000 },
+  { 0xc0001000, 0xc000 },
+  { 0xc0001001, 0xc001 },
+  { 0xc0002000, 0xc001 },
+  { 0xc0003000, 0xc002 },
+  { 0xc057c3d8, 0xc2be },
+  { 0xc07ff000, 0xc400 },
+  { 0xc07fffff, 0xc400 },
+  { 0xc7000000, 0xf800 },
+  { 0xc7000fff, 0xf800 },
+  { 0xc7001000, 0xf800 },
+  { 0xc7001001, 0xf801 },
+  { 0xc7002000, 0xf801 },
+  { 0xc7003000, 0xf802 },
+  { 0xc70fc7a8, 0xf87e },
+  { 0xc77fe000, 0xfbff },
+  { 0xc77fefff, 0xfbff },
+  { 0xc77ff000, 0xfc00 },
+  { 0xc77fffff, 0xfc00 },
+  { 0xc7800000, 0xfc00 },
+  { 0xff7fffff, 0xfc00 },
+  { 0xff800000, 0xfc00 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7f800001, 0x7e00 },
+  { 0x7fa01234, 0x7f00 },
+  { 0x7fc00000, 0x7e00 },
+  { 0x7fd54005, 0x7eaa },
+  { 0x7fffffff, 0x7fff },
+  { 0xff800001, 0xfe00 },
+  { 0xffa01234, 0xff00 },
+  { 0xffc00000, 0xfe00 },
+  { 0xffd54005, 0xfeaa },
+  { 0xffffffff, 0xffff },
+};
+
+float
+make_float (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_half (_Float16 x)
+{
+  uint16_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_f2h. */
+      _Float16 out = (_Float16)make_float(t->in);
+      uint32_t outbits = unmake_half(out);
+#else
+      extern uint32_t arm_fp_f2h(uint32_t);
+      uint32_t outbits = arm_fp_f2h(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: f2h(%08" PRIx32 ") -> %04" PRIx32
+		  ", expected %04" PRIx32 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
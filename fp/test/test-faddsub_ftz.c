@@ -0,0 +1,653 @@
+/*
+ * Tests of single-precision addition and subtraction with flush-to-zero
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+enum operation
+{
+  ADD,
+  SUB,
+};
+
+struct test
+{
+  enum operation op;
+  uint32_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests with no NaN inputs
+  { ADD, 0x00000000, 0x00000000, 0x00000000 },
+  { ADD, 0x00000000, 0x007fffff, 0x00000000 },
+  { ADD, 0x00000000, 0x3f800000, 0x3f800000 },
+  { ADD, 0x00000000, 0x7f000000, 0x7f000000 },
+  { ADD, 0x00000000, 0x7f800000, 0x7f800000 },
+  { ADD, 0x00000000, 0x80000000, 0x00000000 },
+  { ADD, 0x00000000, 0x807fffff, 0x00000000 },
+  { ADD, 0x00000000, 0x80800000, 0x80800000 },
+  { ADD, 0x00000000, 0xff800000, 0xff800000 },
+  { ADD, 0x00000001, 0x00000001, 0x00000000 },
+  { ADD, 0x00000001, 0x3f7fffff, 0x3f7fffff },
+  { ADD, 0x00000001, 0x3f800000, 0x3f800000 },
+  { ADD, 0x00000001, 0x3ffffffe, 0x3ffffffe },
+  { ADD, 0x00000001, 0x3fffffff, 0x3fffffff },
+  { ADD, 0x00000001, 0x7effffff, 0x7effffff },
+  { ADD, 0x00000001, 0x7f000000, 0x7f000000 },
+  { ADD, 0x00000001, 0x7f7ffffe, 0x7f7ffffe },
+  { ADD, 0x00000001, 0x7f7fffff, 0x7f7fffff },
+  { ADD, 0x00000001, 0x80000001, 0x00000000 },
+  { ADD, 0x00000002, 0x80000001, 0x00000000 },
+  { ADD, 0x00000003, 0x00000000, 0x00000000 },
+  { ADD, 0x00000003, 0x7f800000, 0x7f800000 },
+  { ADD, 0x00000003, 0x80000000, 0x00000000 },
+  { ADD, 0x00000003, 0x80000002, 0x00000000 },
+  { ADD, 0x00000003, 0xc0a00000, 0xc0a00000 },
+  { ADD, 0x00000003, 0xff000000, 0xff000000 },
+  { ADD, 0x00000003, 0xff800000, 0xff800000 },
+  { ADD, 0x00000004, 0x00000004, 0x00000000 },
+  { ADD, 0x007ffffc, 0x807ffffc, 0x00000000 },
+  { ADD, 0x007ffffd, 0x807ffffe, 0x00000000 },
+  { ADD, 0x007fffff, 0x007fffff, 0x00000000 },
+  { ADD, 0x007fffff, 0x807ffffe, 0x00000000 },
+  { ADD, 0x007fffff, 0x80800000, 0x80800000 },
+  { ADD, 0x00800000, 0x00000000, 0x00800000 },
+  { ADD, 0x00800000, 0x00800000, 0x01000000 },
+  { ADD, 0x00800000, 0x80800000, 0x00000000 },
+  { ADD, 0x00800001, 0x80800000, 0x00000000 },
+  { ADD, 0x00800001, 0x80800002, 0x80000000 },
+  { ADD, 0x00ffffff, 0x81000000, 0x80000000 },
+  { ADD, 0x00ffffff, 0x81000002, 0x80000000 },
+  { ADD, 0x00ffffff, 0x81000004, 0x80000000 },
+  { ADD, 0x01000000, 0x80ffffff, 0x00000000 },
+  { ADD, 0x01000001, 0x80800001, 0x00800001 },
+  { ADD, 0x01000001, 0x80ffffff, 0x00000000 },
+  { ADD, 0x01000002, 0x80800001, 0x00800003 },
+  { ADD, 0x017fffff, 0x81800000, 0x80000000 },
+  { ADD, 0x01800000, 0x817fffff, 0x00000000 },
+  { ADD, 0x01800001, 0x817fffff, 0x00000000 },
+  { ADD, 0x01800002, 0x81000003, 0x01000001 },
+  { ADD, 0x3f7fffff, 0x80000001, 0x3f7fffff },
+  { ADD, 0x3f800000, 0x3f800000, 0x40000000 },
+  { ADD, 0x3f800000, 0x3f800003, 0x40000002 },
+  { ADD, 0x3f800000, 0x40000000, 0x40400000 },
+  { ADD, 0x3f800000, 0x40e00000, 0x41000000 },
+  { ADD, 0x3f800000, 0x80000000, 0x3f800000 },
+  { ADD, 0x3f800000, 0xbf800000, 0x00000000 },
+  { ADD, 0x3f800001, 0x3f800000, 0x40000000 },
+  { ADD, 0x3f800001, 0xbf800000, 0x34000000 },
+  { ADD, 0x3f800001, 0xbf800002, 0xb4000000 },
+  { ADD, 0x3ffffffc, 0xbffffffd, 0xb4000000 },
+  { ADD, 0x3fffffff, 0xc0000000, 0xb4000000 },
+  { ADD, 0x40000000, 0x34000000, 0x40000000 },
+  { ADD, 0x40000000, 0x3f800000, 0x40400000 },
+  { ADD, 0x40000000, 0x40000000, 0x40800000 },
+  { ADD, 0x40000000, 0x40000001, 0x40800000 },
+  { ADD, 0x40000000, 0xbfffffff, 0x34000000 },
+  { ADD, 0x40000000, 0xc0000000, 0x00000000 },
+  { ADD, 0x40000000, 0xc0000001, 0xb4800000 },
+  { ADD, 0x40000000, 0xc0a00000, 0xc0400000 },
+  { ADD, 0x40000001, 0x34000000, 0x40000002 },
+  { ADD, 0x40000001, 0x40000002, 0x40800002 },
+  { ADD, 0x40000001, 0xbf800001, 0x3f800001 },
+  { ADD, 0x40000002, 0xbf800001, 0x3f800003 },
+  { ADD, 0x40000002, 0xbf800003, 0x3f800001 },
+  { ADD, 0x40000004, 0xc0000003, 0x34800000 },
+  { ADD, 0x40400000, 0x40400000, 0x40c00000 },
+  { ADD, 0x407fffff, 0x33ffffff, 0x407fffff },
+  { ADD, 0x407fffff, 0x34000000, 0x40800000 },
+  { ADD, 0x407fffff, 0xc07ffffe, 0x34800000 },
+  { ADD, 0x407fffff, 0xc0800002, 0xb5a00000 },
+  { ADD, 0x40800001, 0xc07fffff, 0x35400000 },
+  { ADD, 0x40a00000, 0x00000000, 0x40a00000 },
+  { ADD, 0x40a00000, 0x80000000, 0x40a00000 },
+  { ADD, 0x40a00000, 0xbf800000, 0x40800000 },
+  { ADD, 0x40a00000, 0xc0a00000, 0x00000000 },
+  { ADD, 0x7d800001, 0xfd7fffff, 0x72400000 },
+  { ADD, 0x7e7fffff, 0xfe7ffffe, 0x72800000 },
+  { ADD, 0x7e7fffff, 0xfe800002, 0xf3a00000 },
+  { ADD, 0x7e800000, 0x7e800000, 0x7f000000 },
+  { ADD, 0x7e800000, 0xfe7fffff, 0x72800000 },
+  { ADD, 0x7e800000, 0xfe800001, 0xf3000000 },
+  { ADD, 0x7e800001, 0x7e800000, 0x7f000000 },
+  { ADD, 0x7e800001, 0xff000001, 0xfe800001 },
+  { ADD, 0x7e800002, 0xfe000003, 0x7e000001 },
+  { ADD, 0x7e800004, 0xfe800003, 0x73000000 },
+  { ADD, 0x7efffffe, 0x7efffffe, 0x7f7ffffe },
+  { ADD, 0x7efffffe, 0x7effffff, 0x7f7ffffe },
+  { ADD, 0x7effffff, 0x3f800000, 0x7effffff },
+  { ADD, 0x7effffff, 0x7f000000, 0x7f800000 },
+  { ADD, 0x7effffff, 0xbf800000, 0x7effffff },
+  { ADD, 0x7effffff, 0xff000000, 0xf3000000 },
+  { ADD, 0x7f000000, 0x3f800000, 0x7f000000 },
+  { ADD, 0x7f000000, 0x7f000000, 0x7f800000 },
+  { ADD, 0x7f000000, 0x7f800000, 0x7f800000 },
+  { ADD, 0x7f000000, 0xbf800000, 0x7f000000 },
+  { ADD, 0x7f000000, 0xff000000, 0x00000000 },
+  { ADD, 0x7f000000, 0xff800000, 0xff800000 },
+  { ADD, 0x7f000001, 0x7f000000, 0x7f800000 },
+  { ADD, 0x7f000001, 0xff000000, 0x73800000 },
+  { ADD, 0x7f000001, 0xff000002, 0xf3800000 },
+  { ADD, 0x7f000002, 0xfe800001, 0x7e800003 },
+  { ADD, 0x7f7ffffe, 0x3f800000, 0x7f7ffffe },
+  { ADD, 0x7f7ffffe, 0x7f7ffffe, 0x7f800000 },
+  { ADD, 0x7f7ffffe, 0x7f7fffff, 0x7f800000 },
+  { ADD, 0x7f7ffffe, 0xbf800000, 0x7f7ffffe },
+  { ADD, 0x7f7ffffe, 0xff7fffff, 0xf3800000 },
+  { ADD, 0x7f7fffff, 0x3f800000, 0x7f7fffff },
+  { ADD, 0x7f7fffff, 0x80000001, 0x7f7fffff },
+  { ADD, 0x7f7fffff, 0xbf800000, 0x7f7fffff },
+  { ADD, 0x7f7fffff, 0xff7fffff, 0x00000000 },
+  { ADD, 0x7f800000, 0x00000000, 0x7f800000 },
+  { ADD, 0x7f800000, 0x007fffff, 0x7f800000 },
+  { ADD, 0x7f800000, 0x7f000000, 0x7f800000 },
+  { ADD, 0x7f800000, 0x7f800000, 0x7f800000 },
+  { ADD, 0x7f800000, 0x80000000, 0x7f800000 },
+  { ADD, 0x7f800000, 0x807fffff, 0x7f800000 },
+  { ADD, 0x7f800000, 0xff000000, 0x7f800000 },
+  { ADD, 0x80000000, 0x00000000, 0x00000000 },
+  { ADD, 0x80000000, 0x007fffff, 0x00000000 },
+  { ADD, 0x80000000, 0x7f000000, 0x7f000000 },
+  { ADD, 0x80000000, 0x7f800000, 0x7f800000 },
+  { ADD, 0x80000000, 0x80000000, 0x80000000 },
+  { ADD, 0x80000000, 0x807fffff, 0x80000000 },
+  { ADD, 0x80000000, 0x80800000, 0x80800000 },
+  { ADD, 0x80000000, 0xbf800000, 0xbf800000 },
+  { ADD, 0x80000000, 0xff800000, 0xff800000 },
+  { ADD, 0x80000001, 0x00000001, 0x00000000 },
+  { ADD, 0x80000001, 0x80000001, 0x80000000 },
+  { ADD, 0x80000001, 0xbf7fffff, 0xbf7fffff },
+  { ADD, 0x80000001, 0xbf800000, 0xbf800000 },
+  { ADD, 0x80000001, 0xbffffffe, 0xbffffffe },
+  { ADD, 0x80000001, 0xbfffffff, 0xbfffffff },
+  { ADD, 0x80000001, 0xfeffffff, 0xfeffffff },
+  { ADD, 0x80000001, 0xff000000, 0xff000000 },
+  { ADD, 0x80000001, 0xff7ffffe, 0xff7ffffe },
+  { ADD, 0x80000001, 0xff7fffff, 0xff7fffff },
+  { ADD, 0x80000002, 0x00000001, 0x00000000 },
+  { ADD, 0x80000003, 0x00000000, 0x00000000 },
+  { ADD, 0x80000003, 0x00000002, 0x00000000 },
+  { ADD, 0x80000003, 0x40400000, 0x40400000 },
+  { ADD, 0x80000003, 0x7f000000, 0x7f000000 },
+  { ADD, 0x80000003, 0x7f800000, 0x7f800000 },
+  { ADD, 0x80000003, 0x80000000, 0x80000000 },
+  { ADD, 0x80000003, 0xff800000, 0xff800000 },
+  { ADD, 0x80000004, 0x80000004, 0x80000000 },
+  { ADD, 0x807ffffd, 0x007ffffe, 0x00000000 },
+  { ADD, 0x807fffff, 0x007ffffe, 0x00000000 },
+  { ADD, 0x807fffff, 0x007fffff, 0x00000000 },
+  { ADD, 0x807fffff, 0x00800000, 0x00800000 },
+  { ADD, 0x807fffff, 0x807fffff, 0x80000000 },
+  { ADD, 0x80800000, 0x00000000, 0x80800000 },
+  { ADD, 0x80800000, 0x00800000, 0x00000000 },
+  { ADD, 0x80800001, 0x00800000, 0x80000000 },
+  { ADD, 0x80800001, 0x00800002, 0x00000000 },
+  { ADD, 0x80ffffff, 0x01000000, 0x00000000 },
+  { ADD, 0x80ffffff, 0x01000002, 0x00000000 },
+  { ADD, 0x80ffffff, 0x01000004, 0x00000000 },
+  { ADD, 0x81000000, 0x00ffffff, 0x80000000 },
+  { ADD, 0x81000001, 0x00800001, 0x80800001 },
+  { ADD, 0x81000001, 0x00ffffff, 0x80000000 },
+  { ADD, 0x81000002, 0x00800001, 0x80800003 },
+  { ADD, 0x817fffff, 0x01800000, 0x00000000 },
+  { ADD, 0x81800000, 0x017fffff, 0x80000000 },
+  { ADD, 0x81800001, 0x017fffff, 0x80000000 },
+  { ADD, 0x81800002, 0x01000003, 0x81000001 },
+  { ADD, 0xbf800000, 0x80000000, 0xbf800000 },
+  { ADD, 0xbf800000, 0xbf800003, 0xc0000002 },
+  { ADD, 0xbf800001, 0x3f800000, 0xb4000000 },
+  { ADD, 0xbf800001, 0x3f800002, 0x34000000 },
+  { ADD, 0xbf800001, 0xbf800000, 0xc0000000 },
+  { ADD, 0xbffffffc, 0x3ffffffd, 0x34000000 },
+  { ADD, 0xbfffffff, 0x00000001, 0xbfffffff },
+  { ADD, 0xbfffffff, 0x40000000, 0x34000000 },
+  { ADD, 0xc0000000, 0x3fffffff, 0xb4000000 },
+  { ADD, 0xc0000000, 0x40000001, 0x34800000 },
+  { ADD, 0xc0000000, 0xc0000001, 0xc0800000 },
+  { ADD, 0xc0000001, 0x3f800001, 0xbf800001 },
+  { ADD, 0xc0000001, 0xc0000002, 0xc0800002 },
+  { ADD, 0xc0000002, 0x3f800001, 0xbf800003 },
+  { ADD, 0xc0000002, 0x3f800003, 0xbf800001 },
+  { ADD, 0xc0000004, 0x40000003, 0xb4800000 },
+  { ADD, 0xc0400000, 0x40400000, 0x00000000 },
+  { ADD, 0xc07fffff, 0x407ffffe, 0xb4800000 },
+  { ADD, 0xc07fffff, 0x40800002, 0x35a00000 },
+  { ADD, 0xc07fffff, 0xb3ffffff, 0xc07fffff },
+  { ADD, 0xc07fffff, 0xb4000000, 0xc0800000 },
+  { ADD, 0xc0800001, 0x407fffff, 0xb5400000 },
+  { ADD, 0xfd800001, 0x7d7fffff, 0xf2400000 },
+  { ADD, 0xfe7fffff, 0x7e7ffffe, 0xf2800000 },
+  { ADD, 0xfe7fffff, 0x7e800002, 0x73a00000 },
+  { ADD, 0xfe800000, 0x7e7fffff, 0xf2800000 },
+  { ADD, 0xfe800000, 0x7e800001, 0x73000000 },
+  { ADD, 0xfe800001, 0x7f000001, 0x7e800001 },
+  { ADD, 0xfe800001, 0xfe800000, 0xff000000 },
+  { ADD, 0xfe800002, 0x7e000003, 0xfe000001 },
+  { ADD, 0xfe800004, 0x7e800003, 0xf3000000 },
+  { ADD, 0xfefffffe, 0x7efffffe, 0x00000000 },
+  { ADD, 0xfefffffe, 0xfefffffe, 0xff7ffffe },
+  { ADD, 0xfefffffe, 0xfeffffff, 0xff7ffffe },
+  { ADD, 0xfeffffff, 0x3f800000, 0xfeffffff },
+  { ADD, 0xfeffffff, 0x7f000000, 0x73000000 },
+  { ADD, 0xfeffffff, 0xbf800000, 0xfeffffff },
+  { ADD, 0xfeffffff, 0xff000000, 0xff800000 },
+  { ADD, 0xff000000, 0x00000000, 0xff000000 },
+  { ADD, 0xff000000, 0x3f800000, 0xff000000 },
+  { ADD, 0xff000000, 0x7f800000, 0x7f800000 },
+  { ADD, 0xff000000, 0x80000000, 0xff000000 },
+  { ADD, 0xff000000, 0xbf800000, 0xff000000 },
+  { ADD, 0xff000000, 0xff000000, 0xff800000 },
+  { ADD, 0xff000000, 0xff800000, 0xff800000 },
+  { ADD, 0xff000001, 0x7f000000, 0xf3800000 },
+  { ADD, 0xff000001, 0x7f000002, 0x73800000 },
+  { ADD, 0xff000001, 0xff000000, 0xff800000 },
+  { ADD, 0xff000002, 0x7e800001, 0xfe800003 },
+  { ADD, 0xff7ffffe, 0x3f800000, 0xff7ffffe },
+  { ADD, 0xff7ffffe, 0x7f7fffff, 0x73800000 },
+  { ADD, 0xff7ffffe, 0xbf800000, 0xff7ffffe },
+  { ADD, 0xff7ffffe, 0xff7ffffe, 0xff800000 },
+  { ADD, 0xff7ffffe, 0xff7fffff, 0xff800000 },
+  { ADD, 0xff7fffff, 0x00000001, 0xff7fffff },
+  { ADD, 0xff7fffff, 0x3f800000, 0xff7fffff },
+  { ADD, 0xff7fffff, 0xbf800000, 0xff7fffff },
+  { ADD, 0xff800000, 0x00000000, 0xff800000 },
+  { ADD, 0xff800000, 0x007fffff, 0xff800000 },
+  { ADD, 0xff800000, 0x7f000000, 0xff800000 },
+  { ADD, 0xff800000, 0x80000000, 0xff800000 },
+  { ADD, 0xff800000, 0x807fffff, 0xff800000 },
+  { ADD, 0xff800000, 0xff000000, 0xff800000 },
+  { ADD, 0xff800000, 0xff800000, 0xff800000 },
+  { ADD, 0x7f7fffff, 0x74ffffff, 0x7f800000 },
+  { ADD, 0x3f7fffff, 0x34004000, 0x3f800001 },
+  { ADD, 0x3f800001, 0x23800000, 0x3f800001 },
+  { ADD, 0xbbebe66d, 0x3b267c1f, 0xbb98a85e },
+  { ADD, 0x01f5b166, 0x81339a37, 0x019be44a },
+  { SUB, 0x00000000, 0x00000000, 0x00000000 },
+  { SUB, 0x00000000, 0x007fffff, 0x00000000 },
+  { SUB, 0x00000000, 0x00800000, 0x80800000 },
+  { SUB, 0x00000000, 0x7f800000, 0xff800000 },
+  { SUB, 0x00000000, 0x80000000, 0x00000000 },
+  { SUB, 0x00000000, 0x807fffff, 0x00000000 },
+  { SUB, 0x00000000, 0xbf800000, 0x3f800000 },
+  { SUB, 0x00000000, 0xff000000, 0x7f000000 },
+  { SUB, 0x00000000, 0xff800000, 0x7f800000 },
+  { SUB, 0x00000001, 0x00000001, 0x00000000 },
+  { SUB, 0x00000001, 0x80000001, 0x00000000 },
+  { SUB, 0x00000001, 0xbf7fffff, 0x3f7fffff },
+  { SUB, 0x00000001, 0xbf800000, 0x3f800000 },
+  { SUB, 0x00000001, 0xbffffffe, 0x3ffffffe },
+  { SUB, 0x00000001, 0xbfffffff, 0x3fffffff },
+  { SUB, 0x00000001, 0xfeffffff, 0x7effffff },
+  { SUB, 0x00000001, 0xff000000, 0x7f000000 },
+  { SUB, 0x00000001, 0xff7ffffe, 0x7f7ffffe },
+  { SUB, 0x00000001, 0xff7fffff, 0x7f7fffff },
+  { SUB, 0x00000002, 0x00000001, 0x00000000 },
+  { SUB, 0x00000003, 0x00000000, 0x00000000 },
+  { SUB, 0x00000003, 0x00000002, 0x00000000 },
+  { SUB, 0x00000003, 0x40a00000, 0xc0a00000 },
+  { SUB, 0x00000003, 0x7f000000, 0xff000000 },
+  { SUB, 0x00000003, 0x7f800000, 0xff800000 },
+  { SUB, 0x00000003, 0x80000000, 0x00000000 },
+  { SUB, 0x00000003, 0xff800000, 0x7f800000 },
+  { SUB, 0x00000004, 0x80000004, 0x00000000 },
+  { SUB, 0x007ffffc, 0x007ffffc, 0x00000000 },
+  { SUB, 0x007ffffd, 0x007ffffe, 0x00000000 },
+  { SUB, 0x007fffff, 0x007ffffe, 0x00000000 },
+  { SUB, 0x007fffff, 0x00800000, 0x80800000 },
+  { SUB, 0x007fffff, 0x807fffff, 0x00000000 },
+  { SUB, 0x00800000, 0x00800000, 0x00000000 },
+  { SUB, 0x00800000, 0x80000000, 0x00800000 },
+  { SUB, 0x00800000, 0x80800000, 0x01000000 },
+  { SUB, 0x00800001, 0x00800000, 0x00000000 },
+  { SUB, 0x00800001, 0x00800002, 0x80000000 },
+  { SUB, 0x00ffffff, 0x01000000, 0x80000000 },
+  { SUB, 0x00ffffff, 0x01000002, 0x80000000 },
+  { SUB, 0x00ffffff, 0x01000004, 0x80000000 },
+  { SUB, 0x01000000, 0x00ffffff, 0x00000000 },
+  { SUB, 0x01000001, 0x00800001, 0x00800001 },
+  { SUB, 0x01000001, 0x00ffffff, 0x00000000 },
+  { SUB, 0x01000002, 0x00800001, 0x00800003 },
+  { SUB, 0x017fffff, 0x01800000, 0x80000000 },
+  { SUB, 0x01800000, 0x017fffff, 0x00000000 },
+  { SUB, 0x01800001, 0x017fffff, 0x00000000 },
+  { SUB, 0x01800002, 0x01000003, 0x01000001 },
+  { SUB, 0x3f7fffff, 0x00000001, 0x3f7fffff },
+  { SUB, 0x3f800000, 0x00000000, 0x3f800000 },
+  { SUB, 0x3f800000, 0x3f800000, 0x00000000 },
+  { SUB, 0x3f800000, 0xbf800000, 0x40000000 },
+  { SUB, 0x3f800000, 0xbf800003, 0x40000002 },
+  { SUB, 0x3f800000, 0xc0000000, 0x40400000 },
+  { SUB, 0x3f800000, 0xc0e00000, 0x41000000 },
+  { SUB, 0x3f800001, 0x3f800000, 0x34000000 },
+  { SUB, 0x3f800001, 0x3f800002, 0xb4000000 },
+  { SUB, 0x3f800001, 0xbf800000, 0x40000000 },
+  { SUB, 0x3ffffffc, 0x3ffffffd, 0xb4000000 },
+  { SUB, 0x3fffffff, 0x40000000, 0xb4000000 },
+  { SUB, 0x40000000, 0x3fffffff, 0x34000000 },
+  { SUB, 0x40000000, 0x40000000, 0x00000000 },
+  { SUB, 0x40000000, 0x40000001, 0xb4800000 },
+  { SUB, 0x40000000, 0x40a00000, 0xc0400000 },
+  { SUB, 0x40000000, 0xb4000000, 0x40000000 },
+  { SUB, 0x40000000, 0xbf800000, 0x40400000 },
+  { SUB, 0x40000000, 0xc0000000, 0x40800000 },
+  { SUB, 0x40000000, 0xc0000001, 0x40800000 },
+  { SUB, 0x40000001, 0x3f800001, 0x3f800001 },
+  { SUB, 0x40000001, 0xb4000000, 0x40000002 },
+  { SUB, 0x40000001, 0xc0000002, 0x40800002 },
+  { SUB, 0x40000002, 0x3f800001, 0x3f800003 },
+  { SUB, 0x40000002, 0x3f800003, 0x3f800001 },
+  { SUB, 0x40000004, 0x40000003, 0x34800000 },
+  { SUB, 0x40400000, 0xc0400000, 0x40c00000 },
+  { SUB, 0x407fffff, 0x407ffffe, 0x34800000 },
+  { SUB, 0x407fffff, 0x40800002, 0xb5a00000 },
+  { SUB, 0x407fffff, 0xb3ffffff, 0x407fffff },
+  { SUB, 0x407fffff, 0xb4000000, 0x40800000 },
+  { SUB, 0x40800001, 0x407fffff, 0x35400000 },
+  { SUB, 0x40a00000, 0x00000000, 0x40a00000 },
+  { SUB, 0x40a00000, 0x3f800000, 0x40800000 },
+  { SUB, 0x40a00000, 0x40a00000, 0x00000000 },
+  { SUB, 0x40a00000, 0x80000000, 0x40a00000 },
+  { SUB, 0x7d800001, 0x7d7fffff, 0x72400000 },
+  { SUB, 0x7e7fffff, 0x7e7ffffe, 0x72800000 },
+  { SUB, 0x7e7fffff, 0x7e800002, 0xf3a00000 },
+  { SUB, 0x7e800000, 0x7e7fffff, 0x72800000 },
+  { SUB, 0x7e800000, 0x7e800001, 0xf3000000 },
+  { SUB, 0x7e800000, 0xfe800000, 0x7f000000 },
+  { SUB, 0x7e800001, 0x7f000001, 0xfe800001 },
+  { SUB, 0x7e800001, 0xfe800000, 0x7f000000 },
+  { SUB, 0x7e800002, 0x7e000003, 0x7e000001 },
+  { SUB, 0x7e800004, 0x7e800003, 0x73000000 },
+  { SUB, 0x7efffffe, 0xfefffffe, 0x7f7ffffe },
+  { SUB, 0x7efffffe, 0xfeffffff, 0x7f7ffffe },
+  { SUB, 0x7effffff, 0x3f800000, 0x7effffff },
+  { SUB, 0x7effffff, 0x7f000000, 0xf3000000 },
+  { SUB, 0x7effffff, 0xbf800000, 0x7effffff },
+  { SUB, 0x7effffff, 0xff000000, 0x7f800000 },
+  { SUB, 0x7f000000, 0x3f800000, 0x7f000000 },
+  { SUB, 0x7f000000, 0x7f000000, 0x00000000 },
+  { SUB, 0x7f000000, 0x7f800000, 0xff800000 },
+  { SUB, 0x7f000000, 0xbf800000, 0x7f000000 },
+  { SUB, 0x7f000000, 0xff000000, 0x7f800000 },
+  { SUB, 0x7f000000, 0xff800000, 0x7f800000 },
+  { SUB, 0x7f000001, 0x7f000000, 0x73800000 },
+  { SUB, 0x7f000001, 0x7f000002, 0xf3800000 },
+  { SUB, 0x7f000001, 0xff000000, 0x7f800000 },
+  { SUB, 0x7f000002, 0x7e800001, 0x7e800003 },
+  { SUB, 0x7f7ffffe, 0x3f800000, 0x7f7ffffe },
+  { SUB, 0x7f7ffffe, 0x7f7fffff, 0xf3800000 },
+  { SUB, 0x7f7ffffe, 0xbf800000, 0x7f7ffffe },
+  { SUB, 0x7f7ffffe, 0xff7ffffe, 0x7f800000 },
+  { SUB, 0x7f7ffffe, 0xff7fffff, 0x7f800000 },
+  { SUB, 0x7f7fffff, 0x00000001, 0x7f7fffff },
+  { SUB, 0x7f7fffff, 0x3f800000, 0x7f7fffff },
+  { SUB, 0x7f7fffff, 0x7f7fffff, 0x00000000 },
+  { SUB, 0x7f7fffff, 0xbf800000, 0x7f7fffff },
+  { SUB, 0x7f800000, 0x00000000, 0x7f800000 },
+  { SUB, 0x7f800000, 0x007fffff, 0x7f800000 },
+  { SUB, 0x7f800000, 0x7f000000, 0x7f800000 },
+  { SUB, 0x7f800000, 0x80000000, 0x7f800000 },
+  { SUB, 0x7f800000, 0x807fffff, 0x7f800000 },
+  { SUB, 0x7f800000, 0xff000000, 0x7f800000 },
+  { SUB, 0x7f800000, 0xff800000, 0x7f800000 },
+  { SUB, 0x80000000, 0x00000000, 0x80000000 },
+  { SUB, 0x80000000, 0x007fffff, 0x80000000 },
+  { SUB, 0x80000000, 0x00800000, 0x80800000 },
+  { SUB, 0x80000000, 0x3f800000, 0xbf800000 },
+  { SUB, 0x80000000, 0x7f800000, 0xff800000 },
+  { SUB, 0x80000000, 0x80000000, 0x00000000 },
+  { SUB, 0x80000000, 0x807fffff, 0x00000000 },
+  { SUB, 0x80000000, 0xff000000, 0x7f000000 },
+  { SUB, 0x80000000, 0xff800000, 0x7f800000 },
+  { SUB, 0x80000001, 0x00000001, 0x80000000 },
+  { SUB, 0x80000001, 0x3f7fffff, 0xbf7fffff },
+  { SUB, 0x80000001, 0x3f800000, 0xbf800000 },
+  { SUB, 0x80000001, 0x3ffffffe, 0xbffffffe },
+  { SUB, 0x80000001, 0x3fffffff, 0xbfffffff },
+  { SUB, 0x80000001, 0x7effffff, 0xfeffffff },
+  { SUB, 0x80000001, 0x7f000000, 0xff000000 },
+  { SUB, 0x80000001, 0x7f7ffffe, 0xff7ffffe },
+  { SUB, 0x80000001, 0x7f7fffff, 0xff7fffff },
+  { SUB, 0x80000001, 0x80000001, 0x00000000 },
+  { SUB, 0x80000002, 0x80000001, 0x00000000 },
+  { SUB, 0x80000003, 0x00000000, 0x80000000 },
+  { SUB, 0x80000003, 0x7f800000, 0xff800000 },
+  { SUB, 0x80000003, 0x80000000, 0x00000000 },
+  { SUB, 0x80000003, 0x80000002, 0x00000000 },
+  { SUB, 0x80000003, 0xc0400000, 0x40400000 },
+  { SUB, 0x80000003, 0xff000000, 0x7f000000 },
+  { SUB, 0x80000003, 0xff800000, 0x7f800000 },
+  { SUB, 0x80000004, 0x00000004, 0x80000000 },
+  { SUB, 0x807ffffd, 0x807ffffe, 0x00000000 },
+  { SUB, 0x807fffff, 0x007fffff, 0x80000000 },
+  { SUB, 0x807fffff, 0x807ffffe, 0x00000000 },
+  { SUB, 0x807fffff, 0x807fffff, 0x00000000 },
+  { SUB, 0x807fffff, 0x80800000, 0x00800000 },
+  { SUB, 0x80800000, 0x80000000, 0x80800000 },
+  { SUB, 0x80800000, 0x80800000, 0x00000000 },
+  { SUB, 0x80800001, 0x80800000, 0x80000000 },
+  { SUB, 0x80800001, 0x80800002, 0x00000000 },
+  { SUB, 0x80ffffff, 0x81000000, 0x00000000 },
+  { SUB, 0x80ffffff, 0x81000002, 0x00000000 },
+  { SUB, 0x80ffffff, 0x81000004, 0x00000000 },
+  { SUB, 0x81000000, 0x80ffffff, 0x80000000 },
+  { SUB, 0x81000001, 0x80800001, 0x80800001 },
+  { SUB, 0x81000001, 0x80ffffff, 0x80000000 },
+  { SUB, 0x81000002, 0x80800001, 0x80800003 },
+  { SUB, 0x817fffff, 0x81800000, 0x00000000 },
+  { SUB, 0x81800000, 0x817fffff, 0x80000000 },
+  { SUB, 0x81800001, 0x817fffff, 0x80000000 },
+  { SUB, 0x81800002, 0x81000003, 0x81000001 },
+  { SUB, 0xbf800000, 0x00000000, 0xbf800000 },
+  { SUB, 0xbf800000, 0x3f800003, 0xc0000002 },
+  { SUB, 0xbf800001, 0x3f800000, 0xc0000000 },
+  { SUB, 0xbf800001, 0xbf800000, 0xb4000000 },
+  { SUB, 0xbf800001, 0xbf800002, 0x34000000 },
+  { SUB, 0xbffffffc, 0xbffffffd, 0x34000000 },
+  { SUB, 0xbfffffff, 0x80000001, 0xbfffffff },
+  { SUB, 0xbfffffff, 0xc0000000, 0x34000000 },
+  { SUB, 0xc0000000, 0x40000001, 0xc0800000 },
+  { SUB, 0xc0000000, 0xbfffffff, 0xb4000000 },
+  { SUB, 0xc0000000, 0xc0000001, 0x34800000 },
+  { SUB, 0xc0000001, 0x40000002, 0xc0800002 },
+  { SUB, 0xc0000001, 0xbf800001, 0xbf800001 },
+  { SUB, 0xc0000002, 0xbf800001, 0xbf800003 },
+  { SUB, 0xc0000002, 0xbf800003, 0xbf800001 },
+  { SUB, 0xc0000004, 0xc0000003, 0xb4800000 },
+  { SUB, 0xc0400000, 0xc0400000, 0x00000000 },
+  { SUB, 0xc07fffff, 0x33ffffff, 0xc07fffff },
+  { SUB, 0xc07fffff, 0x34000000, 0xc0800000 },
+  { SUB, 0xc07fffff, 0xc07ffffe, 0xb4800000 },
+  { SUB, 0xc07fffff, 0xc0800002, 0x35a00000 },
+  { SUB, 0xc0800001, 0xc07fffff, 0xb5400000 },
+  { SUB, 0xfd800001, 0xfd7fffff, 0xf2400000 },
+  { SUB, 0xfe7fffff, 0xfe7ffffe, 0xf2800000 },
+  { SUB, 0xfe7fffff, 0xfe800002, 0x73a00000 },
+  { SUB, 0xfe800000, 0xfe7fffff, 0xf2800000 },
+  { SUB, 0xfe800000, 0xfe800001, 0x73000000 },
+  { SUB, 0xfe800001, 0x7e800000, 0xff000000 },
+  { SUB, 0xfe800001, 0xff000001, 0x7e800001 },
+  { SUB, 0xfe800002, 0xfe000003, 0xfe000001 },
+  { SUB, 0xfe800004, 0xfe800003, 0xf3000000 },
+  { SUB, 0xfefffffe, 0x7efffffe, 0xff7ffffe },
+  { SUB, 0xfefffffe, 0x7effffff, 0xff7ffffe },
+  { SUB, 0xfefffffe, 0xfefffffe, 0x00000000 },
+  { SUB, 0xfeffffff, 0x3f800000, 0xfeffffff },
+  { SUB, 0xfeffffff, 0x7f000000, 0xff800000 },
+  { SUB, 0xfeffffff, 0xbf800000, 0xfeffffff },
+  { SUB, 0xfeffffff, 0xff000000, 0x73000000 },
+  { SUB, 0xff000000, 0x00000000, 0xff000000 },
+  { SUB, 0xff000000, 0x3f800000, 0xff000000 },
+  { SUB, 0xff000000, 0x7f000000, 0xff800000 },
+  { SUB, 0xff000000, 0x7f800000, 0xff800000 },
+  { SUB, 0xff000000, 0x80000000, 0xff000000 },
+  { SUB, 0xff000000, 0xbf800000, 0xff000000 },
+  { SUB, 0xff000000, 0xff800000, 0x7f800000 },
+  { SUB, 0xff000001, 0x7f000000, 0xff800000 },
+  { SUB, 0xff000001, 0xff000000, 0xf3800000 },
+  { SUB, 0xff000001, 0xff000002, 0x73800000 },
+  { SUB, 0xff000002, 0xfe800001, 0xfe800003 },
+  { SUB, 0xff7ffffe, 0x3f800000, 0xff7ffffe },
+  { SUB, 0xff7ffffe, 0x7f7ffffe, 0xff800000 },
+  { SUB, 0xff7ffffe, 0x7f7fffff, 0xff800000 },
+  { SUB, 0xff7ffffe, 0xbf800000, 0xff7ffffe },
+  { SUB, 0xff7ffffe, 0xff7fffff, 0x73800000 },
+  { SUB, 0xff7fffff, 0x3f800000, 0xff7fffff },
+  { SUB, 0xff7fffff, 0x80000001, 0xff7fffff },
+  { SUB, 0xff7fffff, 0xbf800000, 0xff7fffff },
+  { SUB, 0xff800000, 0x00000000, 0xff800000 },
+  { SUB, 0xff800000, 0x007fffff, 0xff800000 },
+  { SUB, 0xff800000, 0x7f000000, 0xff800000 },
+  { SUB, 0xff800000, 0x7f800000, 0xff800000 },
+  { SUB, 0xff800000, 0x80000000, 0xff800000 },
+  { SUB, 0xff800000, 0x807fffff, 0xff800000 },
+  { SUB, 0xff800000, 0xff000000, 0xff800000 },
+  { SUB, 0x46f99cee, 0x4656466d, 0x468e79b8 },
+  { SUB, 0x007ffff7, 0x00f7ffff, 0x80f7ffff },
+  { SUB, 0x80ffffbf, 0x80800000, 0x80000000 },
+
+  // Tests with NaN inputs, which all return the default NaN
+  { ADD, 0x00000000, 0x7fad4be3, 0x7fc00000 },
+  { ADD, 0x00000000, 0x7fdf48c7, 0x7fc00000 },
+  { ADD, 0x00000001, 0x7f970eba, 0x7fc00000 },
+  { ADD, 0x00000001, 0x7fc35716, 0x7fc00000 },
+  { ADD, 0x007fffff, 0x7fbf52d6, 0x7fc00000 },
+  { ADD, 0x007fffff, 0x7fc7a2df, 0x7fc00000 },
+  { ADD, 0x3f800000, 0x7f987a85, 0x7fc00000 },
+  { ADD, 0x3f800000, 0x7fc50124, 0x7fc00000 },
+  { ADD, 0x7f7fffff, 0x7f95fd6f, 0x7fc00000 },
+  { ADD, 0x7f7fffff, 0x7ffc28dc, 0x7fc00000 },
+  { ADD, 0x7f800000, 0x7f8dd790, 0x7fc00000 },
+  { ADD, 0x7f800000, 0x7fd2ef2b, 0x7fc00000 },
+  { ADD, 0x7f800000, 0xff800000, 0x7fc00000 },
+  { ADD, 0x7f99b09d, 0x00000000, 0x7fc00000 },
+  { ADD, 0x7f93541e, 0x00000001, 0x7fc00000 },
+  { ADD, 0x7f9fc002, 0x007fffff, 0x7fc00000 },
+  { ADD, 0x7fb5db77, 0x3f800000, 0x7fc00000 },
+  { ADD, 0x7f9f5d92, 0x7f7fffff, 0x7fc00000 },
+  { ADD, 0x7fac7a36, 0x7f800000, 0x7fc00000 },
+  { ADD, 0x7fb42008, 0x7fb0ee07, 0x7fc00000 },
+  { ADD, 0x7f8bd740, 0x7fc7aaf1, 0x7fc00000 },
+  { ADD, 0x7f9bb57b, 0x80000000, 0x7fc00000 },
+  { ADD, 0x7f951a78, 0x80000001, 0x7fc00000 },
+  { ADD, 0x7f9ba63b, 0x807fffff, 0x7fc00000 },
+  { ADD, 0x7f89463c, 0xbf800000, 0x7fc00000 },
+  { ADD, 0x7fb63563, 0xff7fffff, 0x7fc00000 },
+  { ADD, 0x7f90886e, 0xff800000, 0x7fc00000 },
+  { ADD, 0x7fe8c15e, 0x00000000, 0x7fc00000 },
+  { ADD, 0x7fe915ae, 0x00000001, 0x7fc00000 },
+  { ADD, 0x7ffa9b42, 0x007fffff, 0x7fc00000 },
+  { ADD, 0x7fdad0f5, 0x3f800000, 0x7fc00000 },
+  { ADD, 0x7fd10dcb, 0x7f7fffff, 0x7fc00000 },
+  { ADD, 0x7fd08e8a, 0x7f800000, 0x7fc00000 },
+  { ADD, 0x7fc3a9e6, 0x7f91a816, 0x7fc00000 },
+  { ADD, 0x7fdb229c, 0x7fc26c68, 0x7fc00000 },
+  { ADD, 0x7fc9f6bb, 0x80000000, 0x7fc00000 },
+  { ADD, 0x7ffa178b, 0x80000001, 0x7fc00000 },
+  { ADD, 0x7fef2a0b, 0x807fffff, 0x7fc00000 },
+  { ADD, 0x7ffc885b, 0xbf800000, 0x7fc00000 },
+  { ADD, 0x7fd26e8c, 0xff7fffff, 0x7fc00000 },
+  { ADD, 0x7fc55329, 0xff800000, 0x7fc00000 },
+  { ADD, 0x80000000, 0x7fa833ae, 0x7fc00000 },
+  { ADD, 0x80000000, 0x7fc4df63, 0x7fc00000 },
+  { ADD, 0x80000001, 0x7f98827d, 0x7fc00000 },
+  { ADD, 0x80000001, 0x7fd7acc5, 0x7fc00000 },
+  { ADD, 0x807fffff, 0x7fad19c0, 0x7fc00000 },
+  { ADD, 0x807fffff, 0x7ffe1907, 0x7fc00000 },
+  { ADD, 0xbf800000, 0x7fa95487, 0x7fc00000 },
+  { ADD, 0xbf800000, 0x7fd2bbee, 0x7fc00000 },
+  { ADD, 0xff7fffff, 0x7f86ba21, 0x7fc00000 },
+  { ADD, 0xff7fffff, 0x7feb00d7, 0x7fc00000 },
+  { ADD, 0xff800000, 0x7f800000, 0x7fc00000 },
+  { ADD, 0xff800000, 0x7f857fdc, 0x7fc00000 },
+  { ADD, 0xff800000, 0x7fde0397, 0x7fc00000 },
+  { SUB, 0x00000000, 0x7fad4be3, 0x7fc00000 },
+  { SUB, 0x00000000, 0x7fdf48c7, 0x7fc00000 },
+  { SUB, 0x00000001, 0x7f970eba, 0x7fc00000 },
+  { SUB, 0x00000001, 0x7fc35716, 0x7fc00000 },
+  { SUB, 0x007fffff, 0x7fbf52d6, 0x7fc00000 },
+  { SUB, 0x007fffff, 0x7fc7a2df, 0x7fc00000 },
+  { SUB, 0x3f800000, 0x7f987a85, 0x7fc00000 },
+  { SUB, 0x3f800000, 0x7fc50124, 0x7fc00000 },
+  { SUB, 0x7f7fffff, 0x7f95fd6f, 0x7fc00000 },
+  { SUB, 0x7f7fffff, 0x7ffc28dc, 0x7fc00000 },
+  { SUB, 0x7f800000, 0x7f800000, 0x7fc00000 },
+  { SUB, 0x7f800000, 0x7f8dd790, 0x7fc00000 },
+  { SUB, 0x7f800000, 0x7fd2ef2b, 0x7fc00000 },
+  { SUB, 0x7f99b09d, 0x00000000, 0x7fc00000 },
+  { SUB, 0x7f93541e, 0x00000001, 0x7fc00000 },
+  { SUB, 0x7f9fc002, 0x007fffff, 0x7fc00000 },
+  { SUB, 0x7fb5db77, 0x3f800000, 0x7fc00000 },
+  { SUB, 0x7f9f5d92, 0x7f7fffff, 0x7fc00000 },
+  { SUB, 0x7fac7a36, 0x7f800000, 0x7fc00000 },
+  { SUB, 0x7fb42008, 0x7fb0ee07, 0x7fc00000 },
+  { SUB, 0x7f8bd740, 0x7fc7aaf1, 0x7fc00000 },
+  { SUB, 0x7f9bb57b, 0x80000000, 0x7fc00000 },
+  { SUB, 0x7f951a78, 0x80000001, 0x7fc00000 },
+  { SUB, 0x7f9ba63b, 0x807fffff, 0x7fc00000 },
+  { SUB, 0x7f89463c, 0xbf800000, 0x7fc00000 },
+  { SUB, 0x7fb63563, 0xff7fffff, 0x7fc00000 },
+  { SUB, 0x7f90886e, 0xff800000, 0x7fc00000 },
+  { SUB, 0x7fe8c15e, 0x00000000, 0x7fc00000 },
+  { SUB, 0x7fe915ae, 0x00000001, 0x7fc00000 },
+  { SUB, 0x7ffa9b42, 0x007fffff, 0x7fc00000 },
+  { SUB, 0x7fdad0f5, 0x3f800000, 0x7fc00000 },
+  { SUB, 0x7fd10dcb, 0x7f7fffff, 0x7fc00000 },
+  { SUB, 0x7fd08e8a, 0x7f800000, 0x7fc00000 },
+  { SUB, 0x7fc3a9e6, 0x7f91a816, 0x7fc00000 },
+  { SUB, 0x7fdb229c, 0x7fc26c68, 0x7fc00000 },
+  { SUB, 0x7fc9f6bb, 0x80000000, 0x7fc00000 },
+  { SUB, 0x7ffa178b, 0x80000001, 0x7fc00000 },
+  { SUB, 0x7fef2a0b, 0x807fffff, 0x7fc00000 },
+  { SUB, 0x7ffc885b, 0xbf800000, 0x7fc00000 },
+  { SUB, 0x7fd26e8c, 0xff7fffff, 0x7fc00000 },
+  { SUB, 0x7fc55329, 0xff800000, 0x7fc00000 },
+  { SUB, 0x80000000, 0x7fa833ae, 0x7fc00000 },
+  { SUB, 0x80000000, 0x7fc4df63, 0x7fc00000 },
+  { SUB, 0x80000001, 0x7f98827d, 0x7fc00000 },
+  { SUB, 0x80000001, 0x7fd7acc5, 0x7fc00000 },
+  { SUB, 0x807fffff, 0x7fad19c0, 0x7fc00000 },
+  { SUB, 0x807fffff, 0x7ffe1907, 0x7fc00000 },
+  { SUB, 0xbf800000, 0x7fa95487, 0x7fc00000 },
+  { SUB, 0xbf800000, 0x7fd2bbee, 0x7fc00000 },
+  { SUB, 0xff7fffff, 0x7f86ba21, 0x7fc00000 },
+  { SUB, 0xff7fffff, 0x7feb00d7, 0x7fc00000 },
+  { SUB, 0xff800000, 0x7f857fdc, 0x7fc00000 },
+  { SUB, 0xff800000, 0x7fde0397, 0x7fc00000 },
+  { SUB, 0xff800000, 0xff800000, 0x7fc00000 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint32_t arm_fp_fadd_ftz(uint32_t, uint32_t);
+      extern uint32_t arm_fp_fsub_ftz(uint32_t, uint32_t);
+      uint32_t outbits = (t->op == ADD ? arm_fp_fadd_ftz(t->in1, t->in2) :
+                          arm_fp_fsub_ftz(t->in1, t->in2));
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: %s(%08" PRIx32 ", %08" PRIx32 ") -> %08" PRIx32
+		  ", expected %08" PRIx32 "\n",
+                  (t->op == ADD ? "fadd_ftz" : "fsub_ftz"),
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,342 @@
+/*
+ * Tests of single-precision AXPY in the unpacked-operand format
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t a;
+  size_t n;
+  uint32_t x[4], y[4];
+  uint32_t out[4];
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x3f800000, 0, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x11111111, 0x22222222, 0x33333333, 0x44444444 },
+      { 0x11111111, 0x22222222, 0x33333333, 0x44444444 } },
+  { 0x40000000, 2, { 0x3f800000, 0x40400000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0xc0c00000, 0x11111111, 0x22222222 },
+      { 0x40400000, 0x00000000, 0x11111111, 0x22222222 } },
+  { 0x3f800001, 1, { 0x3f800001, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xbf800002, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x30000000, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x3f800001, 2, { 0x3f800001, 0x3f7fffff, 0x00000000, 0x00000000 },
+      { 0xbf800000, 0x33800000, 0x11111111, 0x22222222 },
+      { 0x34804000, 0x3f800001, 0x11111111, 0x22222222 } },
+  { 0x00000001, 2, { 0x3f000000, 0x3f400000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x80000000, 0x11111111, 0x22222222 },
+      { 0x00000000, 0x00000001, 0x11111111, 0x22222222 } },
+  { 0x00400000, 2, { 0x00000003, 0x40000000, 0x00000000, 0x00000000 },
+      { 0x00000001, 0x80800000, 0x11111111, 0x22222222 },
+      { 0x00000001, 0x00000000, 0x11111111, 0x22222222 } },
+  { 0x7f7fffff, 2, { 0x40000000, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0xff7fffff, 0xff7fffff, 0x11111111, 0x22222222 },
+      { 0x7f7fffff, 0x00000000, 0x11111111, 0x22222222 } },
+  { 0x00000000, 3, { 0x3f800000, 0x7f800000, 0x00000001, 0x00000000 },
+      { 0x80000000, 0x3f800000, 0x80000000, 0x11111111 },
+      { 0x00000000, 0x7fc00000, 0x00000000, 0x11111111 } },
+  { 0x80000000, 2, { 0x3f800000, 0x80000000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x80000000, 0x11111111, 0x22222222 },
+      { 0x00000000, 0x00000000, 0x11111111, 0x22222222 } },
+  { 0x7f800000, 3, { 0x3f800000, 0x00000000, 0xbf800000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x7f800000, 0x11111111 },
+      { 0x7f800000, 0x7fc00000, 0x7fc00000, 0x11111111 } },
+  { 0xff800000, 1, { 0x00000001, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x58824823, 1, { 0x5e92b9ff, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xa2d44d0c, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x77955798, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x7f800000, 3, { 0x0052abd8, 0x8074c178, 0x80662536, 0x00000000 },
+      { 0x00000000, 0x00615bb3, 0x3fe60c7c, 0x11111111 },
+      { 0x7f800000, 0xff800000, 0xff800000, 0x11111111 } },
+  { 0x37ee2fb7, 2, { 0x2ceacb0a, 0x0050fd4f, 0x00000000, 0x00000000 },
+      { 0xc043405e, 0x4c69ddd3, 0x11111111, 0x22222222 },
+      { 0xc043405e, 0x4c69ddd3, 0x11111111, 0x22222222 } },
+  { 0xcd648652, 1, { 0xa48255b6, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x3268b171, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x25006306, 4, { 0x2007020b, 0x218e4530, 0x40cdc7de, 0x5c83153d },
+      { 0x23778003, 0xb380f95d, 0x486fa668, 0x204778f6 },
+      { 0x23778003, 0xb380f95d, 0x486fa668, 0x42037aa6 } },
+  { 0x38aa5484, 1, { 0x50646b02, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x5def9b5a, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x5def9b5a, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x26176cff, 1, { 0xb609f289, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x006b3424, 2, { 0x7f800000, 0x40d0f54a, 0x00000000, 0x00000000 },
+      { 0x80000000, 0xff800000, 0x11111111, 0x22222222 },
+      { 0x7f800000, 0xff800000, 0x11111111, 0x22222222 } },
+  { 0x5736845a, 4, { 0x5254c78e, 0x46b6b90e, 0xab651961, 0xcd269010 },
+      { 0xaaf6bf58, 0x462aff74, 0xc0a3b4dc, 0x4f4a6df1 },
+      { 0x6a17b3e1, 0x5e824608, 0xc3287423, 0xe4ed8110 } },
+  { 0x23c4a41a, 2, { 0xa87933eb, 0xbf6b582e, 0x00000000, 0x00000000 },
+      { 0xd72c91d6, 0x40cb1b74, 0x11111111, 0x22222222 },
+      { 0xd72c91d6, 0x40cb1b74, 0x11111111, 0x22222222 } },
+  { 0x43a898e9, 4, { 0xa7d95689, 0x5425efaa, 0xd77d388d, 0xc6002040 },
+      { 0xa6dbc7ed, 0xb2bd26db, 0xbf31908b, 0xa151b138 },
+      { 0xac0f3e14, 0x585a90ca, 0xdba6c45d, 0xca28c364 } },
+  { 0xb5e03450, 4, { 0x30e423b0, 0xd9fe0b51, 0x23e71993, 0x394e7f0f },
+      { 0xddd42415, 0x5454f748, 0x266c34da, 0x3f88e380 },
+      { 0xddd42415, 0x5455d5c6, 0x266c34d9, 0x3f88e380 } },
+  { 0x5985b4ac, 4, { 0xbdef1a26, 0x433aa6db, 0x00000000, 0x3d607c39 },
+      { 0x7f800000, 0x54643523, 0x53c3e129, 0xff800000 },
+      { 0x7f800000, 0x5d42f90e, 0x53c3e129, 0xff800000 } },
+  { 0x804468b2, 2, { 0xdeebd022, 0x7f800000, 0x00000000, 0x00000000 },
+      { 0xd911cdb1, 0xff800000, 0x11111111, 0x22222222 },
+      { 0xd911cdb1, 0xff800000, 0x11111111, 0x22222222 } },
+  { 0xa99f78d8, 3, { 0x4fea2fdf, 0x28c91c63, 0x2a4a600d, 0x00000000 },
+      { 0xae050845, 0xbde20565, 0xdeb5c12f, 0x11111111 },
+      { 0xba11e248, 0xbde20565, 0xdeb5c12f, 0x11111111 } },
+  { 0xccbb7abd, 1, { 0x384f40f8, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x8004ba9c, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xc597c7d3, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0xca8434dd, 1, { 0x20a192d7, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x3444a464, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x3444a411, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0xc2774fe6, 1, { 0x54f73189, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x2ef17ef8, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xd7eecdf2, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x7f800000, 2, { 0x7f800000, 0x58ce4502, 0x00000000, 0x00000000 },
+      { 0xdcba1b01, 0xc941a27c, 0x11111111, 0x22222222 },
+      { 0x7f800000, 0x7f800000, 0x11111111, 0x22222222 } },
+  { 0xff800000, 4, { 0x4c5ad021, 0x801904a0, 0x262f5772, 0x481ea94e },
+      { 0x00000000, 0x00000000, 0xb67df7ee, 0x3d159565 },
+      { 0xff800000, 0x7f800000, 0xff800000, 0xff800000 } },
+  { 0x281ccf28, 1, { 0x4298f584, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x5093a1bf, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x5093a1bf, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x30e0a1c1, 4, { 0x3f6009c3, 0xb948cf16, 0xb49c35b6, 0x00538f3a },
+      { 0xdc7a55ca, 0x23027e53, 0x0014b298, 0xd830ef42 },
+      { 0xdc7a55ca, 0xaab03310, 0xa60911b3, 0xd830ef42 } },
+  { 0x80000000, 4, { 0x5d15fbb6, 0x00000000, 0x2f7755bd, 0x3a9cede3 },
+      { 0xb74bce00, 0x8032251a, 0xba4809f1, 0x511433c0 },
+      { 0xb74bce00, 0x8032251a, 0xba4809f1, 0x511433c0 } },
+  { 0x2df313bd, 1, { 0x38ba7726, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x22849d7a, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x27314fc8, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x0009c8bc, 2, { 0x7f800000, 0x000fca93, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x7f800000, 0x11111111, 0x22222222 },
+      { 0x7f800000, 0x7f800000, 0x11111111, 0x22222222 } },
+  { 0x00000000, 3, { 0xd922e7c7, 0xff800000, 0xa7358118, 0x00000000 },
+      { 0xaddd024e, 0x4431c57f, 0x806a5a05, 0x11111111 },
+      { 0xaddd024e, 0x7fc00000, 0x806a5a05, 0x11111111 } },
+  { 0xc0b73621, 2, { 0xc8c57073, 0x80000000, 0x00000000, 0x00000000 },
+      { 0x537c9515, 0xff800000, 0x11111111, 0x22222222 },
+      { 0x537c9538, 0xff800000, 0x11111111, 0x22222222 } },
+  { 0x7f800000, 1, { 0xff800000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xd3ace279, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x52a9d3de, 4, { 0xdc47008b, 0xc232e710, 0x3f4b4473, 0x22c9e208 },
+      { 0x4d836731, 0x370e0bc2, 0x5a0f95f6, 0x325f8ee3 },
+      { 0xef84040e, 0xd56d5d32, 0x5a0f9704, 0x3606ccdb } },
+  { 0x4b70b145, 4, { 0x7f800000, 0xff800000, 0x31325744, 0x80000000 },
+      { 0xff800000, 0x30780c0c, 0x39e70efb, 0x00223551 },
+      { 0x7fc00000, 0xff800000, 0x3d297b6c, 0x00223551 } },
+  { 0x47525c17, 4, { 0x39413e41, 0xa36c0240, 0xb7670916, 0x212d18ba },
+      { 0x44de81d9, 0x37629db4, 0xbd502a79, 0x44c038ec },
+      { 0x44dfbf6e, 0x37629db3, 0xbf4adb38, 0x44c038ec } },
+  { 0x3b77cd38, 4, { 0x4cd3dacd, 0x2ed43fa3, 0x408d60b0, 0x5b322a6b },
+      { 0xd62831a0, 0xc6cfb1fe, 0x38ac2048, 0xd63592a5 },
+      { 0xd62831a0, 0xc6cfb1fe, 0x3c8985bf, 0x56fe222e } },
+  { 0x20f91d0b, 4, { 0xd034d171, 0xc60c9648, 0x323a35c9, 0x322ec952 },
+      { 0x5546e6b9, 0xb38c82e9, 0xd4010ef5, 0x5879fcc1 },
+      { 0x5546e6b9, 0xb38c82ea, 0xd4010ef5, 0x5879fcc1 } },
+  { 0x21b505be, 2, { 0x3ab98848, 0xaf95b5a5, 0x00000000, 0x00000000 },
+      { 0xd6c6a4c4, 0xa80e2e1f, 0x11111111, 0x22222222 },
+      { 0xd6c6a4c4, 0xa80e2e1f, 0x11111111, 0x22222222 } },
+  { 0xcb5e0d69, 4, { 0xa00c398a, 0x35b78ab5, 0x4001b643, 0xdc3a60bd },
+      { 0x36bf2f16, 0x3a6cd28a, 0xb30b2c68, 0xa3d6117c },
+      { 0x36bf2f1a, 0xc19f320d, 0xcbe105b3, 0x6821a9a7 } },
+  { 0x22c90a25, 4, { 0xbb98ee63, 0xff800000, 0x7f800000, 0xc242fc36 },
+      { 0x44ea0287, 0x4e0f3f06, 0x25ef2a4c, 0x00000000 },
+      { 0x44ea0287, 0xff800000, 0x7f800000, 0xa5991fc0 } },
+  { 0xc6032032, 1, { 0x4ad8ef3f, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x000a02bb, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xd15e3b6b, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0xa86f16c3, 2, { 0xff800000, 0x8051f7bb, 0x00000000, 0x00000000 },
+      { 0x5c52cb23, 0x80000000, 0x11111111, 0x22222222 },
+      { 0x7f800000, 0x00000000, 0x11111111, 0x22222222 } },
+  { 0x4790540f, 4, { 0x33da36c0, 0xff800000, 0xa9379d60, 0x803381d8 },
+      { 0xde7a5ee6, 0x7f800000, 0x2420ec57, 0xbc36678e },
+      { 0xde7a5ee6, 0x7fc00000, 0xb14f09a1, 0xbc36678e } },
+  { 0xd3448ec6, 3, { 0x310a45cc, 0x2ac49cf0, 0xad47c9d6, 0x00000000 },
+      { 0x3bee9db7, 0xbe6f16e3, 0xbc22e967, 0x11111111 },
+      { 0xc4d454e0, 0xbf0740a0, 0x41193d3a, 0x11111111 } },
+  { 0x7f800000, 4, { 0x4cfa7400, 0xdd18e7d7, 0xd0dd9809, 0x3c296aa3 },
+      { 0xca69ac2c, 0x28f06ace, 0xab24d4ea, 0x80000000 },
+      { 0x7f800000, 0xff800000, 0xff800000, 0x7f800000 } },
+  { 0x2ae9b62c, 1, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xb91bee0b, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xb91bee0b, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x5eb9de8f, 4, { 0x7f800000, 0x00000000, 0x5dc3f30d, 0x00000000 },
+      { 0x4feaecd2, 0x37beca1e, 0x8044a6e6, 0xff800000 },
+      { 0x7f800000, 0x37beca1e, 0x7d0e44ff, 0xff800000 } },
+  { 0xaba59210, 3, { 0x3f579290, 0x2aca9d4b, 0x3894a00b, 0x00000000 },
+      { 0xb489facc, 0x44713139, 0xac3d94d4, 0x11111111 },
+      { 0xb489faef, 0x44713139, 0xac3d9654, 0x11111111 } },
+  { 0x4cce7db0, 4, { 0x2df982f8, 0x34f627ae, 0x3b83dad7, 0xd2a50650 },
+      { 0x4d59ab33, 0x595cf509, 0xb0a6d6cc, 0x20073455 },
+      { 0x4d59ab33, 0x595cf509, 0x48d4b5ab, 0xe0051c1a } },
+  { 0x37f63c11, 1, { 0xdca5a6b2, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xb2611e43, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xd51f550d, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0xd9ff77ef, 4, { 0xbb9ce73f, 0xb77ac141, 0xc8bfe9ff, 0xb27cec80 },
+      { 0x4f40127d, 0xdaadff1a, 0x21c6166f, 0x48572b5a },
+      { 0x561c96da, 0xdaadfedb, 0x633f83fe, 0x4cfcd1a7 } },
+  { 0x274dc024, 3, { 0xa717255e, 0x000ac736, 0xaf63db90, 0x00000000 },
+      { 0x80000000, 0x22b05f3e, 0xcbf69676, 0x11111111 },
+      { 0x8ef2f4bb, 0x22b05f3e, 0xcbf69676, 0x11111111 } },
+  { 0xbdec7339, 1, { 0xd99bc778, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x80000000, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x580fe200, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x244267ea, 3, { 0x000471f8, 0x005dd930, 0xdd475cb6, 0x00000000 },
+      { 0xd9d2c34f, 0xb0d460fa, 0x247c0a5e, 0x11111111 },
+      { 0xd9d2c34f, 0xb0d460fa, 0xc217652e, 0x11111111 } },
+  { 0xb6a42654, 3, { 0xbf749043, 0x4fb8402a, 0xafd3bb4e, 0x00000000 },
+      { 0xc845b8fd, 0xa8920267, 0xa4661fd0, 0x11111111 },
+      { 0xc845b8fd, 0xc6ec4962, 0x27042b32, 0x11111111 } },
+  { 0x7f800000, 1, { 0xd6d12dd7, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x80074087, 0x11111111, 0x22222222, 0x33333333 },
+      { 0xff800000, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x80000000, 2, { 0xd4bdace6, 0x000faa57, 0x00000000, 0x00000000 },
+      { 0xb5104b67, 0xa4919780, 0x11111111, 0x22222222 },
+      { 0xb5104b67, 0xa4919780, 0x11111111, 0x22222222 } },
+  { 0x3f16449c, 3, { 0xaece0e6c, 0x492a9f98, 0x4967a5f5, 0x00000000 },
+      { 0xd076c9cf, 0x44559421, 0x56a1ba6b, 0x11111111 },
+      { 0xd076c9cf, 0x48c8b945, 0x56a1ba6b, 0x11111111 } },
+  { 0xb4c88992, 1, { 0xdcd60753, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x295d4699, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x5227a8bd, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0x30b11a38, 3, { 0xce1f2226, 0xa0a06bb4, 0x4554b855, 0x00000000 },
+      { 0x5edfbcb1, 0xc03ce4fc, 0x4e91c777, 0x11111111 },
+      { 0x5edfbcb1, 0xc03ce4fc, 0x4e91c777, 0x11111111 } },
+  { 0x4109f95c, 4, { 0xb6a00678, 0xbb94681e, 0xd3cb6abc, 0xa88cda18 },
+      { 0xb4cfe5cf, 0x42674caa, 0x34b385d9, 0xd12579b1 },
+      { 0xb82e1e78, 0x426724ac, 0xd55b4485, 0xd12579b1 } },
+  { 0xc103d948, 4, { 0xde45abd9, 0x4d68a193, 0x30e0050f, 0x496a79c1 },
+      { 0x399dc2d6, 0x2dd5a442, 0x3f88a831, 0xb73e9d9a },
+      { 0x5fcb9d6d, 0xceefa041, 0x3f88a831, 0xcaf186a2 } },
+  { 0xccedc972, 1, { 0x2a609b0e, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x49961893, 0x11111111, 0x22222222, 0x33333333 },
+      { 0x49961893, 0x11111111, 0x22222222, 0x33333333 } },
+  { 0xca6f2242, 4, { 0x80000000, 0xad15caf0, 0x3d910749, 0xda20733a },
+      { 0x80000000, 0x4c44d386, 0x006a6f1d, 0x3cd0ac23 },
+      { 0x00000000, 0x4c44d386, 0xc8877936, 0x6515e10c } },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7fc00000, 2, { 0x3f800000, 0x7f800001, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x11111111, 0x22222222 },
+      { 0x7fc00000, 0x7fc00001, 0x11111111, 0x22222222 } },
+  { 0x7f800001, 2, { 0x7fc00000, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x7fc00001, 0x11111111, 0x22222222 },
+      { 0x7fc00001, 0x7fc00001, 0x11111111, 0x22222222 } },
+  { 0x3f800000, 3, { 0x3f800000, 0x7f800001, 0x7fc00000, 0x00000000 },
+      { 0x7f800002, 0x7fc00001, 0x3f800000, 0x11111111 },
+      { 0x7fc00002, 0x7fc00001, 0x7fc00000, 0x11111111 } },
+};
+
+// Tests where the addition cancels most of a product that was rounded to odd
+// at 32 bits, so that the output is far from a fused multiply-add. These are
+// checked against their expected output like the tests above, and also
+// against the error bound in fp/README.md: the error is at most 2^-31 times
+// the magnitude of the product, plus the final rounding to single precision.
+// For these inputs, the product and the sum are exact in double precision, so
+// the test can compute the bound and the exact answer directly.
+static const struct test cancel_tests[] = {
+  { 0x3f800001, 2, { 0x3f800001, 0x3f800003, 0x00000000, 0x00000000 },
+      { 0xbf800001, 0xbf800006, 0x11111111, 0x22222222 },
+      { 0x34008000, 0xb47f8000, 0x11111111, 0x22222222 } },
+  { 0x4b800001, 2, { 0x4b800001, 0x3f800003, 0x00000000, 0x00000000 },
+      { 0xd7000001, 0xbf800006, 0x11111111, 0x22222222 },
+      { 0x57000003, 0x4b800004, 0x11111111, 0x22222222 } },
+};
+
+static double
+fval (uint32_t bits)
+{
+  float f;
+  memcpy (&f, &bits, sizeof (f));
+  return f;
+}
+
+static double
+dabs (double d)
+{
+  return d < 0 ? -d : d;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern void arm_fp_faxpy(uint32_t, const uint32_t *, uint32_t *, size_t);
+      uint32_t y[4];
+      memcpy (y, t->y, sizeof (y));
+      arm_fp_faxpy(t->a, t->x, y, t->n);
+
+      // Check every element, including those after the first n, which
+      // should be unchanged.
+      for (size_t j = 0; j < 4; j++)
+	if (y[j] != t->out[j])
+	  {
+	    printf ("FAIL: test %zu: faxpy y[%zu] -> %08" PRIx32
+		    ", expected %08" PRIx32 "\n", i, j, y[j], t->out[j]);
+	    failed = true;
+	  }
+    }
+
+  for (size_t i = 0; i < sizeof (cancel_tests) / sizeof (cancel_tests[0]);
+       i++)
+    {
+      const struct test *t = &cancel_tests[i];
+
+      extern void arm_fp_faxpy(uint32_t, const uint32_t *, uint32_t *, size_t);
+      uint32_t y[4];
+      memcpy (y, t->y, sizeof (y));
+      arm_fp_faxpy(t->a, t->x, y, t->n);
+
+      for (size_t j = 0; j < t->n; j++)
+	{
+	  if (y[j] != t->out[j])
+	    {
+	      printf ("FAIL: cancellation test %zu: faxpy y[%zu] -> %08" PRIx32
+		      ", expected %08" PRIx32 "\n", i, j, y[j], t->out[j]);
+	      failed = true;
+	    }
+
+	  double product = fval (t->a) * fval (t->x[j]);
+	  double exact = product + fval (t->y[j]);
+	  double out = fval (y[j]);
+	  double bound = dabs (product) * 0x1p-31 + dabs (out) * 0x1p-24;
+	  if (dabs (out - exact) > bound)
+	    {
+	      printf ("FAIL: cancellation test %zu: faxpy y[%zu] -> %08" PRIx32
+		      ", error %a exceeds bound %a\n", i, j, y[j], out - exact,
+		      bound);
+	      failed = true;
+	    }
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
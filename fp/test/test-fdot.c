@@ -0,0 +1,281 @@
+/*
+ * Tests of the single-precision dot product in the unpacked-operand format
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  size_t n;
+  uint32_t x[4], y[4];
+  uint32_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 1, { 0x3f800000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x40000000, 0x00000000, 0x00000000, 0x00000000 }, 0x40000000 },
+  { 1, { 0x80000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x00000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 1, { 0x80000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 2, { 0x80000000, 0x80000000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 3, { 0x4b800000, 0x3f800000, 0xcb800000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x3f800000, 0x00000000 }, 0x3f800000 },
+  { 2, { 0x3f800001, 0xbf800000, 0x00000000, 0x00000000 },
+      { 0x3f800001, 0x3f800000, 0x00000000, 0x00000000 }, 0x34804000 },
+  { 3, { 0x3f7fffff, 0x3f800000, 0xbf800000, 0x00000000 },
+      { 0x3f7fffff, 0x33800000, 0x3f800000, 0x00000000 }, 0xb37f0000 },
+  { 2, { 0x7f000000, 0x7f000000, 0x00000000, 0x00000000 },
+      { 0x40000000, 0xc0000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 3, { 0x7f7fffff, 0x7f7fffff, 0xff7fffff, 0x00000000 },
+      { 0x7f7fffff, 0x3f800000, 0x7f7fffff, 0x00000000 }, 0x00000000 },
+  { 2, { 0x00000001, 0x00000001, 0x00000000, 0x00000000 },
+      { 0x00000001, 0x3f000000, 0x00000000, 0x00000000 }, 0x00000001 },
+  { 2, { 0x00000001, 0x00400000, 0x00000000, 0x00000000 },
+      { 0x3f000000, 0x00000003, 0x00000000, 0x00000000 }, 0x00000001 },
+  { 2, { 0x00800000, 0x80800000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x3f7fffff, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 2, { 0x7f800000, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x7f800000, 0x00000000, 0x00000000 }, 0x7f800000 },
+  { 2, { 0x7f800000, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0xff800000, 0x00000000, 0x00000000 }, 0x7fc00000 },
+  { 1, { 0x7f800000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, 0x7fc00000 },
+  { 2, { 0x5812d29a, 0x5c287f15, 0x00000000, 0x00000000 },
+      { 0x4641de06, 0xc4eb11b8, 0x00000000, 0x00000000 }, 0xe1973ed1 },
+  { 2, { 0xc21c0260, 0x5e2f2ef5, 0x00000000, 0x00000000 },
+      { 0x35cf30ec, 0xcf151e77, 0x00000000, 0x00000000 }, 0xedcc165b },
+  { 2, { 0xa604364a, 0xbe1bc2e3, 0x00000000, 0x00000000 },
+      { 0xff800000, 0xca488dfe, 0x00000000, 0x00000000 }, 0x7f800000 },
+  { 4, { 0x2848da69, 0x4704a2ff, 0xb3877277, 0x3a4b4dc5 },
+      { 0xb036459a, 0x3c31b3ae, 0xb2c7d0e7, 0xa9ca68b2 }, 0x43b82395 },
+  { 4, { 0x002f2650, 0x2619c99c, 0xb4fa7c6f, 0xa449199e },
+      { 0xb18924ff, 0xbc727979, 0x3cbbe948, 0x3e12b372 }, 0xb237dd27 },
+  { 3, { 0xaaed3411, 0x80000000, 0x2d57ba06, 0x00000000 },
+      { 0xccaa40c8, 0xdeeb0b7f, 0x578faf3a, 0x00000000 }, 0x45722925 },
+  { 3, { 0xa652fa2d, 0x38d7439a, 0x4662098d, 0x00000000 },
+      { 0x49523105, 0xb957fa1b, 0x472991ba, 0x00000000 }, 0x4e15b8fa },
+  { 3, { 0xde490c59, 0xb09037a2, 0xdb1a7e7d, 0x00000000 },
+      { 0x2b18c088, 0x22517c7a, 0xaca4e529, 0x00000000 }, 0xc9d70c3d },
+  { 3, { 0xbb848fce, 0xc50e4041, 0x3c0259f8, 0x00000000 },
+      { 0xb81ab34b, 0xbfe8de7c, 0xa3d0a592, 0x00000000 }, 0x458165dc },
+  { 3, { 0x80343d58, 0xb58aed33, 0x55c63afb, 0x00000000 },
+      { 0x5ecff723, 0xd53f119c, 0x531b108f, 0x00000000 }, 0x69702511 },
+  { 3, { 0xb8d1260e, 0x20f61b7c, 0xbb1316c7, 0x00000000 },
+      { 0xd970b8ba, 0xdc28f7b7, 0xc5289e42, 0x00000000 }, 0x52c4aa98 },
+  { 4, { 0xcf946260, 0xd7f29e1e, 0x26f58dc8, 0x2df2aeb0 },
+      { 0x3f411466, 0xb9266b74, 0x540edbc8, 0x3bc48908 }, 0x5196b9be },
+  { 2, { 0x42f478d7, 0x5ea6fd41, 0x00000000, 0x00000000 },
+      { 0x277bcf5c, 0x39241337, 0x00000000, 0x00000000 }, 0x58560d8d },
+  { 1, { 0xb67b2cf8, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xc14bc514, 0x00000000, 0x00000000, 0x00000000 }, 0x3847ee06 },
+  { 1, { 0x34a95d1b, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x5903d975, 0x00000000, 0x00000000, 0x00000000 }, 0x4e2e7504 },
+  { 1, { 0xa4789923, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xb582e4a4, 0x00000000, 0x00000000, 0x00000000 }, 0x1a7e3797 },
+  { 2, { 0xba195504, 0x497bb6a3, 0x00000000, 0x00000000 },
+      { 0x5480b05a, 0xac00d983, 0x00000000, 0x00000000 }, 0xcf1a2845 },
+  { 4, { 0xabad976b, 0x25e6bb9b, 0x2f2fbcb8, 0x3c3ef4fc },
+      { 0x5cdcdcba, 0xdad55473, 0x5afc673d, 0xc37f5ad6 }, 0x4a9a8c0c },
+  { 4, { 0x7f800000, 0x800d7b95, 0x584c9546, 0x00000000 },
+      { 0x3cb41bd2, 0x4fff005c, 0x80000000, 0x005be8e8 }, 0x7f800000 },
+  { 2, { 0xa46a5ba2, 0x4df8161d, 0x00000000, 0x00000000 },
+      { 0xc186d604, 0x3b01bdbf, 0x00000000, 0x00000000 }, 0x497b760c },
+  { 1, { 0xaa81269b, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x56ceb8ad, 0x00000000, 0x00000000, 0x00000000 }, 0xc1d09478 },
+  { 2, { 0xb38c799f, 0xd3295ffa, 0x00000000, 0x00000000 },
+      { 0xa6b04f85, 0x5be9bfbe, 0x00000000, 0x00000000 }, 0xef9aa737 },
+  { 1, { 0xc8cde64c, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x44b0a3b7, 0x00000000, 0x00000000, 0x00000000 }, 0xce0e1201 },
+  { 3, { 0x56cae6dd, 0xd76cd5f1, 0xb391417e, 0x00000000 },
+      { 0x4f6343de, 0xc6a5eca6, 0xab9498b3, 0x00000000 }, 0x66b4211a },
+  { 4, { 0x43b7b7c7, 0xb00e9880, 0xbd7fc468, 0x3a466e1e },
+      { 0xd68b9cff, 0xb0fee4ce, 0x4d3b014c, 0xd1318e04 }, 0xdac862e8 },
+  { 4, { 0x541a3886, 0xb3e7db94, 0xb0e25f12, 0x2730d4de },
+      { 0xc6ca5fe5, 0x202dded7, 0xace75808, 0xc6529ac3 }, 0xdb73d4bd },
+  { 3, { 0xdade8809, 0x80000000, 0x496ff5ed, 0x00000000 },
+      { 0xbdbdaa2c, 0x4b5797b7, 0x80000000, 0x00000000 }, 0x5924de5b },
+  { 3, { 0xcbf3bada, 0xb4980705, 0x369de50d, 0x00000000 },
+      { 0x8038796d, 0x4f67825f, 0xb0571eb4, 0x00000000 }, 0xc4897bc1 },
+  { 4, { 0x3a340368, 0x22ca472c, 0xa16aa668, 0xcd19b70d },
+      { 0x42c10b7b, 0xc2c366f7, 0xa310c60b, 0x513c6b7e }, 0xdee245f1 },
+  { 3, { 0x38f9f17e, 0x5aceeb0d, 0xdce13171, 0x00000000 },
+      { 0xb02b3e9a, 0x2d123538, 0x23e16834, 0x00000000 }, 0x486c570a },
+  { 1, { 0x23320bd1, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xb76fb076, 0x00000000, 0x00000000, 0x00000000 }, 0x9b26b3c2 },
+  { 4, { 0xc7040b1f, 0xc15bf10a, 0xc780bce5, 0x32ea931e },
+      { 0x26ff149f, 0xbac9f54d, 0x2738c535, 0xa45b0929 }, 0x3cad8301 },
+  { 1, { 0x80000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xcf57dfe8, 0x00000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 4, { 0x3c0dad86, 0xd55d1813, 0xcf556b45, 0x50235012 },
+      { 0xd73a1eb3, 0x3a7dc11f, 0xb7992b67, 0xcb06e483 }, 0xdbac1c30 },
+  { 4, { 0xa3485694, 0x33a6b86f, 0x314a1db3, 0xdbbb2b8f },
+      { 0xc22fc72f, 0x46bcbad6, 0x4daea90b, 0x247fc0b5 }, 0xc0987482 },
+  { 4, { 0x549f48c0, 0x48eb5571, 0xff800000, 0x0014fc89 },
+      { 0x80000000, 0x7f800000, 0x5d8da734, 0xc79beadf }, 0x7fc00000 },
+  { 2, { 0x2a455f4e, 0xd351a260, 0x00000000, 0x00000000 },
+      { 0xb291d372, 0x58f2264c, 0x00000000, 0x00000000 }, 0xecc64adb },
+  { 1, { 0x38e045b4, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x373a2c7f, 0x00000000, 0x00000000, 0x00000000 }, 0x30a319a0 },
+  { 4, { 0x80000000, 0x0076bd28, 0xa586bd7d, 0xae6df845 },
+      { 0x30163595, 0x00000000, 0xa770624a, 0x4c3a7845 }, 0xbb2d562f },
+  { 2, { 0xb66874c6, 0xd25a93ae, 0x00000000, 0x00000000 },
+      { 0xa89330e5, 0x29b9dbd8, 0x00000000, 0x00000000 }, 0xbc9eb06e },
+  { 2, { 0xa7e127e0, 0x45da5332, 0x00000000, 0x00000000 },
+      { 0x2c7754a1, 0xab136ca1, 0x00000000, 0x00000000 }, 0xb17b74d4 },
+  { 3, { 0x5a08a172, 0xc6443d34, 0x47a2ee31, 0x00000000 },
+      { 0xb2224cfc, 0xdede8817, 0xc2553dfa, 0x00000000 }, 0x65aa9565 },
+  { 1, { 0x565ba7a4, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xb182e168, 0x00000000, 0x00000000, 0x00000000 }, 0xc8609912 },
+  { 4, { 0x804a913e, 0x315f8bfd, 0x58815ea7, 0x00000000 },
+      { 0x30a0b5ae, 0x3ee43597, 0x3330d659, 0xff800000 }, 0x7fc00000 },
+  { 1, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+      { 0x580f4449, 0x00000000, 0x00000000, 0x00000000 }, 0x00000000 },
+  { 2, { 0xc2e86a01, 0x00317c4f, 0x00000000, 0x00000000 },
+      { 0x21ba490f, 0x3001f648, 0x00000000, 0x00000000 }, 0xa5291f59 },
+  { 4, { 0xba186e60, 0xcfe58a6e, 0x228885b0, 0xcb0ac022 },
+      { 0xbf9542a7, 0xbb2148aa, 0x80175600, 0xb73239de }, 0x4b909d67 },
+  { 2, { 0xc889d843, 0x532ad424, 0x00000000, 0x00000000 },
+      { 0xd70c7d3d, 0x80000000, 0x00000000, 0x00000000 }, 0x60174b68 },
+  { 1, { 0x5bb96758, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xa323ba35, 0x00000000, 0x00000000, 0x00000000 }, 0xbf6d2751 },
+  { 1, { 0x57cd4c2e, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xbe5633f3, 0x00000000, 0x00000000, 0x00000000 }, 0xd6abc758 },
+  { 4, { 0xdab95266, 0xd73c20c4, 0x5d1e6077, 0x30a62a64 },
+      { 0x2faa9ffe, 0x2e3451af, 0xad356016, 0x2dbc4470 }, 0xcb6bdb50 },
+  { 4, { 0x000ac651, 0x8070fefc, 0x3600f7de, 0x7f800000 },
+      { 0xff800000, 0xc6800e45, 0x33eaa92e, 0x3b411005 }, 0x7fc00000 },
+  { 4, { 0x25f02815, 0x563b4d1f, 0xadc81c69, 0xcf29c433 },
+      { 0xd1267093, 0x5104cdcf, 0xcdfab5e7, 0xd8c64d24 }, 0x68b41613 },
+  { 3, { 0x80000000, 0xb15bf033, 0x7f800000, 0x00000000 },
+      { 0x2e01e7e4, 0xb3b9f48a, 0x3d803545, 0x00000000 }, 0x7f800000 },
+  { 4, { 0xb18cf72b, 0xddbe407f, 0xd8faa0d2, 0xb2c11fdf },
+      { 0xa5ae1359, 0xa2fc0253, 0x55202dfc, 0xd1b05b9f }, 0xee9cd188 },
+  { 4, { 0xd3836a1e, 0x50bb03b3, 0x58b8dfa3, 0xc0fb08eb },
+      { 0x4ff62f28, 0x3afe30fe, 0x27ed1d72, 0xcbf1ee98 }, 0xe3fcc05c },
+  { 3, { 0xa3a8f7de, 0xd706042a, 0x2fa751ef, 0x00000000 },
+      { 0xb4ca864a, 0xc4d5cd61, 0xb47abac9, 0x00000000 }, 0x5c5fd9f6 },
+  { 2, { 0xcb390362, 0x20ab81ff, 0x00000000, 0x00000000 },
+      { 0xb2760560, 0xaa8e9fcb, 0x00000000, 0x00000000 }, 0x3e31cd23 },
+  { 3, { 0x3d47f6d8, 0xcda928d8, 0x80000000, 0x00000000 },
+      { 0x317cc689, 0x20cbf33f, 0x7f800000, 0x00000000 }, 0x7fc00000 },
+  { 1, { 0x5064354c, 0x00000000, 0x00000000, 0x00000000 },
+      { 0xa031b22e, 0x00000000, 0x00000000, 0x00000000 }, 0xb11e67b0 },
+
+  // Tests that do depend on Arm NaN policy
+  { 2, { 0x7fc00000, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0x3f800000, 0x7f800001, 0x00000000, 0x00000000 }, 0x7fc00000 },
+  { 2, { 0x3f800000, 0xffa00000, 0x00000000, 0x00000000 },
+      { 0x7fc12345, 0x3f800000, 0x00000000, 0x00000000 }, 0x7fc12345 },
+};
+
+// Tests where an addition cancels most of a product or partial sum that was
+// rounded to odd at 32 bits, so that the output is far from the correctly
+// rounded dot product. These are checked against their expected output like
+// the tests above, and also against the error bound in fp/README.md: the
+// error is at most 2^-31 times the sum of the magnitudes of all the products
+// and partial sums, plus the final rounding to single precision. For these
+// inputs, every product and partial sum is exact in double precision, so the
+// test can compute the bound and the exact answer directly.
+static const struct test cancel_tests[] = {
+  // 2^40 + 1 - 2^40: the 1 is rounded into the low bit of 2^40's mantissa,
+  // which is worth 2^9.
+  { 3, { 0x53800000, 0x3f800000, 0xd3800000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x3f800000, 0x00000000 }, 0x44000000 },
+  // 2^40 + 1 + 1 - 2^40: the second 1 is lost entirely.
+  { 4, { 0x53800000, 0x3f800000, 0x3f800000, 0xd3800000 },
+      { 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000 }, 0x44000000 },
+  // 1 + 2^-40 - 1, the same at the other end of the range.
+  { 3, { 0x3f800000, 0x2b800000, 0xbf800000, 0x00000000 },
+      { 0x3f800000, 0x3f800000, 0x3f800000, 0x00000000 }, 0x30000000 },
+  // (1+2^-23)^2 - (1+2^-22): the rounding of the first product is what
+  // survives.
+  { 2, { 0x3f800001, 0x3f800002, 0x00000000, 0x00000000 },
+      { 0x3f800001, 0xbf800000, 0x00000000, 0x00000000 }, 0x30000000 },
+  { 2, { 0x3f800001, 0x3f800000, 0x00000000, 0x00000000 },
+      { 0x3f800001, 0xbf800001, 0x00000000, 0x00000000 }, 0x34008000 },
+};
+
+static double
+fval (uint32_t bits)
+{
+  float f;
+  memcpy (&f, &bits, sizeof (f));
+  return f;
+}
+
+static double
+dabs (double d)
+{
+  return d < 0 ? -d : d;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint32_t arm_fp_fdot(const uint32_t *, const uint32_t *, size_t);
+      uint32_t outbits = arm_fp_fdot(t->x, t->y, t->n);
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: test %zu: fdot -> %08" PRIx32 ", expected %08" PRIx32
+		  "\n", i, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  for (size_t i = 0; i < sizeof (cancel_tests) / sizeof (cancel_tests[0]);
+       i++)
+    {
+      const struct test *t = &cancel_tests[i];
+
+      extern uint32_t arm_fp_fdot(const uint32_t *, const uint32_t *, size_t);
+      uint32_t outbits = arm_fp_fdot(t->x, t->y, t->n);
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: cancellation test %zu: fdot -> %08" PRIx32
+		  ", expected %08" PRIx32 "\n", i, outbits, t->out);
+	  failed = true;
+	}
+
+      double sum = 0, magnitudes = 0;
+      for (size_t j = 0; j < t->n; j++)
+	{
+	  double product = fval (t->x[j]) * fval (t->y[j]);
+	  sum += product;
+	  magnitudes += dabs (product) + dabs (sum);
+	}
+      double out = fval (outbits);
+      double bound = magnitudes * 0x1p-31 + dabs (out) * 0x1p-24;
+      if (dabs (out - sum) > bound)
+	{
+	  printf ("FAIL: cancellation test %zu: fdot -> %08" PRIx32
+		  ", error %a exceeds bound %a\n", i, outbits, out - sum,
+		  bound);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
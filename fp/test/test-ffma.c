@@ -0,0 +1,281 @@
+/*
+ * Tests of IEEE 754 single-precision fused multiply-add
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in1, in2, in3, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x3f800000, 0x3f800000, 0x3f800000, 0x40000000 },
+  { 0x40000000, 0x40400000, 0x3f800000, 0x40e00000 },
+  { 0x40400000, 0x40400000, 0xc1000000, 0x3f800000 },
+  { 0x3f800000, 0x3f800000, 0xbf800000, 0x00000000 },
+  { 0xbf800000, 0x3f800000, 0x3f800000, 0x00000000 },
+  { 0x00000000, 0x3f800000, 0x00000000, 0x00000000 },
+  { 0x3f800000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x3f800000, 0x80000000, 0x00000000 },
+  { 0x3f800000, 0x00000000, 0x80000000, 0x00000000 },
+  { 0x00000000, 0xbf800000, 0x00000000, 0x00000000 },
+  { 0x3f800000, 0x80000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0xbf800000, 0x80000000, 0x80000000 },
+  { 0x3f800000, 0x80000000, 0x80000000, 0x80000000 },
+  { 0x80000000, 0x3f800000, 0x00000000, 0x00000000 },
+  { 0xbf800000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x80000000, 0x3f800000, 0x80000000, 0x80000000 },
+  { 0xbf800000, 0x00000000, 0x80000000, 0x80000000 },
+  { 0x80000000, 0xbf800000, 0x00000000, 0x00000000 },
+  { 0xbf800000, 0x80000000, 0x00000000, 0x00000000 },
+  { 0x80000000, 0xbf800000, 0x80000000, 0x00000000 },
+  { 0xbf800000, 0x80000000, 0x80000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x80000000, 0x00000000 },
+  { 0x80000000, 0x00000000, 0x80000000, 0x80000000 },
+  { 0x00000000, 0x7f7fffff, 0x40400000, 0x40400000 },
+  { 0x80000000, 0x00000001, 0xbf800005, 0xbf800005 },
+  { 0x40400000, 0x40000000, 0x00000000, 0x40c00000 },
+  { 0x40400000, 0x40000000, 0x80000000, 0x40c00000 },
+  { 0xc1800007, 0x00000001, 0x80000000, 0x80000010 },
+  { 0x7f800000, 0x40000000, 0x3f800000, 0x7f800000 },
+  { 0xff800000, 0x40000000, 0x3f800000, 0xff800000 },
+  { 0x7f800000, 0xbf800000, 0x7f7fffff, 0xff800000 },
+  { 0x40000000, 0x7f800000, 0x7f800000, 0x7f800000 },
+  { 0x7f800000, 0x7f800000, 0x7f800000, 0x7f800000 },
+  { 0x3f800000, 0x40000000, 0x7f800000, 0x7f800000 },
+  { 0x3f800000, 0x40000000, 0xff800000, 0xff800000 },
+  { 0x00000000, 0x40000000, 0xff800000, 0xff800000 },
+  { 0x7f7fffff, 0x7f7fffff, 0xff800000, 0xff800000 },
+  { 0x00000001, 0x00000001, 0x7f800000, 0x7f800000 },
+  { 0x3f800001, 0x3f800001, 0xbf800002, 0x28800000 },
+  { 0x3f800001, 0xbf800001, 0x3f800002, 0xa8800000 },
+  { 0x3fffffff, 0x3fffffff, 0xc07ffffe, 0x28800000 },
+  { 0x49f41a02, 0x35803039, 0xbf800000, 0x3f68ebf1 },
+  { 0xb50c32b6, 0x4b339663, 0x40c4b3a2, 0xb4410188 },
+  { 0xb6480221, 0xaf1c5e3b, 0xa5f455d5, 0x19f93736 },
+  { 0x2f54b44f, 0x46668137, 0xb63f855c, 0xa9eee80e },
+  { 0xba36ac75, 0x450d44aa, 0x3fc99bf6, 0xb40e99b2 },
+  { 0xaf4fe5bc, 0xac1615ea, 0x9bf3c4d0, 0x0e069d80 },
+  { 0xcbcbdbd7, 0x4172d755, 0x4dc1614b, 0x4160e13a },
+  { 0xb464d77f, 0x48217869, 0x3d10572b, 0x31a08a74 },
+  { 0x3e79cbe2, 0x3f895a8d, 0xbe860677, 0x31d2fde8 },
+  { 0x49e77732, 0x47e3537e, 0xd24d8a2f, 0xc4c0fb20 },
+  { 0x346bc5ea, 0xb3cfa0c1, 0x28bf3917, 0x1d2bc54b },
+  { 0xbd13dfdc, 0x38583cc0, 0x35f9cff1, 0xa9feea00 },
+  { 0x34253d6b, 0x442f82a4, 0xb8e2929f, 0xac9ea2e8 },
+  { 0x3d0ad171, 0x3f3b1fb8, 0x34897a56, 0x3ccaf0eb },
+  { 0xc245631b, 0x3be4556a, 0xba099d86, 0xbeb052ee },
+  { 0x3cd6048b, 0xc1ef4a18, 0x379fc96a, 0xbf480af0 },
+  { 0x42f32308, 0x42c5ddd5, 0xc37e7c57, 0x4637f2b3 },
+  { 0x42f7d7d1, 0xc21631ce, 0x4543cf1d, 0xc4be0477 },
+  { 0xbf0d8779, 0xbf7f0105, 0x3875aa9c, 0x3f0cfe58 },
+  { 0x4031be94, 0xc13f0c82, 0xbe148bd2, 0xc2053a6b },
+  { 0x3e58de79, 0xc0f0dd30, 0x3c4ccfce, 0xbfca7253 },
+  { 0x3d9062c1, 0xc2411c65, 0xbd746833, 0xc05da68f },
+  { 0x3fe75d32, 0xc15034e2, 0xc06f023d, 0xc1da0bcb },
+  { 0xc2850406, 0x3d08d8c2, 0x3fe42430, 0xbee11b76 },
+  { 0xbcc5c130, 0x40989ea7, 0xbd4d4598, 0xbe2936a9 },
+  { 0xbe662d8e, 0x3c60d1b2, 0x3b7ec95d, 0x3a5293d6 },
+  { 0xc32d84f6, 0xbfb9d634, 0xba1289de, 0x437bec68 },
+  { 0xc26176d0, 0xc0eceeb7, 0xb794333e, 0x43d0abc5 },
+  { 0xbdb94c5c, 0xbf47f9d4, 0x340b7dea, 0x3d90bf42 },
+  { 0x3f800000, 0x3f800000, 0x33800000, 0x3f800000 },
+  { 0x3f800001, 0x3f800000, 0x33800000, 0x3f800002 },
+  { 0x3f800000, 0x3f800000, 0xb3000000, 0x3f800000 },
+  { 0x3f800001, 0x3f800000, 0xb3000000, 0x3f800001 },
+  { 0x3f800001, 0x33800000, 0x3f800000, 0x3f800001 },
+  { 0x33800001, 0x3f800000, 0x3f800000, 0x3f800001 },
+  { 0xb3800001, 0x3f800000, 0x3f800000, 0x3f7fffff },
+  { 0x33800001, 0xbf800000, 0x3f800001, 0x3f800000 },
+  { 0x00000001, 0x00000001, 0x3f800000, 0x3f800000 },
+  { 0x00000001, 0x80000001, 0x3f800000, 0x3f800000 },
+  { 0x00000001, 0x80000001, 0x00800000, 0x00800000 },
+  { 0x3f800000, 0x3f800000, 0x00000001, 0x3f800000 },
+  { 0x3f800000, 0x3f800000, 0x80000001, 0x3f800000 },
+  { 0x7f7fffff, 0x3f800000, 0x80800003, 0x7f7fffff },
+  { 0x5d800000, 0x5d800000, 0xa1800000, 0x7b800000 },
+  { 0x3f8bcf68, 0xbfc83973, 0xbe7b2caa, 0xbffa1868 },
+  { 0xbfec1f96, 0x3fe737ad, 0xc6502167, 0xc6502ebb },
+  { 0xbfe899ac, 0x3fe4f318, 0x3df38e87, 0xc0486949 },
+  { 0x3fdc5108, 0xbfde3a7d, 0xa3d3027b, 0xc03f409b },
+  { 0x3fec16d5, 0xbfc3140f, 0xb2fb06c4, 0xc033e7e4 },
+  { 0xbf9efcaa, 0x3fa84c44, 0x304af3c7, 0xbfd10a5a },
+  { 0xbf945a25, 0x3fa74726, 0x4e87d828, 0x4e87d828 },
+  { 0xbfb53290, 0x3fd5484c, 0xc99d6e3f, 0xc99d6e52 },
+  { 0x7f7fffff, 0x40000000, 0xff7fffff, 0x7f7fffff },
+  { 0x7f7fffff, 0x40000000, 0xfe800000, 0x7f800000 },
+  { 0x7f7fffff, 0x7f7fffff, 0x3f800000, 0x7f800000 },
+  { 0x7f7fffff, 0xc0000000, 0x7f000000, 0xff800000 },
+  { 0x7f7fffff, 0x3f800000, 0x7f7fffff, 0x7f800000 },
+  { 0x7f7fffff, 0x3f800001, 0xf3800000, 0x7f800000 },
+  { 0x7f7fffff, 0x3f800000, 0x73000000, 0x7f800000 },
+  { 0x7f7fffff, 0x3f800000, 0x73000001, 0x7f800000 },
+  { 0x00800000, 0x3f000000, 0x00000000, 0x00400000 },
+  { 0x00800000, 0x3f000000, 0x80000000, 0x00400000 },
+  { 0x80800001, 0x3f000000, 0x00000000, 0x80400000 },
+  { 0x00800000, 0x00800000, 0x00000000, 0x00000000 },
+  { 0x00800000, 0x00800000, 0x80000000, 0x00000000 },
+  { 0x00800000, 0x00800000, 0x00000001, 0x00000001 },
+  { 0x00800000, 0x00800000, 0x80000001, 0x80000001 },
+  { 0x00000001, 0x3f000000, 0x00000000, 0x00000000 },
+  { 0x00000003, 0x3f000000, 0x00000000, 0x00000002 },
+  { 0x00000003, 0x3f000000, 0x80000000, 0x00000002 },
+  { 0x007fffff, 0x3f800000, 0x00000001, 0x00800000 },
+  { 0x00800000, 0x3f800000, 0x80000001, 0x007fffff },
+  { 0x00800000, 0x3f800001, 0x80800000, 0x00000001 },
+  { 0x34000000, 0x00800000, 0x00000001, 0x00000002 },
+  { 0x33800000, 0x00800000, 0x00000000, 0x00000000 },
+  { 0x33800001, 0x00800000, 0x00000000, 0x00000001 },
+  { 0x33800000, 0x00800000, 0x00000001, 0x00000002 },
+  { 0x4b000000, 0x00000001, 0x80800000, 0x00000000 },
+  { 0x83630195, 0xb25f2111, 0x8017ad2f, 0x8017ad29 },
+  { 0x030648a6, 0x3b38c5ba, 0x00587866, 0x006495e4 },
+  { 0x0a0fb0b4, 0x3c54900b, 0x805a0a47, 0x06ee98bd },
+  { 0x89d842cc, 0xb4d12912, 0x0164e286, 0x016fed9a },
+  { 0x8c7dff23, 0x325a5919, 0x0141ba00, 0x01342fc5 },
+  { 0x02828be4, 0xb441b061, 0x807f7725, 0x807f773e },
+  { 0x0442438a, 0xb810947a, 0x80cf6f9f, 0x80d04b0c },
+  { 0x88c3551f, 0xb58f043e, 0x01e48a94, 0x01e7f392 },
+  { 0x007fffff, 0x4b000000, 0x3f800000, 0x3f800000 },
+  { 0x00000001, 0x7e800000, 0xbf800000, 0xbf7ffffe },
+  { 0x71800000, 0x00003039, 0x00000001, 0x2dc0e400 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7f800000, 0x00000000, 0x3f800000, 0x7fc00000 },
+  { 0x00000000, 0xff800000, 0x3f800000, 0x7fc00000 },
+  { 0x80000000, 0x7f800000, 0xff800000, 0x7fc00000 },
+  { 0x7f800000, 0x3f800000, 0xff800000, 0x7fc00000 },
+  { 0xff800000, 0xbf800000, 0xff800000, 0x7fc00000 },
+  { 0x7f7fffff, 0x7f7fffff, 0xff800000, 0xff800000 },
+  { 0x7f800000, 0x7f800000, 0xff800000, 0x7fc00000 },
+  { 0x3f800000, 0x3f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x3f800000, 0x3f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x3f800000, 0x00000000, 0x7fc09abc, 0x7fc09abc },
+  { 0x3f800000, 0x00000000, 0xff80cba9, 0xffc0cba9 },
+  { 0x3f800000, 0x7f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x3f800000, 0x7f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x3f800000, 0xffc05678, 0x3f800000, 0xffc05678 },
+  { 0x3f800000, 0xffc05678, 0x7fc09abc, 0x7fc09abc },
+  { 0x3f800000, 0xffc05678, 0xff80cba9, 0xffc0cba9 },
+  { 0x3f800000, 0x7f808765, 0x3f800000, 0x7fc08765 },
+  { 0x3f800000, 0x7f808765, 0x7fc09abc, 0x7fc08765 },
+  { 0x3f800000, 0x7f808765, 0xff80cba9, 0xffc0cba9 },
+  { 0x00000000, 0x3f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x00000000, 0x3f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x00000000, 0x00000000, 0x7fc09abc, 0x7fc09abc },
+  { 0x00000000, 0x00000000, 0xff80cba9, 0xffc0cba9 },
+  { 0x00000000, 0x7f800000, 0x7fc09abc, 0x7fc00000 },
+  { 0x00000000, 0x7f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x00000000, 0xffc05678, 0x3f800000, 0xffc05678 },
+  { 0x00000000, 0xffc05678, 0x7fc09abc, 0x7fc09abc },
+  { 0x00000000, 0xffc05678, 0xff80cba9, 0xffc0cba9 },
+  { 0x00000000, 0x7f808765, 0x3f800000, 0x7fc08765 },
+  { 0x00000000, 0x7f808765, 0x7fc09abc, 0x7fc08765 },
+  { 0x00000000, 0x7f808765, 0xff80cba9, 0xffc0cba9 },
+  { 0x7f800000, 0x3f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x7f800000, 0x3f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7f800000, 0x00000000, 0x7fc09abc, 0x7fc00000 },
+  { 0x7f800000, 0x00000000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7f800000, 0x7f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x7f800000, 0x7f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7f800000, 0xffc05678, 0x3f800000, 0xffc05678 },
+  { 0x7f800000, 0xffc05678, 0x7fc09abc, 0x7fc09abc },
+  { 0x7f800000, 0xffc05678, 0xff80cba9, 0xffc0cba9 },
+  { 0x7f800000, 0x7f808765, 0x3f800000, 0x7fc08765 },
+  { 0x7f800000, 0x7f808765, 0x7fc09abc, 0x7fc08765 },
+  { 0x7f800000, 0x7f808765, 0xff80cba9, 0xffc0cba9 },
+  { 0x7fc01234, 0x3f800000, 0x3f800000, 0x7fc01234 },
+  { 0x7fc01234, 0x3f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x7fc01234, 0x3f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7fc01234, 0x00000000, 0x3f800000, 0x7fc01234 },
+  { 0x7fc01234, 0x00000000, 0x7fc09abc, 0x7fc09abc },
+  { 0x7fc01234, 0x00000000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7fc01234, 0x7f800000, 0x3f800000, 0x7fc01234 },
+  { 0x7fc01234, 0x7f800000, 0x7fc09abc, 0x7fc09abc },
+  { 0x7fc01234, 0x7f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0x7fc01234, 0xffc05678, 0x3f800000, 0x7fc01234 },
+  { 0x7fc01234, 0xffc05678, 0x7fc09abc, 0x7fc09abc },
+  { 0x7fc01234, 0xffc05678, 0xff80cba9, 0xffc0cba9 },
+  { 0x7fc01234, 0x7f808765, 0x3f800000, 0x7fc08765 },
+  { 0x7fc01234, 0x7f808765, 0x7fc09abc, 0x7fc08765 },
+  { 0x7fc01234, 0x7f808765, 0xff80cba9, 0xffc0cba9 },
+  { 0xff804321, 0x3f800000, 0x3f800000, 0xffc04321 },
+  { 0xff804321, 0x3f800000, 0x7fc09abc, 0xffc04321 },
+  { 0xff804321, 0x3f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0xff804321, 0x00000000, 0x3f800000, 0xffc04321 },
+  { 0xff804321, 0x00000000, 0x7fc09abc, 0xffc04321 },
+  { 0xff804321, 0x00000000, 0xff80cba9, 0xffc0cba9 },
+  { 0xff804321, 0x7f800000, 0x3f800000, 0xffc04321 },
+  { 0xff804321, 0x7f800000, 0x7fc09abc, 0xffc04321 },
+  { 0xff804321, 0x7f800000, 0xff80cba9, 0xffc0cba9 },
+  { 0xff804321, 0xffc05678, 0x3f800000, 0xffc04321 },
+  { 0xff804321, 0xffc05678, 0x7fc09abc, 0xffc04321 },
+  { 0xff804321, 0xffc05678, 0xff80cba9, 0xffc0cba9 },
+  { 0xff804321, 0x7f808765, 0x3f800000, 0xffc04321 },
+  { 0xff804321, 0x7f808765, 0x7fc09abc, 0xffc04321 },
+  { 0xff804321, 0x7f808765, 0xff80cba9, 0xffc0cba9 },
+};
+
+float
+make_float (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_float (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in float
+       * arithmetic, instead of calling arm_fp_ffma. */
+      float in1 = make_float (t->in1);
+      float in2 = make_float (t->in2);
+      float in3 = make_float (t->in3);
+      float out = fmaf (in1, in2, in3);
+      uint32_t outbits = unmake_float (out);
+#else
+      extern uint32_t arm_fp_ffma(uint32_t, uint32_t, uint32_t);
+      uint32_t outbits = arm_fp_ffma(t->in1, t->in2, t->in3);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: ffma(%08" PRIx32 ", %08" PRIx32 ", %08" PRIx32
+		  ") -> %08" PRIx32 ", expected %08" PRIx32 "\n",
+		  t->in1, t->in2, t->in3, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,249 @@
+/*
+ * Tests of conversion from the unpacked-operand format to single precision
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct test
+{
+  uint64_t in;
+  uint32_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000000000000000, 0x00000000 },
+  { 0x2fffffea80000000, 0x00000001 },
+  { 0x2fffffeb80000000, 0x00000002 },
+  { 0x2fffffebc0000000, 0x00000003 },
+  { 0x2fffffeca0000000, 0x00000005 },
+  { 0x2fffffed90000000, 0x00000009 },
+  { 0x2fffffee88000000, 0x00000011 },
+  { 0x2fffffef84000000, 0x00000021 },
+  { 0x2ffffff082000000, 0x00000041 },
+  { 0x2ffffff181000000, 0x00000081 },
+  { 0x2ffffff280800000, 0x00000101 },
+  { 0x2ffffff380400000, 0x00000201 },
+  { 0x2ffffff480200000, 0x00000401 },
+  { 0x2ffffff580100000, 0x00000801 },
+  { 0x2ffffff680080000, 0x00001001 },
+  { 0x2ffffff780040000, 0x00002001 },
+  { 0x2ffffff880020000, 0x00004001 },
+  { 0x2ffffff980010000, 0x00008001 },
+  { 0x2ffffffa80008000, 0x00010001 },
+  { 0x2ffffffa91a28000, 0x00012345 },
+  { 0x2ffffffb80004000, 0x00020001 },
+  { 0x2ffffffc80002000, 0x00040001 },
+  { 0x2ffffffd80001000, 0x00080001 },
+  { 0x2ffffffe80000800, 0x00100001 },
+  { 0x2fffffff80000400, 0x00200001 },
+  { 0x3000000080000000, 0x00400000 },
+  { 0x3000000080000200, 0x00400001 },
+  { 0x30000000fffffe00, 0x007fffff },
+  { 0x3000000180000000, 0x00800000 },
+  { 0x3000000180000100, 0x00800001 },
+  { 0x30000001ffffff00, 0x00ffffff },
+  { 0x3000000280000100, 0x01000001 },
+  { 0x3000004080000100, 0x20000001 },
+  { 0x3000004ce9eb5400, 0x2669eb54 },
+  { 0x3000005bbb72f700, 0x2dbb72f7 },
+  { 0x3000006080000100, 0x30000001 },
+  { 0x30000076893b4b00, 0x3b093b4b },
+  { 0x3000007f80000000, 0x3f800000 },
+  { 0x30000080c90fdb00, 0x40490fdb },
+  { 0x30000088b6f76800, 0x4436f768 },
+  { 0x3000008ef37a1200, 0x47737a12 },
+  { 0x30000091c6528e00, 0x48c6528e },
+  { 0x300000978055fa00, 0x4b8055fa },
+  { 0x300000bbfd12f900, 0x5dfd12f9 },
+  { 0x300000c5ee48af00, 0x62ee48af },
+  { 0x300000c9a5d85c00, 0x64a5d85c },
+  { 0x300000ceee5e6500, 0x676e5e65 },
+  { 0x300000cfc851c700, 0x67c851c7 },
+  { 0x300000cfd5288f00, 0x67d5288f },
+  { 0x300000ddb4882900, 0x6eb48829 },
+  { 0x300000de84840c00, 0x6f04840c },
+  { 0x300000fe80000000, 0x7f000000 },
+  { 0x300000feffffff00, 0x7f7fffff },
+  { 0x7fffffff00000000, 0x7f800000 },
+  { 0x8000000000000000, 0x80000000 },
+  { 0xafffffea80000000, 0x80000001 },
+  { 0xafffffeb80000000, 0x80000002 },
+  { 0xafffffebc0000000, 0x80000003 },
+  { 0xaffffffffffffc00, 0x803fffff },
+  { 0xb000000080000000, 0x80400000 },
+  { 0xb0000000fffffe00, 0x807fffff },
+  { 0xb000000180000000, 0x80800000 },
+  { 0xb000002b9f34bb00, 0x959f34bb },
+  { 0xb0000051f7297c00, 0xa8f7297c },
+  { 0xb000007f80000100, 0xbf800001 },
+  { 0xb0000088839d4100, 0xc4039d41 },
+  { 0xb0000095ba3d5d00, 0xcaba3d5d },
+  { 0xb00000dfaac84500, 0xefaac845 },
+  { 0xb00000fe80000000, 0xff000000 },
+  { 0xb00000feffffff00, 0xff7fffff },
+  { 0xffffffff00000000, 0xff800000 },
+  { 0xb00000fe80000080, 0xff000000 },
+  { 0x300000feffffff7f, 0x7f7fffff },
+  { 0x300000feffffff80, 0x7f800000 },
+  { 0xb00000fec0000000, 0xff400000 },
+  { 0x300000fe80000001, 0x7f000000 },
+  { 0x300000ff80000000, 0x7f800000 },
+  { 0x300000ff80000080, 0x7f800000 },
+  { 0xb00000ffffffff80, 0xff800000 },
+  { 0xb00000ffc0000000, 0xff800000 },
+  { 0xb00000ff80000001, 0xff800000 },
+  { 0xb000010080000000, 0xff800000 },
+  { 0x3000010080000080, 0x7f800000 },
+  { 0x3000010080000081, 0x7f800000 },
+  { 0xb000010080000180, 0xff800000 },
+  { 0xb0000100ffffff80, 0xff800000 },
+  { 0xb0000100ffffffff, 0xff800000 },
+  { 0xb0000100c0000000, 0xff800000 },
+  { 0xb000000180000000, 0x80800000 },
+  { 0xb000000180000080, 0x80800000 },
+  { 0x3000000180000081, 0x00800001 },
+  { 0xb000000180000180, 0x80800002 },
+  { 0xb0000001ffffff7f, 0x80ffffff },
+  { 0x30000001ffffff80, 0x01000000 },
+  { 0xb0000001ffffffff, 0x81000000 },
+  { 0x30000001c0000000, 0x00c00000 },
+  { 0x3000000080000080, 0x00400000 },
+  { 0x3000000080000081, 0x00400000 },
+  { 0x30000000ffffff80, 0x00800000 },
+  { 0xb0000000ffffffff, 0x80800000 },
+  { 0x30000000c0000000, 0x00600000 },
+  { 0x3000000080000001, 0x00400000 },
+  { 0xafffffff80000080, 0x80200000 },
+  { 0xafffffff80000081, 0x80200000 },
+  { 0xafffffffffffff7f, 0x80400000 },
+  { 0xafffffffffffff80, 0x80400000 },
+  { 0x2fffffffffffffff, 0x00400000 },
+  { 0xafffffffc0000000, 0x80300000 },
+  { 0x2fffffeb80000000, 0x00000002 },
+  { 0xafffffeb80000080, 0x80000002 },
+  { 0x2fffffebffffff80, 0x00000004 },
+  { 0x2fffffebc0000000, 0x00000003 },
+  { 0x2fffffeb80000001, 0x00000002 },
+  { 0xafffffea80000080, 0x80000001 },
+  { 0xafffffeaffffff80, 0x80000002 },
+  { 0xafffffeac0000000, 0x80000002 },
+  { 0xafffffe980000080, 0x80000001 },
+  { 0xafffffe980000081, 0x80000001 },
+  { 0x2fffffe9ffffff80, 0x00000001 },
+  { 0xafffffe9c0000000, 0x80000001 },
+  { 0x2fffffe980000001, 0x00000001 },
+  { 0xafffffe880000000, 0x80000000 },
+  { 0xafffffe880000080, 0x80000000 },
+  { 0xafffffe880000081, 0x80000000 },
+  { 0xafffffe8ffffff7f, 0x80000000 },
+  { 0xafffffe8ffffff80, 0x80000000 },
+  { 0x2fffffe8ffffffff, 0x00000000 },
+  { 0xafffffe8c0000000, 0x80000000 },
+  { 0xafffffe780000080, 0x80000000 },
+  { 0x2fffffe7ffffff80, 0x00000000 },
+  { 0xafffffe7c0000000, 0x80000000 },
+  { 0x2fffff9c80000000, 0x00000000 },
+  { 0xafffff9c80000080, 0x80000000 },
+  { 0xafffff9c80000180, 0x80000000 },
+  { 0xafffff9cffffff80, 0x80000000 },
+  { 0xafffff9cffffffff, 0x80000000 },
+  { 0xafffff9cc0000000, 0x80000000 },
+  { 0x2fffffeac0000000, 0x00000002 },
+  { 0xafffffeac0000000, 0x80000002 },
+  { 0x2fffffeba0000000, 0x00000002 },
+  { 0xafffffebe0000000, 0x80000004 },
+  { 0x2fffffec90000000, 0x00000004 },
+  { 0xafffffecb0000000, 0x80000006 },
+  { 0x2fffffed88000000, 0x00000008 },
+  { 0xafffffed98000000, 0x8000000a },
+  { 0x2fffffee84000000, 0x00000010 },
+  { 0xafffffee8c000000, 0x80000012 },
+  { 0x2fffffef82000000, 0x00000020 },
+  { 0xafffffef86000000, 0x80000022 },
+  { 0x2ffffff081000000, 0x00000040 },
+  { 0xaffffff083000000, 0x80000042 },
+  { 0x2ffffff180800000, 0x00000080 },
+  { 0xaffffff181800000, 0x80000082 },
+  { 0x2ffffff280400000, 0x00000100 },
+  { 0xaffffff280c00000, 0x80000102 },
+  { 0x2ffffff380200000, 0x00000200 },
+  { 0xaffffff380600000, 0x80000202 },
+  { 0x2ffffff480100000, 0x00000400 },
+  { 0xaffffff480300000, 0x80000402 },
+  { 0x2ffffff580080000, 0x00000800 },
+  { 0xaffffff580180000, 0x80000802 },
+  { 0x2ffffff680040000, 0x00001000 },
+  { 0xaffffff6800c0000, 0x80001002 },
+  { 0x2ffffff780020000, 0x00002000 },
+  { 0xaffffff780060000, 0x80002002 },
+  { 0x2ffffff880010000, 0x00004000 },
+  { 0xaffffff880030000, 0x80004002 },
+  { 0x2ffffff980008000, 0x00008000 },
+  { 0xaffffff980018000, 0x80008002 },
+  { 0x2ffffffa80004000, 0x00010000 },
+  { 0xaffffffa8000c000, 0x80010002 },
+  { 0x2ffffffb80002000, 0x00020000 },
+  { 0xaffffffb80006000, 0x80020002 },
+  { 0x2ffffffc80001000, 0x00040000 },
+  { 0xaffffffc80003000, 0x80040002 },
+  { 0x2ffffffd80000800, 0x00080000 },
+  { 0xaffffffd80001800, 0x80080002 },
+  { 0x2ffffffe80000400, 0x00100000 },
+  { 0xaffffffe80000c00, 0x80100002 },
+  { 0x2fffffff80000200, 0x00200000 },
+  { 0xafffffff80000600, 0x80200002 },
+  { 0x3000000080000100, 0x00400000 },
+  { 0xb000000080000300, 0x80400002 },
+  { 0x3000000180000080, 0x00800000 },
+  { 0xb000000180000180, 0x80800002 },
+  { 0x3fffffffffffffff, 0x7f800000 },
+  { 0xa000000080000000, 0x80000000 },
+  { 0x1000000080000000, 0x00000000 },
+  { 0xd000000080000000, 0xff800000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7fffffff00000200, 0x7f800001 },
+  { 0x7fffffff5ea76200, 0x7faf53b1 },
+  { 0x7fffffff7ffffe00, 0x7fbfffff },
+  { 0x7fffffff80000000, 0x7fc00000 },
+  { 0x7fffffffc223a600, 0x7fe111d3 },
+  { 0xffffffff14b4b400, 0xff8a5a5a },
+  { 0xffffffff5ea76200, 0xffaf53b1 },
+  { 0xffffffff80000200, 0xffc00001 },
+  { 0xffffffffc223a600, 0xffe111d3 },
+  { 0x7fffffff00000200, 0x7f800001 },
+  { 0x7fffffff80000000, 0x7fc00000 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint32_t arm_fp_fpack(uint64_t);
+      uint32_t outbits = arm_fp_fpack(t->in);
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: fpack(%016" PRIx64 ") -> %08" PRIx32
+		  ", expected %08" PRIx32 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
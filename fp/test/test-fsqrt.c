@@ -0,0 +1,184 @@
+/*
+ * Tests of IEEE 754 single-precision square root
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x00000000, 0x00000000 },
+  { 0x80000000, 0x80000000 },
+  { 0x00000001, 0x1a3504f3 },
+  { 0x00000002, 0x1a800000 },
+  { 0x00000003, 0x1a9cc471 },
+  { 0x00000004, 0x1ab504f3 },
+  { 0x00000009, 0x1b07c3b6 },
+  { 0x00000010, 0x1b3504f3 },
+  { 0x000000ff, 0x1c34aa5a },
+  { 0x00012345, 0x1e411636 },
+  { 0x00400000, 0x1fb504f3 },
+  { 0x007fffff, 0x1fffffff },
+  { 0x00800000, 0x20000000 },
+  { 0x00800001, 0x20000000 },
+  { 0x00ffffff, 0x203504f3 },
+  { 0x01000000, 0x203504f3 },
+  { 0x01000001, 0x203504f4 },
+  { 0x3e800000, 0x3f000000 },
+  { 0x3f000000, 0x3f3504f3 },
+  { 0x3f7fffff, 0x3f7fffff },
+  { 0x3f800000, 0x3f800000 },
+  { 0x3f800001, 0x3f800000 },
+  { 0x3f800002, 0x3f800001 },
+  { 0x3fffffff, 0x3fb504f3 },
+  { 0x40000000, 0x3fb504f3 },
+  { 0x40000001, 0x3fb504f4 },
+  { 0x40400000, 0x3fddb3d7 },
+  { 0x40800000, 0x40000000 },
+  { 0x40800001, 0x40000000 },
+  { 0x41100000, 0x40400000 },
+  { 0x41c80000, 0x40a00000 },
+  { 0x42c80000, 0x41200000 },
+  { 0x4479c000, 0x41fcdb0f },
+  { 0x461c4000, 0x42c80000 },
+  { 0x4b7fffff, 0x457fffff },
+  { 0x4f800000, 0x47800000 },
+  { 0x7effffff, 0x5f3504f3 },
+  { 0x7f000000, 0x5f3504f3 },
+  { 0x7f7ffffe, 0x5f7fffff },
+  { 0x7f7fffff, 0x5f7fffff },
+  { 0x7f800000, 0x7f800000 },
+  { 0x3fb504f3, 0x3f9837f0 },
+  { 0x3fb504f4, 0x3f9837f1 },
+  { 0x3e2aaaab, 0x3ed105ec },
+  { 0x3eaaaaab, 0x3f13cd3a },
+  { 0x40490fdb, 0x3fe2dfc5 },
+  { 0x402df854, 0x3fd3094c },
+  { 0x0de1b5e2, 0x26a9f92e },
+  { 0x5f3759df, 0x4f58a6c8 },
+  { 0x1a000000, 0x2cb504f3 },
+  { 0x1a800000, 0x2d000000 },
+  { 0x20000001, 0x2fb504f4 },
+  { 0x60ffffff, 0x503504f3 },
+  { 0x59127d69, 0x4c41a71e },
+  { 0x57127d6a, 0x4b41a71f },
+  { 0x476ca72b, 0x437622f1 },
+  { 0x536ca72c, 0x497622f1 },
+  { 0x2d0ea52e, 0x363f183d },
+  { 0x500ea52f, 0x47bf183e },
+  { 0x4537e495, 0x4258f8ad },
+  { 0x2337e496, 0x3158f8ad },
+  { 0x310281e1, 0x3836c8a0 },
+  { 0x260281e2, 0x32b6c8a1 },
+  { 0x451b6ef1, 0x42477a07 },
+  { 0x2e1b6ef2, 0x36c77a08 },
+  { 0x2e13a856, 0x36c26c4f },
+  { 0x4513a857, 0x42426c50 },
+  { 0x246159ea, 0x31f02fef },
+  { 0x406159eb, 0x3ff02ff0 },
+  { 0x4539f4d6, 0x425a2f71 },
+  { 0x2b39f4d7, 0x355a2f72 },
+  { 0x4e231497, 0x46cc5321 },
+  { 0x27231498, 0x334c5321 },
+  { 0x3f460f05, 0x3f612c5e },
+  { 0x42460f06, 0x40e12c5f },
+  { 0x270126ad, 0x3335d4da },
+  { 0x3c0126ae, 0x3db5d4db },
+  { 0x3803e888, 0x3bb7c31d },
+  { 0x3503e889, 0x3a37c31e },
+  { 0x40273eb7, 0x3fceeacc },
+  { 0x29273eb8, 0x344eeacc },
+  { 0x2c4d7506, 0x35e55725 },
+  { 0x394d7507, 0x3c655726 },
+  { 0x397a59aa, 0x3c7d28cc },
+  { 0x337a59ab, 0x397d28cd },
+  { 0x525188f1, 0x48e79aeb },
+  { 0x3c5188f2, 0x3de79aeb },
+  { 0x4102b332, 0x4036eb26 },
+  { 0x4f02b333, 0x4736eb27 },
+  { 0x547a470f, 0x49fd1f64 },
+  { 0x227a4710, 0x30fd1f64 },
+  { 0x5d1b49be, 0x4e476227 },
+  { 0x251b49bf, 0x32476227 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x80000001, 0x7fc00000 },
+  { 0x807fffff, 0x7fc00000 },
+  { 0x80800000, 0x7fc00000 },
+  { 0xbf800000, 0x7fc00000 },
+  { 0xff7fffff, 0x7fc00000 },
+  { 0xff800000, 0x7fc00000 },
+  { 0x7f800001, 0x7fc00001 },
+  { 0x7fa00000, 0x7fe00000 },
+  { 0x7fbfffff, 0x7fffffff },
+  { 0x7fc00000, 0x7fc00000 },
+  { 0x7fc00001, 0x7fc00001 },
+  { 0x7fffffff, 0x7fffffff },
+  { 0xff800001, 0xffc00001 },
+  { 0xffa55555, 0xffe55555 },
+  { 0xffc00000, 0xffc00000 },
+  { 0xffeaaaaa, 0xffeaaaaa },
+};
+
+float
+make_float (uint32_t x)
+{
+  float r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_float (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in float
+       * arithmetic, instead of calling arm_fp_fsqrt. */
+      float in = make_float (t->in);
+      float out = sqrtf (in);
+      uint32_t outbits = unmake_float (out);
+#else
+      extern uint32_t arm_fp_fsqrt(uint32_t);
+      uint32_t outbits = arm_fp_fsqrt(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: fsqrt(%08" PRIx32 ") -> %08" PRIx32
+		  ", expected %08" PRIx32 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
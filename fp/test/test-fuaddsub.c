@@ -0,0 +1,504 @@
+/*
+ * Tests of single-precision addition and subtraction in the unpacked-operand
+ * format
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+enum operation
+{
+  ADD,
+  SUB,
+};
+
+struct test
+{
+  enum operation op;
+  uint64_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { ADD, 0x0000000000000000, 0x300000fe80000000, 0x300000fe80000000 },
+  { ADD, 0x0000000000000000, 0x7fffffff00000000, 0x7fffffff00000000 },
+  { ADD, 0x2fffffea80000000, 0x3000007f80000000, 0x3000007f80000001 },
+  { ADD, 0x2fffffea80000000, 0x300000fdffffff00, 0x300000fdffffff01 },
+  { ADD, 0x2fffffea80000000, 0x300000fe80000000, 0x300000fe80000001 },
+  { ADD, 0x2fffffea80000000, 0x300000feffffff00, 0x300000feffffff01 },
+  { ADD, 0x2fffffebc0000000, 0x0000000000000000, 0x2fffffebc0000000 },
+  { ADD, 0x2fffffebc0000000, 0x8000000000000000, 0x2fffffebc0000000 },
+  { ADD, 0x2fffffebc0000000, 0xb0000081a0000000, 0xb00000819fffffff },
+  { ADD, 0x2fffffec80000000, 0x2fffffec80000000, 0x2fffffed80000000 },
+  { ADD, 0x30000000fffff800, 0xb0000000fffff800, 0x0000000000000000 },
+  { ADD, 0x30000000fffffa00, 0xb0000000fffffc00, 0xafffffea80000000 },
+  { ADD, 0x30000000fffffe00, 0xb0000000fffffc00, 0x2fffffea80000000 },
+  { ADD, 0x3000000180000100, 0xb000000180000200, 0xafffffea80000000 },
+  { ADD, 0x30000001ffffff00, 0xb000000280000400, 0xafffffed90000000 },
+  { ADD, 0x30000002ffffff00, 0xb000000380000000, 0xafffffeb80000000 },
+  { ADD, 0x3000000380000000, 0xb0000002ffffff00, 0x2fffffeb80000000 },
+  { ADD, 0x3000000380000100, 0xb0000002ffffff00, 0x2fffffecc0000000 },
+  { ADD, 0x3000000380000200, 0xb000000280000300, 0x3000000280000100 },
+  { ADD, 0x3000007f80000000, 0x3000007f80000000, 0x3000008080000000 },
+  { ADD, 0x3000007f80000000, 0xb000007f80000000, 0x0000000000000000 },
+  { ADD, 0x3000007f80000100, 0xb000007f80000200, 0xb000006880000000 },
+  { ADD, 0x3000007ffffffc00, 0xb000007ffffffd00, 0xb000006880000000 },
+  { ADD, 0x3000008080000000, 0xb000007fffffff00, 0x3000006880000000 },
+  { ADD, 0x3000008080000000, 0xb000008080000000, 0x0000000000000000 },
+  { ADD, 0x3000008080000000, 0xb000008080000100, 0xb000006980000000 },
+  { ADD, 0x3000008080000100, 0x3000008080000200, 0x3000008180000180 },
+  { ADD, 0x3000008080000100, 0xb000007f80000100, 0x3000007f80000100 },
+  { ADD, 0x3000008080000200, 0xb000007f80000300, 0x3000007f80000100 },
+  { ADD, 0x3000008080000400, 0xb000008080000300, 0x3000006980000000 },
+  { ADD, 0x30000080ffffff00, 0x3000006880000000, 0x30000080ffffff80 },
+  { ADD, 0x30000080ffffff00, 0xb0000080fffffe00, 0x3000006980000000 },
+  { ADD, 0x30000080ffffff00, 0xb000008180000200, 0xb000006ba0000000 },
+  { ADD, 0x3000008180000100, 0xb0000080ffffff00, 0x3000006ac0000000 },
+  { ADD, 0x30000081a0000000, 0x0000000000000000, 0x30000081a0000000 },
+  { ADD, 0x30000081a0000000, 0xb000007f80000000, 0x3000008180000000 },
+  { ADD, 0x300000fcffffff00, 0xb00000fcfffffe00, 0x300000e580000000 },
+  { ADD, 0x300000fcffffff00, 0xb00000fd80000200, 0xb00000e7a0000000 },
+  { ADD, 0x300000fd80000000, 0x300000fd80000000, 0x300000fe80000000 },
+  { ADD, 0x300000fd80000100, 0x300000fd80000000, 0x300000fe80000080 },
+  { ADD, 0x300000fd80000100, 0xb00000fe80000100, 0xb00000fd80000100 },
+  { ADD, 0x300000fdfffffe00, 0x300000fdfffffe00, 0x300000fefffffe00 },
+  { ADD, 0x300000fdfffffe00, 0x300000fdffffff00, 0x300000fefffffe80 },
+  { ADD, 0x300000fdffffff00, 0x3000007f80000000, 0x300000fdffffff01 },
+  { ADD, 0x300000fdffffff00, 0xb00000fe80000000, 0xb00000e680000000 },
+  { ADD, 0x300000fe80000000, 0x300000fe80000000, 0x300000ff80000000 },
+  { ADD, 0x300000fe80000000, 0xb000007f80000000, 0x300000fdffffffff },
+  { ADD, 0x300000fe80000100, 0x300000fe80000000, 0x300000ff80000080 },
+  { ADD, 0x300000fe80000100, 0xb00000fe80000000, 0x300000e780000000 },
+  { ADD, 0x300000fe80000200, 0xb00000fd80000100, 0x300000fd80000300 },
+  { ADD, 0x300000fefffffe00, 0x300000feffffff00, 0x300000fffffffe80 },
+  { ADD, 0x300000fefffffe00, 0xb00000feffffff00, 0xb00000e780000000 },
+  { ADD, 0x7fffffff00000000, 0x7fffffff00000000, 0x7fffffff00000000 },
+  { ADD, 0x8000000000000000, 0x300000fe80000000, 0x300000fe80000000 },
+  { ADD, 0x8000000000000000, 0x7fffffff00000000, 0x7fffffff00000000 },
+  { ADD, 0x8000000000000000, 0x8000000000000000, 0x8000000000000000 },
+  { ADD, 0xafffffea80000000, 0x2fffffea80000000, 0x0000000000000000 },
+  { ADD, 0xafffffea80000000, 0xafffffea80000000, 0xafffffeb80000000 },
+  { ADD, 0xafffffea80000000, 0xb000007f80000000, 0xb000007f80000001 },
+  { ADD, 0xafffffea80000000, 0xb000007fffffff00, 0xb000007fffffff01 },
+  { ADD, 0xafffffea80000000, 0xb00000fe80000000, 0xb00000fe80000001 },
+  { ADD, 0xafffffebc0000000, 0x0000000000000000, 0xafffffebc0000000 },
+  { ADD, 0xafffffebc0000000, 0xffffffff00000000, 0xffffffff00000000 },
+  { ADD, 0xb0000000fffffe00, 0x3000000180000000, 0x2fffffea80000000 },
+  { ADD, 0xb0000000fffffe00, 0xb0000000fffffe00, 0xb0000001fffffe00 },
+  { ADD, 0xb0000001ffffff00, 0x3000000280000400, 0x2fffffed90000000 },
+  { ADD, 0xb000000280000000, 0x30000001ffffff00, 0xafffffea80000000 },
+  { ADD, 0xb000000280000100, 0x3000000180000100, 0xb000000180000100 },
+  { ADD, 0xb000000380000200, 0x3000000280000300, 0xb000000280000100 },
+  { ADD, 0xb000007f80000100, 0x3000007f80000000, 0xb000006880000000 },
+  { ADD, 0xb000007f80000100, 0x3000007f80000200, 0x3000006880000000 },
+  { ADD, 0xb000007ffffffc00, 0x3000007ffffffd00, 0x3000006880000000 },
+  { ADD, 0xb000007fffffff00, 0x2fffffea80000000, 0xb000007ffffffeff },
+  { ADD, 0xb000007fffffff00, 0x3000008080000000, 0x3000006880000000 },
+  { ADD, 0xb000008080000000, 0x3000007fffffff00, 0xb000006880000000 },
+  { ADD, 0xb000008080000000, 0xb000008080000100, 0xb000008180000080 },
+  { ADD, 0xb000008080000100, 0x3000007f80000100, 0xb000007f80000100 },
+  { ADD, 0xb000008080000200, 0x3000007f80000300, 0xb000007f80000100 },
+  { ADD, 0xb000008080000400, 0x3000008080000300, 0xb000006980000000 },
+  { ADD, 0xb0000080ffffff00, 0x30000080fffffe00, 0xb000006980000000 },
+  { ADD, 0xb0000080ffffff00, 0x3000008180000200, 0x3000006ba0000000 },
+  { ADD, 0xb00000fd80000000, 0x300000fcffffff00, 0xb00000e580000000 },
+  { ADD, 0xb00000fd80000100, 0xb00000fd80000000, 0xb00000fe80000080 },
+  { ADD, 0xb00000fdfffffe00, 0xb00000fdffffff00, 0xb00000fefffffe80 },
+  { ADD, 0xb00000fdffffff00, 0xb000007f80000000, 0xb00000fdffffff01 },
+  { ADD, 0xb00000fe80000000, 0x3000007f80000000, 0xb00000fdffffffff },
+  { ADD, 0xb00000fe80000000, 0x8000000000000000, 0xb00000fe80000000 },
+  { ADD, 0xb00000fe80000000, 0xffffffff00000000, 0xffffffff00000000 },
+  { ADD, 0xb00000fe80000100, 0x300000fe80000200, 0x300000e780000000 },
+  { ADD, 0xb00000fe80000200, 0x300000fd80000100, 0xb00000fd80000300 },
+  { ADD, 0xb00000fefffffe00, 0x3000007f80000000, 0xb00000fefffffdff },
+  { ADD, 0xb00000fefffffe00, 0x300000feffffff00, 0x300000e780000000 },
+  { ADD, 0xffffffff00000000, 0x30000000fffffe00, 0xffffffff00000000 },
+  { ADD, 0xffffffff00000000, 0x300000fe80000000, 0xffffffff00000000 },
+  { ADD, 0xffffffff00000000, 0x8000000000000000, 0xffffffff00000000 },
+  { ADD, 0xffffffff00000000, 0xb0000000fffffe00, 0xffffffff00000000 },
+  { ADD, 0xffffffff00000000, 0xffffffff00000000, 0xffffffff00000000 },
+  { ADD, 0x300000feffffff00, 0x300000e9ffffff00, 0x300000ff8000037f },
+  { ADD, 0x3000007f80000100, 0x3000004780000000, 0x3000007f80000101 },
+  { SUB, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+  { SUB, 0x0000000000000000, 0x3000000180000000, 0xb000000180000000 },
+  { SUB, 0x0000000000000000, 0xb0000000fffffe00, 0x30000000fffffe00 },
+  { SUB, 0x0000000000000000, 0xb000007f80000000, 0x3000007f80000000 },
+  { SUB, 0x2fffffea80000000, 0x2fffffea80000000, 0x0000000000000000 },
+  { SUB, 0x2fffffea80000000, 0xb000007f80000000, 0x3000007f80000001 },
+  { SUB, 0x2fffffea80000000, 0xb000007ffffffe00, 0x3000007ffffffe01 },
+  { SUB, 0x2fffffea80000000, 0xb00000fdffffff00, 0x300000fdffffff01 },
+  { SUB, 0x2fffffea80000000, 0xb00000fe80000000, 0x300000fe80000001 },
+  { SUB, 0x2fffffea80000000, 0xb00000fefffffe00, 0x300000fefffffe01 },
+  { SUB, 0x2fffffeb80000000, 0x2fffffea80000000, 0x2fffffea80000000 },
+  { SUB, 0x2fffffebc0000000, 0x30000081a0000000, 0xb00000819fffffff },
+  { SUB, 0x2fffffebc0000000, 0x8000000000000000, 0x2fffffebc0000000 },
+  { SUB, 0x2fffffec80000000, 0xafffffec80000000, 0x2fffffed80000000 },
+  { SUB, 0x30000000fffff800, 0x30000000fffff800, 0x0000000000000000 },
+  { SUB, 0x30000000fffffe00, 0x30000000fffffc00, 0x2fffffea80000000 },
+  { SUB, 0x30000000fffffe00, 0xb0000000fffffe00, 0x30000001fffffe00 },
+  { SUB, 0x3000000180000000, 0x3000000180000000, 0x0000000000000000 },
+  { SUB, 0x3000000180000000, 0xb000000180000000, 0x3000000280000000 },
+  { SUB, 0x3000000180000100, 0x3000000180000000, 0x2fffffea80000000 },
+  { SUB, 0x30000001ffffff00, 0x3000000280000000, 0xafffffea80000000 },
+  { SUB, 0x3000000280000100, 0x3000000180000100, 0x3000000180000100 },
+  { SUB, 0x3000007effffff00, 0x2fffffea80000000, 0x3000007efffffeff },
+  { SUB, 0x3000007f80000100, 0x3000007f80000000, 0x3000006880000000 },
+  { SUB, 0x3000007ffffffc00, 0x3000007ffffffd00, 0xb000006880000000 },
+  { SUB, 0x3000008080000000, 0x3000007fffffff00, 0x3000006880000000 },
+  { SUB, 0x3000008080000000, 0xb000007f80000000, 0x30000080c0000000 },
+  { SUB, 0x3000008080000000, 0xb000008080000000, 0x3000008180000000 },
+  { SUB, 0x3000008080000100, 0xb000008080000200, 0x3000008180000180 },
+  { SUB, 0x3000008080000200, 0x3000007f80000100, 0x3000007f80000300 },
+  { SUB, 0x3000008080000400, 0x3000008080000300, 0x3000006980000000 },
+  { SUB, 0x30000080ffffff00, 0xb0000067ffffff00, 0x30000080ffffff7f },
+  { SUB, 0x3000008180000100, 0x30000080ffffff00, 0x3000006ac0000000 },
+  { SUB, 0x30000081a0000000, 0x0000000000000000, 0x30000081a0000000 },
+  { SUB, 0x30000081a0000000, 0x8000000000000000, 0x30000081a0000000 },
+  { SUB, 0x300000fcffffff00, 0x300000fd80000200, 0xb00000e7a0000000 },
+  { SUB, 0x300000fd80000000, 0x300000fcffffff00, 0x300000e580000000 },
+  { SUB, 0x300000fd80000000, 0x300000fd80000100, 0xb00000e680000000 },
+  { SUB, 0x300000fd80000000, 0xb00000fd80000000, 0x300000fe80000000 },
+  { SUB, 0x300000fd80000100, 0xb00000fd80000000, 0x300000fe80000080 },
+  { SUB, 0x300000fd80000200, 0x300000fc80000300, 0x300000fc80000100 },
+  { SUB, 0x300000fd80000400, 0x300000fd80000300, 0x300000e680000000 },
+  { SUB, 0x300000fdfffffe00, 0xb00000fdfffffe00, 0x300000fefffffe00 },
+  { SUB, 0x300000fdffffff00, 0x3000007f80000000, 0x300000fdfffffeff },
+  { SUB, 0x300000fdffffff00, 0xb000007f80000000, 0x300000fdffffff01 },
+  { SUB, 0x300000fe80000000, 0x7fffffff00000000, 0xffffffff00000000 },
+  { SUB, 0x300000fe80000000, 0xb000007f80000000, 0x300000fe80000001 },
+  { SUB, 0x300000fe80000000, 0xb00000fe80000000, 0x300000ff80000000 },
+  { SUB, 0x300000fe80000100, 0x300000fe80000000, 0x300000e780000000 },
+  { SUB, 0x300000fe80000100, 0x300000fe80000200, 0xb00000e780000000 },
+  { SUB, 0x300000fe80000200, 0x300000fd80000100, 0x300000fd80000300 },
+  { SUB, 0x300000fefffffe00, 0x3000007f80000000, 0x300000fefffffdff },
+  { SUB, 0x300000fefffffe00, 0xb000007f80000000, 0x300000fefffffe01 },
+  { SUB, 0x300000feffffff00, 0x2fffffea80000000, 0x300000fefffffeff },
+  { SUB, 0x7fffffff00000000, 0x30000000fffffe00, 0x7fffffff00000000 },
+  { SUB, 0x7fffffff00000000, 0xb0000000fffffe00, 0x7fffffff00000000 },
+  { SUB, 0x7fffffff00000000, 0xb00000fe80000000, 0x7fffffff00000000 },
+  { SUB, 0x7fffffff00000000, 0xffffffff00000000, 0x7fffffff00000000 },
+  { SUB, 0x8000000000000000, 0x0000000000000000, 0x8000000000000000 },
+  { SUB, 0x8000000000000000, 0x3000000180000000, 0xb000000180000000 },
+  { SUB, 0x8000000000000000, 0x3000007f80000000, 0xb000007f80000000 },
+  { SUB, 0x8000000000000000, 0x8000000000000000, 0x0000000000000000 },
+  { SUB, 0x8000000000000000, 0xb00000fe80000000, 0x300000fe80000000 },
+  { SUB, 0xafffffea80000000, 0x3000007f80000000, 0xb000007f80000001 },
+  { SUB, 0xafffffea80000000, 0x3000007fffffff00, 0xb000007fffffff01 },
+  { SUB, 0xafffffea80000000, 0x300000fefffffe00, 0xb00000fefffffe01 },
+  { SUB, 0xafffffea80000000, 0x300000feffffff00, 0xb00000feffffff01 },
+  { SUB, 0xafffffea80000000, 0xafffffea80000000, 0x0000000000000000 },
+  { SUB, 0xafffffebc0000000, 0x7fffffff00000000, 0xffffffff00000000 },
+  { SUB, 0xafffffebc0000000, 0xffffffff00000000, 0x7fffffff00000000 },
+  { SUB, 0xb0000000fffffa00, 0xb0000000fffffc00, 0x2fffffea80000000 },
+  { SUB, 0xb000000180000000, 0x8000000000000000, 0xb000000180000000 },
+  { SUB, 0xb000000180000000, 0xb000000180000000, 0x0000000000000000 },
+  { SUB, 0xb0000001ffffff00, 0xb000000280000000, 0x2fffffea80000000 },
+  { SUB, 0xb0000001ffffff00, 0xb000000280000200, 0x2fffffeca0000000 },
+  { SUB, 0xb0000001ffffff00, 0xb000000280000400, 0x2fffffed90000000 },
+  { SUB, 0xb000000280000100, 0xb000000180000100, 0xb000000180000100 },
+  { SUB, 0xb000000380000000, 0xb0000002ffffff00, 0xafffffeb80000000 },
+  { SUB, 0xb000000380000100, 0xb0000002ffffff00, 0xafffffecc0000000 },
+  { SUB, 0xb000000380000200, 0xb000000280000300, 0xb000000280000100 },
+  { SUB, 0xb000007f80000000, 0x0000000000000000, 0xb000007f80000000 },
+  { SUB, 0xb000007f80000000, 0x3000007f80000300, 0xb000008080000180 },
+  { SUB, 0xb000007f80000100, 0x3000007f80000000, 0xb000008080000080 },
+  { SUB, 0xb000007f80000100, 0xb000007f80000000, 0xb000006880000000 },
+  { SUB, 0xb000008080000000, 0x3000008080000100, 0xb000008180000080 },
+  { SUB, 0xb000008080000000, 0xb000007fffffff00, 0xb000006880000000 },
+  { SUB, 0xb000008080000000, 0xb000008080000100, 0x3000006980000000 },
+  { SUB, 0xb000008080000100, 0xb000007f80000100, 0xb000007f80000100 },
+  { SUB, 0xb000008080000200, 0xb000007f80000100, 0xb000007f80000300 },
+  { SUB, 0xb000008080000400, 0xb000008080000300, 0xb000006980000000 },
+  { SUB, 0xb0000080ffffff00, 0xb000008180000200, 0x3000006ba0000000 },
+  { SUB, 0xb00000fcffffff00, 0xb00000fd80000200, 0x300000e7a0000000 },
+  { SUB, 0xb00000fd80000000, 0xb00000fcffffff00, 0xb00000e580000000 },
+  { SUB, 0xb00000fd80000000, 0xb00000fd80000100, 0x300000e680000000 },
+  { SUB, 0xb00000fdffffff00, 0x300000fe80000000, 0xb00000feffffff80 },
+  { SUB, 0xb00000fdffffff00, 0xb00000fe80000000, 0x300000e680000000 },
+  { SUB, 0xb00000fe80000000, 0x3000007f80000000, 0xb00000fe80000001 },
+  { SUB, 0xb00000fe80000000, 0x300000fe80000000, 0xb00000ff80000000 },
+  { SUB, 0xb00000fe80000000, 0x8000000000000000, 0xb00000fe80000000 },
+  { SUB, 0xb00000fe80000000, 0xb000007f80000000, 0xb00000fdffffffff },
+  { SUB, 0xb00000fe80000100, 0xb00000fe80000000, 0xb00000e780000000 },
+  { SUB, 0xb00000fefffffe00, 0x300000feffffff00, 0xb00000fffffffe80 },
+  { SUB, 0xb00000feffffff00, 0xafffffea80000000, 0xb00000fefffffeff },
+  { SUB, 0xb00000feffffff00, 0xb000007f80000000, 0xb00000fefffffeff },
+  { SUB, 0xffffffff00000000, 0x30000000fffffe00, 0xffffffff00000000 },
+  { SUB, 0xffffffff00000000, 0x8000000000000000, 0xffffffff00000000 },
+  { SUB, 0xffffffff00000000, 0xb0000000fffffe00, 0xffffffff00000000 },
+  { SUB, 0xffffffff00000000, 0xb00000fe80000000, 0xffffffff00000000 },
+  { ADD, 0x7fffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { ADD, 0xffffffff00000000, 0x7fffffff00000000, 0x7fffffff80000000 },
+  { SUB, 0xffffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { ADD, 0x3000007f80000000, 0x3000007f80000000, 0x3000008080000000 },
+  { ADD, 0x3000007f80000000, 0xb000007f80000000, 0x0000000000000000 },
+  { ADD, 0x3000007fffffffff, 0x3000007fffffffff, 0x30000080ffffffff },
+  { ADD, 0x3000007fffffffff, 0xb000007fffffffff, 0x0000000000000000 },
+  { ADD, 0x3000007f80000000, 0x3000007fffffffff, 0x30000080bfffffff },
+  { ADD, 0x3000007f80000000, 0xb000007fffffffff, 0xb000007efffffffe },
+  { ADD, 0x3000007f80000001, 0x3000007f80000000, 0x3000008080000001 },
+  { ADD, 0x3000007f80000001, 0xb000007f80000000, 0x3000006080000000 },
+  { ADD, 0x3000007fc0000000, 0x3000007f80000001, 0x30000080a0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000007f80000001, 0x3000007dfffffffc },
+  { ADD, 0x3000007f80000000, 0x3000007e80000000, 0x3000007fc0000000 },
+  { ADD, 0x3000007f80000000, 0xb000007e80000000, 0x3000007e80000000 },
+  { ADD, 0x3000007fffffffff, 0x3000007effffffff, 0x30000080bfffffff },
+  { ADD, 0x3000007fffffffff, 0xb000007effffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000000, 0x3000007effffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0xb000007effffffff, 0x3000005f80000000 },
+  { ADD, 0x3000007f80000001, 0x3000007e80000000, 0x3000007fc0000001 },
+  { ADD, 0x3000007f80000001, 0xb000007e80000000, 0x3000007e80000002 },
+  { ADD, 0x3000007fc0000000, 0x3000007e80000001, 0x3000008080000001 },
+  { ADD, 0x3000007fc0000000, 0xb000007e80000001, 0x3000007effffffff },
+  { ADD, 0x3000007f80000000, 0x3000007d80000000, 0x3000007fa0000000 },
+  { ADD, 0x3000007f80000000, 0xb000007d80000000, 0x3000007ec0000000 },
+  { ADD, 0x3000007fffffffff, 0x3000007dffffffff, 0x300000809fffffff },
+  { ADD, 0x3000007fffffffff, 0xb000007dffffffff, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x3000007dffffffff, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0xb000007dffffffff, 0x3000007e80000001 },
+  { ADD, 0x3000007f80000001, 0x3000007d80000000, 0x3000007fa0000001 },
+  { ADD, 0x3000007f80000001, 0xb000007d80000000, 0x3000007ec0000002 },
+  { ADD, 0x3000007fc0000000, 0x3000007d80000001, 0x3000007fe0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000007d80000001, 0x3000007f9fffffff },
+  { ADD, 0x3000007f80000000, 0x3000006180000000, 0x3000007f80000002 },
+  { ADD, 0x3000007f80000000, 0xb000006180000000, 0x3000007efffffffc },
+  { ADD, 0x3000007fffffffff, 0x30000061ffffffff, 0x3000008080000001 },
+  { ADD, 0x3000007fffffffff, 0xb0000061ffffffff, 0x3000007ffffffffb },
+  { ADD, 0x3000007f80000000, 0x30000061ffffffff, 0x3000007f80000003 },
+  { ADD, 0x3000007f80000000, 0xb0000061ffffffff, 0x3000007efffffff9 },
+  { ADD, 0x3000007f80000001, 0x3000006180000000, 0x3000007f80000003 },
+  { ADD, 0x3000007f80000001, 0xb000006180000000, 0x3000007efffffffe },
+  { ADD, 0x3000007fc0000000, 0x3000006180000001, 0x3000007fc0000003 },
+  { ADD, 0x3000007fc0000000, 0xb000006180000001, 0x3000007fbffffffd },
+  { ADD, 0x3000007f80000000, 0x3000006080000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000006080000000, 0x3000007efffffffe },
+  { ADD, 0x3000007fffffffff, 0x30000060ffffffff, 0x3000008080000001 },
+  { ADD, 0x3000007fffffffff, 0xb0000060ffffffff, 0x3000007ffffffffd },
+  { ADD, 0x3000007f80000000, 0x30000060ffffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb0000060ffffffff, 0x3000007efffffffd },
+  { ADD, 0x3000007f80000001, 0x3000006080000000, 0x3000007f80000002 },
+  { ADD, 0x3000007f80000001, 0xb000006080000000, 0x3000007f80000000 },
+  { ADD, 0x3000007fc0000000, 0x3000006080000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000006080000001, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x3000005f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000005f80000000, 0x3000007effffffff },
+  { ADD, 0x3000007fffffffff, 0x3000005fffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007fffffffff, 0xb000005fffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0x3000005fffffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000005fffffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000001, 0x3000005f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000001, 0xb000005f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007fc0000000, 0x3000005f80000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000005f80000001, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x3000005e80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000005e80000000, 0x3000007effffffff },
+  { ADD, 0x3000007fffffffff, 0x3000005effffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007fffffffff, 0xb000005effffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0x3000005effffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000005effffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000001, 0x3000005e80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000001, 0xb000005e80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007fc0000000, 0x3000005e80000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000005e80000001, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x3000004080000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000004080000000, 0x3000007effffffff },
+  { ADD, 0x3000007fffffffff, 0x30000040ffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007fffffffff, 0xb0000040ffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0x30000040ffffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb0000040ffffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000001, 0x3000004080000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000001, 0xb000004080000000, 0x3000007f80000001 },
+  { ADD, 0x3000007fc0000000, 0x3000004080000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000004080000001, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x3000003f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000003f80000000, 0x3000007effffffff },
+  { ADD, 0x3000007fffffffff, 0x3000003fffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007fffffffff, 0xb000003fffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0x3000003fffffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xb000003fffffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000001, 0x3000003f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000001, 0xb000003f80000000, 0x3000007f80000001 },
+  { ADD, 0x3000007fc0000000, 0x3000003f80000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xb000003f80000001, 0x3000007fbfffffff },
+  { ADD, 0x3000007f80000000, 0x2ffffc9780000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xaffffc9780000000, 0x3000007effffffff },
+  { ADD, 0x3000007fffffffff, 0x2ffffc97ffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007fffffffff, 0xaffffc97ffffffff, 0x3000007fffffffff },
+  { ADD, 0x3000007f80000000, 0x2ffffc97ffffffff, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000000, 0xaffffc97ffffffff, 0x3000007effffffff },
+  { ADD, 0x3000007f80000001, 0x2ffffc9780000000, 0x3000007f80000001 },
+  { ADD, 0x3000007f80000001, 0xaffffc9780000000, 0x3000007f80000001 },
+  { ADD, 0x3000007fc0000000, 0x2ffffc9780000001, 0x3000007fc0000001 },
+  { ADD, 0x3000007fc0000000, 0xaffffc9780000001, 0x3000007fbfffffff },
+  { ADD, 0xb0000064cbf85505, 0x30000064cbf85502, 0xb0000046c0000000 },
+  { ADD, 0xb0000064949e6f6a, 0x30000064949e6f6b, 0x3000004580000000 },
+  { ADD, 0xb00000648ab83474, 0x300000648ab83471, 0xb0000046c0000000 },
+  { ADD, 0xb0000064871340d0, 0x30000064871340d0, 0x0000000000000000 },
+  { ADD, 0xb0000064907b12b7, 0x30000064907b12b4, 0xb0000046c0000000 },
+  { ADD, 0xb0000064e2e03dd6, 0x30000064e2e03dd9, 0x30000046c0000000 },
+  { ADD, 0xb0000064a53d7622, 0x30000064a53d7625, 0x30000046c0000000 },
+  { ADD, 0xb00000649331a9fb, 0x300000649331a9fb, 0x0000000000000000 },
+  { ADD, 0xb00000649d0413de, 0x300000649d0413de, 0x0000000000000000 },
+  { ADD, 0xb00000648a70bdba, 0x300000648a70bdb7, 0xb0000046c0000000 },
+  { ADD, 0xb0000064a731c6ff, 0x30000064a731c6fe, 0xb000004580000000 },
+  { ADD, 0xb0000064a262d5bf, 0x30000064a262d5bc, 0xb0000046c0000000 },
+  { ADD, 0xb00000649aeb50c8, 0x300000649aeb50c8, 0x0000000000000000 },
+  { ADD, 0xb000006497840d5e, 0x3000006497840d5c, 0xb000004680000000 },
+  { ADD, 0xb000006488e6823d, 0x3000006488e68240, 0x30000046c0000000 },
+  { ADD, 0xb0000064c144498c, 0x30000064c1444989, 0xb0000046c0000000 },
+  { ADD, 0xb0000064f8cc5cbe, 0x30000064f8cc5cbb, 0xb0000046c0000000 },
+  { ADD, 0xb0000064bfb9ec94, 0x30000064bfb9ec91, 0xb0000046c0000000 },
+  { ADD, 0xb0000064c0a904a0, 0x30000064c0a904a1, 0x3000004580000000 },
+  { ADD, 0xb00000648554017b, 0x3000006485540178, 0xb0000046c0000000 },
+  { ADD, 0x3000007f9abcdef1, 0xb000007f9abcdef1, 0x0000000000000000 },
+  { ADD, 0xb000007f9abcdef1, 0x3000007f9abcdef1, 0x0000000000000000 },
+  { ADD, 0x3fffffffffffffff, 0x3fffffffffffffff, 0x7fffffff00000000 },
+  { ADD, 0xbfffffff80000000, 0xbfffffff80000000, 0xffffffff00000000 },
+  { ADD, 0x2000000080000001, 0xa000000080000000, 0x0000000000000000 },
+  { ADD, 0x2000000180000000, 0xa0000000ffffffff, 0x0000000000000000 },
+  { ADD, 0x3fffffff80000000, 0x2000000080000000, 0x3fffffff80000001 },
+  { ADD, 0x1fffffff80000000, 0x9fffffff80000000, 0x0000000000000000 },
+  { ADD, 0x4000000080000000, 0x3000007f80000000, 0x7fffffff00000000 },
+  { ADD, 0x8000000000000000, 0x8000000000000000, 0x8000000000000000 },
+  { ADD, 0x8000000000000000, 0x0000000000000000, 0x0000000000000000 },
+  { ADD, 0x0000000000000000, 0xb000000180000000, 0xb000000180000000 },
+  { ADD, 0xb000000180000000, 0x8000000000000000, 0xb000000180000000 },
+  { ADD, 0x7fffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { ADD, 0xffffffff00000000, 0xffffffff00000000, 0xffffffff00000000 },
+  { ADD, 0x30000003abcdef01, 0xffffffff00000000, 0xffffffff00000000 },
+  { SUB, 0x3000007f80000000, 0xb000007f80000000, 0x3000008080000000 },
+  { SUB, 0x3000007fffffffff, 0x3000007fffffffff, 0x0000000000000000 },
+  { SUB, 0x3000007f80000001, 0xb000007f80000000, 0x3000008080000001 },
+  { SUB, 0x3000007fc0000000, 0x3000007f80000001, 0x3000007dfffffffc },
+  { SUB, 0x3000007fffffffff, 0xb000007effffffff, 0x30000080bfffffff },
+  { SUB, 0x3000007f80000000, 0x3000007effffffff, 0x3000005f80000000 },
+  { SUB, 0x3000007fc0000000, 0xb000007e80000001, 0x3000008080000001 },
+  { SUB, 0x3000007f80000000, 0x3000007d80000000, 0x3000007ec0000000 },
+  { SUB, 0x3000007f80000000, 0xb000007dffffffff, 0x3000007fbfffffff },
+  { SUB, 0x3000007f80000001, 0x3000007d80000000, 0x3000007ec0000002 },
+  { SUB, 0x3000007f80000000, 0xb000006180000000, 0x3000007f80000002 },
+  { SUB, 0x3000007fffffffff, 0x30000061ffffffff, 0x3000007ffffffffb },
+  { SUB, 0x3000007f80000001, 0xb000006180000000, 0x3000007f80000003 },
+  { SUB, 0x3000007fc0000000, 0x3000006180000001, 0x3000007fbffffffd },
+  { SUB, 0x3000007fffffffff, 0xb0000060ffffffff, 0x3000008080000001 },
+  { SUB, 0x3000007f80000000, 0x30000060ffffffff, 0x3000007efffffffd },
+  { SUB, 0x3000007fc0000000, 0xb000006080000001, 0x3000007fc0000001 },
+  { SUB, 0x3000007f80000000, 0x3000005f80000000, 0x3000007effffffff },
+  { SUB, 0x3000007f80000000, 0xb000005fffffffff, 0x3000007f80000001 },
+  { SUB, 0x3000007f80000001, 0x3000005f80000000, 0x3000007f80000001 },
+  { SUB, 0x3000007f80000000, 0xb000005e80000000, 0x3000007f80000001 },
+  { SUB, 0x3000007fffffffff, 0x3000005effffffff, 0x3000007fffffffff },
+  { SUB, 0x3000007f80000001, 0xb000005e80000000, 0x3000007f80000001 },
+  { SUB, 0x3000007fc0000000, 0x3000005e80000001, 0x3000007fbfffffff },
+  { SUB, 0x3000007fffffffff, 0xb0000040ffffffff, 0x3000007fffffffff },
+  { SUB, 0x3000007f80000000, 0x30000040ffffffff, 0x3000007effffffff },
+  { SUB, 0x3000007fc0000000, 0xb000004080000001, 0x3000007fc0000001 },
+  { SUB, 0x3000007f80000000, 0x3000003f80000000, 0x3000007effffffff },
+  { SUB, 0x3000007f80000000, 0xb000003fffffffff, 0x3000007f80000001 },
+  { SUB, 0x3000007f80000001, 0x3000003f80000000, 0x3000007f80000001 },
+  { SUB, 0x3000007f80000000, 0xaffffc9780000000, 0x3000007f80000001 },
+  { SUB, 0x3000007fffffffff, 0x2ffffc97ffffffff, 0x3000007fffffffff },
+  { SUB, 0x3000007f80000001, 0xaffffc9780000000, 0x3000007f80000001 },
+  { SUB, 0x3000007fc0000000, 0x2ffffc9780000001, 0x3000007fbfffffff },
+  { SUB, 0xb0000064b79cd2ca, 0xb0000064b79cd2c8, 0xb000004680000000 },
+  { SUB, 0xb0000064b78af267, 0xb0000064b78af267, 0x0000000000000000 },
+  { SUB, 0xb0000064839b3d57, 0xb0000064839b3d5a, 0x30000046c0000000 },
+  { SUB, 0xb0000064fd2c18ec, 0xb0000064fd2c18ea, 0xb000004680000000 },
+  { SUB, 0xb0000064c4cf4357, 0xb0000064c4cf4354, 0xb0000046c0000000 },
+  { SUB, 0xb0000064fb9b3410, 0xb0000064fb9b3411, 0x3000004580000000 },
+  { SUB, 0x3000007f9abcdef1, 0x3000007f9abcdef1, 0x0000000000000000 },
+  { SUB, 0xbfffffff80000000, 0x3fffffff80000000, 0xffffffff00000000 },
+  { SUB, 0x3fffffff80000000, 0xa000000080000000, 0x3fffffff80000001 },
+  { SUB, 0x8000000000000000, 0x0000000000000000, 0x8000000000000000 },
+  { SUB, 0xb000000180000000, 0x0000000000000000, 0xb000000180000000 },
+  { SUB, 0x30000003abcdef01, 0x7fffffff00000000, 0xffffffff00000000 },
+
+  // Tests that do depend on Arm NaN policy
+  { ADD, 0x30000000fffffe00, 0x7fffffff8f45be00, 0x7fffffff8f45be00 },
+  { ADD, 0x3000007f80000000, 0x7fffffff30f50a00, 0x7fffffffb0f50a00 },
+  { ADD, 0x300000feffffff00, 0x7fffffff2bfade00, 0x7fffffffabfade00 },
+  { ADD, 0x7fffffff00000000, 0x7fffffff1baf2000, 0x7fffffff9baf2000 },
+  { ADD, 0x7fffffff33613a00, 0x0000000000000000, 0x7fffffffb3613a00 },
+  { ADD, 0x7fffffff26a83c00, 0x2fffffea80000000, 0x7fffffffa6a83c00 },
+  { ADD, 0x7fffffff3f800400, 0x30000000fffffe00, 0x7fffffffbf800400 },
+  { ADD, 0x7fffffff3ebb2400, 0x300000feffffff00, 0x7fffffffbebb2400 },
+  { ADD, 0x7fffffff58f46c00, 0x7fffffff00000000, 0x7fffffffd8f46c00 },
+  { ADD, 0x7fffffff128c7800, 0xb000007f80000000, 0x7fffffff928c7800 },
+  { ADD, 0x7fffffff6c6ac600, 0xb00000feffffff00, 0x7fffffffec6ac600 },
+  { ADD, 0x7fffffff2110dc00, 0xffffffff00000000, 0x7fffffffa110dc00 },
+  { ADD, 0x7fffffffd22b5c00, 0x2fffffea80000000, 0x7fffffffd22b5c00 },
+  { ADD, 0x7ffffffff5368400, 0x30000000fffffe00, 0x7ffffffff5368400 },
+  { ADD, 0x7fffffff8753cc00, 0x7fffffff23502c00, 0x7fffffffa3502c00 },
+  { ADD, 0x7fffffff93ed7600, 0x8000000000000000, 0x7fffffff93ed7600 },
+  { ADD, 0x7ffffffff42f1600, 0xafffffea80000000, 0x7ffffffff42f1600 },
+  { ADD, 0x7fffffffde541600, 0xb0000000fffffe00, 0x7fffffffde541600 },
+  { ADD, 0x7ffffffff910b600, 0xb000007f80000000, 0x7ffffffff910b600 },
+  { ADD, 0x7fffffffa4dd1800, 0xb00000feffffff00, 0x7fffffffa4dd1800 },
+  { ADD, 0x8000000000000000, 0x7fffffff50675c00, 0x7fffffffd0675c00 },
+  { ADD, 0x8000000000000000, 0x7fffffff89bec600, 0x7fffffff89bec600 },
+  { ADD, 0xafffffea80000000, 0x7fffffffaf598a00, 0x7fffffffaf598a00 },
+  { ADD, 0xb0000000fffffe00, 0x7ffffffffc320e00, 0x7ffffffffc320e00 },
+  { ADD, 0xb000007f80000000, 0x7fffffffa577dc00, 0x7fffffffa577dc00 },
+  { ADD, 0xb00000feffffff00, 0x7fffffff0d744200, 0x7fffffff8d744200 },
+  { ADD, 0xffffffff00000000, 0x7fffffffbc072e00, 0x7fffffffbc072e00 },
+  { SUB, 0x2fffffea80000000, 0x7fffffff2e1d7400, 0x7fffffffae1d7400 },
+  { SUB, 0x30000000fffffe00, 0x7fffffff7ea5ac00, 0x7ffffffffea5ac00 },
+  { SUB, 0x30000000fffffe00, 0x7fffffff8f45be00, 0x7fffffff8f45be00 },
+  { SUB, 0x3000007f80000000, 0x7fffffff8a024800, 0x7fffffff8a024800 },
+  { SUB, 0x300000feffffff00, 0x7ffffffff851b800, 0x7ffffffff851b800 },
+  { SUB, 0x7fffffff00000000, 0x7fffffff1baf2000, 0x7fffffff9baf2000 },
+  { SUB, 0x7fffffff3f800400, 0x30000000fffffe00, 0x7fffffffbf800400 },
+  { SUB, 0x7fffffff6bb6ee00, 0x3000007f80000000, 0x7fffffffebb6ee00 },
+  { SUB, 0x7fffffff17ae8000, 0x7fffffff8f55e200, 0x7fffffff97ae8000 },
+  { SUB, 0x7fffffff374c7600, 0xb0000000fffffe00, 0x7fffffffb74c7600 },
+  { SUB, 0x7fffffff128c7800, 0xb000007f80000000, 0x7fffffff928c7800 },
+  { SUB, 0x7fffffffd182bc00, 0x0000000000000000, 0x7fffffffd182bc00 },
+  { SUB, 0x7fffffffd22b5c00, 0x2fffffea80000000, 0x7fffffffd22b5c00 },
+  { SUB, 0x7ffffffff5368400, 0x30000000fffffe00, 0x7ffffffff5368400 },
+  { SUB, 0x7fffffffb5a1ea00, 0x3000007f80000000, 0x7fffffffb5a1ea00 },
+  { SUB, 0x7fffffffa11d1400, 0x7fffffff00000000, 0x7fffffffa11d1400 },
+  { SUB, 0x7fffffffb6453800, 0x7fffffff84d8d000, 0x7fffffffb6453800 },
+  { SUB, 0x7fffffffde541600, 0xb0000000fffffe00, 0x7fffffffde541600 },
+  { SUB, 0x7fffffffa4dd1800, 0xb00000feffffff00, 0x7fffffffa4dd1800 },
+  { SUB, 0x8000000000000000, 0x7fffffff50675c00, 0x7fffffffd0675c00 },
+  { SUB, 0xafffffea80000000, 0x7fffffffaf598a00, 0x7fffffffaf598a00 },
+  { SUB, 0xb0000000fffffe00, 0x7fffffff5a338000, 0x7fffffffda338000 },
+  { SUB, 0xb00000feffffff00, 0x7fffffff0d744200, 0x7fffffff8d744200 },
+  { ADD, 0x7fffffff80000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { ADD, 0x7fffffff12345600, 0x7fffffff80000000, 0x7fffffff92345600 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint64_t arm_fp_fuadd(uint64_t, uint64_t);
+      extern uint64_t arm_fp_fusub(uint64_t, uint64_t);
+      uint64_t outbits = (t->op == ADD ? arm_fp_fuadd(t->in1, t->in2) :
+                          arm_fp_fusub(t->in1, t->in2));
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: %s(%016" PRIx64 ", %016" PRIx64 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n",
+                  (t->op == ADD ? "fuadd" : "fusub"),
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
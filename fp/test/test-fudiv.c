@@ -0,0 +1,396 @@
+/*
+ * Tests of single-precision division in the unpacked-operand format
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct test
+{
+  uint64_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000000000000000, 0x2fffffea80000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x30000000fffffe00, 0x0000000000000000 },
+  { 0x0000000000000000, 0x3000000180000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x3000007f80000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x30000081a0000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x300000fe80000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0xafffffeb80000000, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb0000000fffffe00, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb000000180000100, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb000000280000000, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb0000081e0000000, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb00000fcffffff00, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb00000fe80000000, 0x8000000000000000 },
+  { 0x2fffffea80000000, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x2fffffea80000000, 0x3000007c80000000, 0x2fffffed80000000 },
+  { 0x2fffffea80000000, 0x3000008080000000, 0x2fffffe980000000 },
+  { 0x2fffffea80000000, 0xb00000feffffff00, 0xafffff6a80000081 },
+  { 0x2fffffeb80000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x2fffffeb80000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x2fffffed90000000, 0x3000008290000000, 0x2fffffea80000000 },
+  { 0x2fffffed90000000, 0xb000008290000000, 0xafffffea80000000 },
+  { 0x30000000fffffc00, 0x3000007efffffe00, 0x30000000fffffdff },
+  { 0x30000000fffffe00, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x30000000fffffe00, 0x3000007680000000, 0x30000009fffffe00 },
+  { 0x30000000fffffe00, 0x3000007e80000000, 0x30000001fffffe00 },
+  { 0x30000000fffffe00, 0x3000007f80000000, 0x30000000fffffe00 },
+  { 0x30000000fffffe00, 0x3000007f80000200, 0x30000000fffffa01 },
+  { 0x30000000fffffe00, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x30000000fffffe00, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x30000000fffffe00, 0xb000007f80000000, 0xb0000000fffffe00 },
+  { 0x30000000fffffe00, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x3000000180000000, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x3000000180000000, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x3000000180000100, 0x3000007f80000200, 0x30000000fffffe01 },
+  { 0x3000000180000100, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x30000001fffffe00, 0x3000008080000000, 0x30000000fffffe00 },
+  { 0x30000001ffffff00, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x3000000280000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x3000000280000100, 0xb000008080000000, 0xb000000180000100 },
+  { 0x3000000280000300, 0xb000000180000300, 0xb000008080000000 },
+  { 0x3000000280000300, 0xb000008080000000, 0xb000000180000300 },
+  { 0x3000007efffff700, 0x3000007efffffb00, 0x3000007efffffbff },
+  { 0x3000007efffff700, 0x3000007efffffe00, 0x3000007efffff8ff },
+  { 0x3000007efffff800, 0x3000007efffffc00, 0x3000007efffffbff },
+  { 0x3000007efffff800, 0x3000007efffffd00, 0x3000007efffffaff },
+  { 0x3000007efffffa00, 0x3000007efffff900, 0x3000007f80000081 },
+  { 0x3000007efffffc00, 0x3000007efffff900, 0x3000007f80000181 },
+  { 0x3000007efffffc00, 0x3000007efffffd00, 0x3000007efffffeff },
+  { 0x3000007efffffc00, 0x3000007f80000100, 0x3000007efffffa01 },
+  { 0x3000007efffffd00, 0x3000007efffff900, 0x3000007f80000201 },
+  { 0x3000007efffffd00, 0x3000007efffffe00, 0x3000007efffffeff },
+  { 0x3000007efffffd00, 0x3000007effffff00, 0x3000007efffffdff },
+  { 0x3000007efffffd00, 0x3000007f80000100, 0x3000007efffffb01 },
+  { 0x3000007efffffd00, 0x3000007f80000200, 0x3000007efffff901 },
+  { 0x3000007efffffe00, 0x3000007efffff900, 0x3000007f80000281 },
+  { 0x3000007efffffe00, 0x3000007efffffc00, 0x3000007f80000101 },
+  { 0x3000007efffffe00, 0x3000007efffffd00, 0x3000007f80000081 },
+  { 0x3000007efffffe00, 0x3000007effffff00, 0x3000007efffffeff },
+  { 0x3000007efffffe00, 0x3000007f80000200, 0x3000007efffffa01 },
+  { 0x3000007efffffe00, 0x3000007f80000300, 0x3000007efffff801 },
+  { 0x3000007effffff00, 0x3000007efffffc00, 0x3000007f80000181 },
+  { 0x3000007effffff00, 0x3000007efffffe00, 0x3000007f80000081 },
+  { 0x3000007effffff00, 0x3000007f80000300, 0x3000007efffff901 },
+  { 0x3000007effffff00, 0x3000007f80000400, 0x3000007efffff701 },
+  { 0x3000007f80000000, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x3000007f80000000, 0x3000007efffff700, 0x3000007f80000481 },
+  { 0x3000007f80000000, 0x3000007efffff800, 0x3000007f80000401 },
+  { 0x3000007f80000000, 0x3000007efffffb00, 0x3000007f80000281 },
+  { 0x3000007f80000000, 0x3000007efffffc00, 0x3000007f80000201 },
+  { 0x3000007f80000000, 0x3000007efffffd00, 0x3000007f80000181 },
+  { 0x3000007f80000000, 0x3000007effffff00, 0x3000007f80000081 },
+  { 0x3000007f80000000, 0x3000007f80000000, 0x3000007f80000000 },
+  { 0x3000007f80000000, 0x3000007f80000100, 0x3000007efffffe01 },
+  { 0x3000007f80000000, 0x3000007f80000200, 0x3000007efffffc01 },
+  { 0x3000007f80000000, 0x3000007f80000300, 0x3000007efffffa01 },
+  { 0x3000007f80000000, 0x3000007f80000400, 0x3000007efffff801 },
+  { 0x3000007f80000000, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x3000007f80000100, 0x3000007efffffb00, 0x3000007f80000381 },
+  { 0x3000007f80000100, 0x3000007efffffe00, 0x3000007f80000201 },
+  { 0x3000007f80000100, 0x3000007f80000200, 0x3000007efffffe01 },
+  { 0x3000007f80000200, 0x3000007efffffc00, 0x3000007f80000401 },
+  { 0x3000007f80000200, 0x3000007efffffd00, 0x3000007f80000381 },
+  { 0x3000007f80000200, 0x3000007f80000100, 0x3000007f800000ff },
+  { 0x3000007f80000200, 0x3000007f80000300, 0x3000007efffffe01 },
+  { 0x3000007f80000300, 0x3000007efffffe00, 0x3000007f80000401 },
+  { 0x3000007f80000300, 0x3000007f80000100, 0x3000007f800001ff },
+  { 0x3000007f80000400, 0x3000007efffffe00, 0x3000007f80000501 },
+  { 0x3000007f80000400, 0x3000007f80000100, 0x3000007f800002ff },
+  { 0x3000007f80000400, 0x3000007f80000700, 0x3000007efffffa01 },
+  { 0x3000007f80000900, 0x3000007f80000800, 0x3000007f800000ff },
+  { 0x3000008080000000, 0xb000007f80000000, 0xb000008080000000 },
+  { 0x30000080c0000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x30000080c0000000, 0xb0000080c0000000, 0xb000007f80000000 },
+  { 0x30000080c0000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x30000081a0000000, 0x30000081a0000000, 0x3000007f80000000 },
+  { 0x30000081a0000000, 0x7fffffff00000000, 0x0000000000000000 },
+  { 0x30000081e0000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x30000081e0000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x3000008280000000, 0x3000008080000000, 0x3000008180000000 },
+  { 0x3000008290000000, 0x30000080c0000000, 0x30000080c0000000 },
+  { 0x300000f680000000, 0x3000000a80000000, 0x3000016b80000000 },
+  { 0x300000fdfffffd00, 0xb000008080000000, 0xb00000fcfffffd00 },
+  { 0x300000fdffffff00, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x300000fe80000000, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x300000fe80000000, 0x3000007e80000000, 0x300000ff80000000 },
+  { 0x300000fe80000000, 0x3000008080000000, 0x300000fd80000000 },
+  { 0x300000fe80000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x300000fe80000000, 0xb000007e80000000, 0xb00000ff80000000 },
+  { 0x300000fe80000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x300000fe80000300, 0xb00000fd80000300, 0xb000008080000000 },
+  { 0x300000feffffff00, 0x2fffffea80000000, 0x30000193ffffff00 },
+  { 0x300000feffffff00, 0x3000007effffff00, 0x300000ff80000000 },
+  { 0x300000feffffff00, 0x300000fcffffff00, 0x3000008180000000 },
+  { 0x300000feffffff00, 0x300000fdffffff00, 0x3000008080000000 },
+  { 0x300000feffffff00, 0xb000008080000000, 0xb00000fdffffff00 },
+  { 0x300000feffffff00, 0xb00000fcffffff00, 0xb000008180000000 },
+  { 0x300000feffffff00, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x7fffffff00000000, 0x0000000000000000, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x30000000fffffe00, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x30000001ffffff00, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x3000007f80000000, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x30000081a0000000, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x300000fdffffff00, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x300000fe80000000, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xafffffeb80000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb0000000fffffe00, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb000000280000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb0000080c0000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb00000fcffffff00, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb00000fe80000000, 0xffffffff00000000 },
+  { 0x8000000000000000, 0x30000000fffffe00, 0x8000000000000000 },
+  { 0x8000000000000000, 0x3000000280000000, 0x8000000000000000 },
+  { 0x8000000000000000, 0x3000008080000000, 0x8000000000000000 },
+  { 0x8000000000000000, 0x30000081c0000000, 0x8000000000000000 },
+  { 0x8000000000000000, 0x300000fcffffff00, 0x8000000000000000 },
+  { 0x8000000000000000, 0x300000fd80000000, 0x8000000000000000 },
+  { 0x8000000000000000, 0xafffffec80000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0xb0000001ffffff00, 0x0000000000000000 },
+  { 0x8000000000000000, 0xb000008180000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0xb00000fd80000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0xb00000fdffffff00, 0x0000000000000000 },
+  { 0x8000000000000000, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xafffffea80000000, 0x3000007e80000000, 0xafffffeb80000000 },
+  { 0xafffffea80000000, 0x3000008080000000, 0xafffffe980000000 },
+  { 0xafffffea80000000, 0x300000feffffff00, 0xafffff6a80000081 },
+  { 0xafffffea80000000, 0xb00000feffffff00, 0x2fffff6a80000081 },
+  { 0xafffffebc0000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xafffffebc0000000, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xafffffec80000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xafffffec80000000, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xb0000000fffffe00, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb0000000fffffe00, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xb0000000fffffe00, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb0000000fffffe00, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xb000000180000000, 0x3000007f80000100, 0xb0000000fffffe01 },
+  { 0xb000000180000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb000000180000000, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xb000000180000100, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xb0000001ffffff00, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb0000001ffffff00, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xb000000280000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb000000280000000, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xb000000280000100, 0x3000000180000100, 0xb000008080000000 },
+  { 0xb000000280000500, 0x3000000180000500, 0xb000008080000000 },
+  { 0xb000007f80000000, 0xb000007f80000000, 0x3000007f80000000 },
+  { 0xb000008080000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb000008080000000, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xb000008180000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb0000081c0000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb0000081c0000000, 0x7fffffff00000000, 0x8000000000000000 },
+  { 0xb0000081c0000000, 0xb0000080c0000000, 0x3000008080000000 },
+  { 0xb0000081e0000000, 0x30000081e0000000, 0xb000007f80000000 },
+  { 0xb000008280000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb000008280000000, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xb00000fcffffff00, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb00000fd80000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xb00000fd80000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xb00000fefffffd00, 0x3000008180000000, 0xb00000fcfffffd00 },
+  { 0xb00000fefffffd00, 0xb000008180000000, 0x300000fcfffffd00 },
+  { 0xb00000feffffff00, 0x300000fcffffff00, 0xb000008180000000 },
+  { 0xb00000feffffff00, 0xb00000fcffffff00, 0x3000008180000000 },
+  { 0xb00000feffffff00, 0xffffffff00000000, 0x0000000000000000 },
+  { 0xffffffff00000000, 0x0000000000000000, 0xffffffff00000000 },
+  { 0xffffffff00000000, 0x3000000280000000, 0xffffffff00000000 },
+  { 0xffffffff00000000, 0x3000008080000000, 0xffffffff00000000 },
+  { 0xffffffff00000000, 0x30000081c0000000, 0xffffffff00000000 },
+  { 0xffffffff00000000, 0x8000000000000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xafffffec80000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb0000000fffffe00, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb000000180000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb0000001ffffff00, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb000008180000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb00000feffffff00, 0x7fffffff00000000 },
+  { 0x30000059bed88300, 0x30000066bf611300, 0x30000071ff495375 },
+  { 0x3000007f87ffff00, 0x300000fe80100000, 0x3000000087ef011f },
+  { 0x0000000000000000, 0x0000000000000000, 0x7fffffff80000000 },
+  { 0x0000000000000000, 0x8000000000000000, 0x7fffffff80000000 },
+  { 0x7fffffff00000000, 0x7fffffff00000000, 0x7fffffff80000000 },
+  { 0x7fffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { 0x8000000000000000, 0x0000000000000000, 0x7fffffff80000000 },
+  { 0xffffffff00000000, 0x7fffffff00000000, 0x7fffffff80000000 },
+  { 0xffffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { 0x3000007f80000000, 0xb000007f80000000, 0xb000007f80000000 },
+  { 0x3000007f80000000, 0xb000007f80000001, 0xb000007effffffff },
+  { 0x3000007f80000000, 0xb000007fffffffff, 0xb000007e80000001 },
+  { 0x3000007f80000000, 0xb000007ffffffffe, 0xb000007e80000001 },
+  { 0x3000007f80000000, 0xb000007fc0000000, 0xb000007eaaaaaaab },
+  { 0x3000007f80000000, 0xb000007faaaaaaab, 0xb000007ebfffffff },
+  { 0x3000007f80000000, 0xb000007fb504f334, 0xb000007eb504f333 },
+  { 0x3000007f80000000, 0xb000007ff0000001, 0xb000007e88888887 },
+  { 0x3000007f80000001, 0xb000007f80000000, 0xb000007f80000001 },
+  { 0x3000007f80000001, 0xb000007f80000001, 0xb000007f80000000 },
+  { 0x3000007f80000001, 0xb000007fffffffff, 0xb000007e80000001 },
+  { 0x3000007f80000001, 0xb000007ffffffffe, 0xb000007e80000003 },
+  { 0x3000007f80000001, 0xb000007fc0000000, 0xb000007eaaaaaaac },
+  { 0x3000007f80000001, 0xb000007faaaaaaab, 0xb000007ec0000001 },
+  { 0x3000007f80000001, 0xb000007fb504f334, 0xb000007eb504f335 },
+  { 0x3000007f80000001, 0xb000007ff0000001, 0xb000007e88888889 },
+  { 0x3000007fffffffff, 0xb000007f80000000, 0xb000007fffffffff },
+  { 0x3000007fffffffff, 0xb000007f80000001, 0xb000007ffffffffd },
+  { 0x3000007fffffffff, 0xb000007fffffffff, 0xb000007f80000000 },
+  { 0x3000007fffffffff, 0xb000007ffffffffe, 0xb000007f80000001 },
+  { 0x3000007fffffffff, 0xb000007fc0000000, 0xb000007faaaaaaaa },
+  { 0x3000007fffffffff, 0xb000007faaaaaaab, 0xb000007fbfffffff },
+  { 0x3000007fffffffff, 0xb000007fb504f334, 0xb000007fb504f333 },
+  { 0x3000007fffffffff, 0xb000007ff0000001, 0xb000007f88888887 },
+  { 0x3000007ffffffffe, 0xb000007f80000000, 0xb000007ffffffffe },
+  { 0x3000007ffffffffe, 0xb000007f80000001, 0xb000007ffffffffd },
+  { 0x3000007ffffffffe, 0xb000007fffffffff, 0xb000007effffffff },
+  { 0x3000007ffffffffe, 0xb000007ffffffffe, 0xb000007f80000000 },
+  { 0x3000007ffffffffe, 0xb000007fc0000000, 0xb000007faaaaaaa9 },
+  { 0x3000007ffffffffe, 0xb000007faaaaaaab, 0xb000007fbfffffff },
+  { 0x3000007ffffffffe, 0xb000007fb504f334, 0xb000007fb504f333 },
+  { 0x3000007ffffffffe, 0xb000007ff0000001, 0xb000007f88888887 },
+  { 0x3000007fc0000000, 0xb000007f80000000, 0xb000007fc0000000 },
+  { 0x3000007fc0000000, 0xb000007f80000001, 0xb000007fbfffffff },
+  { 0x3000007fc0000000, 0xb000007fffffffff, 0xb000007ec0000001 },
+  { 0x3000007fc0000000, 0xb000007ffffffffe, 0xb000007ec0000001 },
+  { 0x3000007fc0000000, 0xb000007fc0000000, 0xb000007f80000000 },
+  { 0x3000007fc0000000, 0xb000007faaaaaaab, 0xb000007f8fffffff },
+  { 0x3000007fc0000000, 0xb000007fb504f334, 0xb000007f87c3b667 },
+  { 0x3000007fc0000000, 0xb000007ff0000001, 0xb000007ecccccccb },
+  { 0x3000007faaaaaaab, 0xb000007f80000000, 0xb000007faaaaaaab },
+  { 0x3000007faaaaaaab, 0xb000007f80000001, 0xb000007faaaaaaa9 },
+  { 0x3000007faaaaaaab, 0xb000007fffffffff, 0xb000007eaaaaaaab },
+  { 0x3000007faaaaaaab, 0xb000007ffffffffe, 0xb000007eaaaaaaad },
+  { 0x3000007faaaaaaab, 0xb000007fc0000000, 0xb000007ee38e38e4 },
+  { 0x3000007faaaaaaab, 0xb000007faaaaaaab, 0xb000007f80000000 },
+  { 0x3000007faaaaaaab, 0xb000007fb504f334, 0xb000007ef15beef1 },
+  { 0x3000007faaaaaaab, 0xb000007ff0000001, 0xb000007eb60b60b5 },
+  { 0x3000007fb504f334, 0xb000007f80000000, 0xb000007fb504f334 },
+  { 0x3000007fb504f334, 0xb000007f80000001, 0xb000007fb504f333 },
+  { 0x3000007fb504f334, 0xb000007fffffffff, 0xb000007eb504f335 },
+  { 0x3000007fb504f334, 0xb000007ffffffffe, 0xb000007eb504f335 },
+  { 0x3000007fb504f334, 0xb000007fc0000000, 0xb000007ef15beef0 },
+  { 0x3000007fb504f334, 0xb000007faaaaaaab, 0xb000007f87c3b667 },
+  { 0x3000007fb504f334, 0xb000007fb504f334, 0xb000007f80000000 },
+  { 0x3000007fb504f334, 0xb000007ff0000001, 0xb000007ec11658bf },
+  { 0x3000007ff0000001, 0xb000007f80000000, 0xb000007ff0000001 },
+  { 0x3000007ff0000001, 0xb000007f80000001, 0xb000007fefffffff },
+  { 0x3000007ff0000001, 0xb000007fffffffff, 0xb000007ef0000001 },
+  { 0x3000007ff0000001, 0xb000007ffffffffe, 0xb000007ef0000003 },
+  { 0x3000007ff0000001, 0xb000007fc0000000, 0xb000007fa0000001 },
+  { 0x3000007ff0000001, 0xb000007faaaaaaab, 0xb000007fb4000001 },
+  { 0x3000007ff0000001, 0xb000007fb504f334, 0xb000007fa9b4a401 },
+  { 0x3000007ff0000001, 0xb000007ff0000001, 0xb000007f80000000 },
+  { 0xb000003aab186e16, 0x3000006f819b0c58, 0xb000004aa8f9cbb7 },
+  { 0xb0000055d29c0c9d, 0xb00000e6b94e23d4, 0x2fffffee917aa153 },
+  { 0xb00000dcfe41fade, 0x30000051ad3f0bf3, 0xb000010abbda99b3 },
+  { 0x300000cff687a074, 0x300000deb06cdc63, 0x30000070b2dcbbd1 },
+  { 0xb000005ac2425fce, 0xb000005ae8e217ff, 0x3000007ed58aca39 },
+  { 0xb00000ce9701477e, 0x30000037a7855a3a, 0xb0000115e6c2cbd1 },
+  { 0x300000bf910ab842, 0xb00000bda0a958f0, 0xb0000080e71c89cd },
+  { 0x30000045d4379b74, 0xb000001fd1edc8e2, 0xb00000a58165319d },
+  { 0x300000d8dde56d3a, 0x30000044a53676a6, 0x30000113abea7e67 },
+  { 0xb00000a1c4a73da5, 0x30000055f8e55871, 0xb00000caca442a1b },
+  { 0x30000090c5bd74d1, 0x30000045cb20cf98, 0x300000c9f9359dab },
+  { 0xb0000076a218dd9f, 0x30000067858f7eb6, 0xb000008e9b5939e5 },
+  { 0xb00000b8d4447a8f, 0xb0000069d63af47e, 0x300000cdfda78d93 },
+  { 0x300000aec464352d, 0xb000007fe896319b, 0xb00000add829413b },
+  { 0xb00000d9a20b6436, 0xb00000d8aae9aee3, 0x3000007ff2b77797 },
+  { 0xb000008c8445d1a4, 0x3000006dda272fcb, 0xb000009d9b386fa3 },
+  { 0xb00000558f5e378f, 0xb0000067b974a4a0, 0x3000006cc5e72783 },
+  { 0x30000003c45db505, 0xb00000b4c08e79ea, 0xafffffce82884657 },
+  { 0x30000056943628f7, 0xb000009dea24b2c3, 0xb0000037a20bf533 },
+  { 0xb00000c8cd55c3de, 0x300000dae3a19ce4, 0xb000006ce6ecced9 },
+  { 0x3000005783024fa4, 0x300000c2b8497912, 0x30000013b5fd53f1 },
+  { 0xb000001fa922190e, 0xb00000f2c4c5dd2f, 0x2fffffabdc0a7beb },
+  { 0x30000005c79f0652, 0x300000cbf506e7d2, 0x2fffffb8d08f9157 },
+  { 0xb00000479f71810e, 0xb000005f94388e02, 0x3000006789b10277 },
+  { 0x3000007f80000002, 0x3000007f80000001, 0x3000007f80000001 },
+  { 0x3000007fccccccc9, 0x3000007ffffffffb, 0x3000007ecccccccd },
+  { 0x3000007fe0000003, 0x3000007fc0000003, 0x3000007f95555555 },
+  { 0x3000007fb0000003, 0x3000007fc0000003, 0x3000007eeaaaaaab },
+  { 0x3000007f953a6bac, 0x3000007f9e3779b1, 0x3000007ef174d0af },
+  { 0x3000007fb03195bb, 0x3000007f9e3779b1, 0x3000007f8e8b2f51 },
+  { 0x3fffffff80000000, 0x2000000080000000, 0x7fffffff00000000 },
+  { 0xa000000080000000, 0x3fffffff80000000, 0x8000000000000000 },
+  { 0x3000007f80000000, 0x2000007f80000000, 0x7fffffff00000000 },
+  { 0x3000007f80000000, 0x2000007f80000001, 0x7fffffff00000000 },
+  { 0x0000000000000000, 0x8000000000000000, 0x7fffffff80000000 },
+  { 0x7fffffff00000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { 0x3000000380000000, 0x8000000000000000, 0xffffffff00000000 },
+  { 0x8000000000000000, 0x3000000380000000, 0x8000000000000000 },
+  { 0xffffffff00000000, 0x3000000380000000, 0xffffffff00000000 },
+  { 0x3000000380000000, 0xffffffff00000000, 0x8000000000000000 },
+  { 0x1000000012345678, 0x5000000000000000, 0x0000000000000000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x0000000000000000, 0x7fffffff5a97c600, 0x7fffffffda97c600 },
+  { 0x0000000000000000, 0x7fffffffbe918e00, 0x7fffffffbe918e00 },
+  { 0x2fffffea80000000, 0x7fffffff86ae2c00, 0x7fffffff86ae2c00 },
+  { 0x3000007f80000000, 0x7fffffff8a024800, 0x7fffffff8a024800 },
+  { 0x300000feffffff00, 0x7fffffff2bfade00, 0x7fffffffabfade00 },
+  { 0x300000feffffff00, 0x7ffffffff851b800, 0x7ffffffff851b800 },
+  { 0x7fffffff00000000, 0x7fffffff1baf2000, 0x7fffffff9baf2000 },
+  { 0x7fffffff00000000, 0x7fffffffa5de5600, 0x7fffffffa5de5600 },
+  { 0x7fffffff33613a00, 0x0000000000000000, 0x7fffffffb3613a00 },
+  { 0x7fffffff26a83c00, 0x2fffffea80000000, 0x7fffffffa6a83c00 },
+  { 0x7fffffff6bb6ee00, 0x3000007f80000000, 0x7fffffffebb6ee00 },
+  { 0x7fffffff3ebb2400, 0x300000feffffff00, 0x7fffffffbebb2400 },
+  { 0x7fffffff58f46c00, 0x7fffffff00000000, 0x7fffffffd8f46c00 },
+  { 0x7fffffff68401000, 0x7fffffff61dc0e00, 0x7fffffffe8401000 },
+  { 0x7fffffff17ae8000, 0x7fffffff8f55e200, 0x7fffffff97ae8000 },
+  { 0x7fffffff2a34f000, 0xafffffea80000000, 0x7fffffffaa34f000 },
+  { 0x7fffffff374c7600, 0xb0000000fffffe00, 0x7fffffffb74c7600 },
+  { 0x7fffffff128c7800, 0xb000007f80000000, 0x7fffffff928c7800 },
+  { 0x7fffffff6c6ac600, 0xb00000feffffff00, 0x7fffffffec6ac600 },
+  { 0x7fffffffd22b5c00, 0x2fffffea80000000, 0x7fffffffd22b5c00 },
+  { 0x7ffffffff5368400, 0x30000000fffffe00, 0x7ffffffff5368400 },
+  { 0x7fffffffb5a1ea00, 0x3000007f80000000, 0x7fffffffb5a1ea00 },
+  { 0x7fffffffa21b9600, 0x300000feffffff00, 0x7fffffffa21b9600 },
+  { 0x7fffffffa11d1400, 0x7fffffff00000000, 0x7fffffffa11d1400 },
+  { 0x7fffffff8753cc00, 0x7fffffff23502c00, 0x7fffffffa3502c00 },
+  { 0x7fffffffb6453800, 0x7fffffff84d8d000, 0x7fffffffb6453800 },
+  { 0x7fffffff93ed7600, 0x8000000000000000, 0x7fffffff93ed7600 },
+  { 0x7ffffffff42f1600, 0xafffffea80000000, 0x7ffffffff42f1600 },
+  { 0x7fffffffa4dd1800, 0xb00000feffffff00, 0x7fffffffa4dd1800 },
+  { 0x7fffffff8aa65200, 0xffffffff00000000, 0x7fffffff8aa65200 },
+  { 0x8000000000000000, 0x7fffffff50675c00, 0x7fffffffd0675c00 },
+  { 0xafffffea80000000, 0x7fffffffaf598a00, 0x7fffffffaf598a00 },
+  { 0xb000007f80000000, 0x7fffffff52a90e00, 0x7fffffffd2a90e00 },
+  { 0xb00000feffffff00, 0x7fffffffd601ae00, 0x7fffffffd601ae00 },
+  { 0xffffffff00000000, 0x7fffffff0affb800, 0x7fffffff8affb800 },
+  { 0xffffffff00000000, 0x7fffffffbc072e00, 0x7fffffffbc072e00 },
+  { 0x7fffffff80000000, 0x0000000000000000, 0x7fffffff80000000 },
+  { 0x0000000000000000, 0xffffffff00000200, 0xffffffff80000200 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint64_t arm_fp_fudiv(uint64_t, uint64_t);
+      uint64_t outbits = arm_fp_fudiv(t->in1, t->in2);
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: fudiv(%016" PRIx64 ", %016" PRIx64 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n",
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,412 @@
+/*
+ * Tests of single-precision multiplication in the unpacked-operand format
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct test
+{
+  uint64_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0x30000001ffffff00, 0x0000000000000000 },
+  { 0x0000000000000000, 0x300000fdffffff00, 0x0000000000000000 },
+  { 0x0000000000000000, 0xb0000000fffffe00, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb0000080c0000000, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb00000fcffffff00, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb00000fe80000000, 0x8000000000000000 },
+  { 0x0000000000000000, 0xb00000feffffff00, 0x8000000000000000 },
+  { 0x2fffffea80000000, 0x3000007e80000000, 0x2fffffe980000000 },
+  { 0x2fffffea80000000, 0x3000007effffff00, 0x2fffffe9ffffff00 },
+  { 0x2fffffecc0000000, 0x3000007e80000000, 0x2fffffebc0000000 },
+  { 0x2fffffecc0000000, 0xb000007e80000000, 0xafffffebc0000000 },
+  { 0x2fffffed80000000, 0x3000007c80000000, 0x2fffffea80000000 },
+  { 0x30000000ffffee00, 0xb000000280000300, 0xafffff83fffff3ff },
+  { 0x30000000fffff000, 0x3000007f80000100, 0x30000000fffff1ff },
+  { 0x30000000fffffc00, 0x3000007f80000100, 0x30000000fffffdff },
+  { 0x30000000fffffe00, 0x3000007f80000100, 0x30000000ffffffff },
+  { 0x3000000180000000, 0x0000000000000000, 0x0000000000000000 },
+  { 0x3000000180000000, 0x3000007efffffe00, 0x30000000fffffe00 },
+  { 0x3000000180000000, 0xb000008080000000, 0xb000000280000000 },
+  { 0x3000000180000100, 0x3000007efffffa00, 0x30000000fffffbff },
+  { 0x3000000180000100, 0xb000008080000000, 0xb000000280000100 },
+  { 0x3000000180000200, 0x3000007efffffc00, 0x30000000ffffffff },
+  { 0x30000001fffff800, 0x3000007e80000000, 0x30000000fffff800 },
+  { 0x30000001fffffe00, 0xb000007e80000000, 0xb0000000fffffe00 },
+  { 0x30000001ffffff00, 0x3000007e80000000, 0x30000000ffffff00 },
+  { 0x3000007e80000000, 0xafffffea80000000, 0xafffffe980000000 },
+  { 0x3000007f80000000, 0x3000000280000300, 0x3000000280000300 },
+  { 0x3000007f80000100, 0x3000007f80000100, 0x3000007f80000201 },
+  { 0x3000007f80000100, 0xb000007f80000200, 0xb000007f80000301 },
+  { 0x3000007f80000200, 0x3000007f80000100, 0x3000007f80000301 },
+  { 0x3000008080000000, 0x3000000180000100, 0x3000000280000100 },
+  { 0x3000008080000000, 0x3000007f80000000, 0x3000008080000000 },
+  { 0x3000008080000000, 0x300000fd80000000, 0x300000fe80000000 },
+  { 0x3000008080000000, 0x300000fdffffff00, 0x300000feffffff00 },
+  { 0x3000008080000000, 0xb000000180000300, 0xb000000280000300 },
+  { 0x3000008080000000, 0xb000007f80000000, 0xb000008080000000 },
+  { 0x3000008080000000, 0xb00000fd80000300, 0xb00000fe80000300 },
+  { 0x30000080bfffff00, 0x3000007efffffe00, 0x30000080bffffd81 },
+  { 0x30000080bfffff00, 0x3000007effffff00, 0x30000080bffffe41 },
+  { 0x30000080c0000000, 0x2fffffeb80000000, 0x2fffffecc0000000 },
+  { 0x30000080c0000000, 0x3000008080000000, 0x30000081c0000000 },
+  { 0x30000080c0000100, 0xb000007f80000300, 0xb0000080c0000581 },
+  { 0x3000008180000000, 0x2fffffeb80000000, 0x2fffffed80000000 },
+  { 0x30000081a0000000, 0x7fffffff00000000, 0x7fffffff00000000 },
+  { 0x30000081dfffff00, 0x3000007effffff00, 0x30000081dffffe21 },
+  { 0x30000081e0000100, 0x3000007f80000100, 0x30000081e00002c1 },
+  { 0x300000fcfffffd00, 0x3000008180000000, 0x300000fefffffd00 },
+  { 0x300000fcfffffd00, 0xb000008180000000, 0xb00000fefffffd00 },
+  { 0x300000fd80000000, 0xb000008080000000, 0xb00000fe80000000 },
+  { 0x300000fdfffffd00, 0xb000008080000800, 0xb00000ff8000067f },
+  { 0x300000fe80000000, 0x0000000000000000, 0x0000000000000000 },
+  { 0x300000fe80000000, 0x300000fe80000000, 0x3000017d80000000 },
+  { 0x300000fe80000000, 0xb00000fd80000400, 0xb000017c80000400 },
+  { 0x300000fe80000900, 0x300000fefffffa00, 0x3000017e800005ff },
+  { 0x300000fe80000900, 0xb0000081c0000200, 0xb0000100c0000f81 },
+  { 0x7fffffff00000000, 0x30000001ffffff00, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0x300000fdffffff00, 0x7fffffff00000000 },
+  { 0x7fffffff00000000, 0xafffffeb80000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xb00000fe80000000, 0xffffffff00000000 },
+  { 0x7fffffff00000000, 0xffffffff00000000, 0xffffffff00000000 },
+  { 0x8000000000000000, 0x8000000000000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0xafffffec80000000, 0x0000000000000000 },
+  { 0x8000000000000000, 0xb00000fd80000000, 0x0000000000000000 },
+  { 0xafffffea80000000, 0x2fffffea80000000, 0xafffff5580000000 },
+  { 0xb0000000fffffe00, 0x0000000000000000, 0x8000000000000000 },
+  { 0xb0000000fffffe00, 0x3000007f80000100, 0xb0000000ffffffff },
+  { 0xb0000000fffffe00, 0x7fffffff00000000, 0xffffffff00000000 },
+  { 0xb0000000fffffe00, 0x8000000000000000, 0x0000000000000000 },
+  { 0xb000000180000000, 0xb000000180000000, 0x2fffff8380000000 },
+  { 0xb000000180000100, 0x0000000000000000, 0x8000000000000000 },
+  { 0xb000000180000100, 0x7fffffff00000000, 0xffffffff00000000 },
+  { 0xb000000180000100, 0xb000007f80000000, 0x3000000180000100 },
+  { 0xb0000001fffffc00, 0xb000007e80000000, 0x30000000fffffc00 },
+  { 0xb0000001ffffff00, 0x8000000000000000, 0x0000000000000000 },
+  { 0xb000007effffff00, 0xb00000feffffff00, 0x300000fefffffe01 },
+  { 0xb000007f80000000, 0x2fffffed90000000, 0xafffffed90000000 },
+  { 0xb000007f80000000, 0xb000008080000000, 0x3000008080000000 },
+  { 0xb000007f80000100, 0xb000007f80000100, 0x3000007f80000201 },
+  { 0xb000007f80000200, 0xb000007f80000100, 0x3000007f80000301 },
+  { 0xb000008080000000, 0x0000000000000000, 0x8000000000000000 },
+  { 0xb000008080000000, 0x3000000180000100, 0xb000000280000100 },
+  { 0xb000008080000000, 0x3000000180000900, 0xb000000280000900 },
+  { 0xb000008080000000, 0x300000fcffffff00, 0xb00000fdffffff00 },
+  { 0xb000008080000000, 0x7fffffff00000000, 0xffffffff00000000 },
+  { 0xb000008080000000, 0xb0000080c0000000, 0x30000081c0000000 },
+  { 0xb0000080bffffe00, 0x300000fe80000000, 0xb00000ffbffffe00 },
+  { 0xb0000080c0000000, 0xb000008080000000, 0x30000081c0000000 },
+  { 0xb000008180000000, 0xffffffff00000000, 0x7fffffff00000000 },
+  { 0xb0000081dffff900, 0x300000fe80000000, 0xb0000100dffff900 },
+  { 0xb000008290000000, 0x300000fe80000000, 0xb000010190000000 },
+  { 0xb000008290000100, 0xb00000fe80000000, 0x3000010190000100 },
+  { 0xb00000fcffffff00, 0x0000000000000000, 0x8000000000000000 },
+  { 0xb00000fd80000000, 0x0000000000000000, 0x8000000000000000 },
+  { 0xb00000fdfffff700, 0x300000fd80000100, 0xb000017bfffff8ff },
+  { 0xb00000fdffffff00, 0x3000007f80000100, 0xb00000fe8000007f },
+  { 0xb00000fdffffff00, 0x8000000000000000, 0x0000000000000000 },
+  { 0xb00000fefffffd00, 0x300000fe80000000, 0xb000017dfffffd00 },
+  { 0xb00000fefffffd00, 0xb00000fe80000100, 0x3000017dfffffeff },
+  { 0xb00000feffffff00, 0x8000000000000000, 0x0000000000000000 },
+  { 0xb00000feffffff00, 0xffffffff00000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb000000180000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xb00000fd80000000, 0x7fffffff00000000 },
+  { 0xffffffff00000000, 0xffffffff00000000, 0x7fffffff00000000 },
+  { 0x3000006189705f00, 0x3000001d93639000, 0x2fffffff9e41f4a1 },
+  { 0x3000006289705f00, 0x3000001df3639000, 0x3000000182ab1df1 },
+  { 0x3000006389705f00, 0x3000001df3639000, 0x3000000282ab1df1 },
+  { 0xb000006189705f00, 0x3000001df3639000, 0xb000000082ab1df1 },
+  { 0xb000006289705f00, 0x3000001df3639000, 0xb000000182ab1df1 },
+  { 0xb000006389705f00, 0x3000001df3639000, 0xb000000282ab1df1 },
+  { 0xb000006389705f00, 0x3000001d93639000, 0xb00000019e41f4a1 },
+  { 0x3000006189705f00, 0xb000001d93639000, 0xafffffff9e41f4a1 },
+  { 0x3000006289705f00, 0xb000001df3639000, 0xb000000182ab1df1 },
+  { 0x3000006289705f00, 0xb000001d93639000, 0xb00000009e41f4a1 },
+  { 0x3000006389705f00, 0xb000001df3639000, 0xb000000282ab1df1 },
+  { 0xb000006189705f00, 0xb000001df3639000, 0x3000000082ab1df1 },
+  { 0xb000006189705f00, 0xb000001d93639000, 0x2fffffff9e41f4a1 },
+  { 0xb000006389705f00, 0xb000001df3639000, 0x3000000282ab1df1 },
+  { 0xb000006389705f00, 0xb000001d93639000, 0x300000019e41f4a1 },
+  { 0x3000003f80000100, 0x3000003fc0000000, 0x2fffffffc0000180 },
+  { 0x3000003f80000100, 0x3000003fc0080000, 0x2fffffffc0080181 },
+  { 0x3000003f80000300, 0x3000003fc0080000, 0x2fffffffc0080481 },
+  { 0x3000007fea3b2600, 0x3000007ec0000000, 0x3000007fafac5c80 },
+  { 0x300000dfea3b2600, 0x3000009ec0000000, 0x300000ffafac5c80 },
+  { 0x30000041ea3b2600, 0x3000003dc0000000, 0x30000000afac5c80 },
+  { 0x3000007f8f11bb00, 0x3000007fc0000000, 0x3000007fd69a9880 },
+  { 0x300000df8f11bb00, 0x3000009fc0000000, 0x300000ffd69a9880 },
+  { 0x300000418f11bb00, 0x3000003ec0000000, 0x30000000d69a9880 },
+  { 0x3000007f8f11bb00, 0x3000007f80000000, 0x3000007f8f11bb00 },
+  { 0x300000df8f11bb00, 0x3000009f80000000, 0x300000ff8f11bb00 },
+  { 0x300000df8f11bb00, 0x3000009fd7f48d00, 0x300000fff1611f7f },
+  { 0x300000418f11bb00, 0x3000003ea80b7300, 0x30000000bbd41181 },
+  { 0x300000418f11bb00, 0x3000003e97f48d00, 0x30000000a9d841ff },
+  { 0x3000007f8f11bb00, 0x3000007ee80b7300, 0x3000007f81ae7781 },
+  { 0x300000df8f11bb00, 0x3000009ee80b7300, 0x300000ff81ae7781 },
+  { 0x300000dfff5dd800, 0x3000009ee0000000, 0x300000ffdf721d00 },
+  { 0x3000007fff5dd800, 0x3000007e90000000, 0x3000007f8fa4c980 },
+  { 0x300000dfff5dd800, 0x3000009e90000000, 0x300000ff8fa4c980 },
+  { 0x3000007fffe96b00, 0x3000007efefb4300, 0x3000007ffee4c501 },
+  { 0x300000dfffe96b00, 0x3000009e8104bd00, 0x300000ff80f95b7f },
+  { 0x3000007f8fbbb700, 0x3000007fa6edf900, 0x3000007fbb72aa7f },
+  { 0x300000df8fbbb700, 0x3000009fa6edf900, 0x300000ffbb72aa7f },
+  { 0x3000007f8fbbb700, 0x3000007fd9120700, 0x3000007ff3c07a81 },
+  { 0x300000df8fbbb700, 0x3000009fd9120700, 0x300000fff3c07a81 },
+  { 0x300000418fbbb700, 0x3000003ed9120700, 0x30000000f3c07a81 },
+  { 0x3000007f8fbbb700, 0x3000007f99120700, 0x3000007fabe29f01 },
+  { 0x300000df8fbbb700, 0x3000009f99120700, 0x300000ffabe29f01 },
+  { 0x300000418fbbb700, 0x3000003de6edf900, 0x3000000081a842ff },
+  { 0x3000007fdb62f300, 0x3000007ef879c500, 0x3000007fd4f035ff },
+  { 0x300000dfdb62f300, 0x3000009ef879c500, 0x300000ffd4f035ff },
+  { 0x30000041db62f300, 0x3000003df879c500, 0x30000000d4f035ff },
+  { 0x3000007fafa7ec00, 0x3000007f90000000, 0x3000007fc59ce980 },
+  { 0x30000041cf8c8d00, 0x3000003da7164500, 0x300000008776be01 },
+  { 0x3000007fc173ef00, 0x3000007f901b0f00, 0x3000007fd9cb5201 },
+  { 0x30000041c173ef00, 0x3000003e901b0f00, 0x30000000d9cb5201 },
+  { 0x3000007fb48d3300, 0x3000007eca35fb00, 0x3000007f8e9d7c81 },
+  { 0x300000dfc6f87b00, 0x3000009ee5d94d00, 0x300000ffb2a52a7f },
+  { 0x30000041c6f87b00, 0x3000003de5d94d00, 0x30000000b2a52a7f },
+  { 0x3000007f860ae700, 0x3000007f96972900, 0x3000007f9db3127f },
+  { 0x3000007f860ae700, 0x3000007fc0000000, 0x3000007fc9105a80 },
+  { 0x300000df860ae700, 0x3000009fc0000000, 0x300000ffc9105a80 },
+  { 0x30000041860ae700, 0x3000003ec0000000, 0x30000000c9105a80 },
+  { 0x30000041860ae700, 0x3000003ee968d700, 0x30000000f46da281 },
+  { 0x300000df860ae700, 0x3000009f80000000, 0x300000ff860ae700 },
+  { 0x3000007f860ae700, 0x3000007fa968d700, 0x3000007fb1682f01 },
+  { 0x300000df860ae700, 0x3000009fa968d700, 0x300000ffb1682f01 },
+  { 0x3000007f860ae700, 0x3000007fd6972900, 0x3000007fe0b885ff },
+  { 0x300000df860ae700, 0x3000009fd6972900, 0x300000ffe0b885ff },
+  { 0x3000007f9aecdd00, 0x3000007fb14b7500, 0x3000007fd696de01 },
+  { 0x300000df9aecdd00, 0x3000009fceb48b00, 0x300000fffa2fb8ff },
+  { 0x3000007f9aecdd00, 0x3000007fc0000000, 0x3000007fe8634b80 },
+  { 0x300000df9aecdd00, 0x3000009fc0000000, 0x300000ffe8634b80 },
+  { 0x3000007fd65dc600, 0x3000007ec0000000, 0x3000007fa0c65480 },
+  { 0x3000007feecf0300, 0x3000007edf93ab00, 0x3000007fd0901401 },
+  { 0x300000dfeecf0300, 0x3000009edf93ab00, 0x300000ffd0901401 },
+  { 0x30000041eecf0300, 0x3000003ddf93ab00, 0x30000000d0901401 },
+  { 0x3000007feecf0300, 0x3000007ea06c5500, 0x3000007f95a6707f },
+  { 0x30000041eecf0300, 0x3000003da06c5500, 0x3000000095a6707f },
+  { 0x3000007f98feed00, 0x3000007ee0f11b00, 0x3000007f866f277f },
+  { 0x3000004198feed00, 0x3000003de0f11b00, 0x30000000866f277f },
+  { 0x3000007f9a1b9d00, 0x3000007f9c42b500, 0x3000007fbc21f781 },
+  { 0x300000df9a1b9d00, 0x3000009f9c42b500, 0x300000ffbc21f781 },
+  { 0x300000df9a1b9d00, 0x3000009edc42b500, 0x300000ff8497e301 },
+  { 0x3000007f94704400, 0x3000007ee0000000, 0x3000007f81e23b80 },
+  { 0x30000041a3fb7700, 0x3000003deeb1b900, 0x3000000098e59fff },
+  { 0x3000007fde13d500, 0x3000007eeb728300, 0x3000007fcc3f8aff },
+  { 0x3000007fd5b21100, 0x3000007f80810f00, 0x3000007fd689877f },
+  { 0x30000041d5b21100, 0x3000003e80810f00, 0x30000000d689877f },
+  { 0x3000007fd5b21100, 0x3000007ebf7ef100, 0x3000007f9fd9d181 },
+  { 0x3000007fadfbc400, 0x3000007ec0000000, 0x3000007f827cd300 },
+  { 0x300000dfadfbc400, 0x3000009ec0000000, 0x300000ff827cd300 },
+  { 0x30000041adfbc400, 0x3000003dc0000000, 0x30000000827cd300 },
+  { 0x3000007fd0ef0300, 0x3000007f80000000, 0x3000007fd0ef0300 },
+  { 0x30000041d0ef0300, 0x3000003df98c5500, 0x30000000cbab01ff },
+  { 0x30000041dd118100, 0x3000003e8ad17f00, 0x30000000efc0b0ff },
+  { 0x30000041dd118100, 0x3000003df52e8100, 0x30000000d3b9e901 },
+  { 0x300000df92efc600, 0x3000009fa0000000, 0x300000ffb7abb780 },
+  { 0x3000004192efc600, 0x3000003ea0000000, 0x30000000b7abb780 },
+  { 0x300000dfdcefe600, 0x3000009ec0000000, 0x300000ffa5b3ec80 },
+  { 0x30000041dcefe600, 0x3000003dc0000000, 0x30000000a5b3ec80 },
+  { 0x3000007fad650700, 0x3000007fa2f8b700, 0x3000007fdcc4c881 },
+  { 0x300000dfad650700, 0x3000009ee2f8b700, 0x300000ff99bba601 },
+  { 0x3000007fbfde6b00, 0x3000007f8721bd00, 0x3000007fca8f277f },
+  { 0x300000dfbfde6b00, 0x3000009f8721bd00, 0x300000ffca8f277f },
+  { 0x300000dfbfde6b00, 0x3000009ec721bd00, 0x300000ff953f2e7f },
+  { 0x30000041bfde6b00, 0x3000003dc721bd00, 0x30000000953f2e7f },
+  { 0x300000dff40db400, 0x3000009ee0000000, 0x300000ffd58bfd80 },
+  { 0x30000041f40db400, 0x3000003de0000000, 0x30000000d58bfd80 },
+  { 0x3000007f9e20d300, 0x3000007f90c8a500, 0x3000007fb2dccc7f },
+  { 0x300000419e20d300, 0x3000003e90c8a500, 0x30000000b2dccc7f },
+  { 0x3000007f9e20d300, 0x3000007fc0000000, 0x3000007fed313c80 },
+  { 0x300000419e20d300, 0x3000003ec0000000, 0x30000000ed313c80 },
+  { 0x3000007f82e64100, 0x3000007f8fd63f00, 0x3000007f931855ff },
+  { 0x3000004182e64100, 0x3000003e8fd63f00, 0x30000000931855ff },
+  { 0x3000007f9a190100, 0x3000007f96e70100, 0x3000007fb5ab6781 },
+  { 0x300000df9a190100, 0x3000009f96e70100, 0x300000ffb5ab6781 },
+  { 0x300000419a190100, 0x3000003e96e70100, 0x30000000b5ab6781 },
+  { 0x3000007fa21aa100, 0x3000007efc496100, 0x3000007f9fc0ad81 },
+  { 0x300000dfa21aa100, 0x3000009efc496100, 0x300000ff9fc0ad81 },
+  { 0x3000007fcd076700, 0x3000007ef8245700, 0x3000007fc6bc4681 },
+  { 0x300000dfcd076700, 0x3000009ef8245700, 0x300000ffc6bc4681 },
+  { 0x3000007fb875e100, 0x3000007f968e2100, 0x3000007fd8f6f601 },
+  { 0x3000007fc2f0d700, 0x3000007edefd1900, 0x3000007fa9cd957f },
+  { 0x300000dfc2f0d700, 0x3000009edefd1900, 0x300000ffa9cd957f },
+  { 0x2fffffebc0000000, 0xb00000808fffff00, 0xafffffecd7fffe80 },
+  { 0x2fffffebc0000000, 0x300000808fffff00, 0x2fffffecd7fffe80 },
+  { 0x2fffffebc0000000, 0xb00000808ffffd00, 0xafffffecd7fffb80 },
+  { 0xafffffebc0000000, 0xb00000808ffffd00, 0x2fffffecd7fffb80 },
+  { 0xafffffebc0000000, 0x300000808ffffd00, 0xafffffecd7fffb80 },
+  { 0xb000009effff0000, 0xb0000081ffff0000, 0x300000a1fffe0001 },
+  { 0x3000007fdf7f0000, 0x3000007fffff0000, 0x30000080df7e2081 },
+  { 0x8000000000000000, 0x7fffffff00000000, 0x7fffffff80000000 },
+  { 0x8000000000000000, 0xffffffff00000000, 0x7fffffff80000000 },
+  { 0x3000007f80000000, 0xb000007f80000000, 0xb000007f80000000 },
+  { 0x3000007f80000000, 0xb000007f80000001, 0xb000007f80000001 },
+  { 0x3000007f80000000, 0xb000007fffffffff, 0xb000007fffffffff },
+  { 0x3000007f80000000, 0xb000007ffffffffe, 0xb000007ffffffffe },
+  { 0x3000007f80000000, 0xb000007fc0000000, 0xb000007fc0000000 },
+  { 0x3000007f80000000, 0xb000007faaaaaaab, 0xb000007faaaaaaab },
+  { 0x3000007f80000000, 0xb000007fb504f334, 0xb000007fb504f334 },
+  { 0x3000007f80000000, 0xb000007fb504f333, 0xb000007fb504f333 },
+  { 0x3000007f80000001, 0xb000007f80000000, 0xb000007f80000001 },
+  { 0x3000007f80000001, 0xb000007f80000001, 0xb000007f80000003 },
+  { 0x3000007f80000001, 0xb000007fffffffff, 0xb000008080000001 },
+  { 0x3000007f80000001, 0xb000007ffffffffe, 0xb000007fffffffff },
+  { 0x3000007f80000001, 0xb000007fc0000000, 0xb000007fc0000001 },
+  { 0x3000007f80000001, 0xb000007faaaaaaab, 0xb000007faaaaaaad },
+  { 0x3000007f80000001, 0xb000007fb504f334, 0xb000007fb504f335 },
+  { 0x3000007f80000001, 0xb000007fb504f333, 0xb000007fb504f335 },
+  { 0x3000007fffffffff, 0xb000007f80000000, 0xb000007fffffffff },
+  { 0x3000007fffffffff, 0xb000007f80000001, 0xb000008080000001 },
+  { 0x3000007fffffffff, 0xb000007fffffffff, 0xb0000080ffffffff },
+  { 0x3000007fffffffff, 0xb000007ffffffffe, 0xb0000080fffffffd },
+  { 0x3000007fffffffff, 0xb000007fc0000000, 0xb0000080bfffffff },
+  { 0x3000007fffffffff, 0xb000007faaaaaaab, 0xb0000080aaaaaaab },
+  { 0x3000007fffffffff, 0xb000007fb504f334, 0xb0000080b504f333 },
+  { 0x3000007fffffffff, 0xb000007fb504f333, 0xb0000080b504f333 },
+  { 0x3000007ffffffffe, 0xb000007f80000000, 0xb000007ffffffffe },
+  { 0x3000007ffffffffe, 0xb000007f80000001, 0xb000007fffffffff },
+  { 0x3000007ffffffffe, 0xb000007fffffffff, 0xb0000080fffffffd },
+  { 0x3000007ffffffffe, 0xb000007ffffffffe, 0xb0000080fffffffd },
+  { 0x3000007ffffffffe, 0xb000007fc0000000, 0xb0000080bfffffff },
+  { 0x3000007ffffffffe, 0xb000007faaaaaaab, 0xb0000080aaaaaaa9 },
+  { 0x3000007ffffffffe, 0xb000007fb504f334, 0xb0000080b504f333 },
+  { 0x3000007ffffffffe, 0xb000007fb504f333, 0xb0000080b504f331 },
+  { 0x3000007fc0000000, 0xb000007f80000000, 0xb000007fc0000000 },
+  { 0x3000007fc0000000, 0xb000007f80000001, 0xb000007fc0000001 },
+  { 0x3000007fc0000000, 0xb000007fffffffff, 0xb0000080bfffffff },
+  { 0x3000007fc0000000, 0xb000007ffffffffe, 0xb0000080bfffffff },
+  { 0x3000007fc0000000, 0xb000007fc0000000, 0xb000008090000000 },
+  { 0x3000007fc0000000, 0xb000007faaaaaaab, 0xb000008080000001 },
+  { 0x3000007fc0000000, 0xb000007fb504f334, 0xb000008087c3b667 },
+  { 0x3000007fc0000000, 0xb000007fb504f333, 0xb000008087c3b667 },
+  { 0x3000007faaaaaaab, 0xb000007f80000000, 0xb000007faaaaaaab },
+  { 0x3000007faaaaaaab, 0xb000007f80000001, 0xb000007faaaaaaad },
+  { 0x3000007faaaaaaab, 0xb000007fffffffff, 0xb0000080aaaaaaab },
+  { 0x3000007faaaaaaab, 0xb000007ffffffffe, 0xb0000080aaaaaaa9 },
+  { 0x3000007faaaaaaab, 0xb000007fc0000000, 0xb000008080000001 },
+  { 0x3000007faaaaaaab, 0xb000007faaaaaaab, 0xb000007fe38e38e5 },
+  { 0x3000007faaaaaaab, 0xb000007fb504f334, 0xb000007ff15beef1 },
+  { 0x3000007faaaaaaab, 0xb000007fb504f333, 0xb000007ff15beeef },
+  { 0x3000007fb504f334, 0xb000007f80000000, 0xb000007fb504f334 },
+  { 0x3000007fb504f334, 0xb000007f80000001, 0xb000007fb504f335 },
+  { 0x3000007fb504f334, 0xb000007fffffffff, 0xb0000080b504f333 },
+  { 0x3000007fb504f334, 0xb000007ffffffffe, 0xb0000080b504f333 },
+  { 0x3000007fb504f334, 0xb000007fc0000000, 0xb000008087c3b667 },
+  { 0x3000007fb504f334, 0xb000007faaaaaaab, 0xb000007ff15beef1 },
+  { 0x3000007fb504f334, 0xb000007fb504f334, 0xb000008080000001 },
+  { 0x3000007fb504f334, 0xb000007fb504f333, 0xb000007fffffffff },
+  { 0x3000007fb504f333, 0xb000007f80000000, 0xb000007fb504f333 },
+  { 0x3000007fb504f333, 0xb000007f80000001, 0xb000007fb504f335 },
+  { 0x3000007fb504f333, 0xb000007fffffffff, 0xb0000080b504f333 },
+  { 0x3000007fb504f333, 0xb000007ffffffffe, 0xb0000080b504f331 },
+  { 0x3000007fb504f333, 0xb000007fc0000000, 0xb000008087c3b667 },
+  { 0x3000007fb504f333, 0xb000007faaaaaaab, 0xb000007ff15beeef },
+  { 0x3000007fb504f333, 0xb000007fb504f334, 0xb000007fffffffff },
+  { 0x3000007fb504f333, 0xb000007fb504f333, 0xb000007ffffffffd },
+  { 0xb00000d9af9e09c9, 0x30000046ece4048f, 0xb00000a1a2821ce7 },
+  { 0xb000006bde384261, 0x30000063ce0e8896, 0xb0000050b2dde30d },
+  { 0x30000059acb8cefc, 0x30000077ff62df26, 0x30000052ac4ecb7b },
+  { 0xb00000c8d0a3727d, 0x3000004af7bb3654, 0xb0000094c9e64723 },
+  { 0x3000005484f32551, 0x300000729ebf3deb, 0x30000047a4e2c531 },
+  { 0xb00000cc8652ab69, 0xb0000047d0ef5c36, 0x30000094db4185ab },
+  { 0x300000dab6de6548, 0x30000002f423f8be, 0x3000005eae65aa9f },
+  { 0x300000e1f440cabe, 0xb0000055e872d96b, 0xb00000b8ddc84c07 },
+  { 0xb00000c9d563d56d, 0xb00000d9ab9f4430, 0x300001248f0e7167 },
+  { 0x300000f786f594cf, 0x300000d9a8215db0, 0x30000151b1458169 },
+  { 0x30000090afe987c1, 0xb00000cb89d33078, 0xb00000dcbd6a30df },
+  { 0x3000001d9eebba4e, 0xb00000488e48e488, 0xafffffe6b0a80305 },
+  { 0xb0000092bb20e1d5, 0x30000092cb717794, 0xb00000a694b60401 },
+  { 0xb0000045ab994360, 0xb000002299f900d3, 0x2fffffe8ce6b03c9 },
+  { 0xb000004498afaf54, 0xb0000070abd8af21, 0x30000035ccfd2d99 },
+  { 0x300000b08f7815f2, 0xb000005cb8ec796e, 0xb000008dcf45ad0f },
+  { 0xb0000030a55c9c8e, 0xb000001c81b2499e, 0x2fffffcda78da9ab },
+  { 0x30000047968e485e, 0xb0000011ca815857, 0xafffffd9ee30ad81 },
+  { 0xb0000051a950e9ae, 0x300000429018d7f5, 0xb0000014be9be3b9 },
+  { 0x3000006addd284e8, 0xb00000e8c6db0211, 0xb00000d4ac4e97ad },
+  { 0x3000006bf72699ec, 0x3000000f98b0f10e, 0x2ffffffc9369bea7 },
+  { 0x30000006cf56d48f, 0x30000019af925385, 0x2fffffa18e32de77 },
+  { 0xb0000094fcf2c86d, 0xb00000dcd9adb533, 0x300000f2d7156eff },
+  { 0x300000c8f4bf589b, 0xb00000a1a79b8a2e, 0xb00000eba03d86c3 },
+  { 0x300000fac0000000, 0x300000fac0000000, 0x3000017690000000 },
+  { 0xafffff3880000001, 0x2fffff38ffffffff, 0xaffffdf280000001 },
+  { 0x3fffffff80000000, 0x3000008080000000, 0x7fffffff00000000 },
+  { 0x3fffffff80000000, 0x3000007f80000000, 0x3fffffff80000000 },
+  { 0xbfffffffffffffff, 0x3000007fffffffff, 0xffffffff00000000 },
+  { 0x2000000080000000, 0x3000007e80000000, 0x0000000000000000 },
+  { 0x2000000080000000, 0xb000007f80000000, 0xa000000080000000 },
+  { 0x20000000ffffffff, 0x3000007fffffffff, 0x20000001ffffffff },
+  { 0x1fffffff80000000, 0x3000007f80000000, 0x0000000000000000 },
+  { 0xc000000080000000, 0x3000007f80000000, 0xffffffff00000000 },
+  { 0xc000000080000000, 0x1000000012345678, 0x7fffffff80000000 },
+  { 0x7fffffff00000000, 0xb000000387654321, 0xffffffff00000000 },
+  { 0x8000000000000000, 0xb000000387654321, 0x0000000000000000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x0000000000000000, 0x7fffffff5a97c600, 0x7fffffffda97c600 },
+  { 0x0000000000000000, 0x7fffffffbe918e00, 0x7fffffffbe918e00 },
+  { 0x3000007f80000000, 0x7fffffff30f50a00, 0x7fffffffb0f50a00 },
+  { 0x300000feffffff00, 0x7fffffff2bfade00, 0x7fffffffabfade00 },
+  { 0x7fffffff00000000, 0x7fffffff1baf2000, 0x7fffffff9baf2000 },
+  { 0x7fffffff00000000, 0x7fffffffa5de5600, 0x7fffffffa5de5600 },
+  { 0x7fffffff33613a00, 0x0000000000000000, 0x7fffffffb3613a00 },
+  { 0x7fffffff26a83c00, 0x2fffffea80000000, 0x7fffffffa6a83c00 },
+  { 0x7fffffff3f800400, 0x30000000fffffe00, 0x7fffffffbf800400 },
+  { 0x7fffffff68401000, 0x7fffffff61dc0e00, 0x7fffffffe8401000 },
+  { 0x7fffffff6c6ac600, 0xb00000feffffff00, 0x7fffffffec6ac600 },
+  { 0x7fffffff2110dc00, 0xffffffff00000000, 0x7fffffffa110dc00 },
+  { 0x7fffffffd182bc00, 0x0000000000000000, 0x7fffffffd182bc00 },
+  { 0x7fffffffd22b5c00, 0x2fffffea80000000, 0x7fffffffd22b5c00 },
+  { 0x7ffffffff5368400, 0x30000000fffffe00, 0x7ffffffff5368400 },
+  { 0x7fffffff8753cc00, 0x7fffffff23502c00, 0x7fffffffa3502c00 },
+  { 0x7fffffffb6453800, 0x7fffffff84d8d000, 0x7fffffffb6453800 },
+  { 0x7fffffffde541600, 0xb0000000fffffe00, 0x7fffffffde541600 },
+  { 0x7fffffffa4dd1800, 0xb00000feffffff00, 0x7fffffffa4dd1800 },
+  { 0x7fffffff8aa65200, 0xffffffff00000000, 0x7fffffff8aa65200 },
+  { 0x8000000000000000, 0x7fffffff89bec600, 0x7fffffff89bec600 },
+  { 0xafffffea80000000, 0x7fffffff3104fa00, 0x7fffffffb104fa00 },
+  { 0xb0000000fffffe00, 0x7fffffff5a338000, 0x7fffffffda338000 },
+  { 0xb0000000fffffe00, 0x7ffffffffc320e00, 0x7ffffffffc320e00 },
+  { 0xb000007f80000000, 0x7fffffff52a90e00, 0x7fffffffd2a90e00 },
+  { 0xb000007f80000000, 0x7fffffffa577dc00, 0x7fffffffa577dc00 },
+  { 0xb00000feffffff00, 0x7fffffffd601ae00, 0x7fffffffd601ae00 },
+  { 0x7fffffff80000000, 0x3000007f80000000, 0x7fffffff80000000 },
+  { 0xffffffff12345600, 0x7fffffffc0000000, 0xffffffff92345600 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+      extern uint64_t arm_fp_fumul(uint64_t, uint64_t);
+      uint64_t outbits = arm_fp_fumul(t->in1, t->in2);
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: fumul(%016" PRIx64 ", %016" PRIx64 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n",
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,168 @@
+/*
+ * Tests of IEEE 754 half-precision to double-precision conversion
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in;
+  uint64_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000, 0x0000000000000000 },
+  { 0x0001, 0x3e70000000000000 },
+  { 0x0002, 0x3e80000000000000 },
+  { 0x0003, 0x3e88000000000000 },
+  { 0x0004, 0x3e90000000000000 },
+  { 0x0005, 0x3e94000000000000 },
+  { 0x0008, 0x3ea0000000000000 },
+  { 0x0009, 0x3ea2000000000000 },
+  { 0x0010, 0x3eb0000000000000 },
+  { 0x0011, 0x3eb1000000000000 },
+  { 0x0020, 0x3ec0000000000000 },
+  { 0x0021, 0x3ec0800000000000 },
+  { 0x0040, 0x3ed0000000000000 },
+  { 0x0041, 0x3ed0400000000000 },
+  { 0x0080, 0x3ee0000000000000 },
+  { 0x0081, 0x3ee0200000000000 },
+  { 0x0100, 0x3ef0000000000000 },
+  { 0x0101, 0x3ef0100000000000 },
+  { 0x0155, 0x3ef5500000000000 },
+  { 0x0200, 0x3f00000000000000 },
+  { 0x0201, 0x3f00080000000000 },
+  { 0x02aa, 0x3f05500000000000 },
+  { 0x03ff, 0x3f0ff80000000000 },
+  { 0x0400, 0x3f10000000000000 },
+  { 0x0401, 0x3f10040000000000 },
+  { 0x07ff, 0x3f1ffc0000000000 },
+  { 0x1000, 0x3f40000000000000 },
+  { 0x2e66, 0x3fb9980000000000 },
+  { 0x3555, 0x3fd5540000000000 },
+  { 0x3bff, 0x3feffc0000000000 },
+  { 0x3c00, 0x3ff0000000000000 },
+  { 0x3c01, 0x3ff0040000000000 },
+  { 0x4000, 0x4000000000000000 },
+  { 0x4248, 0x4009200000000000 },
+  { 0x57ff, 0x405ffc0000000000 },
+  { 0x6400, 0x4090000000000000 },
+  { 0x7800, 0x40e0000000000000 },
+  { 0x7bfe, 0x40eff80000000000 },
+  { 0x7bff, 0x40effc0000000000 },
+  { 0x7c00, 0x7ff0000000000000 },
+  { 0x8000, 0x8000000000000000 },
+  { 0x8001, 0xbe70000000000000 },
+  { 0x8002, 0xbe80000000000000 },
+  { 0x8003, 0xbe88000000000000 },
+  { 0x8004, 0xbe90000000000000 },
+  { 0x8005, 0xbe94000000000000 },
+  { 0x8008, 0xbea0000000000000 },
+  { 0x8009, 0xbea2000000000000 },
+  { 0x8010, 0xbeb0000000000000 },
+  { 0x8011, 0xbeb1000000000000 },
+  { 0x8020, 0xbec0000000000000 },
+  { 0x8021, 0xbec0800000000000 },
+  { 0x8040, 0xbed0000000000000 },
+  { 0x8041, 0xbed0400000000000 },
+  { 0x8080, 0xbee0000000000000 },
+  { 0x8081, 0xbee0200000000000 },
+  { 0x8100, 0xbef0000000000000 },
+  { 0x8101, 0xbef0100000000000 },
+  { 0x8155, 0xbef5500000000000 },
+  { 0x8200, 0xbf00000000000000 },
+  { 0x8201, 0xbf00080000000000 },
+  { 0x82aa, 0xbf05500000000000 },
+  { 0x83ff, 0xbf0ff80000000000 },
+  { 0x8400, 0xbf10000000000000 },
+  { 0x8401, 0xbf10040000000000 },
+  { 0x87ff, 0xbf1ffc0000000000 },
+  { 0x9000, 0xbf40000000000000 },
+  { 0xae66, 0xbfb9980000000000 },
+  { 0xb555, 0xbfd5540000000000 },
+  { 0xbbff, 0xbfeffc0000000000 },
+  { 0xbc00, 0xbff0000000000000 },
+  { 0xbc01, 0xbff0040000000000 },
+  { 0xc000, 0xc000000000000000 },
+  { 0xc248, 0xc009200000000000 },
+  { 0xd7ff, 0xc05ffc0000000000 },
+  { 0xe400, 0xc090000000000000 },
+  { 0xf800, 0xc0e0000000000000 },
+  { 0xfbfe, 0xc0eff80000000000 },
+  { 0xfbff, 0xc0effc0000000000 },
+  { 0xfc00, 0xfff0000000000000 },
+
+  // The upper 16 bits of the input are ignored
+  { 0xffff3c00, 0x3ff0000000000000 },
+  { 0x80000001, 0x3e70000000000000 },
+  { 0x7fff8400, 0xbf10000000000000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7c01, 0x7ff8040000000000 },
+  { 0x7d55, 0x7ffd540000000000 },
+  { 0x7dff, 0x7ffffc0000000000 },
+  { 0x7e00, 0x7ff8000000000000 },
+  { 0x7f3a, 0x7ffce80000000000 },
+  { 0xfc01, 0xfff8040000000000 },
+  { 0xfe91, 0xfffa440000000000 },
+  { 0xffff, 0xfffffc0000000000 },
+};
+
+_Float16
+make_half (uint32_t x)
+{
+  uint16_t h = x;
+  _Float16 r;
+  memcpy (&r, &h, sizeof (r));
+  return r;
+}
+
+uint64_t
+unmake_double (double x)
+{
+  uint64_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_h2d. */
+      double out = (double)make_half(t->in);
+      uint64_t outbits = unmake_double(out);
+#else
+      extern uint64_t arm_fp_h2d(uint32_t);
+      uint64_t outbits = arm_fp_h2d(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: h2d(%04" PRIx32 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
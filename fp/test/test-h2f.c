@@ -0,0 +1,168 @@
+/*
+ * Tests of IEEE 754 half-precision to single-precision conversion
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in;
+  uint32_t out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000, 0x00000000 },
+  { 0x0001, 0x33800000 },
+  { 0x0002, 0x34000000 },
+  { 0x0003, 0x34400000 },
+  { 0x0004, 0x34800000 },
+  { 0x0005, 0x34a00000 },
+  { 0x0008, 0x35000000 },
+  { 0x0009, 0x35100000 },
+  { 0x0010, 0x35800000 },
+  { 0x0011, 0x35880000 },
+  { 0x0020, 0x36000000 },
+  { 0x0021, 0x36040000 },
+  { 0x0040, 0x36800000 },
+  { 0x0041, 0x36820000 },
+  { 0x0080, 0x37000000 },
+  { 0x0081, 0x37010000 },
+  { 0x0100, 0x37800000 },
+  { 0x0101, 0x37808000 },
+  { 0x0155, 0x37aa8000 },
+  { 0x0200, 0x38000000 },
+  { 0x0201, 0x38004000 },
+  { 0x02aa, 0x382a8000 },
+  { 0x03ff, 0x387fc000 },
+  { 0x0400, 0x38800000 },
+  { 0x0401, 0x38802000 },
+  { 0x07ff, 0x38ffe000 },
+  { 0x1000, 0x3a000000 },
+  { 0x2e66, 0x3dccc000 },
+  { 0x3555, 0x3eaaa000 },
+  { 0x3bff, 0x3f7fe000 },
+  { 0x3c00, 0x3f800000 },
+  { 0x3c01, 0x3f802000 },
+  { 0x4000, 0x40000000 },
+  { 0x4248, 0x40490000 },
+  { 0x57ff, 0x42ffe000 },
+  { 0x6400, 0x44800000 },
+  { 0x7800, 0x47000000 },
+  { 0x7bfe, 0x477fc000 },
+  { 0x7bff, 0x477fe000 },
+  { 0x7c00, 0x7f800000 },
+  { 0x8000, 0x80000000 },
+  { 0x8001, 0xb3800000 },
+  { 0x8002, 0xb4000000 },
+  { 0x8003, 0xb4400000 },
+  { 0x8004, 0xb4800000 },
+  { 0x8005, 0xb4a00000 },
+  { 0x8008, 0xb5000000 },
+  { 0x8009, 0xb5100000 },
+  { 0x8010, 0xb5800000 },
+  { 0x8011, 0xb5880000 },
+  { 0x8020, 0xb6000000 },
+  { 0x8021, 0xb6040000 },
+  { 0x8040, 0xb6800000 },
+  { 0x8041, 0xb6820000 },
+  { 0x8080, 0xb7000000 },
+  { 0x8081, 0xb7010000 },
+  { 0x8100, 0xb7800000 },
+  { 0x8101, 0xb7808000 },
+  { 0x8155, 0xb7aa8000 },
+  { 0x8200, 0xb8000000 },
+  { 0x8201, 0xb8004000 },
+  { 0x82aa, 0xb82a8000 },
+  { 0x83ff, 0xb87fc000 },
+  { 0x8400, 0xb8800000 },
+  { 0x8401, 0xb8802000 },
+  { 0x87ff, 0xb8ffe000 },
+  { 0x9000, 0xba000000 },
+  { 0xae66, 0xbdccc000 },
+  { 0xb555, 0xbeaaa000 },
+  { 0xbbff, 0xbf7fe000 },
+  { 0xbc00, 0xbf800000 },
+  { 0xbc01, 0xbf802000 },
+  { 0xc000, 0xc0000000 },
+  { 0xc248, 0xc0490000 },
+  { 0xd7ff, 0xc2ffe000 },
+  { 0xe400, 0xc4800000 },
+  { 0xf800, 0xc7000000 },
+  { 0xfbfe, 0xc77fc000 },
+  { 0xfbff, 0xc77fe000 },
+  { 0xfc00, 0xff800000 },
+
+  // The upper 16 bits of the input are ignored
+  { 0xffff3c00, 0x3f800000 },
+  { 0x80000001, 0x33800000 },
+  { 0x7fff8400, 0xb8800000 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x7c01, 0x7fc02000 },
+  { 0x7d55, 0x7feaa000 },
+  { 0x7dff, 0x7fffe000 },
+  { 0x7e00, 0x7fc00000 },
+  { 0x7f3a, 0x7fe74000 },
+  { 0xfc01, 0xffc02000 },
+  { 0xfe91, 0xffd22000 },
+  { 0xffff, 0xffffe000 },
+};
+
+_Float16
+make_half (uint32_t x)
+{
+  uint16_t h = x;
+  _Float16 r;
+  memcpy (&r, &h, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_float (float x)
+{
+  uint32_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_h2f. */
+      float out = (float)make_half(t->in);
+      uint32_t outbits = unmake_float(out);
+#else
+      extern uint32_t arm_fp_h2f(uint32_t);
+      uint32_t outbits = arm_fp_h2f(t->in);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: h2f(%04" PRIx32 ") -> %08" PRIx32
+		  ", expected %08" PRIx32 "\n", t->in, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,695 @@
+/*
+ * Tests of IEEE 754 half-precision addition and subtraction
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+enum operation
+{
+  ADD,
+  SUB,
+};
+
+struct test
+{
+  enum operation op;
+  uint32_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { ADD, 0x0000, 0x0000, 0x0000 },
+  { ADD, 0x0000, 0x0001, 0x0001 },
+  { ADD, 0x0000, 0x03ff, 0x03ff },
+  { ADD, 0x0000, 0x0400, 0x0400 },
+  { ADD, 0x0000, 0x3c00, 0x3c00 },
+  { ADD, 0x0000, 0x7bff, 0x7bff },
+  { ADD, 0x0000, 0x7c00, 0x7c00 },
+  { ADD, 0x0000, 0x8000, 0x0000 },
+  { ADD, 0x0000, 0x8001, 0x8001 },
+  { ADD, 0x0000, 0x83ff, 0x83ff },
+  { ADD, 0x0000, 0x8400, 0x8400 },
+  { ADD, 0x0000, 0xbc00, 0xbc00 },
+  { ADD, 0x0000, 0xfbff, 0xfbff },
+  { ADD, 0x0000, 0xfc00, 0xfc00 },
+  { ADD, 0x0001, 0x0000, 0x0001 },
+  { ADD, 0x0001, 0x0001, 0x0002 },
+  { ADD, 0x0001, 0x03ff, 0x0400 },
+  { ADD, 0x0001, 0x0400, 0x0401 },
+  { ADD, 0x0001, 0x3c00, 0x3c00 },
+  { ADD, 0x0001, 0x7bff, 0x7bff },
+  { ADD, 0x0001, 0x7c00, 0x7c00 },
+  { ADD, 0x0001, 0x8000, 0x0001 },
+  { ADD, 0x0001, 0x8001, 0x0000 },
+  { ADD, 0x0001, 0x83ff, 0x83fe },
+  { ADD, 0x0001, 0x8400, 0x83ff },
+  { ADD, 0x0001, 0xbc00, 0xbc00 },
+  { ADD, 0x0001, 0xfbff, 0xfbff },
+  { ADD, 0x0001, 0xfc00, 0xfc00 },
+  { ADD, 0x03ff, 0x0000, 0x03ff },
+  { ADD, 0x03ff, 0x0001, 0x0400 },
+  { ADD, 0x03ff, 0x03ff, 0x07fe },
+  { ADD, 0x03ff, 0x0400, 0x07ff },
+  { ADD, 0x03ff, 0x3c00, 0x3c00 },
+  { ADD, 0x03ff, 0x7bff, 0x7bff },
+  { ADD, 0x03ff, 0x7c00, 0x7c00 },
+  { ADD, 0x03ff, 0x8000, 0x03ff },
+  { ADD, 0x03ff, 0x8001, 0x03fe },
+  { ADD, 0x03ff, 0x83ff, 0x0000 },
+  { ADD, 0x03ff, 0x8400, 0x8001 },
+  { ADD, 0x03ff, 0xbc00, 0xbc00 },
+  { ADD, 0x03ff, 0xfbff, 0xfbff },
+  { ADD, 0x03ff, 0xfc00, 0xfc00 },
+  { ADD, 0x0400, 0x0000, 0x0400 },
+  { ADD, 0x0400, 0x0001, 0x0401 },
+  { ADD, 0x0400, 0x03ff, 0x07ff },
+  { ADD, 0x0400, 0x0400, 0x0800 },
+  { ADD, 0x0400, 0x3c00, 0x3c00 },
+  { ADD, 0x0400, 0x7bff, 0x7bff },
+  { ADD, 0x0400, 0x7c00, 0x7c00 },
+  { ADD, 0x0400, 0x8000, 0x0400 },
+  { ADD, 0x0400, 0x8001, 0x03ff },
+  { ADD, 0x0400, 0x83ff, 0x0001 },
+  { ADD, 0x0400, 0x8400, 0x0000 },
+  { ADD, 0x0400, 0xbc00, 0xbc00 },
+  { ADD, 0x0400, 0xfbff, 0xfbff },
+  { ADD, 0x0400, 0xfc00, 0xfc00 },
+  { ADD, 0x04a6, 0x8200, 0x02a6 },
+  { ADD, 0x0c00, 0x8bff, 0x0002 },
+  { ADD, 0x0f3f, 0x1bda, 0x1c61 },
+  { ADD, 0x1201, 0x1400, 0x1700 },
+  { ADD, 0x1600, 0x9e00, 0x9c80 },
+  { ADD, 0x17fe, 0x1cd5, 0x1ed4 },
+  { ADD, 0x197c, 0xa200, 0xa0a1 },
+  { ADD, 0x1e8f, 0xa5f0, 0xa44c },
+  { ADD, 0x2000, 0xa8f1, 0xa7e2 },
+  { ADD, 0x2201, 0x2e30, 0x2ef0 },
+  { ADD, 0x2558, 0x9801, 0x24d8 },
+  { ADD, 0x25a3, 0x3001, 0x30b5 },
+  { ADD, 0x2659, 0x1c01, 0x2759 },
+  { ADD, 0x2c00, 0x3601, 0x3701 },
+  { ADD, 0x3000, 0xb200, 0xac00 },
+  { ADD, 0x33ff, 0xb400, 0x8800 },
+  { ADD, 0x3401, 0x37a4, 0x39d2 },
+  { ADD, 0x35bd, 0xb5bd, 0x0000 },
+  { ADD, 0x3600, 0xbbfe, 0xb8fe },
+  { ADD, 0x3800, 0x37ff, 0x3c00 },
+  { ADD, 0x3c00, 0x0000, 0x3c00 },
+  { ADD, 0x3c00, 0x0001, 0x3c00 },
+  { ADD, 0x3c00, 0x03ff, 0x3c00 },
+  { ADD, 0x3c00, 0x0400, 0x3c00 },
+  { ADD, 0x3c00, 0x3c00, 0x4000 },
+  { ADD, 0x3c00, 0x7bff, 0x7bff },
+  { ADD, 0x3c00, 0x7c00, 0x7c00 },
+  { ADD, 0x3c00, 0x8000, 0x3c00 },
+  { ADD, 0x3c00, 0x8001, 0x3c00 },
+  { ADD, 0x3c00, 0x83ff, 0x3c00 },
+  { ADD, 0x3c00, 0x8400, 0x3c00 },
+  { ADD, 0x3c00, 0xbc00, 0x0000 },
+  { ADD, 0x3c00, 0xfbff, 0xfbff },
+  { ADD, 0x3c00, 0xfc00, 0xfc00 },
+  { ADD, 0x3f14, 0xc401, 0xc078 },
+  { ADD, 0x4001, 0xc001, 0x0000 },
+  { ADD, 0x4731, 0xc730, 0x1c00 },
+  { ADD, 0x4e2a, 0x5258, 0x54b6 },
+  { ADD, 0x5000, 0x4bfe, 0x5200 },
+  { ADD, 0x5901, 0xe001, 0xdd82 },
+  { ADD, 0x5c00, 0xdc00, 0x0000 },
+  { ADD, 0x6001, 0xdc00, 0x5c02 },
+  { ADD, 0x6344, 0xd6d0, 0x626a },
+  { ADD, 0x63ff, 0xe643, 0xe087 },
+  { ADD, 0x67ff, 0xce01, 0x67e7 },
+  { ADD, 0x6801, 0xfa00, 0xf9c0 },
+  { ADD, 0x6a00, 0x5d71, 0x6aae },
+  { ADD, 0x6aad, 0x3bff, 0x6aad },
+  { ADD, 0x6fff, 0xba00, 0x6fff },
+  { ADD, 0x706d, 0xee1a, 0x6980 },
+  { ADD, 0x7323, 0xfbff, 0xfa36 },
+  { ADD, 0x73fe, 0x7401, 0x7800 },
+  { ADD, 0x73fe, 0xf2eb, 0x684c },
+  { ADD, 0x7601, 0x7a00, 0x7c00 },
+  { ADD, 0x77fe, 0xf821, 0xe440 },
+  { ADD, 0x7800, 0xc516, 0x7800 },
+  { ADD, 0x7801, 0xf93a, 0xf0e4 },
+  { ADD, 0x7a00, 0xfa01, 0xd000 },
+  { ADD, 0x7bff, 0x0000, 0x7bff },
+  { ADD, 0x7bff, 0x0001, 0x7bff },
+  { ADD, 0x7bff, 0x03ff, 0x7bff },
+  { ADD, 0x7bff, 0x0400, 0x7bff },
+  { ADD, 0x7bff, 0x3c00, 0x7bff },
+  { ADD, 0x7bff, 0x7bff, 0x7c00 },
+  { ADD, 0x7bff, 0x7c00, 0x7c00 },
+  { ADD, 0x7bff, 0x8000, 0x7bff },
+  { ADD, 0x7bff, 0x8001, 0x7bff },
+  { ADD, 0x7bff, 0x83ff, 0x7bff },
+  { ADD, 0x7bff, 0x8400, 0x7bff },
+  { ADD, 0x7bff, 0xbc00, 0x7bff },
+  { ADD, 0x7bff, 0xfbff, 0x0000 },
+  { ADD, 0x7bff, 0xfc00, 0xfc00 },
+  { ADD, 0x7c00, 0x0000, 0x7c00 },
+  { ADD, 0x7c00, 0x0001, 0x7c00 },
+  { ADD, 0x7c00, 0x03ff, 0x7c00 },
+  { ADD, 0x7c00, 0x0400, 0x7c00 },
+  { ADD, 0x7c00, 0x3c00, 0x7c00 },
+  { ADD, 0x7c00, 0x7bff, 0x7c00 },
+  { ADD, 0x7c00, 0x7c00, 0x7c00 },
+  { ADD, 0x7c00, 0x8000, 0x7c00 },
+  { ADD, 0x7c00, 0x8001, 0x7c00 },
+  { ADD, 0x7c00, 0x83ff, 0x7c00 },
+  { ADD, 0x7c00, 0x8400, 0x7c00 },
+  { ADD, 0x7c00, 0xbc00, 0x7c00 },
+  { ADD, 0x7c00, 0xfbff, 0x7c00 },
+  { ADD, 0x8000, 0x0000, 0x0000 },
+  { ADD, 0x8000, 0x0001, 0x0001 },
+  { ADD, 0x8000, 0x03ff, 0x03ff },
+  { ADD, 0x8000, 0x0400, 0x0400 },
+  { ADD, 0x8000, 0x3c00, 0x3c00 },
+  { ADD, 0x8000, 0x7bff, 0x7bff },
+  { ADD, 0x8000, 0x7c00, 0x7c00 },
+  { ADD, 0x8000, 0x8000, 0x8000 },
+  { ADD, 0x8000, 0x8001, 0x8001 },
+  { ADD, 0x8000, 0x83ff, 0x83ff },
+  { ADD, 0x8000, 0x8400, 0x8400 },
+  { ADD, 0x8000, 0xbc00, 0xbc00 },
+  { ADD, 0x8000, 0xfbff, 0xfbff },
+  { ADD, 0x8000, 0xfc00, 0xfc00 },
+  { ADD, 0x8001, 0x0000, 0x8001 },
+  { ADD, 0x8001, 0x0001, 0x0000 },
+  { ADD, 0x8001, 0x03ff, 0x03fe },
+  { ADD, 0x8001, 0x0400, 0x03ff },
+  { ADD, 0x8001, 0x3c00, 0x3c00 },
+  { ADD, 0x8001, 0x7bff, 0x7bff },
+  { ADD, 0x8001, 0x7c00, 0x7c00 },
+  { ADD, 0x8001, 0x8000, 0x8001 },
+  { ADD, 0x8001, 0x8001, 0x8002 },
+  { ADD, 0x8001, 0x83ff, 0x8400 },
+  { ADD, 0x8001, 0x8400, 0x8401 },
+  { ADD, 0x8001, 0xbc00, 0xbc00 },
+  { ADD, 0x8001, 0xfbff, 0xfbff },
+  { ADD, 0x8001, 0xfc00, 0xfc00 },
+  { ADD, 0x83ff, 0x0000, 0x83ff },
+  { ADD, 0x83ff, 0x0001, 0x83fe },
+  { ADD, 0x83ff, 0x03ff, 0x0000 },
+  { ADD, 0x83ff, 0x0400, 0x0001 },
+  { ADD, 0x83ff, 0x3c00, 0x3c00 },
+  { ADD, 0x83ff, 0x7bff, 0x7bff },
+  { ADD, 0x83ff, 0x7c00, 0x7c00 },
+  { ADD, 0x83ff, 0x8000, 0x83ff },
+  { ADD, 0x83ff, 0x8001, 0x8400 },
+  { ADD, 0x83ff, 0x83ff, 0x87fe },
+  { ADD, 0x83ff, 0x8400, 0x87ff },
+  { ADD, 0x83ff, 0xbc00, 0xbc00 },
+  { ADD, 0x83ff, 0xfbff, 0xfbff },
+  { ADD, 0x83ff, 0xfc00, 0xfc00 },
+  { ADD, 0x8400, 0x0000, 0x8400 },
+  { ADD, 0x8400, 0x0001, 0x83ff },
+  { ADD, 0x8400, 0x03ff, 0x8001 },
+  { ADD, 0x8400, 0x0400, 0x0000 },
+  { ADD, 0x8400, 0x3c00, 0x3c00 },
+  { ADD, 0x8400, 0x7bff, 0x7bff },
+  { ADD, 0x8400, 0x7c00, 0x7c00 },
+  { ADD, 0x8400, 0x8000, 0x8400 },
+  { ADD, 0x8400, 0x8001, 0x8401 },
+  { ADD, 0x8400, 0x83ff, 0x87ff },
+  { ADD, 0x8400, 0x8400, 0x8800 },
+  { ADD, 0x8400, 0xbc00, 0xbc00 },
+  { ADD, 0x8400, 0xfbff, 0xfbff },
+  { ADD, 0x8400, 0xfc00, 0xfc00 },
+  { ADD, 0x8801, 0x8801, 0x8c01 },
+  { ADD, 0x8801, 0xae00, 0xae02 },
+  { ADD, 0x8a01, 0x0000, 0x8a01 },
+  { ADD, 0x9200, 0x11ff, 0x8008 },
+  { ADD, 0x9201, 0x9c01, 0x9cc1 },
+  { ADD, 0x93ff, 0x1c00, 0x1a00 },
+  { ADD, 0x97ff, 0x9801, 0x9c00 },
+  { ADD, 0x98d0, 0xa400, 0xa49a },
+  { ADD, 0x9e01, 0x1600, 0x9c81 },
+  { ADD, 0x9f10, 0x27fe, 0x263a },
+  { ADD, 0xa3ff, 0x23fe, 0x8080 },
+  { ADD, 0xac00, 0xb3ff, 0xb500 },
+  { ADD, 0xae00, 0xabfe, 0xb100 },
+  { ADD, 0xae5b, 0xa3f4, 0xaf5a },
+  { ADD, 0xaffe, 0x2a00, 0xacfe },
+  { ADD, 0xb200, 0x5c01, 0x5c00 },
+  { ADD, 0xb3fe, 0xbc01, 0xbd01 },
+  { ADD, 0xb85b, 0xc600, 0xc68b },
+  { ADD, 0xbbfe, 0x23ff, 0xbbde },
+  { ADD, 0xbc00, 0x0000, 0xbc00 },
+  { ADD, 0xbc00, 0x0001, 0xbc00 },
+  { ADD, 0xbc00, 0x03ff, 0xbc00 },
+  { ADD, 0xbc00, 0x0400, 0xbc00 },
+  { ADD, 0xbc00, 0x3c00, 0x0000 },
+  { ADD, 0xbc00, 0x7bff, 0x7bff },
+  { ADD, 0xbc00, 0x7c00, 0x7c00 },
+  { ADD, 0xbc00, 0x8000, 0xbc00 },
+  { ADD, 0xbc00, 0x8001, 0xbc00 },
+  { ADD, 0xbc00, 0x83ff, 0xbc00 },
+  { ADD, 0xbc00, 0x8400, 0xbc00 },
+  { ADD, 0xbc00, 0xbc00, 0xc000 },
+  { ADD, 0xbc00, 0xcbfe, 0xcc3f },
+  { ADD, 0xbc00, 0xfbff, 0xfbff },
+  { ADD, 0xbc00, 0xfc00, 0xfc00 },
+  { ADD, 0xc200, 0xcfff, 0xd060 },
+  { ADD, 0xc3fe, 0x1bff, 0xc3fc },
+  { ADD, 0xc3ff, 0xbbfe, 0xc4ff },
+  { ADD, 0xc400, 0x4c00, 0x4a00 },
+  { ADD, 0xc600, 0xcd59, 0xced9 },
+  { ADD, 0xc7ff, 0xca00, 0xcd00 },
+  { ADD, 0xcfff, 0xc200, 0xd060 },
+  { ADD, 0xd001, 0x5400, 0x4ffe },
+  { ADD, 0xd001, 0xa800, 0xd002 },
+  { ADD, 0xd601, 0xb001, 0xd603 },
+  { ADD, 0xd7ff, 0x57ff, 0x0000 },
+  { ADD, 0xd800, 0xd3ff, 0xda00 },
+  { ADD, 0xd801, 0x5a68, 0x54ce },
+  { ADD, 0xdab1, 0xdffe, 0xe1ab },
+  { ADD, 0xde00, 0x5e01, 0x3400 },
+  { ADD, 0xde01, 0x5e01, 0x0000 },
+  { ADD, 0xe200, 0xe35e, 0xe6af },
+  { ADD, 0xe201, 0xe801, 0xe981 },
+  { ADD, 0xe7fe, 0xe45b, 0xea2c },
+  { ADD, 0xe993, 0xd801, 0xe9d3 },
+  { ADD, 0xea0c, 0xf773, 0xf81a },
+  { ADD, 0xee22, 0xc82b, 0xee24 },
+  { ADD, 0xf001, 0xf191, 0xf4c9 },
+  { ADD, 0xf201, 0x79fc, 0x787c },
+  { ADD, 0xf201, 0xec00, 0xf400 },
+  { ADD, 0xf400, 0xfa00, 0xfc00 },
+  { ADD, 0xfbff, 0x0000, 0xfbff },
+  { ADD, 0xfbff, 0x0001, 0xfbff },
+  { ADD, 0xfbff, 0x03ff, 0xfbff },
+  { ADD, 0xfbff, 0x0400, 0xfbff },
+  { ADD, 0xfbff, 0x3c00, 0xfbff },
+  { ADD, 0xfbff, 0x7bff, 0x0000 },
+  { ADD, 0xfbff, 0x7c00, 0x7c00 },
+  { ADD, 0xfbff, 0x8000, 0xfbff },
+  { ADD, 0xfbff, 0x8001, 0xfbff },
+  { ADD, 0xfbff, 0x83ff, 0xfbff },
+  { ADD, 0xfbff, 0x8400, 0xfbff },
+  { ADD, 0xfbff, 0xbc00, 0xfbff },
+  { ADD, 0xfbff, 0xfbff, 0xfc00 },
+  { ADD, 0xfbff, 0xfc00, 0xfc00 },
+  { ADD, 0xfc00, 0x0000, 0xfc00 },
+  { ADD, 0xfc00, 0x0001, 0xfc00 },
+  { ADD, 0xfc00, 0x03ff, 0xfc00 },
+  { ADD, 0xfc00, 0x0400, 0xfc00 },
+  { ADD, 0xfc00, 0x3c00, 0xfc00 },
+  { ADD, 0xfc00, 0x7bff, 0xfc00 },
+  { ADD, 0xfc00, 0x8000, 0xfc00 },
+  { ADD, 0xfc00, 0x8001, 0xfc00 },
+  { ADD, 0xfc00, 0x83ff, 0xfc00 },
+  { ADD, 0xfc00, 0x8400, 0xfc00 },
+  { ADD, 0xfc00, 0xbc00, 0xfc00 },
+  { ADD, 0xfc00, 0xfbff, 0xfc00 },
+  { ADD, 0xfc00, 0xfc00, 0xfc00 },
+  { SUB, 0x0000, 0x0000, 0x0000 },
+  { SUB, 0x0000, 0x0001, 0x8001 },
+  { SUB, 0x0000, 0x03ff, 0x83ff },
+  { SUB, 0x0000, 0x0400, 0x8400 },
+  { SUB, 0x0000, 0x3c00, 0xbc00 },
+  { SUB, 0x0000, 0x7bff, 0xfbff },
+  { SUB, 0x0000, 0x7c00, 0xfc00 },
+  { SUB, 0x0000, 0x8000, 0x0000 },
+  { SUB, 0x0000, 0x8001, 0x0001 },
+  { SUB, 0x0000, 0x83fe, 0x03fe },
+  { SUB, 0x0000, 0x83ff, 0x03ff },
+  { SUB, 0x0000, 0x8400, 0x0400 },
+  { SUB, 0x0000, 0xbc00, 0x3c00 },
+  { SUB, 0x0000, 0xfbff, 0x7bff },
+  { SUB, 0x0000, 0xfc00, 0x7c00 },
+  { SUB, 0x0001, 0x0000, 0x0001 },
+  { SUB, 0x0001, 0x0001, 0x0000 },
+  { SUB, 0x0001, 0x03ff, 0x83fe },
+  { SUB, 0x0001, 0x0400, 0x83ff },
+  { SUB, 0x0001, 0x3c00, 0xbc00 },
+  { SUB, 0x0001, 0x7bff, 0xfbff },
+  { SUB, 0x0001, 0x7c00, 0xfc00 },
+  { SUB, 0x0001, 0x8000, 0x0001 },
+  { SUB, 0x0001, 0x8001, 0x0002 },
+  { SUB, 0x0001, 0x83ff, 0x0400 },
+  { SUB, 0x0001, 0x8400, 0x0401 },
+  { SUB, 0x0001, 0xbc00, 0x3c00 },
+  { SUB, 0x0001, 0xfbff, 0x7bff },
+  { SUB, 0x0001, 0xfc00, 0x7c00 },
+  { SUB, 0x0201, 0x8600, 0x0800 },
+  { SUB, 0x03ff, 0x0000, 0x03ff },
+  { SUB, 0x03ff, 0x0001, 0x03fe },
+  { SUB, 0x03ff, 0x03ff, 0x0000 },
+  { SUB, 0x03ff, 0x0400, 0x8001 },
+  { SUB, 0x03ff, 0x3c00, 0xbc00 },
+  { SUB, 0x03ff, 0x7bff, 0xfbff },
+  { SUB, 0x03ff, 0x7c00, 0xfc00 },
+  { SUB, 0x03ff, 0x8000, 0x03ff },
+  { SUB, 0x03ff, 0x8001, 0x0400 },
+  { SUB, 0x03ff, 0x83fe, 0x07fd },
+  { SUB, 0x03ff, 0x83ff, 0x07fe },
+  { SUB, 0x03ff, 0x8400, 0x07ff },
+  { SUB, 0x03ff, 0xbc00, 0x3c00 },
+  { SUB, 0x03ff, 0xfbff, 0x7bff },
+  { SUB, 0x03ff, 0xfc00, 0x7c00 },
+  { SUB, 0x0400, 0x0000, 0x0400 },
+  { SUB, 0x0400, 0x0001, 0x03ff },
+  { SUB, 0x0400, 0x03ff, 0x0001 },
+  { SUB, 0x0400, 0x0400, 0x0000 },
+  { SUB, 0x0400, 0x3c00, 0xbc00 },
+  { SUB, 0x0400, 0x7bff, 0xfbff },
+  { SUB, 0x0400, 0x7c00, 0xfc00 },
+  { SUB, 0x0400, 0x8000, 0x0400 },
+  { SUB, 0x0400, 0x8001, 0x0401 },
+  { SUB, 0x0400, 0x83ff, 0x07ff },
+  { SUB, 0x0400, 0x8400, 0x0800 },
+  { SUB, 0x0400, 0xbc00, 0x3c00 },
+  { SUB, 0x0400, 0xfbff, 0x7bff },
+  { SUB, 0x0400, 0xfc00, 0x7c00 },
+  { SUB, 0x0401, 0x07ff, 0x83fe },
+  { SUB, 0x0ffe, 0x41d9, 0xc1d9 },
+  { SUB, 0x1201, 0x1595, 0x9129 },
+  { SUB, 0x13d6, 0x9a01, 0x1bf6 },
+  { SUB, 0x1400, 0x1ffe, 0x9efe },
+  { SUB, 0x1400, 0x9800, 0x1a00 },
+  { SUB, 0x1498, 0x9bf3, 0x1d20 },
+  { SUB, 0x1801, 0x992c, 0x1c96 },
+  { SUB, 0x1bff, 0x1000, 0x1aff },
+  { SUB, 0x1c01, 0x277d, 0xa67d },
+  { SUB, 0x1e00, 0x8201, 0x1e08 },
+  { SUB, 0x2000, 0x23ff, 0x9ffe },
+  { SUB, 0x2546, 0x9be7, 0x2643 },
+  { SUB, 0x2601, 0x2fff, 0xae7f },
+  { SUB, 0x27ff, 0x1a01, 0x273f },
+  { SUB, 0x27ff, 0xa3ff, 0x29ff },
+  { SUB, 0x2bff, 0x3400, 0xb200 },
+  { SUB, 0x2c00, 0xbbfe, 0x3c3f },
+  { SUB, 0x2ffe, 0xaffd, 0x33fe },
+  { SUB, 0x3043, 0x3c01, 0xbaf1 },
+  { SUB, 0x3201, 0x3c01, 0xba82 },
+  { SUB, 0x365b, 0x3e01, 0xbc6a },
+  { SUB, 0x37fe, 0x44c6, 0xc446 },
+  { SUB, 0x3bff, 0xbbff, 0x3fff },
+  { SUB, 0x3bff, 0xbc00, 0x4000 },
+  { SUB, 0x3c00, 0x0000, 0x3c00 },
+  { SUB, 0x3c00, 0x0001, 0x3c00 },
+  { SUB, 0x3c00, 0x03ff, 0x3c00 },
+  { SUB, 0x3c00, 0x0400, 0x3c00 },
+  { SUB, 0x3c00, 0x3c00, 0x0000 },
+  { SUB, 0x3c00, 0x7bff, 0xfbff },
+  { SUB, 0x3c00, 0x7c00, 0xfc00 },
+  { SUB, 0x3c00, 0x8000, 0x3c00 },
+  { SUB, 0x3c00, 0x8001, 0x3c00 },
+  { SUB, 0x3c00, 0x83ff, 0x3c00 },
+  { SUB, 0x3c00, 0x8400, 0x3c00 },
+  { SUB, 0x3c00, 0xbc00, 0x4000 },
+  { SUB, 0x3c00, 0xfbff, 0x7bff },
+  { SUB, 0x3c00, 0xfc00, 0x7c00 },
+  { SUB, 0x3e00, 0x31d4, 0x3d46 },
+  { SUB, 0x3e01, 0x4800, 0xc680 },
+  { SUB, 0x4800, 0xc400, 0x4a00 },
+  { SUB, 0x5401, 0xd000, 0x5601 },
+  { SUB, 0x57ff, 0xbfff, 0x580f },
+  { SUB, 0x5bfe, 0xdbfe, 0x5ffe },
+  { SUB, 0x5fff, 0x6401, 0xe002 },
+  { SUB, 0x6001, 0x6e00, 0xed80 },
+  { SUB, 0x6001, 0xfbff, 0x7c00 },
+  { SUB, 0x63ff, 0xe7fe, 0x69ff },
+  { SUB, 0x67ff, 0xe200, 0x6980 },
+  { SUB, 0x6a00, 0x6bfe, 0xe3f8 },
+  { SUB, 0x6a01, 0x6d64, 0xe8c7 },
+  { SUB, 0x729d, 0x6e01, 0x6f39 },
+  { SUB, 0x7801, 0xf801, 0x7c00 },
+  { SUB, 0x797d, 0x6e01, 0x78bd },
+  { SUB, 0x7a00, 0xfbfe, 0x7c00 },
+  { SUB, 0x7a01, 0xec13, 0x7a83 },
+  { SUB, 0x7b0b, 0x6c00, 0x7a8b },
+  { SUB, 0x7bff, 0x0000, 0x7bff },
+  { SUB, 0x7bff, 0x0001, 0x7bff },
+  { SUB, 0x7bff, 0x03ff, 0x7bff },
+  { SUB, 0x7bff, 0x0400, 0x7bff },
+  { SUB, 0x7bff, 0x3c00, 0x7bff },
+  { SUB, 0x7bff, 0x7bff, 0x0000 },
+  { SUB, 0x7bff, 0x7c00, 0xfc00 },
+  { SUB, 0x7bff, 0x8000, 0x7bff },
+  { SUB, 0x7bff, 0x8001, 0x7bff },
+  { SUB, 0x7bff, 0x83ff, 0x7bff },
+  { SUB, 0x7bff, 0x8400, 0x7bff },
+  { SUB, 0x7bff, 0xbc00, 0x7bff },
+  { SUB, 0x7bff, 0xfbff, 0x7c00 },
+  { SUB, 0x7bff, 0xfc00, 0x7c00 },
+  { SUB, 0x7c00, 0x0000, 0x7c00 },
+  { SUB, 0x7c00, 0x0001, 0x7c00 },
+  { SUB, 0x7c00, 0x03ff, 0x7c00 },
+  { SUB, 0x7c00, 0x0400, 0x7c00 },
+  { SUB, 0x7c00, 0x3c00, 0x7c00 },
+  { SUB, 0x7c00, 0x7bff, 0x7c00 },
+  { SUB, 0x7c00, 0x8000, 0x7c00 },
+  { SUB, 0x7c00, 0x8001, 0x7c00 },
+  { SUB, 0x7c00, 0x83ff, 0x7c00 },
+  { SUB, 0x7c00, 0x8400, 0x7c00 },
+  { SUB, 0x7c00, 0xbc00, 0x7c00 },
+  { SUB, 0x7c00, 0xfbff, 0x7c00 },
+  { SUB, 0x7c00, 0xfc00, 0x7c00 },
+  { SUB, 0x8000, 0x0000, 0x8000 },
+  { SUB, 0x8000, 0x0001, 0x8001 },
+  { SUB, 0x8000, 0x03ff, 0x83ff },
+  { SUB, 0x8000, 0x0400, 0x8400 },
+  { SUB, 0x8000, 0x3c00, 0xbc00 },
+  { SUB, 0x8000, 0x7bff, 0xfbff },
+  { SUB, 0x8000, 0x7c00, 0xfc00 },
+  { SUB, 0x8000, 0x8000, 0x0000 },
+  { SUB, 0x8000, 0x8001, 0x0001 },
+  { SUB, 0x8000, 0x83ff, 0x03ff },
+  { SUB, 0x8000, 0x8400, 0x0400 },
+  { SUB, 0x8000, 0xbc00, 0x3c00 },
+  { SUB, 0x8000, 0xfbff, 0x7bff },
+  { SUB, 0x8000, 0xfc00, 0x7c00 },
+  { SUB, 0x8001, 0x0000, 0x8001 },
+  { SUB, 0x8001, 0x0001, 0x8002 },
+  { SUB, 0x8001, 0x03ff, 0x8400 },
+  { SUB, 0x8001, 0x0400, 0x8401 },
+  { SUB, 0x8001, 0x3c00, 0xbc00 },
+  { SUB, 0x8001, 0x7bff, 0xfbff },
+  { SUB, 0x8001, 0x7c00, 0xfc00 },
+  { SUB, 0x8001, 0x8000, 0x8001 },
+  { SUB, 0x8001, 0x8001, 0x0000 },
+  { SUB, 0x8001, 0x83ff, 0x03fe },
+  { SUB, 0x8001, 0x8400, 0x03ff },
+  { SUB, 0x8001, 0xbc00, 0x3c00 },
+  { SUB, 0x8001, 0xfbff, 0x7bff },
+  { SUB, 0x8001, 0xfc00, 0x7c00 },
+  { SUB, 0x83ff, 0x0000, 0x83ff },
+  { SUB, 0x83ff, 0x0001, 0x8400 },
+  { SUB, 0x83ff, 0x03ff, 0x87fe },
+  { SUB, 0x83ff, 0x0400, 0x87ff },
+  { SUB, 0x83ff, 0x3c00, 0xbc00 },
+  { SUB, 0x83ff, 0x7bff, 0xfbff },
+  { SUB, 0x83ff, 0x7c00, 0xfc00 },
+  { SUB, 0x83ff, 0x8000, 0x83ff },
+  { SUB, 0x83ff, 0x8001, 0x83fe },
+  { SUB, 0x83ff, 0x83ff, 0x0000 },
+  { SUB, 0x83ff, 0x8400, 0x0001 },
+  { SUB, 0x83ff, 0xbc00, 0x3c00 },
+  { SUB, 0x83ff, 0xfbff, 0x7bff },
+  { SUB, 0x83ff, 0xfc00, 0x7c00 },
+  { SUB, 0x8400, 0x0000, 0x8400 },
+  { SUB, 0x8400, 0x0001, 0x8401 },
+  { SUB, 0x8400, 0x03ff, 0x87ff },
+  { SUB, 0x8400, 0x0400, 0x8800 },
+  { SUB, 0x8400, 0x3c00, 0xbc00 },
+  { SUB, 0x8400, 0x7bff, 0xfbff },
+  { SUB, 0x8400, 0x7c00, 0xfc00 },
+  { SUB, 0x8400, 0x8000, 0x8400 },
+  { SUB, 0x8400, 0x8001, 0x83ff },
+  { SUB, 0x8400, 0x83ff, 0x8001 },
+  { SUB, 0x8400, 0x8400, 0x0000 },
+  { SUB, 0x8400, 0xbc00, 0x3c00 },
+  { SUB, 0x8400, 0xfbff, 0x7bff },
+  { SUB, 0x8400, 0xfc00, 0x7c00 },
+  { SUB, 0x8765, 0x8243, 0x8522 },
+  { SUB, 0x8a01, 0x87fe, 0x8404 },
+  { SUB, 0x8bff, 0xabff, 0x2bf7 },
+  { SUB, 0x8ffe, 0x83fe, 0x8efe },
+  { SUB, 0x9400, 0x13fe, 0x97ff },
+  { SUB, 0x97ff, 0x9a01, 0x1403 },
+  { SUB, 0x9800, 0x00b7, 0x9806 },
+  { SUB, 0x9c00, 0x1c01, 0xa000 },
+  { SUB, 0x9e00, 0x2f2d, 0xaf8d },
+  { SUB, 0xa0bd, 0x0001, 0xa0bd },
+  { SUB, 0xa400, 0x4000, 0xc008 },
+  { SUB, 0xa601, 0x2ffe, 0xb0bf },
+  { SUB, 0xa744, 0x9c01, 0xa644 },
+  { SUB, 0xa7ff, 0xaa00, 0x2401 },
+  { SUB, 0xa800, 0x03ff, 0xa802 },
+  { SUB, 0xac01, 0xa3ff, 0xaa02 },
+  { SUB, 0xb001, 0x0e00, 0xb004 },
+  { SUB, 0xb295, 0x2918, 0xb3db },
+  { SUB, 0xb800, 0x338e, 0xb9e4 },
+  { SUB, 0xbbfe, 0x3bfd, 0xbffe },
+  { SUB, 0xbc00, 0x0000, 0xbc00 },
+  { SUB, 0xbc00, 0x0001, 0xbc00 },
+  { SUB, 0xbc00, 0x03ff, 0xbc00 },
+  { SUB, 0xbc00, 0x0400, 0xbc00 },
+  { SUB, 0xbc00, 0x3c00, 0xc000 },
+  { SUB, 0xbc00, 0x7bff, 0xfbff },
+  { SUB, 0xbc00, 0x7c00, 0xfc00 },
+  { SUB, 0xbc00, 0x8000, 0xbc00 },
+  { SUB, 0xbc00, 0x8001, 0xbc00 },
+  { SUB, 0xbc00, 0x83ff, 0xbc00 },
+  { SUB, 0xbc00, 0x8400, 0xbc00 },
+  { SUB, 0xbc00, 0xbc00, 0x0000 },
+  { SUB, 0xbc00, 0xfbff, 0x7bff },
+  { SUB, 0xbc00, 0xfc00, 0x7c00 },
+  { SUB, 0xc801, 0x63fe, 0xe407 },
+  { SUB, 0xcbfe, 0x4601, 0xcd7f },
+  { SUB, 0xcc00, 0x52df, 0xd470 },
+  { SUB, 0xccac, 0x5401, 0xd52c },
+  { SUB, 0xcd5b, 0xc601, 0xcbb6 },
+  { SUB, 0xcfff, 0x3c00, 0xd020 },
+  { SUB, 0xd201, 0xdffe, 0x5f3e },
+  { SUB, 0xd600, 0x57fe, 0xdaff },
+  { SUB, 0xd800, 0x7800, 0xf804 },
+  { SUB, 0xd801, 0xcc01, 0xd702 },
+  { SUB, 0xd847, 0xd001, 0xd68e },
+  { SUB, 0xde00, 0x5201, 0xdec0 },
+  { SUB, 0xdf78, 0xe43c, 0x60bc },
+  { SUB, 0xe1bb, 0x6563, 0xe820 },
+  { SUB, 0xe800, 0xe3fe, 0xe401 },
+  { SUB, 0xea4a, 0x3c00, 0xea4a },
+  { SUB, 0xec00, 0xe7fe, 0xe801 },
+  { SUB, 0xec01, 0xe600, 0xe902 },
+  { SUB, 0xf201, 0x77ff, 0xf980 },
+  { SUB, 0xf3ff, 0x7201, 0xf700 },
+  { SUB, 0xf601, 0x7602, 0xfa02 },
+  { SUB, 0xf67e, 0x767d, 0xfa7e },
+  { SUB, 0xfbff, 0x0000, 0xfbff },
+  { SUB, 0xfbff, 0x0001, 0xfbff },
+  { SUB, 0xfbff, 0x03ff, 0xfbff },
+  { SUB, 0xfbff, 0x0400, 0xfbff },
+  { SUB, 0xfbff, 0x3c00, 0xfbff },
+  { SUB, 0xfbff, 0x7bff, 0xfc00 },
+  { SUB, 0xfbff, 0x7c00, 0xfc00 },
+  { SUB, 0xfbff, 0x8000, 0xfbff },
+  { SUB, 0xfbff, 0x8001, 0xfbff },
+  { SUB, 0xfbff, 0x83ff, 0xfbff },
+  { SUB, 0xfbff, 0x8400, 0xfbff },
+  { SUB, 0xfbff, 0xbc00, 0xfbff },
+  { SUB, 0xfbff, 0xfbff, 0x0000 },
+  { SUB, 0xfbff, 0xfc00, 0x7c00 },
+  { SUB, 0xfc00, 0x0000, 0xfc00 },
+  { SUB, 0xfc00, 0x0001, 0xfc00 },
+  { SUB, 0xfc00, 0x03ff, 0xfc00 },
+  { SUB, 0xfc00, 0x0400, 0xfc00 },
+  { SUB, 0xfc00, 0x3c00, 0xfc00 },
+  { SUB, 0xfc00, 0x7bff, 0xfc00 },
+  { SUB, 0xfc00, 0x7c00, 0xfc00 },
+  { SUB, 0xfc00, 0x8000, 0xfc00 },
+  { SUB, 0xfc00, 0x8001, 0xfc00 },
+  { SUB, 0xfc00, 0x83ff, 0xfc00 },
+  { SUB, 0xfc00, 0x8400, 0xfc00 },
+  { SUB, 0xfc00, 0xbc00, 0xfc00 },
+  { SUB, 0xfc00, 0xfbff, 0xfc00 },
+
+  // The upper 16 bits of the inputs are ignored
+  { ADD, 0xffff3c00, 0x00014000, 0x4200 },
+  { ADD, 0x12343555, 0xfedcb800, 0xb156 },
+  { SUB, 0xffff3c00, 0x00014000, 0xbc00 },
+  { SUB, 0x12343555, 0xfedcb800, 0x3aaa },
+
+  // Tests that do depend on Arm NaN policy
+  { ADD, 0x0000, 0x7f3a, 0x7f3a },
+  { ADD, 0x0001, 0x7d55, 0x7f55 },
+  { ADD, 0x3c00, 0x7f3a, 0x7f3a },
+  { ADD, 0x7c00, 0xfc00, 0x7e00 },
+  { ADD, 0x7c01, 0x0000, 0x7e01 },
+  { ADD, 0x7c01, 0x7c00, 0x7e01 },
+  { ADD, 0x7c01, 0x7d55, 0x7e01 },
+  { ADD, 0x7c01, 0x7f3a, 0x7e01 },
+  { ADD, 0x7d55, 0x0000, 0x7f55 },
+  { ADD, 0x7d55, 0xfc00, 0x7f55 },
+  { ADD, 0x7e00, 0x7f3a, 0x7e00 },
+  { ADD, 0x7f3a, 0x3c00, 0x7f3a },
+  { ADD, 0x7f3a, 0x7c00, 0x7f3a },
+  { ADD, 0xfc00, 0x7c00, 0x7e00 },
+  { ADD, 0xfc00, 0xfc2b, 0xfe2b },
+  { ADD, 0xfc2b, 0x0000, 0xfe2b },
+  { ADD, 0xfc2b, 0x3c00, 0xfe2b },
+  { ADD, 0xfe91, 0xfc00, 0xfe91 },
+  { SUB, 0x7bff, 0x7c01, 0x7e01 },
+  { SUB, 0x7c00, 0x7c00, 0x7e00 },
+  { SUB, 0x7c00, 0x7c01, 0x7e01 },
+  { SUB, 0x7c01, 0x7c01, 0x7e01 },
+  { SUB, 0x7c01, 0xfc2b, 0x7e01 },
+  { SUB, 0x7d55, 0x0000, 0x7f55 },
+  { SUB, 0x7d55, 0x0001, 0x7f55 },
+  { SUB, 0x7d55, 0x7bff, 0x7f55 },
+  { SUB, 0x7d55, 0x7c00, 0x7f55 },
+  { SUB, 0x7e00, 0x3c00, 0x7e00 },
+  { SUB, 0x7f3a, 0x0000, 0x7f3a },
+  { SUB, 0x7f3a, 0x3c00, 0x7f3a },
+  { SUB, 0xfc00, 0xfc00, 0x7e00 },
+  { SUB, 0xfc2b, 0x3c00, 0xfe2b },
+  { SUB, 0xfe91, 0x3c00, 0xfe91 },
+  { SUB, 0xfe91, 0x7d55, 0x7f55 },
+  { SUB, 0xfe91, 0x7e00, 0xfe91 },
+};
+
+_Float16
+make_half (uint32_t x)
+{
+  uint16_t h = x;
+  _Float16 r;
+  memcpy (&r, &h, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_half (_Float16 x)
+{
+  uint16_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_hadd and arm_fp_hsub. */
+      _Float16 in1 = make_half (t->in1);
+      _Float16 in2 = make_half (t->in2);
+      _Float16 out = (t->op == ADD ? in1 + in2 : in1 - in2);
+      uint32_t outbits = unmake_half (out);
+#else
+      extern uint32_t arm_fp_hadd(uint32_t, uint32_t);
+      extern uint32_t arm_fp_hsub(uint32_t, uint32_t);
+      uint32_t outbits = (t->op == ADD ? arm_fp_hadd(t->in1, t->in2) :
+                          arm_fp_hsub(t->in1, t->in2));
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: %s(%04" PRIx32 ", %04" PRIx32 ") -> %04" PRIx32
+		  ", expected %04" PRIx32 "\n",
+                  (t->op == ADD ? "hadd" : "hsub"),
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
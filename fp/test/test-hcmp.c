@@ -0,0 +1,548 @@
+/*
+ * Tests of IEEE 754 half-precision comparison
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+enum FloatCompareResult {
+  FCR_LT, FCR_EQ, FCR_GT, FCR_UN,
+};
+
+static const char *const result_strings[] = {
+  "less", "equal", "greater", "unordered",
+};
+
+struct test
+{
+  uint32_t in1, in2;
+  enum FloatCompareResult out;
+};
+
+static const struct test tests[] = {
+  { 0x0000, 0x0000, FCR_EQ },
+  { 0x0000, 0x0001, FCR_LT },
+  { 0x0000, 0x0002, FCR_LT },
+  { 0x0000, 0x0400, FCR_LT },
+  { 0x0000, 0x3bff, FCR_LT },
+  { 0x0000, 0x3c01, FCR_LT },
+  { 0x0000, 0x7bff, FCR_LT },
+  { 0x0000, 0x7c01, FCR_UN },
+  { 0x0000, 0x7e00, FCR_UN },
+  { 0x0000, 0x8000, FCR_EQ },
+  { 0x0000, 0x83ff, FCR_GT },
+  { 0x0000, 0xbc00, FCR_GT },
+  { 0x0000, 0xfbff, FCR_GT },
+  { 0x0000, 0xfc00, FCR_GT },
+  { 0x0000, 0xfd55, FCR_UN },
+  { 0x0001, 0x0001, FCR_EQ },
+  { 0x0001, 0x3bff, FCR_LT },
+  { 0x0001, 0x3c00, FCR_LT },
+  { 0x0001, 0x8001, FCR_GT },
+  { 0x0001, 0x83ff, FCR_GT },
+  { 0x0001, 0x8400, FCR_GT },
+  { 0x0001, 0xfbff, FCR_GT },
+  { 0x0002, 0x0001, FCR_GT },
+  { 0x0002, 0x0002, FCR_EQ },
+  { 0x0002, 0x03ff, FCR_LT },
+  { 0x0002, 0x0400, FCR_LT },
+  { 0x0002, 0x7bff, FCR_LT },
+  { 0x0002, 0x7c00, FCR_LT },
+  { 0x0002, 0x8000, FCR_GT },
+  { 0x0002, 0x8001, FCR_GT },
+  { 0x0002, 0xfc00, FCR_GT },
+  { 0x03ff, 0x0000, FCR_GT },
+  { 0x03ff, 0x03ff, FCR_EQ },
+  { 0x03ff, 0x3c00, FCR_LT },
+  { 0x03ff, 0x7c00, FCR_LT },
+  { 0x03ff, 0x8000, FCR_GT },
+  { 0x03ff, 0x8001, FCR_GT },
+  { 0x03ff, 0xfbff, FCR_GT },
+  { 0x0400, 0x0001, FCR_GT },
+  { 0x0400, 0x0002, FCR_GT },
+  { 0x0400, 0x03ff, FCR_GT },
+  { 0x0400, 0x0400, FCR_EQ },
+  { 0x0400, 0x3bff, FCR_LT },
+  { 0x0400, 0x3c00, FCR_LT },
+  { 0x0400, 0x3c01, FCR_LT },
+  { 0x0400, 0x7c00, FCR_LT },
+  { 0x0400, 0xfc00, FCR_GT },
+  { 0x04a6, 0x8200, FCR_GT },
+  { 0x0be8, 0x87b4, FCR_GT },
+  { 0x0d37, 0x8ffe, FCR_GT },
+  { 0x0e00, 0x0b89, FCR_GT },
+  { 0x13fe, 0x92eb, FCR_GT },
+  { 0x2659, 0x2401, FCR_GT },
+  { 0x2e01, 0xafff, FCR_GT },
+  { 0x30fb, 0x32f8, FCR_LT },
+  { 0x3800, 0x3ffe, FCR_LT },
+  { 0x3bff, 0x0000, FCR_GT },
+  { 0x3bff, 0x0001, FCR_GT },
+  { 0x3bff, 0x0400, FCR_GT },
+  { 0x3bff, 0x3bff, FCR_EQ },
+  { 0x3bff, 0x3c00, FCR_LT },
+  { 0x3bff, 0x3c01, FCR_LT },
+  { 0x3bff, 0x8001, FCR_GT },
+  { 0x3bff, 0xb819, FCR_GT },
+  { 0x3bff, 0xbc00, FCR_GT },
+  { 0x3bff, 0xfbff, FCR_GT },
+  { 0x3c00, 0x0000, FCR_GT },
+  { 0x3c00, 0x0400, FCR_GT },
+  { 0x3c00, 0x3c00, FCR_EQ },
+  { 0x3c00, 0x3c01, FCR_LT },
+  { 0x3c00, 0x7c01, FCR_UN },
+  { 0x3c00, 0x7e00, FCR_UN },
+  { 0x3c00, 0x8001, FCR_GT },
+  { 0x3c00, 0x8400, FCR_GT },
+  { 0x3c00, 0xfbff, FCR_GT },
+  { 0x3c00, 0xfd55, FCR_UN },
+  { 0x3c01, 0x0000, FCR_GT },
+  { 0x3c01, 0x0001, FCR_GT },
+  { 0x3c01, 0x0002, FCR_GT },
+  { 0x3c01, 0x03ff, FCR_GT },
+  { 0x3c01, 0x3c00, FCR_GT },
+  { 0x3c01, 0x3c01, FCR_EQ },
+  { 0x3c01, 0x7bff, FCR_LT },
+  { 0x3c01, 0x8000, FCR_GT },
+  { 0x3c01, 0x83ff, FCR_GT },
+  { 0x3c01, 0x8400, FCR_GT },
+  { 0x3c01, 0xb93a, FCR_GT },
+  { 0x3c01, 0xbc00, FCR_GT },
+  { 0x3c01, 0xbffe, FCR_GT },
+  { 0x3c01, 0xfbff, FCR_GT },
+  { 0x43fe, 0xbfff, FCR_GT },
+  { 0x47ff, 0xc000, FCR_GT },
+  { 0x4cde, 0xcbff, FCR_GT },
+  { 0x4e2a, 0x5258, FCR_LT },
+  { 0x6601, 0x63fe, FCR_GT },
+  { 0x6601, 0x6663, FCR_LT },
+  { 0x6801, 0xee00, FCR_GT },
+  { 0x6aad, 0x67ff, FCR_GT },
+  { 0x6fff, 0xea00, FCR_GT },
+  { 0x706d, 0xf21a, FCR_GT },
+  { 0x77fe, 0xf421, FCR_GT },
+  { 0x7800, 0xf516, FCR_GT },
+  { 0x797c, 0xfa00, FCR_GT },
+  { 0x7bff, 0x03ff, FCR_GT },
+  { 0x7bff, 0x3bff, FCR_GT },
+  { 0x7bff, 0x3c00, FCR_GT },
+  { 0x7bff, 0x7bff, FCR_EQ },
+  { 0x7bff, 0x8000, FCR_GT },
+  { 0x7bff, 0x8001, FCR_GT },
+  { 0x7bff, 0x83ff, FCR_GT },
+  { 0x7bff, 0xbc00, FCR_GT },
+  { 0x7bff, 0xfbff, FCR_GT },
+  { 0x7c00, 0x0000, FCR_GT },
+  { 0x7c00, 0x0001, FCR_GT },
+  { 0x7c00, 0x0002, FCR_GT },
+  { 0x7c00, 0x3c00, FCR_GT },
+  { 0x7c00, 0x3c01, FCR_GT },
+  { 0x7c00, 0x7c00, FCR_EQ },
+  { 0x7c00, 0x7c01, FCR_UN },
+  { 0x7c00, 0x7e00, FCR_UN },
+  { 0x7c00, 0x8000, FCR_GT },
+  { 0x7c00, 0x8001, FCR_GT },
+  { 0x7c00, 0x83ff, FCR_GT },
+  { 0x7c00, 0xbc00, FCR_GT },
+  { 0x7c00, 0xfbff, FCR_GT },
+  { 0x7c00, 0xfd55, FCR_UN },
+  { 0x7c01, 0x0000, FCR_UN },
+  { 0x7c01, 0x3c00, FCR_UN },
+  { 0x7c01, 0x7c00, FCR_UN },
+  { 0x7c01, 0x7c01, FCR_UN },
+  { 0x7c01, 0x7e00, FCR_UN },
+  { 0x7c01, 0xfc00, FCR_UN },
+  { 0x7c01, 0xfd55, FCR_UN },
+  { 0x7c01, 0xfe00, FCR_UN },
+  { 0x7e00, 0x0000, FCR_UN },
+  { 0x7e00, 0x3c00, FCR_UN },
+  { 0x7e00, 0x7c00, FCR_UN },
+  { 0x7e00, 0x7c01, FCR_UN },
+  { 0x7e00, 0xfc00, FCR_UN },
+  { 0x7e00, 0xfe00, FCR_UN },
+  { 0x8000, 0x0000, FCR_EQ },
+  { 0x8000, 0x0001, FCR_LT },
+  { 0x8000, 0x0002, FCR_LT },
+  { 0x8000, 0x0400, FCR_LT },
+  { 0x8000, 0x3bff, FCR_LT },
+  { 0x8000, 0x7bff, FCR_LT },
+  { 0x8000, 0x7c00, FCR_LT },
+  { 0x8000, 0x8000, FCR_EQ },
+  { 0x8000, 0x8001, FCR_GT },
+  { 0x8000, 0xbc00, FCR_GT },
+  { 0x8000, 0xfbff, FCR_GT },
+  { 0x8001, 0x0000, FCR_LT },
+  { 0x8001, 0x0001, FCR_LT },
+  { 0x8001, 0x03ff, FCR_LT },
+  { 0x8001, 0x7c00, FCR_LT },
+  { 0x8001, 0x8001, FCR_EQ },
+  { 0x8001, 0x8400, FCR_GT },
+  { 0x8001, 0xfbff, FCR_GT },
+  { 0x8001, 0xfc00, FCR_GT },
+  { 0x83ff, 0x0000, FCR_LT },
+  { 0x83ff, 0x0002, FCR_LT },
+  { 0x83ff, 0x03ff, FCR_LT },
+  { 0x83ff, 0x0400, FCR_LT },
+  { 0x83ff, 0x3c00, FCR_LT },
+  { 0x83ff, 0x7bff, FCR_LT },
+  { 0x83ff, 0x8000, FCR_LT },
+  { 0x83ff, 0x83ff, FCR_EQ },
+  { 0x83ff, 0x8400, FCR_GT },
+  { 0x83ff, 0xbc00, FCR_GT },
+  { 0x83ff, 0xfbff, FCR_GT },
+  { 0x8400, 0x0001, FCR_LT },
+  { 0x8400, 0x0002, FCR_LT },
+  { 0x8400, 0x03ff, FCR_LT },
+  { 0x8400, 0x0400, FCR_LT },
+  { 0x8400, 0x3c01, FCR_LT },
+  { 0x8400, 0x8000, FCR_LT },
+  { 0x8400, 0x8001, FCR_LT },
+  { 0x8400, 0x83ff, FCR_LT },
+  { 0x8400, 0x8400, FCR_EQ },
+  { 0x8400, 0xbc00, FCR_GT },
+  { 0x8401, 0x8a01, FCR_GT },
+  { 0x8801, 0x87fe, FCR_LT },
+  { 0xa00e, 0x2000, FCR_LT },
+  { 0xb212, 0x33fe, FCR_LT },
+  { 0xb601, 0xb4b8, FCR_LT },
+  { 0xbc00, 0x0002, FCR_LT },
+  { 0xbc00, 0x03ff, FCR_LT },
+  { 0xbc00, 0x0400, FCR_LT },
+  { 0xbc00, 0x3bff, FCR_LT },
+  { 0xbc00, 0x3c01, FCR_LT },
+  { 0xbc00, 0x7bff, FCR_LT },
+  { 0xbc00, 0x7c00, FCR_LT },
+  { 0xbc00, 0x8000, FCR_LT },
+  { 0xbc00, 0x8001, FCR_LT },
+  { 0xbc00, 0x8400, FCR_LT },
+  { 0xbc00, 0xbc00, FCR_EQ },
+  { 0xbc00, 0xfc00, FCR_GT },
+  { 0xc201, 0x3e00, FCR_LT },
+  { 0xc3fe, 0x3fff, FCR_LT },
+  { 0xd058, 0xcf58, FCR_LT },
+  { 0xd50e, 0xd270, FCR_LT },
+  { 0xd601, 0xd001, FCR_LT },
+  { 0xebff, 0x6f81, FCR_LT },
+  { 0xee22, 0xe82b, FCR_LT },
+  { 0xf001, 0xf191, FCR_GT },
+  { 0xf201, 0xf000, FCR_LT },
+  { 0xfbfe, 0xf800, FCR_LT },
+  { 0xfbff, 0x0000, FCR_LT },
+  { 0xfbff, 0x3bff, FCR_LT },
+  { 0xfbff, 0x3c00, FCR_LT },
+  { 0xfbff, 0x3c01, FCR_LT },
+  { 0xfbff, 0x7bff, FCR_LT },
+  { 0xfbff, 0x8400, FCR_LT },
+  { 0xfbff, 0xbc00, FCR_LT },
+  { 0xfbff, 0xfbff, FCR_EQ },
+  { 0xfc00, 0x0000, FCR_LT },
+  { 0xfc00, 0x0002, FCR_LT },
+  { 0xfc00, 0x0400, FCR_LT },
+  { 0xfc00, 0x3bff, FCR_LT },
+  { 0xfc00, 0x3c00, FCR_LT },
+  { 0xfc00, 0x3c01, FCR_LT },
+  { 0xfc00, 0x7c00, FCR_LT },
+  { 0xfc00, 0x7c01, FCR_UN },
+  { 0xfc00, 0x7e00, FCR_UN },
+  { 0xfc00, 0x8400, FCR_LT },
+  { 0xfc00, 0xfc00, FCR_EQ },
+  { 0xfc00, 0xfd55, FCR_UN },
+  { 0xfd55, 0x0000, FCR_UN },
+  { 0xfd55, 0x3c00, FCR_UN },
+  { 0xfd55, 0x7c00, FCR_UN },
+  { 0xfd55, 0x7c01, FCR_UN },
+  { 0xfd55, 0xfc00, FCR_UN },
+  { 0xfd55, 0xfe00, FCR_UN },
+  { 0xfe00, 0x7c01, FCR_UN },
+  { 0xfe00, 0x7e00, FCR_UN },
+  { 0xfe00, 0xfd55, FCR_UN },
+
+  // The upper 16 bits of the inputs are ignored
+  { 0xffff0000, 0x00008000, FCR_EQ },
+  { 0x80003c00, 0x00013c00, FCR_EQ },
+  { 0x7fff0001, 0x00007c01, FCR_UN },
+  { 0x12343c00, 0x0000bc00, FCR_GT },
+};
+
+_Float16
+make_half (uint32_t x)
+{
+  uint16_t h = x;
+  _Float16 r;
+  memcpy (&r, &h, sizeof (r));
+  return r;
+}
+
+/* Three-way return value in the flags (plus a fourth state that
+ * should never happen) */
+
+enum Flag3 {
+  FLAG3_LO = 0,
+  FLAG3_EQ = 1,
+  FLAG3_HI = 2,
+  FLAG3_CONFUSED = 3,
+};
+
+static const char *const flag3_strings[] = {
+  "LO", "EQ", "HI", "confused (C=0 but Z=1)",
+};
+
+#define CALL_FLAG3_RETURNING_FUNCTION(outvar, in0, in1, fn) do { \
+    register uint32_t r0 __asm__("r0");                         \
+    register uint32_t r1 __asm__("r1");                         \
+    r0 = in0;                                                   \
+    r1 = in1;                                                   \
+    __asm__("bl " fn "\n\t"                                     \
+            "bhi 1f \n\t"                                       \
+            "bcs 2f \n\t"                                       \
+            "bne 3f \n\t"                                       \
+            "movs %0, #3 \n\t"                                  \
+            "b 4f \n\t"                                         \
+            "1: movs %0, #2 \n\t"                               \
+            "b 4f \n\t"                                         \
+            "2: movs %0, #1 \n\t"                               \
+            "b 4f \n\t"                                         \
+            "3: movs %0, #0 \n\t"                               \
+            "4:"                                                \
+            : "=r" (outvar)                                     \
+            : "r" (r0), "r" (r1)                                \
+            : "r2", "r3", "r12", "r14", "cc");                  \
+      } while (0)
+
+/* Two-way return value in the flags */
+
+enum Flag2 {
+  FLAG2_NE = 0,
+  FLAG2_EQ = 1,
+};
+
+static const char *const flag2_strings[] = {
+  "NE", "EQ",
+};
+
+#define CALL_FLAG2_RETURNING_FUNCTION(outvar, in0, in1, fn) do { \
+    register uint32_t r0 __asm__("r0");                         \
+    register uint32_t r1 __asm__("r1");                         \
+    r0 = in0;                                                   \
+    r1 = in1;                                                   \
+    __asm__("bl " fn "\n\t"                                     \
+            "beq 1f \n\t"                                       \
+            "movs %0, #0 \n\t"                                  \
+            "b 2f \n\t"                                         \
+            "1: movs %0, #1 \n\t"                               \
+            "2:"                                                \
+            : "=r" (outvar)                                     \
+            : "r" (r0), "r" (r1)                                \
+            : "r2", "r3", "r12", "r14", "cc");                  \
+      } while (0)
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_hcmp_*. */
+      _Float16 in1 = make_half (t->in1);
+      _Float16 in2 = make_half (t->in2);
+#endif
+
+      /* Test the individual comparison functions one at a time. */
+      {
+        extern uint32_t arm_fp_hcmp_bool_eq(uint32_t, uint32_t);
+        unsigned eq_expected = (t->out == FCR_EQ);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned eq_got = (in1 == in2);
+#else
+        unsigned eq_got = arm_fp_hcmp_bool_eq(t->in1, t->in2);
+#endif
+
+        if (eq_got != eq_expected)
+	{
+	  printf ("FAIL: hcmp_bool_eq(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, eq_got, eq_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_bool_lt(uint32_t, uint32_t);
+        unsigned lt_expected = (t->out == FCR_LT);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned lt_got = isless(in1, in2);
+#else
+        unsigned lt_got = arm_fp_hcmp_bool_lt(t->in1, t->in2);
+#endif
+
+        if (lt_got != lt_expected)
+	{
+	  printf ("FAIL: hcmp_bool_lt(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, lt_got, lt_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_bool_le(uint32_t, uint32_t);
+        unsigned le_expected = (t->out == FCR_LT || t->out == FCR_EQ);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned le_got = islessequal(in1, in2);
+#else
+        unsigned le_got = arm_fp_hcmp_bool_le(t->in1, t->in2);
+#endif
+
+        if (le_got != le_expected)
+	{
+	  printf ("FAIL: hcmp_bool_le(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, le_got, le_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_bool_gt(uint32_t, uint32_t);
+        unsigned gt_expected = (t->out == FCR_GT);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned gt_got = isgreater(in1, in2);
+#else
+        unsigned gt_got = arm_fp_hcmp_bool_gt(t->in1, t->in2);
+#endif
+
+        if (gt_got != gt_expected)
+	{
+	  printf ("FAIL: hcmp_bool_gt(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, gt_got, gt_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_bool_ge(uint32_t, uint32_t);
+        unsigned ge_expected = (t->out == FCR_GT || t->out == FCR_EQ);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned ge_got = isgreaterequal(in1, in2);
+#else
+        unsigned ge_got = arm_fp_hcmp_bool_ge(t->in1, t->in2);
+#endif
+
+        if (ge_got != ge_expected)
+	{
+	  printf ("FAIL: hcmp_bool_ge(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, ge_got, ge_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_bool_un(uint32_t, uint32_t);
+        unsigned un_expected = (t->out == FCR_UN);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned un_got = isunordered(in1, in2);
+#else
+        unsigned un_got = arm_fp_hcmp_bool_un(t->in1, t->in2);
+#endif
+
+        if (un_got != un_expected)
+	{
+	  printf ("FAIL: hcmp_bool_un(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, un_got, un_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_gnu_cmp(uint32_t, uint32_t);
+        unsigned cmp_expected = (t->out == FCR_LT ? -1 : t->out == FCR_EQ ? 0 : +1);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned cmp_got = isless(in1, in2) ? -1 : islessequal(in1, in2) ? 0 : +1;
+#else
+        unsigned cmp_got = arm_fp_hcmp_gnu_cmp(t->in1, t->in2);
+#endif
+
+        if (cmp_got != cmp_expected)
+	{
+	  printf ("FAIL: hcmp_gnu_cmp(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, cmp_got, cmp_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        extern uint32_t arm_fp_hcmp_gnu_rcmp(uint32_t, uint32_t);
+        unsigned cmp_expected = (t->out == FCR_GT ? +1 : t->out == FCR_EQ ? 0 : -1);
+#ifdef USE_NATIVE_ARITHMETIC
+        unsigned cmp_got = isgreater(in1, in2) ? +1 : isgreaterequal(in1, in2) ? 0 : -1;
+#else
+        unsigned cmp_got = arm_fp_hcmp_gnu_rcmp(t->in1, t->in2);
+#endif
+
+        if (cmp_got != cmp_expected)
+	{
+	  printf ("FAIL: hcmp_gnu_rcmp(%04" PRIx32 ", %04" PRIx32 ") -> %u, expected %u (full result is '%s')\n",
+		  t->in1, t->in2, cmp_got, cmp_expected, result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        unsigned fl_expected = (t->out == FCR_EQ ? FLAG2_EQ : FLAG2_NE);
+        unsigned fl_got;
+        CALL_FLAG2_RETURNING_FUNCTION(fl_got, t->in1, t->in2, "arm_fp_hcmp_flags_eq");
+
+        if (fl_got != fl_expected)
+	{
+	  printf ("FAIL: hcmp_flags_eq(%04" PRIx32 ", %04" PRIx32 ") -> %s, expected %s (full result is '%s')\n",
+		  t->in1, t->in2, flag2_strings[fl_got], flag2_strings[fl_expected], result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        unsigned fl_expected = (t->out == FCR_EQ ? FLAG3_EQ :
+                                t->out == FCR_LT ? FLAG3_LO :
+                                FLAG3_HI);
+        unsigned fl_got;
+        CALL_FLAG3_RETURNING_FUNCTION(fl_got, t->in1, t->in2, "arm_fp_hcmp_flags");
+
+        if (fl_got != fl_expected)
+	{
+	  printf ("FAIL: hcmp_flags(%04" PRIx32 ", %04" PRIx32 ") -> %s, expected %s (full result is '%s')\n",
+		  t->in1, t->in2, flag3_strings[fl_got], flag3_strings[fl_expected], result_strings[t->out]);
+	  failed = true;
+	}
+      }
+
+      {
+        unsigned fl_expected = (t->out == FCR_EQ ? FLAG3_EQ :
+                                t->out == FCR_GT ? FLAG3_LO :
+                                FLAG3_HI);
+        unsigned fl_got;
+        CALL_FLAG3_RETURNING_FUNCTION(fl_got, t->in1, t->in2, "arm_fp_hcmp_flags_rev");
+
+        if (fl_got != fl_expected)
+	{
+	  printf ("FAIL: hcmp_flags_rev(%04" PRIx32 ", %04" PRIx32 ") -> %s, expected %s (full result is '%s')\n",
+		  t->in1, t->in2, flag3_strings[fl_got], flag3_strings[fl_expected], result_strings[t->out]);
+	  failed = true;
+	}
+      }
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,485 @@
+/*
+ * Tests of IEEE 754 half-precision multiplication
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+struct test
+{
+  uint32_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific NaN policy
+  { 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0001, 0x0000 },
+  { 0x0000, 0x03ff, 0x0000 },
+  { 0x0000, 0x0400, 0x0000 },
+  { 0x0000, 0x07fe, 0x0000 },
+  { 0x0000, 0x3c00, 0x0000 },
+  { 0x0000, 0x7bff, 0x0000 },
+  { 0x0000, 0x8000, 0x8000 },
+  { 0x0000, 0x8001, 0x8000 },
+  { 0x0000, 0x83ff, 0x8000 },
+  { 0x0000, 0x8400, 0x8000 },
+  { 0x0000, 0xbc00, 0x8000 },
+  { 0x0000, 0xfbff, 0x8000 },
+  { 0x0001, 0x0000, 0x0000 },
+  { 0x0001, 0x0001, 0x0000 },
+  { 0x0001, 0x03ff, 0x0000 },
+  { 0x0001, 0x0400, 0x0000 },
+  { 0x0001, 0x3c00, 0x0001 },
+  { 0x0001, 0x7bff, 0x1bff },
+  { 0x0001, 0x7c00, 0x7c00 },
+  { 0x0001, 0x8000, 0x8000 },
+  { 0x0001, 0x8001, 0x8000 },
+  { 0x0001, 0x83ff, 0x8000 },
+  { 0x0001, 0x8400, 0x8000 },
+  { 0x0001, 0x8bfe, 0x8000 },
+  { 0x0001, 0xbc00, 0x8001 },
+  { 0x0001, 0xfbff, 0x9bff },
+  { 0x0001, 0xfc00, 0xfc00 },
+  { 0x0273, 0x9a4b, 0x8002 },
+  { 0x03ff, 0x0000, 0x0000 },
+  { 0x03ff, 0x0001, 0x0000 },
+  { 0x03ff, 0x03ff, 0x0000 },
+  { 0x03ff, 0x0400, 0x0000 },
+  { 0x03ff, 0x17ff, 0x0002 },
+  { 0x03ff, 0x3c00, 0x03ff },
+  { 0x03ff, 0x7bff, 0x43fd },
+  { 0x03ff, 0x7c00, 0x7c00 },
+  { 0x03ff, 0x8000, 0x8000 },
+  { 0x03ff, 0x8001, 0x8000 },
+  { 0x03ff, 0x83ff, 0x8000 },
+  { 0x03ff, 0x8400, 0x8000 },
+  { 0x03ff, 0xbc00, 0x83ff },
+  { 0x03ff, 0xfbff, 0xc3fd },
+  { 0x03ff, 0xfc00, 0xfc00 },
+  { 0x0400, 0x0000, 0x0000 },
+  { 0x0400, 0x0001, 0x0000 },
+  { 0x0400, 0x03ff, 0x0000 },
+  { 0x0400, 0x0400, 0x0000 },
+  { 0x0400, 0x3c00, 0x0400 },
+  { 0x0400, 0x7bff, 0x43ff },
+  { 0x0400, 0x7c00, 0x7c00 },
+  { 0x0400, 0x8000, 0x8000 },
+  { 0x0400, 0x8001, 0x8000 },
+  { 0x0400, 0x83ff, 0x8000 },
+  { 0x0400, 0x8400, 0x8000 },
+  { 0x0400, 0xbc00, 0x8400 },
+  { 0x0400, 0xfbff, 0xc3ff },
+  { 0x0400, 0xfc00, 0xfc00 },
+  { 0x04a6, 0x8200, 0x8000 },
+  { 0x0601, 0x0200, 0x0000 },
+  { 0x0601, 0x8801, 0x8000 },
+  { 0x06d3, 0x8bfe, 0x8000 },
+  { 0x07fe, 0x3eb5, 0x0ab3 },
+  { 0x07fe, 0x8c01, 0x8000 },
+  { 0x07ff, 0x403f, 0x0c3e },
+  { 0x0800, 0xb7b6, 0x83db },
+  { 0x0801, 0x0201, 0x0000 },
+  { 0x09aa, 0x888e, 0x8000 },
+  { 0x09d2, 0x1201, 0x0002 },
+  { 0x09f8, 0x1200, 0x0002 },
+  { 0x0a00, 0x8400, 0x8000 },
+  { 0x0a00, 0xb001, 0x8180 },
+  { 0x0b23, 0x8fff, 0x8002 },
+  { 0x0b7d, 0xac7f, 0x810d },
+  { 0x0bfe, 0x8a00, 0x8001 },
+  { 0x0c00, 0x0e01, 0x0002 },
+  { 0x0c00, 0x8c00, 0x8001 },
+  { 0x0da3, 0x0c01, 0x0001 },
+  { 0x0e01, 0x0001, 0x0000 },
+  { 0x0e01, 0x0bff, 0x0002 },
+  { 0x0e01, 0xafff, 0x8300 },
+  { 0x0fff, 0x13fe, 0x0008 },
+  { 0x1200, 0x8200, 0x8000 },
+  { 0x135f, 0xb447, 0x8be2 },
+  { 0x13ff, 0x8201, 0x8001 },
+  { 0x1601, 0x2fff, 0x0a00 },
+  { 0x1fff, 0x209f, 0x049e },
+  { 0x1fff, 0x2800, 0x0bff },
+  { 0x2000, 0x23ff, 0x07ff },
+  { 0x2200, 0x145b, 0x00d1 },
+  { 0x232d, 0xa200, 0x8962 },
+  { 0x24ea, 0x1753, 0x0240 },
+  { 0x2600, 0xa400, 0x8e00 },
+  { 0x2659, 0x2801, 0x125b },
+  { 0x27fe, 0x1400, 0x0200 },
+  { 0x2a00, 0xacd2, 0x9b3b },
+  { 0x2bff, 0x97fe, 0x87fd },
+  { 0x2e00, 0x33ff, 0x25ff },
+  { 0x2f72, 0xac00, 0x9f72 },
+  { 0x3000, 0xb600, 0xaa00 },
+  { 0x3001, 0x1001, 0x0402 },
+  { 0x325b, 0x1201, 0x08c5 },
+  { 0x33fe, 0xaa00, 0xa1fe },
+  { 0x3a01, 0x07ff, 0x0600 },
+  { 0x3bff, 0xb819, 0xb818 },
+  { 0x3c00, 0x0000, 0x0000 },
+  { 0x3c00, 0x0001, 0x0001 },
+  { 0x3c00, 0x03ff, 0x03ff },
+  { 0x3c00, 0x0400, 0x0400 },
+  { 0x3c00, 0x3c00, 0x3c00 },
+  { 0x3c00, 0x7bff, 0x7bff },
+  { 0x3c00, 0x7c00, 0x7c00 },
+  { 0x3c00, 0x8000, 0x8000 },
+  { 0x3c00, 0x8001, 0x8001 },
+  { 0x3c00, 0x83ff, 0x83ff },
+  { 0x3c00, 0x8400, 0x8400 },
+  { 0x3c00, 0xbc00, 0xbc00 },
+  { 0x3c00, 0xfbff, 0xfbff },
+  { 0x3c00, 0xfc00, 0xfc00 },
+  { 0x4001, 0x4200, 0x4602 },
+  { 0x4134, 0x4a01, 0x4fcf },
+  { 0x428e, 0xfbfe, 0xfc00 },
+  { 0x4561, 0xf600, 0xfc00 },
+  { 0x4601, 0x6c01, 0x7603 },
+  { 0x4800, 0x5201, 0x5e01 },
+  { 0x4a00, 0xd3fe, 0xe1fe },
+  { 0x4bfe, 0x7601, 0x7c00 },
+  { 0x4cd8, 0xc5d1, 0xd70b },
+  { 0x4dd9, 0x6801, 0x79da },
+  { 0x5000, 0xcf81, 0xe381 },
+  { 0x5001, 0x65c3, 0x79c4 },
+  { 0x5201, 0xd7fe, 0xedff },
+  { 0x53fe, 0xebff, 0xfc00 },
+  { 0x54d5, 0x4c01, 0x64d6 },
+  { 0x5801, 0x5e00, 0x7a02 },
+  { 0x5a00, 0x65ed, 0x7c00 },
+  { 0x5ffe, 0xd801, 0xfc00 },
+  { 0x6000, 0xd9d4, 0xfc00 },
+  { 0x6001, 0x5cb8, 0x7c00 },
+  { 0x61da, 0x6200, 0x7c00 },
+  { 0x6201, 0xdb78, 0xfc00 },
+  { 0x6401, 0x5600, 0x7c00 },
+  { 0x64e0, 0xcfff, 0xf8df },
+  { 0x67ff, 0xd001, 0xfc00 },
+  { 0x67ff, 0xe601, 0xfc00 },
+  { 0x6800, 0x5801, 0x7c00 },
+  { 0x6801, 0xf200, 0xfc00 },
+  { 0x6aad, 0x63ff, 0x7c00 },
+  { 0x6e01, 0x4600, 0x7881 },
+  { 0x6fff, 0xe600, 0xfc00 },
+  { 0x706d, 0xf61a, 0xfc00 },
+  { 0x7201, 0x754b, 0x7c00 },
+  { 0x73fe, 0xf6eb, 0xfc00 },
+  { 0x7400, 0xec00, 0xfc00 },
+  { 0x77fe, 0xf821, 0xfc00 },
+  { 0x7800, 0x7a01, 0x7c00 },
+  { 0x7800, 0xf116, 0xfc00 },
+  { 0x797c, 0xfa00, 0xfc00 },
+  { 0x7bff, 0x0000, 0x0000 },
+  { 0x7bff, 0x0001, 0x1bff },
+  { 0x7bff, 0x03ff, 0x43fd },
+  { 0x7bff, 0x0400, 0x43ff },
+  { 0x7bff, 0x3c00, 0x7bff },
+  { 0x7bff, 0x7bff, 0x7c00 },
+  { 0x7bff, 0x7c00, 0x7c00 },
+  { 0x7bff, 0x8000, 0x8000 },
+  { 0x7bff, 0x8001, 0x9bff },
+  { 0x7bff, 0x83ff, 0xc3fd },
+  { 0x7bff, 0x8400, 0xc3ff },
+  { 0x7bff, 0xbc00, 0xfbff },
+  { 0x7bff, 0xfbff, 0xfc00 },
+  { 0x7bff, 0xfc00, 0xfc00 },
+  { 0x7c00, 0x0001, 0x7c00 },
+  { 0x7c00, 0x03ff, 0x7c00 },
+  { 0x7c00, 0x0400, 0x7c00 },
+  { 0x7c00, 0x3c00, 0x7c00 },
+  { 0x7c00, 0x7bff, 0x7c00 },
+  { 0x7c00, 0x7c00, 0x7c00 },
+  { 0x7c00, 0x8001, 0xfc00 },
+  { 0x7c00, 0x83ff, 0xfc00 },
+  { 0x7c00, 0x8400, 0xfc00 },
+  { 0x7c00, 0xbc00, 0xfc00 },
+  { 0x7c00, 0xfbff, 0xfc00 },
+  { 0x7c00, 0xfc00, 0xfc00 },
+  { 0x8000, 0x0000, 0x8000 },
+  { 0x8000, 0x0001, 0x8000 },
+  { 0x8000, 0x03ff, 0x8000 },
+  { 0x8000, 0x0400, 0x8000 },
+  { 0x8000, 0x3c00, 0x8000 },
+  { 0x8000, 0x7bff, 0x8000 },
+  { 0x8000, 0x8000, 0x0000 },
+  { 0x8000, 0x8001, 0x0000 },
+  { 0x8000, 0x83ff, 0x0000 },
+  { 0x8000, 0x8400, 0x0000 },
+  { 0x8000, 0xbc00, 0x0000 },
+  { 0x8000, 0xfbff, 0x0000 },
+  { 0x8001, 0x0000, 0x8000 },
+  { 0x8001, 0x0001, 0x8000 },
+  { 0x8001, 0x03ff, 0x8000 },
+  { 0x8001, 0x0400, 0x8000 },
+  { 0x8001, 0x3c00, 0x8001 },
+  { 0x8001, 0x7bff, 0x9bff },
+  { 0x8001, 0x7c00, 0xfc00 },
+  { 0x8001, 0x8000, 0x0000 },
+  { 0x8001, 0x8001, 0x0000 },
+  { 0x8001, 0x83ff, 0x0000 },
+  { 0x8001, 0x8400, 0x0000 },
+  { 0x8001, 0xbc00, 0x0001 },
+  { 0x8001, 0xfbff, 0x1bff },
+  { 0x8001, 0xfc00, 0x7c00 },
+  { 0x8200, 0x1401, 0x8001 },
+  { 0x8201, 0x0bff, 0x8000 },
+  { 0x83fe, 0x0800, 0x8000 },
+  { 0x83fe, 0xbfff, 0x07fb },
+  { 0x83ff, 0x0000, 0x8000 },
+  { 0x83ff, 0x0001, 0x8000 },
+  { 0x83ff, 0x03ff, 0x8000 },
+  { 0x83ff, 0x0400, 0x8000 },
+  { 0x83ff, 0x3c00, 0x83ff },
+  { 0x83ff, 0x7bff, 0xc3fd },
+  { 0x83ff, 0x7c00, 0xfc00 },
+  { 0x83ff, 0x8000, 0x0000 },
+  { 0x83ff, 0x8001, 0x0000 },
+  { 0x83ff, 0x83ff, 0x0000 },
+  { 0x83ff, 0x8400, 0x0000 },
+  { 0x83ff, 0xbc00, 0x03ff },
+  { 0x83ff, 0xfbff, 0x43fd },
+  { 0x83ff, 0xfc00, 0x7c00 },
+  { 0x8400, 0x0000, 0x8000 },
+  { 0x8400, 0x0001, 0x8000 },
+  { 0x8400, 0x03ff, 0x8000 },
+  { 0x8400, 0x0400, 0x8000 },
+  { 0x8400, 0x3c00, 0x8400 },
+  { 0x8400, 0x7bff, 0xc3ff },
+  { 0x8400, 0x7c00, 0xfc00 },
+  { 0x8400, 0x8000, 0x0000 },
+  { 0x8400, 0x8001, 0x0000 },
+  { 0x8400, 0x83ff, 0x0000 },
+  { 0x8400, 0x8400, 0x0000 },
+  { 0x8400, 0xbc00, 0x0400 },
+  { 0x8400, 0xfbff, 0x43ff },
+  { 0x8400, 0xfc00, 0x7c00 },
+  { 0x8401, 0x0bff, 0x8000 },
+  { 0x8412, 0x8e01, 0x0000 },
+  { 0x84a3, 0x9601, 0x0002 },
+  { 0x87fe, 0x3220, 0x8188 },
+  { 0x8800, 0x04c4, 0x8000 },
+  { 0x8800, 0x2c1b, 0x8083 },
+  { 0x8800, 0x33fe, 0x8200 },
+  { 0x8800, 0x3edf, 0x8adf },
+  { 0x8800, 0x82b1, 0x0000 },
+  { 0x8801, 0x3a10, 0x8612 },
+  { 0x8801, 0x8c01, 0x0001 },
+  { 0x8a01, 0x8f88, 0x0001 },
+  { 0x8bda, 0x0e72, 0x8002 },
+  { 0x8bff, 0x9000, 0x0002 },
+  { 0x8c00, 0x0c01, 0x8001 },
+  { 0x8c01, 0xb21f, 0x0310 },
+  { 0x8da6, 0xae00, 0x021e },
+  { 0x8e01, 0x3801, 0x8a03 },
+  { 0x8e01, 0x9000, 0x0003 },
+  { 0x8fff, 0x8801, 0x0001 },
+  { 0x9000, 0x0401, 0x8001 },
+  { 0x91c3, 0x03ff, 0x8001 },
+  { 0x9200, 0x8001, 0x0000 },
+  { 0x93ff, 0x8200, 0x0000 },
+  { 0x9601, 0x2fff, 0x8a00 },
+  { 0x97fe, 0x9801, 0x0040 },
+  { 0x9a19, 0x2732, 0x857c },
+  { 0x9b36, 0x9201, 0x002b },
+  { 0x9bb4, 0x2182, 0x82a7 },
+  { 0x9bfe, 0x1bff, 0x8100 },
+  { 0x9bff, 0x1400, 0x8040 },
+  { 0x9c01, 0x2401, 0x8402 },
+  { 0x9ca3, 0xa413, 0x04b9 },
+  { 0xa000, 0x27ff, 0x8bff },
+  { 0xa200, 0x1bff, 0x8300 },
+  { 0xa400, 0x1800, 0x8200 },
+  { 0xa7ff, 0x2391, 0x8f90 },
+  { 0xa918, 0x9a96, 0x0832 },
+  { 0xabfe, 0x150b, 0x850a },
+  { 0xac00, 0x1801, 0x8801 },
+  { 0xac00, 0xb7ff, 0x27ff },
+  { 0xac01, 0xb200, 0x2202 },
+  { 0xac56, 0x0bfe, 0x8115 },
+  { 0xacac, 0x0801, 0x8096 },
+  { 0xae00, 0x17ff, 0x89ff },
+  { 0xae5b, 0xa7f4, 0x1a51 },
+  { 0xaffe, 0x1a01, 0x8dff },
+  { 0xafff, 0xa401, 0x1800 },
+  { 0xb212, 0x33fe, 0xaa10 },
+  { 0xb2ca, 0x3801, 0xaecc },
+  { 0xb2d0, 0x2e01, 0xa51d },
+  { 0xb3ff, 0x0801, 0x8200 },
+  { 0xb5f0, 0x3001, 0xa9f1 },
+  { 0xb643, 0x8e00, 0x08b2 },
+  { 0xb800, 0x038e, 0x81c7 },
+  { 0xb8fb, 0x3400, 0xb0fb },
+  { 0xba00, 0x3c01, 0xba02 },
+  { 0xba01, 0x3f17, 0xbd52 },
+  { 0xba0f, 0x0800, 0x860f },
+  { 0xbbfe, 0x0001, 0x8001 },
+  { 0xbbfe, 0x3bff, 0xbbfd },
+  { 0xbbff, 0xb0fe, 0x30fd },
+  { 0xbc00, 0x0000, 0x8000 },
+  { 0xbc00, 0x0001, 0x8001 },
+  { 0xbc00, 0x03ff, 0x83ff },
+  { 0xbc00, 0x0400, 0x8400 },
+  { 0xbc00, 0x3c00, 0xbc00 },
+  { 0xbc00, 0x7bff, 0xfbff },
+  { 0xbc00, 0x7c00, 0xfc00 },
+  { 0xbc00, 0x8000, 0x0000 },
+  { 0xbc00, 0x8001, 0x0001 },
+  { 0xbc00, 0x83ff, 0x03ff },
+  { 0xbc00, 0x8400, 0x0400 },
+  { 0xbc00, 0x87fe, 0x07fe },
+  { 0xbc00, 0xbc00, 0x3c00 },
+  { 0xbc00, 0xfbff, 0x7bff },
+  { 0xbc00, 0xfc00, 0x7c00 },
+  { 0xbef6, 0x83ff, 0x06f4 },
+  { 0xbffe, 0x0201, 0x8401 },
+  { 0xc16e, 0xfa00, 0x7c00 },
+  { 0xc3fe, 0x3fff, 0xc7fd },
+  { 0xc3ff, 0xbffe, 0x47fd },
+  { 0xc600, 0x7878, 0xfc00 },
+  { 0xc665, 0x73ff, 0xfc00 },
+  { 0xca00, 0xc600, 0x5480 },
+  { 0xcbfe, 0xfbfe, 0x7c00 },
+  { 0xcc00, 0xe800, 0x7800 },
+  { 0xd001, 0xcc00, 0x6001 },
+  { 0xd401, 0xebfe, 0x7c00 },
+  { 0xd601, 0xd001, 0x6a03 },
+  { 0xdd93, 0xe401, 0x7c00 },
+  { 0xddf9, 0x57ff, 0xf9f8 },
+  { 0xdffe, 0x5a0e, 0xfc00 },
+  { 0xe039, 0xde00, 0x7c00 },
+  { 0xe200, 0xe75e, 0x7c00 },
+  { 0xe201, 0xe001, 0x7c00 },
+  { 0xe601, 0x5000, 0xfa01 },
+  { 0xe7fe, 0xe801, 0x7c00 },
+  { 0xeb16, 0x53ff, 0xfc00 },
+  { 0xebfe, 0xcfff, 0x7c00 },
+  { 0xedc3, 0xcfff, 0x7c00 },
+  { 0xee00, 0xcbfe, 0x7c00 },
+  { 0xee22, 0xe82b, 0x7c00 },
+  { 0xf001, 0xf591, 0x7c00 },
+  { 0xf201, 0xf000, 0x7c00 },
+  { 0xf7f7, 0xf3f0, 0x7c00 },
+  { 0xfa00, 0xbbfe, 0x79fe },
+  { 0xfa01, 0x7401, 0xfc00 },
+  { 0xfbff, 0x0000, 0x8000 },
+  { 0xfbff, 0x0001, 0x9bff },
+  { 0xfbff, 0x03ff, 0xc3fd },
+  { 0xfbff, 0x0400, 0xc3ff },
+  { 0xfbff, 0x3c00, 0xfbff },
+  { 0xfbff, 0x7bff, 0xfc00 },
+  { 0xfbff, 0x7c00, 0xfc00 },
+  { 0xfbff, 0x8000, 0x0000 },
+  { 0xfbff, 0x8001, 0x1bff },
+  { 0xfbff, 0x83ff, 0x43fd },
+  { 0xfbff, 0x8400, 0x43ff },
+  { 0xfbff, 0xbc00, 0x7bff },
+  { 0xfbff, 0xfbff, 0x7c00 },
+  { 0xfbff, 0xfc00, 0x7c00 },
+  { 0xfc00, 0x0001, 0xfc00 },
+  { 0xfc00, 0x03ff, 0xfc00 },
+  { 0xfc00, 0x0400, 0xfc00 },
+  { 0xfc00, 0x3c00, 0xfc00 },
+  { 0xfc00, 0x7bff, 0xfc00 },
+  { 0xfc00, 0x7c00, 0xfc00 },
+  { 0xfc00, 0x8001, 0x7c00 },
+  { 0xfc00, 0x83ff, 0x7c00 },
+  { 0xfc00, 0x8400, 0x7c00 },
+  { 0xfc00, 0xbc00, 0x7c00 },
+  { 0xfc00, 0xfbff, 0x7c00 },
+  { 0xfc00, 0xfc00, 0x7c00 },
+
+  // The upper 16 bits of the inputs are ignored
+  { 0xffff3c00, 0x00014000, 0x4000 },
+  { 0x12343555, 0xfedcb800, 0xb155 },
+
+  // Tests that do depend on Arm NaN policy
+  { 0x0000, 0x7c00, 0x7e00 },
+  { 0x0000, 0xfc00, 0x7e00 },
+  { 0x0000, 0xfe91, 0xfe91 },
+  { 0x0001, 0xfe91, 0xfe91 },
+  { 0x3c00, 0x7e00, 0x7e00 },
+  { 0x3c00, 0x7f3a, 0x7f3a },
+  { 0x7bff, 0x7f3a, 0x7f3a },
+  { 0x7c00, 0x0000, 0x7e00 },
+  { 0x7c00, 0x8000, 0x7e00 },
+  { 0x7c00, 0xfe91, 0xfe91 },
+  { 0x7c01, 0xfc2b, 0x7e01 },
+  { 0x7c01, 0xfe91, 0x7e01 },
+  { 0x7d55, 0x7bff, 0x7f55 },
+  { 0x7d55, 0x7f3a, 0x7f55 },
+  { 0x7e00, 0x3c00, 0x7e00 },
+  { 0x7e00, 0x7d55, 0x7f55 },
+  { 0x7e00, 0x7e00, 0x7e00 },
+  { 0x7f3a, 0x0001, 0x7f3a },
+  { 0x7f3a, 0x3c00, 0x7f3a },
+  { 0x7f3a, 0x7c00, 0x7f3a },
+  { 0x7f3a, 0x7e00, 0x7f3a },
+  { 0x8000, 0x7c00, 0x7e00 },
+  { 0x8000, 0xfc00, 0x7e00 },
+  { 0xfc00, 0x0000, 0x7e00 },
+  { 0xfc00, 0x8000, 0x7e00 },
+  { 0xfc2b, 0x0001, 0xfe2b },
+  { 0xfc2b, 0xfc2b, 0xfe2b },
+  { 0xfe91, 0x3c00, 0xfe91 },
+  { 0xfe91, 0x7bff, 0xfe91 },
+  { 0xfe91, 0x7c01, 0x7e01 },
+};
+
+_Float16
+make_half (uint32_t x)
+{
+  uint16_t h = x;
+  _Float16 r;
+  memcpy (&r, &h, sizeof (r));
+  return r;
+}
+
+uint32_t
+unmake_half (_Float16 x)
+{
+  uint16_t r;
+  memcpy (&r, &x, sizeof (r));
+  return r;
+}
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in half-precision
+       * arithmetic, instead of calling arm_fp_hmul. */
+      _Float16 out = make_half (t->in1) * make_half (t->in2);
+      uint32_t outbits = unmake_half (out);
+#else
+      extern uint32_t arm_fp_hmul(uint32_t, uint32_t);
+      uint32_t outbits = arm_fp_hmul(t->in1, t->in2);
+#endif
+
+      if (outbits != t->out)
+	{
+	  printf ("FAIL: hmul(%04" PRIx32 ", %04" PRIx32 ") -> %04" PRIx32
+		  ", expected %04" PRIx32 "\n",
+		  t->in1, t->in2, outbits, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
@@ -0,0 +1,81 @@
+/*
+ * Tests of 64-bit integer multiplication
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct test
+{
+  uint64_t in1, in2, out;
+};
+
+static const struct test tests[] = {
+  { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+  { 0x0000000000000001, 0x0000000000000001, 0x0000000000000001 },
+  { 0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000000001 },
+  { 0xffffffffffffffff, 0x0000000000000002, 0xfffffffffffffffe },
+  { 0x00000000ffffffff, 0x00000000ffffffff, 0xfffffffe00000001 },
+  { 0x0000000100000000, 0x0000000100000000, 0x0000000000000000 },
+  { 0x0000000080000000, 0x0000000080000000, 0x4000000000000000 },
+  { 0x000000000000ffff, 0x0000000000010001, 0x00000000ffffffff },
+  { 0x0000000012345678, 0x000000009abcdef0, 0x0b00ea4e242d2080 },
+  { 0x123456789abcdef0, 0x0fedcba987654321, 0x2236d88fe5618cf0 },
+  { 0x8000000000000000, 0x0000000000000003, 0x8000000000000000 },
+  { 0x8000000000000001, 0x8000000000000001, 0x0000000000000001 },
+  { 0xfffffffffffffffe, 0x7fffffffffffffff, 0x0000000000000002 },
+  { 0x00000000ffff0000, 0x000000000000ffff, 0x0000fffe00010000 },
+  { 0x0000ffff0000ffff, 0xffff0000ffff0000, 0x0002fffe00010000 },
+  { 0xdeadbeefcafef00d, 0x0000000000000000, 0x0000000000000000 },
+  { 0x0000000000000000, 0xdeadbeefcafef00d, 0x0000000000000000 },
+  { 0x0000000000000001, 0xdeadbeefcafef00d, 0xdeadbeefcafef00d },
+  { 0xdeadbeefcafef00d, 0x0000000000000001, 0xdeadbeefcafef00d },
+  { 0x00000000deadbeef, 0x00000001cafef00d, 0x8f4098c938f4c223 },
+  { 0x00000001cafef00d, 0x00000000deadbeef, 0x8f4098c938f4c223 },
+  { 0x7fffffffffffffff, 0x7fffffffffffffff, 0x0000000000000001 },
+  { 0x5555555555555555, 0x0000000000000003, 0xffffffffffffffff },
+  { 0x3333333333333333, 0x0000000000000005, 0xffffffffffffffff },
+  { 0xfedcba9876543210, 0xfedcba9876543210, 0xdeec6cd7a44a4100 },
+  { 0x0000000000012345, 0xffffffffffff0001, 0xfffffffedcbc2345 },
+  { 0xffffffff00000000, 0xffffffff00000000, 0x0000000000000000 },
+  { 0x00000000ffffffff, 0xffffffff00000001, 0x00000001ffffffff },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in 64-bit
+       * multiplication, instead of calling arm_fp_lmul. */
+      uint64_t out = t->in1 * t->in2;
+#else
+      extern uint64_t arm_fp_lmul(uint64_t, uint64_t);
+      uint64_t out = arm_fp_lmul(t->in1, t->in2);
+#endif
+
+      if (out != t->out)
+	{
+	  printf ("FAIL: lmul(%016" PRIx64 ", %016" PRIx64 ") -> %016" PRIx64
+		  ", expected %016" PRIx64 "\n",
+		  t->in1, t->in2, out, t->out);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
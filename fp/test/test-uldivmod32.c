@@ -0,0 +1,97 @@
+/*
+ * Tests of unsigned 64-bit by 32-bit integer division
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct test
+{
+  uint64_t n;
+  uint32_t d;
+  uint64_t quot;
+  uint32_t rem;
+};
+
+static const struct test tests[] = {
+  // Tests that don't depend on Arm-specific choices
+  { 0x0000000000000000, 0x00000001, 0x0000000000000000, 0x00000000 },
+  { 0x0000000000000001, 0x00000001, 0x0000000000000001, 0x00000000 },
+  { 0xffffffffffffffff, 0x00000001, 0xffffffffffffffff, 0x00000000 },
+  { 0xffffffffffffffff, 0xffffffff, 0x0000000100000001, 0x00000000 },
+  { 0xffffffffffffffff, 0x80000000, 0x00000001ffffffff, 0x7fffffff },
+  { 0xffffffffffffffff, 0x00000002, 0x7fffffffffffffff, 0x00000001 },
+  { 0xffffffffffffffff, 0x00000003, 0x5555555555555555, 0x00000000 },
+  { 0xffffffffffffffff, 0x0000000a, 0x1999999999999999, 0x00000005 },
+  { 0x123456789abcdef0, 0x12345678, 0x0000000100000008, 0x091a2b30 },
+  { 0x123456789abcdef0, 0x9abcdef0, 0x000000001e1e1e21, 0x46240200 },
+  { 0x00000000ffffffff, 0xffffffff, 0x0000000000000001, 0x00000000 },
+  { 0x00000000fffffffe, 0xffffffff, 0x0000000000000000, 0xfffffffe },
+  { 0x00000001ffffffff, 0xffffffff, 0x0000000000000002, 0x00000001 },
+  { 0xfffffffeffffffff, 0xffffffff, 0x00000000ffffffff, 0xfffffffe },
+  { 0xfffffffe00000000, 0xffffffff, 0x00000000fffffffe, 0xfffffffe },
+  { 0x7fffffffffffffff, 0x7fffffff, 0x0000000100000002, 0x00000001 },
+  { 0x0000000012345678, 0x00010000, 0x0000000000001234, 0x00005678 },
+  { 0x00000000000000ff, 0x00000100, 0x0000000000000000, 0x000000ff },
+  { 0x8000000000000000, 0x00000003, 0x2aaaaaaaaaaaaaaa, 0x00000002 },
+  { 0x8000000000000000, 0xfffffffd, 0x0000000080000001, 0x80000003 },
+  { 0x00000000deadbeef, 0x00000007, 0x000000001fcfad8f, 0x00000006 },
+  { 0x00000005deadbeef, 0x00000006, 0x00000000fa724a7d, 0x00000001 },
+  { 0x00000005deadbeef, 0x00000005, 0x000000012c89262f, 0x00000004 },
+  { 0xdeadbeefcafef00d, 0xcafef00d, 0x0000000118d27d2b, 0x144c44de },
+  { 0xcafef00ddeadbeef, 0xdeadbeef, 0x00000000e95f3134, 0x00263763 },
+  { 0x0000000100000000, 0x00000002, 0x0000000080000000, 0x00000000 },
+  { 0x0de0b6b3a7640000, 0x3b9aca00, 0x000000003b9aca00, 0x00000000 },
+  { 0xffffffffffffffff, 0xfffffffe, 0x0000000100000002, 0x00000003 },
+
+  // Division by zero, which is an Arm-specific choice
+  { 0x123456789abcdef0, 0x00000000, 0x0000000000000000, 0x9abcdef0 },
+  { 0x0000000000000000, 0x00000000, 0x0000000000000000, 0x00000000 },
+};
+
+int
+main (void)
+{
+  bool failed = false;
+
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    {
+      const struct test *t = &tests[i];
+      uint64_t quot, quot_norem;
+      uint32_t rem;
+
+#ifdef USE_NATIVE_ARITHMETIC
+      /* If you compile with USE_NATIVE_ARITHMETIC defined, the same
+       * set of tests will be run using the toolchain's built in 64-bit
+       * division, instead of calling arm_fp_uldivmod32. */
+      if (t->d == 0)
+	continue;
+      quot = quot_norem = t->n / t->d;
+      rem = t->n % t->d;
+#else
+      extern uint64_t arm_fp_uldivmod32(uint64_t, uint32_t, uint32_t *);
+      quot = arm_fp_uldivmod32(t->n, t->d, &rem);
+      quot_norem = arm_fp_uldivmod32(t->n, t->d, NULL);
+#endif
+
+      if (quot != t->quot || rem != t->rem || quot_norem != t->quot)
+	{
+	  printf ("FAIL: uldivmod32(%016" PRIx64 ", %08" PRIx32 ") -> %016"
+		  PRIx64 " rem %08" PRIx32 " (%016" PRIx64 " without rem)"
+		  ", expected %016" PRIx64 " rem %08" PRIx32 "\n",
+		  t->n, t->d, quot, rem, quot_norem, t->quot, t->rem);
+	  failed = true;
+	}
+    }
+
+  if (!failed)
+    printf ("all passed\n");
+
+  return failed;
+}
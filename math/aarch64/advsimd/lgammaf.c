@@ -0,0 +1,185 @@
+/*
+ * Single-precision vector lgamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "v_poly_f64.h"
+#include "test_sig.h"
+#include "test_defs.h"
+
+#define V_LOG_INLINE_POLY_ORDER 4
+#include "v_log_inline.h"
+
+static const struct data
+{
+  float64x2_t q[9], g[3], sinpi[6];
+  float64x2_t half, three_halves, large_bound, c0, log_pi;
+  struct v_log_inline_data log_tbl;
+  float32x4_t zeros_lo, zeros_hi, zeros_bound;
+  uint32x4_t special_bound;
+} data = {
+  /* 1/Gamma(2 + u) ~= 1 + u q(u) for u in [-0.5, 0.5].
+     Relative error in q is 2^-31.5.  */
+  .q = { V2 (-0x1.b0ee6071890dcp-2), V2 (-0x1.dd603f652108fp-3),
+	 V2 (0x1.875ac505d45cfp-3), V2 (-0x1.924521efeeebdp-6),
+	 V2 (-0x1.21194b510792dp-6), V2 (0x1.06f72c365bd78p-7),
+	 V2 (-0x1.a5cc33074b160p-11), V2 (-0x1.84757590ec183p-12),
+	 V2 (0x1.3027b7fd583d2p-13) },
+  /* lgamma(a) - (a - 0.5) (log(a) - 1) - c0 ~= z g(z^2) for z = 1/a in
+     [0, 1/8]. Relative error in g is 2^-30.2.  */
+  .g = { V2 (0x1.55555550a940fp-4), V2 (-0x1.6c141be974608p-9),
+	 V2 (0x1.98f99354c57bap-11) },
+  /* sin(pi r) ~= r s(r^2) for r in [-0.5, 0.5].
+     Relative error in s is 2^-35.5.  */
+  .sinpi = { V2 (0x1.921fb5441e49ep+1), V2 (-0x1.4abbce4f1a2afp+2),
+	     V2 (0x1.466bbfc24eddcp+1), V2 (-0x1.32d11201944d3p-1),
+	     V2 (0x1.500ff7edeaa67p-4), V2 (-0x1.cc3459f5d161bp-8) },
+  .half = V2 (0.5),
+  .three_halves = V2 (1.5),
+  .large_bound = V2 (8.0),
+  .c0 = V2 (0x1.acfe390c97d69p-2),     /* (log(2 pi) - 1) / 2.  */
+  .log_pi = V2 (0x1.250d048e7a1bdp0), /* log(pi).  */
+  .log_tbl = V_LOG_CONSTANTS,
+  .zeros_lo = V4 (-16.0f),
+  .zeros_hi = V4 (-2.0f),
+  .zeros_bound = V4 (0x1p-5f),
+  /* Zero, negative numbers, inf and nan are special.  */
+  .special_bound = V4 (0x7f7fffff),
+};
+
+/* lgamma(a) for a > 0, in double precision.
+   For a >= 8 use the Stirling series. Below that, write a = n + 2 + u with n
+   an integer in [-2, 5] and u in [-0.5, 0.5], approximate 1/Gamma(2 + u) with
+   a polynomial and use the recurrence Gamma(a + 1) = a Gamma(a) to move
+   between the two. The error of the double precision arithmetic is negligible
+   once the result is rounded to single precision, including close to the
+   roots at 1 and 2.  */
+static inline float64x2_t
+v_lgamma_inline (float64x2_t a, const struct data *d)
+{
+  float64x2_t ra = vrndaq_f64 (a);
+  float64x2_t u = vsubq_f64 (a, ra);
+  float64x2_t u2 = vmulq_f64 (u, u);
+  float64x2_t u4 = vmulq_f64 (u2, u2);
+  float64x2_t u8 = vmulq_f64 (u4, u4);
+  float64x2_t r
+      = vfmaq_f64 (v_f64 (1.0), u, v_estrin_8_f64 (u, u2, u4, u8, d->q));
+
+  /* 1/Gamma(a) = m r, with m = a (1 + a) if round(a) = 0, m = a if
+     round(a) = 1 and m = 1 otherwise.  */
+  uint64x2_t lt_three_halves = vcltq_f64 (a, d->three_halves);
+  float64x2_t m = vbslq_f64 (lt_three_halves, vaddq_f64 (v_f64 (1.0), u),
+			     v_f64 (1.0));
+  m = vbslq_f64 (vcltq_f64 (a, d->half), vmulq_f64 (m, a), m);
+  float64x2_t n = vmulq_f64 (m, r);
+
+  /* For 2.5 <= a < 8, Gamma(a) = p Gamma(2 + u) with
+     p = (a - 1) (a - 2) ... (2 + u).  */
+  float64x2_t t = vsubq_f64 (a, v_f64 (1.0));
+  float64x2_t p = v_f64 (1.0);
+  for (int i = 0; i < 6; i++)
+    {
+      p = vbslq_f64 (vcgeq_f64 (t, d->three_halves), vmulq_f64 (p, t), p);
+      t = vsubq_f64 (t, v_f64 (1.0));
+    }
+
+  /* A single division gives 1/Gamma(a) = n / p for the small inputs and
+     z = 1/a for the Stirling series.  */
+  uint64x2_t large = vcgeq_f64 (a, d->large_bound);
+  float64x2_t qd = vdivq_f64 (vbslq_f64 (large, v_f64 (1.0), n),
+			      vbslq_f64 (large, a, p));
+  float64x2_t l = v_log_inline (vbslq_f64 (large, a, qd), &d->log_tbl);
+
+  /* Large a: lgamma(a) = (a - 0.5) (log(a) - 1) + c0 + z g(z^2).  */
+  float64x2_t z2 = vmulq_f64 (qd, qd);
+  float64x2_t corr = vfmaq_f64 (d->c0, qd, v_horner_2_f64 (z2, d->g));
+  float64x2_t y_large = vfmaq_f64 (corr, vsubq_f64 (a, d->half),
+				   vsubq_f64 (l, v_f64 (1.0)));
+  /* Subtract from 0 rather than negate, so that lgamma(1) = lgamma(2) = +0.  */
+  return vbslq_f64 (large, y_large, vsubq_f64 (v_f64 (0.0), l));
+}
+
+/* For negative x use the reflection formula
+   lgamma(x) = log(pi / |x sinpi(x)|) - lgamma(-x),
+   where y holds lgamma(-x).  */
+static inline float64x2_t
+reflect (float64x2_t x, float64x2_t y, const struct data *d)
+{
+  float64x2_t r = vsubq_f64 (x, vrndaq_f64 (x));
+  float64x2_t r2 = vmulq_f64 (r, r);
+  float64x2_t r4 = vmulq_f64 (r2, r2);
+  float64x2_t s = v_pw_horner_5_f64 (r2, r4, d->sinpi);
+  float64x2_t xs = vabsq_f64 (vmulq_f64 (vmulq_f64 (x, r), s));
+  float64x2_t l = v_log_inline (xs, &d->log_tbl);
+  return vsubq_f64 (vsubq_f64 (d->log_pi, l), y);
+}
+
+static float32x4_t VPCS_ATTR NOINLINE
+special_case (float32x4_t x, float64x2_t y_lo, float64x2_t y_hi,
+	      const struct data *d)
+{
+  float64x2_t x_lo = vcvt_f64_f32 (vget_low_f32 (x));
+  float64x2_t x_hi = vcvt_high_f64_f32 (x);
+  y_lo = vbslq_f64 (vcltzq_f64 (x_lo), reflect (x_lo, y_lo, d), y_lo);
+  y_hi = vbslq_f64 (vcltzq_f64 (x_hi), reflect (x_hi, y_hi, d), y_hi);
+  float32x4_t y = vcombine_f32 (vcvt_f32_f64 (y_lo), vcvt_f32_f64 (y_hi));
+
+  /* lgamma is +inf at the poles (zero and the negative integers) and at
+     +/-inf. Nan inputs are returned unchanged.  */
+  uint32x4_t pole
+      = vandq_u32 (vclezq_f32 (x), vceqq_f32 (vrndaq_f32 (x), x));
+  pole = vorrq_u32 (pole, vceqq_f32 (x, v_f32 (INFINITY)));
+  y = vbslq_f32 (pole, v_f32 (INFINITY), y);
+  y = vbslq_f32 (vceqq_f32 (x, x), y, x);
+
+  /* Close to the zeros of lgammaf below -2 the result cancels, and the
+     absolute error of the reflection is too large relative to it. Use the
+     double-precision routine for these lanes. Below -16 no input is close
+     enough to a zero for this to matter.  */
+  uint32x4_t near_zero = vandq_u32 (vcltq_f32 (x, d->zeros_hi),
+				    vcgtq_f32 (x, d->zeros_lo));
+  near_zero = vandq_u32 (near_zero, vcaltq_f32 (y, d->zeros_bound));
+  if (unlikely (v_any_u32 (near_zero)))
+    {
+      float32x2_t y_dp_lo = vcvt_f32_f64 (V_NAME_D1 (lgamma) (x_lo));
+      float32x2_t y_dp_hi = vcvt_f32_f64 (V_NAME_D1 (lgamma) (x_hi));
+      y = vbslq_f32 (near_zero, vcombine_f32 (y_dp_lo, y_dp_hi), y);
+    }
+  return y;
+}
+
+/* Vector implementation of lgammaf, computed in double precision.
+   The largest observed error is 0.53 ULP:
+   _ZGVnN4v_lgammaf(-0x1.3ffb68p+1) got -0x1.cb7b18p-5
+				   want -0x1.cb7b1ap-5.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (lgamma) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  uint32x4_t special
+      = vcgeq_u32 (vsubq_u32 (vreinterpretq_u32_f32 (x), v_u32 (1)),
+		   d->special_bound);
+  float32x4_t a = vabsq_f32 (x);
+  float64x2_t y_lo = v_lgamma_inline (vcvt_f64_f32 (vget_low_f32 (a)), d);
+  float64x2_t y_hi = v_lgamma_inline (vcvt_high_f64_f32 (a), d);
+
+  if (unlikely (v_any_u32 (special)))
+    return special_case (x, y_lo, y_hi, d);
+  return vcombine_f32 (vcvt_f32_f64 (y_lo), vcvt_f32_f64 (y_hi));
+}
+
+HALF_WIDTH_ALIAS_F1 (lgamma)
+
+TEST_ULP (V_NAME_F1 (lgamma), 0.04)
+TEST_INTERVAL (V_NAME_F1 (lgamma), 0, 0.5, 20000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), 0.5, 2.5, 50000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), 2.5, 8, 50000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), 8, 0x1p122, 20000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), 0x1p122, inf, 1000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), -0, -2, 50000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), -2, -0x1p23, 20000)
+TEST_INTERVAL (V_NAME_F1 (lgamma), -0x1p23, -inf, 1000)
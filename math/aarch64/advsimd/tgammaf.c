@@ -0,0 +1,171 @@
+/*
+ * Single-precision vector tgamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "v_poly_f64.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_pow_inline.h"
+
+static const struct tgammaf_data
+{
+  float64x2_t q[9], g[3], sinpi[6];
+  float64x2_t half, three_halves, large_bound, inv_large_bound, large_clamp;
+  float64x2_t c, pi;
+  uint32x4_t special_bound;
+} tgammaf_data = {
+  /* 1/Gamma(2 + u) ~= 1 + u q(u) for u in [-0.5, 0.5], as in lgammaf.  */
+  .q = { V2 (-0x1.b0ee6071890dcp-2), V2 (-0x1.dd603f652108fp-3),
+	 V2 (0x1.875ac505d45cfp-3), V2 (-0x1.924521efeeebdp-6),
+	 V2 (-0x1.21194b510792dp-6), V2 (0x1.06f72c365bd78p-7),
+	 V2 (-0x1.a5cc33074b160p-11), V2 (-0x1.84757590ec183p-12),
+	 V2 (0x1.3027b7fd583d2p-13) },
+  /* Remainder of the Stirling series, as in lgammaf.  */
+  .g = { V2 (0x1.55555550a940fp-4), V2 (-0x1.6c141be974608p-9),
+	 V2 (0x1.98f99354c57bap-11) },
+  /* sin(pi r) ~= r s(r^2), as in lgammaf.  */
+  .sinpi = { V2 (0x1.921fb5441e49ep+1), V2 (-0x1.4abbce4f1a2afp+2),
+	     V2 (0x1.466bbfc24eddcp+1), V2 (-0x1.32d11201944d3p-1),
+	     V2 (0x1.500ff7edeaa67p-4), V2 (-0x1.cc3459f5d161bp-8) },
+  .half = V2 (0.5),
+  .three_halves = V2 (1.5),
+  .large_bound = V2 (8.0),
+  .inv_large_bound = V2 (0.125),
+  /* Beyond this |tgammaf(x)| is 0 or inf, also for x close to the negative
+     integers.  */
+  .large_clamp = V2 (48.0),
+  .c = V2 (0x1.d67f1c864beb5p-1), /* log(2 pi) / 2.  */
+  .pi = V2 (0x1.921fb54442d18p1),
+  /* Zero, negative numbers, inf and nan are special.  */
+  .special_bound = V4 (0x7f7fffff),
+};
+
+/* tgamma(a) for a > 0, in double precision.
+   For a < 8 use the same approximation of 1/Gamma as lgammaf, and divide.
+   Above that, take the exponential of the Stirling series
+   log(Gamma(a)) = (a - 0.5) log(a) - a + log(2 pi) / 2 + z g(z^2), z = 1/a.
+   Results that overflow in single precision are computed with a clamped to
+   48, and overflow when narrowed.  */
+static inline float64x2_t
+v_tgamma_inline (float64x2_t a, const struct tgammaf_data *d,
+		 const struct data *dl)
+{
+  float64x2_t ra = vrndaq_f64 (a);
+  float64x2_t u = vsubq_f64 (a, ra);
+  float64x2_t u2 = vmulq_f64 (u, u);
+  float64x2_t u4 = vmulq_f64 (u2, u2);
+  float64x2_t u8 = vmulq_f64 (u4, u4);
+  float64x2_t r
+      = vfmaq_f64 (v_f64 (1.0), u, v_estrin_8_f64 (u, u2, u4, u8, d->q));
+
+  /* 1/Gamma(a) = m r, with m as in lgammaf.  */
+  uint64x2_t lt_three_halves = vcltq_f64 (a, d->three_halves);
+  float64x2_t m = vbslq_f64 (lt_three_halves, vaddq_f64 (v_f64 (1.0), u),
+			     v_f64 (1.0));
+  m = vbslq_f64 (vcltq_f64 (a, d->half), vmulq_f64 (m, a), m);
+  float64x2_t n = vmulq_f64 (m, r);
+
+  /* For 2.5 <= a < 8, Gamma(a) = p Gamma(2 + u) with
+     p = (a - 1) (a - 2) ... (2 + u).  */
+  float64x2_t t = vsubq_f64 (a, v_f64 (1.0));
+  float64x2_t p = v_f64 (1.0);
+  for (int i = 0; i < 6; i++)
+    {
+      p = vbslq_f64 (vcgeq_f64 (t, d->three_halves), vmulq_f64 (p, t), p);
+      t = vsubq_f64 (t, v_f64 (1.0));
+    }
+
+  /* A single division gives Gamma(a) = p / n for the small inputs and
+     z = 1/a for the Stirling series.  */
+  uint64x2_t large = vcgeq_f64 (a, d->large_bound);
+  float64x2_t al
+      = vminnmq_f64 (vmaxnmq_f64 (a, d->large_bound), d->large_clamp);
+  float64x2_t qd = vdivq_f64 (vbslq_f64 (large, v_f64 (1.0), p),
+			      vbslq_f64 (large, al, n));
+
+  /* Large a: h = (a - 0.5) log(a) - a + c + z g(z^2). z is replaced in the
+     other lanes so that h stays in range of the inline exp.  */
+  float64x2_t ltail;
+  float64x2_t l = v_log_inline (vreinterpretq_u64_f64 (al), &ltail, dl);
+  float64x2_t z = vbslq_f64 (large, qd, d->inv_large_bound);
+  float64x2_t corr = vfmaq_f64 (d->c, z,
+				v_horner_2_f64 (vmulq_f64 (z, z), d->g));
+  float64x2_t h = vfmaq_f64 (vsubq_f64 (corr, al),
+			     vsubq_f64 (al, d->half), l);
+  float64x2_t e = v_exp_inline (h, v_f64 (0.0), dl);
+  return vbslq_f64 (large, e, qd);
+}
+
+/* For negative x use the reflection formula
+   tgamma(x) = pi / (|x| sin(pi x) tgamma(-x)),
+   where y holds tgamma(-x). sin(pi x) = (-1)^k sin(pi r), with x = k + r.  */
+static inline float64x2_t
+reflect (float64x2_t x, float64x2_t y, const struct tgammaf_data *d)
+{
+  float64x2_t k = vrndaq_f64 (x);
+  float64x2_t r = vsubq_f64 (x, k);
+  float64x2_t r2 = vmulq_f64 (r, r);
+  float64x2_t r4 = vmulq_f64 (r2, r2);
+  float64x2_t s = v_pw_horner_5_f64 (r2, r4, d->sinpi);
+  float64x2_t den = vmulq_f64 (vmulq_f64 (vmulq_f64 (x, r), s), y);
+  float64x2_t y_neg = vdivq_f64 (d->pi, vnegq_f64 (den));
+  uint64x2_t odd
+      = vshlq_n_u64 (vreinterpretq_u64_s64 (vcvtaq_s64_f64 (k)), 63);
+  return vreinterpretq_f64_u64 (
+      veorq_u64 (vreinterpretq_u64_f64 (y_neg), odd));
+}
+
+static float32x4_t VPCS_ATTR NOINLINE
+tgamma_special_case (float32x4_t x, float64x2_t y_lo, float64x2_t y_hi,
+		     const struct tgammaf_data *d)
+{
+  float64x2_t x_lo = vcvt_f64_f32 (vget_low_f32 (x));
+  float64x2_t x_hi = vcvt_high_f64_f32 (x);
+  y_lo = vbslq_f64 (vcltzq_f64 (x_lo), reflect (x_lo, y_lo, d), y_lo);
+  y_hi = vbslq_f64 (vcltzq_f64 (x_hi), reflect (x_hi, y_hi, d), y_hi);
+  float32x4_t y = vcombine_f32 (vcvt_f32_f64 (y_lo), vcvt_f32_f64 (y_hi));
+
+  /* tgammaf(+/-0) = +/-inf, and tgammaf is nan at the negative integers and
+     -inf. Nan inputs are returned unchanged.  */
+  y = vbslq_f32 (vceqzq_f32 (x), vdivq_f32 (v_f32 (1.0f), x), y);
+  uint32x4_t invalid
+      = vandq_u32 (vcltzq_f32 (x), vceqq_f32 (vrndaq_f32 (x), x));
+  y = vbslq_f32 (invalid, v_f32 (NAN), y);
+  return vbslq_f32 (vceqq_f32 (x, x), y, x);
+}
+
+/* Vector implementation of tgammaf, computed in double precision.
+   The largest observed error is 0.51 ULP:
+   _ZGVnN4v_tgammaf(-0x1.3c885cp+1) got -0x1.f46e18p-1
+				   want -0x1.f46e1ap-1.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (tgamma) (float32x4_t x)
+{
+  const struct tgammaf_data *d = ptr_barrier (&tgammaf_data);
+  const struct data *dl = ptr_barrier (&data);
+
+  uint32x4_t special
+      = vcgeq_u32 (vsubq_u32 (vreinterpretq_u32_f32 (x), v_u32 (1)),
+		   d->special_bound);
+  float32x4_t a = vabsq_f32 (x);
+  float64x2_t a_lo = vcvt_f64_f32 (vget_low_f32 (a));
+  float64x2_t a_hi = vcvt_high_f64_f32 (a);
+  float64x2_t y_lo = v_tgamma_inline (a_lo, d, dl);
+  float64x2_t y_hi = v_tgamma_inline (a_hi, d, dl);
+
+  if (unlikely (v_any_u32 (special)))
+    return tgamma_special_case (x, y_lo, y_hi, d);
+  return vcombine_f32 (vcvt_f32_f64 (y_lo), vcvt_f32_f64 (y_hi));
+}
+
+HALF_WIDTH_ALIAS_F1 (tgamma)
+
+TEST_SIG (V, F, 1, tgamma, -9.9, 9.9)
+TEST_ULP (V_NAME_F1 (tgamma), 0.01)
+TEST_SYM_INTERVAL (V_NAME_F1 (tgamma), 0, 0.5, 20000)
+TEST_SYM_INTERVAL (V_NAME_F1 (tgamma), 0.5, 8, 50000)
+TEST_SYM_INTERVAL (V_NAME_F1 (tgamma), 8, 48, 50000)
+TEST_SYM_INTERVAL (V_NAME_F1 (tgamma), 48, inf, 1000)
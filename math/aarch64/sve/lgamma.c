@@ -0,0 +1,260 @@
+/*
+ * Double-precision SVE lgamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_poly_f64.h"
+#define WANT_SV_POW_SIGN_BIAS 0
+#include "sv_pow_inline.h"
+
+static const struct lgamma_data
+{
+  double q0_lo, q[15], g[6], sinpi[10];
+  double half, three_halves, large_bound, c0, log_pi, log_pi_lo, pi_lo;
+  double tiny_bound, tiny_scale, tiny_log_scale;
+  uint64_t special_offset, special_bound;
+} lgamma_data = {
+  /* 1/Gamma(2 + u) ~= 1 + u q(u) for u in [-0.5, 0.5], where q(0) = q0 is
+     stored separately in extra precision. Relative error in q is 2^-55.9.  */
+  .q0_lo = -0x1.6cb90701fbfabp-58,
+  .q = { -0x1.b0ee6072093cep-2, -0x1.dd603fb6ac120p-3, 0x1.875ac57822509p-3,
+	 -0x1.92449b66f16c8p-6, -0x1.211985117582dp-6, 0x1.06e8179e08246p-7,
+	 -0x1.a5b350a6550c4p-11, -0x1.7a5da91e1eb6cp-12,
+	 0x1.3156554b006b7p-13, -0x1.265f580f4e741p-16,
+	 -0x1.5b7cf06e6eb5fp-19, 0x1.6770120d3f87bp-20,
+	 -0x1.b95461b8354c4p-23, -0x1.87ed5309c8484p-30,
+	 0x1.b56dec0b9222ep-28 },
+  .g = { 0x1.5555555555553p-4, -0x1.6c16c16bb8473p-9, 0x1.a019fd44acc69p-11,
+	 -0x1.380ec912f0a67p-11, 0x1.b6fd996579147p-11,
+	 -0x1.b16289b132fd1p-10 },
+  /* sin(pi r) ~= r * sinpi(r^2), coefficients as in sinpi.  */
+  .sinpi = { 0x1.921fb54442d184p1, -0x1.4abbce625be53p2, 0x1.466bc6775ab16p1,
+	     -0x1.32d2cce62dc33p-1, 0x1.507834891188ep-4,
+	     -0x1.e30750a28c88ep-8, 0x1.e8f48308acda4p-12,
+	     -0x1.6fc0032b3c29fp-16, 0x1.af86ae521260bp-21,
+	     -0x1.012a9870eeb7dp-25 },
+  .half = 0.5,
+  .three_halves = 1.5,
+  .large_bound = 8.0,
+  .c0 = 0x1.acfe390c97d69p-2,	  /* (log(2 pi) - 1) / 2.  */
+  .log_pi = 0x1.250d048e7a1bdp0, /* log(pi).  */
+  .log_pi_lo = 0x1.7abf2ad8d5088p-57,
+  .pi_lo = 0x1.1a62633145c07p-53,
+  .tiny_bound = 0x1p-54,
+  .tiny_scale = 0x1p64,
+  .tiny_log_scale = 0x1.62e42fefa39efp5, /* log(2^64).  */
+  /* Inputs below 0x1p-1021 (including negative numbers), inf and nan are
+     special.  */
+  .special_offset = 0x0020000000000000,
+  .special_bound = 0x7fd0000000000000,
+};
+
+/* Approximation of 1/Gamma(2 + u) - 1 = u q(u), returned as q + qlo.
+   The first two terms of q are added in extra precision, as rounding errors
+   in the tail of the polynomial would otherwise dominate near the roots.  */
+static inline svfloat64_t
+inv_gamma_poly (svbool_t pg, svfloat64_t u, svfloat64_t *qlo,
+		const struct lgamma_data *d)
+{
+  svfloat64_t u2 = svmul_x (pg, u, u);
+  svfloat64_t u4 = svmul_x (pg, u2, u2);
+  svfloat64_t u8 = svmul_x (pg, u4, u4);
+  svfloat64_t s
+      = svmul_x (pg, u, sv_estrin_12_f64_x (pg, u, u2, u4, u8, d->q + 2));
+  /* t = q1 + s.  */
+  svfloat64_t q1 = sv_f64 (d->q[1]);
+  svfloat64_t t = svadd_x (pg, q1, s);
+  svfloat64_t tlo = svadd_x (pg, svsub_x (pg, q1, t), s);
+  /* q = q0 + u t.  */
+  svfloat64_t q0 = sv_f64 (d->q[0]);
+  svfloat64_t p = svmul_x (pg, u, t);
+  svfloat64_t plo = svnmls_x (pg, p, u, t);
+  plo = svmla_x (pg, svadd_x (pg, plo, d->q0_lo), u, tlo);
+  svfloat64_t q = svadd_x (pg, q0, p);
+  *qlo = svadd_x (pg, svadd_x (pg, svsub_x (pg, q0, q), p), plo);
+  return q;
+}
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t special, svbool_t pg,
+	      const struct lgamma_data *d, const struct data *dl)
+{
+  svfloat64_t a = svabs_x (pg, x);
+
+  /* For negative x use the reflection formula
+     lgamma(x) = log(pi / |x sinpi(x)|) - lgamma(-x),
+     where y already holds lgamma(-x).  */
+  svfloat64_t r = svsub_x (pg, x, svrinta_x (pg, x));
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t r4 = svmul_x (pg, r2, r2);
+  /* s = c0 + r^2 (c1 + r^2 p), with the two leading terms added in extra
+     precision.  */
+  svfloat64_t c0 = sv_f64 (d->sinpi[0]);
+  svfloat64_t c1 = sv_f64 (d->sinpi[1]);
+  svfloat64_t p
+      = svmul_x (pg, r2, sv_pw_horner_7_f64_x (pg, r2, r4, d->sinpi + 2));
+  svfloat64_t p1 = svadd_x (pg, c1, p);
+  svfloat64_t p1lo = svadd_x (pg, svsub_x (pg, c1, p1), p);
+  svfloat64_t rest = svmul_x (pg, r2, p1);
+  svfloat64_t rest_lo = svnmls_x (pg, rest, r2, p1);
+  rest_lo = svmla_x (pg, rest_lo, svnmls_x (pg, r2, r, r), p1);
+  rest_lo = svmla_x (pg, rest_lo, r2, p1lo);
+  svfloat64_t s = svadd_x (pg, c0, rest);
+  svfloat64_t slo = svadd_x (pg, svsub_x (pg, c0, s), rest);
+  slo = svadd_x (pg, slo, svadd_x (pg, rest_lo, d->pi_lo));
+
+  /* x sin(pi x) = +/-(x r) s, accumulating rounding errors relative to the
+     product in xs_rel.  */
+  svfloat64_t xr = svmul_x (pg, x, r);
+  svfloat64_t xr_lo = svnmls_x (pg, xr, x, r);
+  svfloat64_t xs = svmul_x (pg, xr, s);
+  svfloat64_t xs_lo = svnmls_x (pg, xs, xr, s);
+  xs_lo = svmla_x (pg, svmla_x (pg, xs_lo, xr_lo, s), xr, slo);
+  svfloat64_t xs_rel = svdiv_x (pg, xs_lo, xs);
+
+  /* For |x| < 2^-54, lgamma(x) rounds to -log|x|. Scale these inputs so that
+     subnormals are normalized, and share the call to log.  */
+  svbool_t tiny = svcmplt (pg, a, d->tiny_bound);
+  svfloat64_t t
+      = svsel (tiny, svmul_x (pg, a, d->tiny_scale), svabs_x (pg, xs));
+  svfloat64_t ltail;
+  svfloat64_t l = sv_log_inline (pg, svreinterpret_u64 (t), &ltail, dl);
+
+  /* log(pi) - log|x s| in extra precision, as the result may cancel.  */
+  svfloat64_t log_pi = sv_f64 (d->log_pi);
+  svfloat64_t h = svsub_x (pg, log_pi, l);
+  svfloat64_t hb = svsub_x (pg, h, log_pi);
+  svfloat64_t hlo = svsub_x (pg, svsub_x (pg, log_pi, svsub_x (pg, h, hb)),
+			     svadd_x (pg, l, hb));
+  hlo = svadd_x (
+      pg, hlo,
+      svsub_x (pg, sv_f64 (d->log_pi_lo), svadd_x (pg, ltail, xs_rel)));
+  svfloat64_t y_neg = svadd_x (pg, svsub_x (pg, h, y), hlo);
+  l = svadd_x (pg, l, ltail);
+  svfloat64_t y_tiny = svsubr_x (pg, l, d->tiny_log_scale);
+  svfloat64_t res = svsel (svcmplt (pg, x, 0.0), y_neg, y);
+  res = svsel (tiny, y_tiny, res);
+
+  /* lgamma is +inf at the poles (zero and the negative integers) and at
+     +/-inf. Nan inputs are returned unchanged.  */
+  svbool_t pole = svcmpeq (svcmplt (pg, x, 0.0), r, 0.0);
+  pole = svorr_z (pg, pole, svcmpeq (pg, a, 0.0));
+  pole = svorr_z (pg, pole, svcmpeq (pg, a, INFINITY));
+  res = svsel (pole, sv_f64 (INFINITY), res);
+  res = svsel (svcmpuo (pg, x, x), x, res);
+  return svsel (special, res, y);
+}
+
+/* SVE implementation of lgamma, using the same algorithm as AdvSIMD.
+   For a = |x| >= 8 use the Stirling series. Below that, write a = n + 2 + u
+   with n an integer in [-2, 6] and u in [-0.5, 0.5], approximate 1/Gamma(2 + u)
+   with a polynomial and use the recurrence Gamma(a + 1) = a Gamma(a) to move
+   between the two. Negative inputs are handled by the reflection formula in
+   the special case.
+   The largest observed error is 2.01 ULP:
+   _ZGVsMxv_lgamma(-0x1.f9f858bf99cp-2) got 0x1.4410d5d960d2cp+0
+				       want 0x1.4410d5d960d2ep+0.
+   For x < -2 the error is relative to lgamma(-x) rather than to the result,
+   so it is unbounded in ULP close to the zeros of lgamma. In (-24, -2) it is
+   at most 2 ULP of max(|lgamma(x)|, m), with m = 1, 4, 8 and 16 in (-4, -2),
+   (-8, -4), (-16, -8) and (-24, -16). Below -24 no input is close enough to a
+   zero for this to be observed.  */
+svfloat64_t SV_NAME_D1 (lgamma) (svfloat64_t x, const svbool_t pg)
+{
+  const struct lgamma_data *d = ptr_barrier (&lgamma_data);
+  const struct data *dl = ptr_barrier (&data);
+
+  svbool_t special = svcmpge (
+      pg, svsub_x (pg, svreinterpret_u64 (x), d->special_offset),
+      d->special_bound);
+  svfloat64_t a = svabs_x (pg, x);
+
+  /* a = round(a) + u, with 1/Gamma(2 + u) = 1 + u q.  */
+  svfloat64_t ra = svrinta_x (pg, a);
+  svfloat64_t u = svsub_x (pg, a, ra);
+  svfloat64_t qlo;
+  svfloat64_t q = inv_gamma_poly (pg, u, &qlo, d);
+
+  /* n = 1/Gamma(1 + m) = m (1 + u q), with m = 1 + u if round(a) is 0 or 1
+     and m = 1 otherwise, computed as n + nlo.  */
+  svbool_t lt_three_halves = svcmplt (pg, a, d->three_halves);
+  svfloat64_t mm1 = svsel (lt_three_halves, u, sv_f64 (0.0));
+  svfloat64_t m = svadd_x (pg, mm1, 1.0);
+  svfloat64_t mlo = svsub_x (pg, mm1, svsub_x (pg, m, 1.0));
+  svfloat64_t mu = svmul_x (pg, m, u);
+  svfloat64_t mulo = svnmls_x (pg, mu, m, u);
+  svfloat64_t v = svmul_x (pg, mu, q);
+  svfloat64_t vlo = svnmls_x (pg, v, mu, q);
+  vlo = svmla_x (pg, svadd_x (pg, vlo, mlo), mulo, q);
+  vlo = svmla_x (pg, vlo, mu, qlo);
+  svfloat64_t n = svadd_x (pg, m, v);
+  svfloat64_t nlo = svadd_x (pg, svadd_x (pg, svsub_x (pg, m, n), v), vlo);
+
+  /* For 2.5 <= a < 8, Gamma(a) = p Gamma(2 + u) with
+     p = (a - 1) (a - 2) ... (2 + u).  */
+  svfloat64_t t = svsub_x (pg, a, 1.0);
+  svfloat64_t p = sv_f64 (1.0);
+  for (int i = 0; i < 6; i++)
+    {
+      p = svmul_m (svcmpge (pg, t, d->three_halves), p, t);
+      t = svsub_x (pg, t, 1.0);
+    }
+
+  /* A single division gives n / p for the small inputs and z = 1/a for the
+     Stirling series. The rounding error of the quotient is recovered from
+     the residual, and carried as a relative correction e ~= res / n.  */
+  svbool_t large = svcmpge (pg, a, d->large_bound);
+  svfloat64_t qd = svdiv_x (pg, svsel (large, sv_f64 (1.0), n),
+			    svsel (large, a, p));
+  svfloat64_t res = svadd_x (pg, svmls_x (pg, n, qd, p), nlo);
+  svfloat64_t w = svsub_x (pg, n, 1.0);
+  svfloat64_t e
+      = svmul_x (pg, res, svmla_x (pg, svsubr_x (pg, w, 1.0), w, w));
+
+  /* 1/Gamma(a) = n / p, except for a < 0.5 where it is a n.  */
+  svfloat64_t arg = svmul_m (svcmplt (pg, a, d->half), qd, a);
+  arg = svsel (large, a, arg);
+
+  svfloat64_t ltail;
+  svfloat64_t l = sv_log_inline (pg, svreinterpret_u64 (arg), &ltail, dl);
+
+  /* Small a: lgamma(a) = -log(1/Gamma(a)). Subtract from 0 rather than
+     negate, so that lgamma(1) = lgamma(2) = +0.  */
+  svfloat64_t y
+      = svsubr_x (pg, svadd_x (pg, l, svadd_x (pg, ltail, e)), 0.0);
+
+  /* Large a: lgamma(a) = (a - 0.5) (log(a) - 1) + c0 + z g(z^2).  */
+  svfloat64_t z2 = svmul_x (pg, qd, qd);
+  svfloat64_t z4 = svmul_x (pg, z2, z2);
+  svfloat64_t corr = svmla_x (pg, sv_f64 (d->c0), qd,
+			      sv_pw_horner_5_f64_x (pg, z2, z4, d->g));
+  svfloat64_t am = svsub_x (pg, a, d->half);
+  svfloat64_t y_large = svmla_x (pg, corr, am, ltail);
+  y_large = svmla_x (pg, y_large, am, svsub_x (pg, l, 1.0));
+  y = svsel (large, y_large, y);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special, pg, d, dl);
+  return y;
+}
+
+TEST_ULP (SV_NAME_D1 (lgamma), 1.52)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 0, 0x1p-54, 5000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 0x1p-54, 0.5, 20000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 0.5, 2.5, 50000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 2.5, 8, 50000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 8, 0x1p1014, 20000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), 0x1p1014, inf, 1000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), -0, -2, 50000)
+TEST_INTERVAL_ABS (SV_NAME_D1 (lgamma), -2, -4, 50000, 1)
+TEST_INTERVAL_ABS (SV_NAME_D1 (lgamma), -4, -8, 50000, 4)
+TEST_INTERVAL_ABS (SV_NAME_D1 (lgamma), -8, -16, 50000, 8)
+TEST_INTERVAL_ABS (SV_NAME_D1 (lgamma), -16, -24, 50000, 16)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), -24, -0x1p52, 20000)
+TEST_INTERVAL (SV_NAME_D1 (lgamma), -0x1p52, -inf, 1000)
+CLOSE_SVE_ATTR
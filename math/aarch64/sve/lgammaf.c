@@ -0,0 +1,197 @@
+/*
+ * Single-precision SVE lgamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "mathlib.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_poly_f64.h"
+
+#define SV_LOG_INLINE_POLY_ORDER 4
+#include "sv_log_inline.h"
+
+static const struct data
+{
+  double q[9], g[3], sinpi[6];
+  double half, three_halves, large_bound, c0, log_pi;
+  struct sv_log_inline_data log_tbl;
+  float zeros_lo, zeros_hi, zeros_bound;
+  uint32_t special_bound;
+} data = {
+  /* 1/Gamma(2 + u) ~= 1 + u q(u) for u in [-0.5, 0.5].
+     Relative error in q is 2^-31.5.  */
+  .q = { -0x1.b0ee6071890dcp-2, -0x1.dd603f652108fp-3, 0x1.875ac505d45cfp-3,
+	 -0x1.924521efeeebdp-6, -0x1.21194b510792dp-6, 0x1.06f72c365bd78p-7,
+	 -0x1.a5cc33074b160p-11, -0x1.84757590ec183p-12,
+	 0x1.3027b7fd583d2p-13 },
+  /* lgamma(a) - (a - 0.5) (log(a) - 1) - c0 ~= z g(z^2) for z = 1/a in
+     [0, 1/8]. Relative error in g is 2^-30.2.  */
+  .g = { 0x1.55555550a940fp-4, -0x1.6c141be974608p-9, 0x1.98f99354c57bap-11 },
+  /* sin(pi r) ~= r s(r^2) for r in [-0.5, 0.5].
+     Relative error in s is 2^-35.5.  */
+  .sinpi = { 0x1.921fb5441e49ep+1, -0x1.4abbce4f1a2afp+2, 0x1.466bbfc24eddcp+1,
+	     -0x1.32d11201944d3p-1, 0x1.500ff7edeaa67p-4,
+	     -0x1.cc3459f5d161bp-8 },
+  .half = 0.5,
+  .three_halves = 1.5,
+  .large_bound = 8.0,
+  .c0 = 0x1.acfe390c97d69p-2,	  /* (log(2 pi) - 1) / 2.  */
+  .log_pi = 0x1.250d048e7a1bdp0, /* log(pi).  */
+  .log_tbl = SV_LOG_CONSTANTS,
+  .zeros_lo = -16.0f,
+  .zeros_hi = -2.0f,
+  .zeros_bound = 0x1p-5f,
+  /* Zero, negative numbers, inf and nan are special.  */
+  .special_bound = 0x7f7fffff,
+};
+
+/* Convert the low or high half of the lanes of x to double.  */
+static inline svfloat64_t
+sv_cvt_lo (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (), svzip1 (x, x));
+}
+
+static inline svfloat64_t
+sv_cvt_hi (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (), svzip2 (x, x));
+}
+
+static inline svfloat32_t
+sv_cvt_narrow (svfloat64_t lo, svfloat64_t hi)
+{
+  return svuzp1 (svcvt_f32_x (svptrue_b64 (), lo),
+		 svcvt_f32_x (svptrue_b64 (), hi));
+}
+
+/* lgamma(a) for a > 0, in double precision, as in AdvSIMD lgammaf.  */
+static inline svfloat64_t
+sv_lgamma_inline (svbool_t pg, svfloat64_t a, const struct data *d)
+{
+  svfloat64_t ra = svrinta_x (pg, a);
+  svfloat64_t u = svsub_x (pg, a, ra);
+  svfloat64_t u2 = svmul_x (pg, u, u);
+  svfloat64_t u4 = svmul_x (pg, u2, u2);
+  svfloat64_t u8 = svmul_x (pg, u4, u4);
+  svfloat64_t r = svmad_x (pg, u, sv_estrin_8_f64_x (pg, u, u2, u4, u8, d->q),
+			   1.0);
+
+  /* 1/Gamma(a) = m r, with m = a (1 + a) if round(a) = 0, m = a if
+     round(a) = 1 and m = 1 otherwise.  */
+  svfloat64_t m = svadd_m (svcmplt (pg, a, d->three_halves), sv_f64 (1.0), u);
+  m = svmul_m (svcmplt (pg, a, d->half), m, a);
+  svfloat64_t n = svmul_x (pg, m, r);
+
+  /* For 2.5 <= a < 8, Gamma(a) = p Gamma(2 + u) with
+     p = (a - 1) (a - 2) ... (2 + u).  */
+  svfloat64_t t = svsub_x (pg, a, 1.0);
+  svfloat64_t p = sv_f64 (1.0);
+  for (int i = 0; i < 6; i++)
+    {
+      p = svmul_m (svcmpge (pg, t, d->three_halves), p, t);
+      t = svsub_x (pg, t, 1.0);
+    }
+
+  /* A single division gives 1/Gamma(a) = n / p for the small inputs and
+     z = 1/a for the Stirling series.  */
+  svbool_t large = svcmpge (pg, a, d->large_bound);
+  svfloat64_t qd = svdiv_x (pg, svsel (large, sv_f64 (1.0), n),
+			    svsel (large, a, p));
+  svfloat64_t l = sv_log_inline (pg, svsel (large, a, qd), &d->log_tbl);
+
+  /* Large a: lgamma(a) = (a - 0.5) (log(a) - 1) + c0 + z g(z^2).  */
+  svfloat64_t z2 = svmul_x (pg, qd, qd);
+  svfloat64_t g = svmla_x (pg, sv_f64 (d->g[1]), z2, d->g[2]);
+  g = svmad_x (pg, z2, g, d->g[0]);
+  svfloat64_t corr = svmla_x (pg, sv_f64 (d->c0), qd, g);
+  svfloat64_t y_large = svmla_x (pg, corr, svsub_x (pg, a, d->half),
+				 svsub_x (pg, l, 1.0));
+  /* Subtract from 0 rather than negate, so that lgamma(1) = lgamma(2) = +0.  */
+  return svsel (large, y_large, svsubr_x (pg, l, 0.0));
+}
+
+/* For negative x use the reflection formula
+   lgamma(x) = log(pi / |x sinpi(x)|) - lgamma(-x),
+   where y holds lgamma(-x).  */
+static inline svfloat64_t
+reflect (svbool_t pg, svfloat64_t x, svfloat64_t y, const struct data *d)
+{
+  svfloat64_t r = svsub_x (pg, x, svrinta_x (pg, x));
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t r4 = svmul_x (pg, r2, r2);
+  svfloat64_t s = sv_pw_horner_5_f64_x (pg, r2, r4, d->sinpi);
+  svfloat64_t xs = svabs_x (pg, svmul_x (pg, svmul_x (pg, x, r), s));
+  svfloat64_t l = sv_log_inline (pg, xs, &d->log_tbl);
+  return svsub_x (pg, svsubr_x (pg, l, d->log_pi), y);
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat64_t y_lo, svfloat64_t y_hi, svbool_t pg,
+	      const struct data *d)
+{
+  svbool_t ptrue = svptrue_b64 ();
+  svfloat64_t x_lo = sv_cvt_lo (x);
+  svfloat64_t x_hi = sv_cvt_hi (x);
+  y_lo = svsel (svcmplt (ptrue, x_lo, 0.0), reflect (ptrue, x_lo, y_lo, d),
+		y_lo);
+  y_hi = svsel (svcmplt (ptrue, x_hi, 0.0), reflect (ptrue, x_hi, y_hi, d),
+		y_hi);
+  svfloat32_t y = sv_cvt_narrow (y_lo, y_hi);
+
+  /* lgamma is +inf at the poles (zero and the negative integers) and at
+     +/-inf. Nan inputs are returned unchanged.  */
+  svbool_t pole = svcmpeq (svcmple (pg, x, 0.0f), svrinta_x (pg, x), x);
+  pole = svorr_z (pg, pole, svcmpeq (pg, x, INFINITY));
+  y = svsel (pole, sv_f32 (INFINITY), y);
+  y = svsel (svcmpuo (pg, x, x), x, y);
+
+  /* Close to the zeros of lgammaf below -2 the result cancels, and the
+     absolute error of the reflection is too large relative to it. Use the
+     double-precision routine for these lanes. Below -16 no input is close
+     enough to a zero for this to matter.  */
+  svbool_t near_zero = svcmpgt (svcmplt (pg, x, d->zeros_hi), x, d->zeros_lo);
+  near_zero = svaclt (near_zero, y, d->zeros_bound);
+  if (unlikely (svptest_any (pg, near_zero)))
+    {
+      svfloat32_t y_dp = sv_cvt_narrow (SV_NAME_D1 (lgamma) (x_lo, ptrue),
+					SV_NAME_D1 (lgamma) (x_hi, ptrue));
+      y = svsel (near_zero, y_dp, y);
+    }
+  return y;
+}
+
+/* Single-precision SVE lgamma, computed in double precision.
+   The largest observed error is 0.53 ULP:
+   _ZGVsMxv_lgammaf(-0x1.3ffb68p+1) got -0x1.cb7b18p-5
+				   want -0x1.cb7b1ap-5.  */
+svfloat32_t SV_NAME_F1 (lgamma) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  svbool_t special = svcmpge (
+      pg, svsub_x (pg, svreinterpret_u32 (x), 1), d->special_bound);
+  svfloat32_t a = svabs_x (pg, x);
+  svbool_t ptrue = svptrue_b64 ();
+  svfloat64_t y_lo = sv_lgamma_inline (ptrue, sv_cvt_lo (a), d);
+  svfloat64_t y_hi = sv_lgamma_inline (ptrue, sv_cvt_hi (a), d);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y_lo, y_hi, pg, d);
+  return sv_cvt_narrow (y_lo, y_hi);
+}
+
+TEST_ULP (SV_NAME_F1 (lgamma), 0.04)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), 0, 0.5, 20000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), 0.5, 2.5, 50000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), 2.5, 8, 50000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), 8, 0x1p122, 20000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), 0x1p122, inf, 1000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), -0, -2, 50000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), -2, -0x1p23, 20000)
+TEST_INTERVAL (SV_NAME_F1 (lgamma), -0x1p23, -inf, 1000)
+CLOSE_SVE_ATTR
@@ -0,0 +1,184 @@
+/*
+ * Single-precision SVE tgamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_poly_f64.h"
+#define WANT_SV_POW_SIGN_BIAS 0
+#include "sv_pow_inline.h"
+
+static const struct tgammaf_data
+{
+  double q[9], g[3], sinpi[6];
+  double half, three_halves, large_bound, inv_large_bound, large_clamp;
+  double c, pi;
+  uint32_t special_bound;
+} tgammaf_data = {
+  /* 1/Gamma(2 + u) ~= 1 + u q(u) for u in [-0.5, 0.5], as in lgammaf.  */
+  .q = { -0x1.b0ee6071890dcp-2, -0x1.dd603f652108fp-3, 0x1.875ac505d45cfp-3,
+	 -0x1.924521efeeebdp-6, -0x1.21194b510792dp-6, 0x1.06f72c365bd78p-7,
+	 -0x1.a5cc33074b160p-11, -0x1.84757590ec183p-12,
+	 0x1.3027b7fd583d2p-13 },
+  /* Remainder of the Stirling series, as in lgammaf.  */
+  .g = { 0x1.55555550a940fp-4, -0x1.6c141be974608p-9, 0x1.98f99354c57bap-11 },
+  /* sin(pi r) ~= r s(r^2), as in lgammaf.  */
+  .sinpi = { 0x1.921fb5441e49ep+1, -0x1.4abbce4f1a2afp+2,
+	     0x1.466bbfc24eddcp+1, -0x1.32d11201944d3p-1,
+	     0x1.500ff7edeaa67p-4, -0x1.cc3459f5d161bp-8 },
+  .half = 0.5,
+  .three_halves = 1.5,
+  .large_bound = 8.0,
+  .inv_large_bound = 0.125,
+  /* Beyond this |tgammaf(x)| is 0 or inf, also for x close to the negative
+     integers.  */
+  .large_clamp = 48.0,
+  .c = 0x1.d67f1c864beb5p-1, /* log(2 pi) / 2.  */
+  .pi = 0x1.921fb54442d18p1,
+  /* Zero, negative numbers, inf and nan are special.  */
+  .special_bound = 0x7f7fffff,
+};
+
+/* Convert the low or high half of the lanes of x to double.  */
+static inline svfloat64_t
+sv_cvt_lo (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (), svzip1 (x, x));
+}
+
+static inline svfloat64_t
+sv_cvt_hi (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (), svzip2 (x, x));
+}
+
+static inline svfloat32_t
+sv_cvt_narrow (svfloat64_t lo, svfloat64_t hi)
+{
+  return svuzp1 (svcvt_f32_x (svptrue_b64 (), lo),
+		 svcvt_f32_x (svptrue_b64 (), hi));
+}
+
+/* tgamma(a) for a > 0, in double precision, as in AdvSIMD tgammaf.  */
+static inline svfloat64_t
+sv_tgamma_inline (svbool_t pg, svfloat64_t a, const struct tgammaf_data *d,
+		  const struct data *dl)
+{
+  svfloat64_t ra = svrinta_x (pg, a);
+  svfloat64_t u = svsub_x (pg, a, ra);
+  svfloat64_t u2 = svmul_x (pg, u, u);
+  svfloat64_t u4 = svmul_x (pg, u2, u2);
+  svfloat64_t u8 = svmul_x (pg, u4, u4);
+  svfloat64_t r
+      = svmad_x (pg, u, sv_estrin_8_f64_x (pg, u, u2, u4, u8, d->q), 1.0);
+
+  /* 1/Gamma(a) = m r, with m as in lgammaf.  */
+  svfloat64_t m
+      = svadd_m (svcmplt (pg, a, d->three_halves), sv_f64 (1.0), u);
+  m = svmul_m (svcmplt (pg, a, d->half), m, a);
+  svfloat64_t n = svmul_x (pg, m, r);
+
+  /* For 2.5 <= a < 8, Gamma(a) = p Gamma(2 + u) with
+     p = (a - 1) (a - 2) ... (2 + u).  */
+  svfloat64_t t = svsub_x (pg, a, 1.0);
+  svfloat64_t p = sv_f64 (1.0);
+  for (int i = 0; i < 6; i++)
+    {
+      p = svmul_m (svcmpge (pg, t, d->three_halves), p, t);
+      t = svsub_x (pg, t, 1.0);
+    }
+
+  /* A single division gives Gamma(a) = p / n for the small inputs and
+     z = 1/a for the Stirling series.  */
+  svbool_t large = svcmpge (pg, a, d->large_bound);
+  svfloat64_t al = svminnm_x (pg, svmaxnm_x (pg, a, d->large_bound),
+			      d->large_clamp);
+  svfloat64_t qd = svdiv_x (pg, svsel (large, sv_f64 (1.0), p),
+			    svsel (large, al, n));
+
+  /* Large a: h = (a - 0.5) log(a) - a + c + z g(z^2). z is replaced in the
+     other lanes so that h stays in range of the inline exp.  */
+  svfloat64_t ltail;
+  svfloat64_t l = sv_log_inline (pg, svreinterpret_u64 (al), &ltail, dl);
+  svfloat64_t z = svsel (large, qd, sv_f64 (d->inv_large_bound));
+  svfloat64_t z2 = svmul_x (pg, z, z);
+  svfloat64_t g = svmla_x (pg, sv_f64 (d->g[1]), z2, d->g[2]);
+  g = svmad_x (pg, z2, g, d->g[0]);
+  svfloat64_t corr = svmla_x (pg, sv_f64 (d->c), z, g);
+  svfloat64_t h = svmla_x (pg, svsub_x (pg, corr, al),
+			   svsub_x (pg, al, d->half), l);
+  svfloat64_t e = sv_exp_inline (pg, h, sv_f64 (0.0), sv_u64 (0), dl);
+  return svsel (large, e, qd);
+}
+
+/* For negative x use the reflection formula
+   tgamma(x) = pi / (|x| sin(pi x) tgamma(-x)),
+   where y holds tgamma(-x). sin(pi x) = (-1)^k sin(pi r), with x = k + r.  */
+static inline svfloat64_t
+reflect (svbool_t pg, svfloat64_t x, svfloat64_t y,
+	 const struct tgammaf_data *d)
+{
+  svfloat64_t k = svrinta_x (pg, x);
+  svfloat64_t r = svsub_x (pg, x, k);
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t r4 = svmul_x (pg, r2, r2);
+  svfloat64_t s = sv_pw_horner_5_f64_x (pg, r2, r4, d->sinpi);
+  svfloat64_t den = svmul_x (pg, svmul_x (pg, svmul_x (pg, x, r), s), y);
+  svfloat64_t y_neg = svdivr_x (pg, svneg_x (pg, den), d->pi);
+  svuint64_t odd = svlsl_x (pg, svreinterpret_u64 (svcvt_s64_x (pg, k)), 63);
+  return svreinterpret_f64 (sveor_x (pg, svreinterpret_u64 (y_neg), odd));
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat64_t y_lo, svfloat64_t y_hi, svbool_t pg,
+	      const struct tgammaf_data *d)
+{
+  svbool_t ptrue = svptrue_b64 ();
+  svfloat64_t x_lo = sv_cvt_lo (x);
+  svfloat64_t x_hi = sv_cvt_hi (x);
+  y_lo = svsel (svcmplt (ptrue, x_lo, 0.0), reflect (ptrue, x_lo, y_lo, d),
+		y_lo);
+  y_hi = svsel (svcmplt (ptrue, x_hi, 0.0), reflect (ptrue, x_hi, y_hi, d),
+		y_hi);
+  svfloat32_t y = sv_cvt_narrow (y_lo, y_hi);
+
+  /* tgammaf(+/-0) = +/-inf, and tgammaf is nan at the negative integers and
+     -inf. Nan inputs are returned unchanged.  */
+  y = svsel (svcmpeq (pg, x, 0.0f), svdivr_x (pg, x, 1.0f), y);
+  svbool_t invalid = svcmpeq (svcmplt (pg, x, 0.0f), svrinta_x (pg, x), x);
+  y = svsel (invalid, sv_f32 (NAN), y);
+  return svsel (svcmpuo (pg, x, x), x, y);
+}
+
+/* Single-precision SVE tgamma, computed in double precision.
+   The largest observed error is 0.51 ULP:
+   _ZGVsMxv_tgammaf(-0x1.3c885cp+1) got -0x1.f46e18p-1
+				   want -0x1.f46e1ap-1.  */
+svfloat32_t SV_NAME_F1 (tgamma) (svfloat32_t x, const svbool_t pg)
+{
+  const struct tgammaf_data *d = ptr_barrier (&tgammaf_data);
+  const struct data *dl = ptr_barrier (&data);
+
+  svbool_t special = svcmpge (
+      pg, svsub_x (pg, svreinterpret_u32 (x), 1), d->special_bound);
+  svfloat32_t a = svabs_x (pg, x);
+  svbool_t ptrue = svptrue_b64 ();
+  svfloat64_t y_lo = sv_tgamma_inline (ptrue, sv_cvt_lo (a), d, dl);
+  svfloat64_t y_hi = sv_tgamma_inline (ptrue, sv_cvt_hi (a), d, dl);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y_lo, y_hi, pg, d);
+  return sv_cvt_narrow (y_lo, y_hi);
+}
+
+TEST_SIG (SV, F, 1, tgamma, -9.9, 9.9)
+TEST_ULP (SV_NAME_F1 (tgamma), 0.01)
+TEST_SYM_INTERVAL (SV_NAME_F1 (tgamma), 0, 0.5, 20000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (tgamma), 0.5, 8, 50000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (tgamma), 8, 48, 50000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (tgamma), 48, inf, 1000)
+CLOSE_SVE_ATTR
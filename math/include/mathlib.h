@@ -20,6 +20,16 @@ void arm_math_sincospif (float, float *, float *);
 void arm_math_sincospi (double, double *, double *);
 #endif
 
+/* Integer-only scalar implementations for targets without an FPU.  */
+float arm_math_soft_atan2f (float, float);
+float arm_math_soft_cosf (float);
+float arm_math_soft_exp2f (float);
+float arm_math_soft_expf (float);
+float arm_math_soft_log2f (float);
+float arm_math_soft_logf (float);
+float arm_math_soft_sinf (float);
+float arm_math_soft_sqrtf (float);
+
 /* SIMD declaration for autovectorisation with fast-math enabled. Only GCC is
    supported, and vector routines are only supported on Linux on AArch64.  */
 #if defined __aarch64__ && __linux__ && defined(__GNUC__)                     \
@@ -67,6 +77,7 @@ DECL_SIMD_aarch64 float exp2f (float);
 DECL_SIMD_aarch64 float expf (float);
 DECL_SIMD_aarch64 float expm1f (float);
 DECL_SIMD_aarch64 float hypotf (float, float);
+DECL_SIMD_aarch64 float lgammaf (float);
 DECL_SIMD_aarch64 float log10f (float);
 DECL_SIMD_aarch64 float log1pf (float);
 DECL_SIMD_aarch64 float log2f (float);
@@ -77,6 +88,7 @@ void sincosf (float, float *, float *);
 DECL_SIMD_aarch64 float sinhf (float);
 DECL_SIMD_aarch64 float tanf (float);
 DECL_SIMD_aarch64 float tanhf (float);
+DECL_SIMD_aarch64 float tgammaf (float);
 
 DECL_SIMD_aarch64 double acos (double);
 DECL_SIMD_aarch64 double acosh (double);
@@ -95,6 +107,7 @@ DECL_SIMD_aarch64 double exp2 (double);
 DECL_SIMD_aarch64 double exp (double);
 DECL_SIMD_aarch64 double expm1 (double);
 DECL_SIMD_aarch64 double hypot (double, double);
+DECL_SIMD_aarch64 double lgamma (double);
 DECL_SIMD_aarch64 double log10 (double);
 DECL_SIMD_aarch64 double log1p (double);
 DECL_SIMD_aarch64 double log2 (double);
@@ -104,6 +117,7 @@ DECL_SIMD_aarch64 double sin (double);
 DECL_SIMD_aarch64 double sinh (double);
 DECL_SIMD_aarch64 double tan (double);
 DECL_SIMD_aarch64 double tanh (double);
+DECL_SIMD_aarch64 double tgamma (double);
 
 #if __aarch64__ && __linux__
 # include <arm_neon.h>
@@ -135,6 +149,7 @@ __vpcs float32x4_t _ZGVnN4v_exp10m1f (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_expf (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_expf_1u (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_expm1f (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_lgammaf (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_log10f (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_log10p1f (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_log1pf (float32x4_t);
@@ -148,6 +163,7 @@ __vpcs float32x4_t _ZGVnN4v_sinpif (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_tanf (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_tanhf (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_tanpif (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_tgammaf (float32x4_t);
 __vpcs float32x4_t _ZGVnN4vl4_modff (float32x4_t, float *);
 __vpcs float32x4_t _ZGVnN4vv_atan2f (float32x4_t, float32x4_t);
 __vpcs float32x4_t _ZGVnN4vv_atan2pif (float32x4_t, float32x4_t);
@@ -181,6 +197,7 @@ __vpcs float64x2_t _ZGVnN2v_exp10m1 (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_exp2 (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_exp2m1 (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_expm1 (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_lgamma (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_log (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_log10 (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_log10p1 (float64x2_t);
@@ -194,6 +211,7 @@ __vpcs float64x2_t _ZGVnN2v_sinpi (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_tan (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_tanh (float64x2_t);
 __vpcs float64x2_t _ZGVnN2v_tanpi (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_tgamma (float64x2_t);
 __vpcs float64x2_t _ZGVnN2vl8_modf (float64x2_t, double *);
 __vpcs float64x2_t _ZGVnN2vv_atan2 (float64x2_t, float64x2_t);
 __vpcs float64x2_t _ZGVnN2vv_atan2pi (float64x2_t, float64x2_t);
@@ -237,6 +255,7 @@ svfloat32_t _ZGVsMxv_expf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_expm1f (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_exp2m1f (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_exp10m1f (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_lgammaf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_log10f (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_log10p1f (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_log1pf (svfloat32_t, svbool_t);
@@ -250,6 +269,7 @@ svfloat32_t _ZGVsMxv_sinpif (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_tanf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_tanhf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_tanpif (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_tgammaf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxvl4_modff (svfloat32_t, float *, svbool_t);
 svfloat32_t _ZGVsMxvv_atan2f (svfloat32_t, svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxvv_atan2pif (svfloat32_t, svfloat32_t, svbool_t);
@@ -283,6 +303,7 @@ svfloat64_t _ZGVsMxv_exp10m1 (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_exp2 (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_exp2m1 (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_expm1 (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_lgamma (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_log (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_log10 (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_log10p1 (svfloat64_t, svbool_t);
@@ -296,6 +317,7 @@ svfloat64_t _ZGVsMxv_sinpi (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_tan (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_tanh (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_tanpi (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_tgamma (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxvl8_modf (svfloat64_t, double *, svbool_t);
 svfloat64_t _ZGVsMxvv_atan2 (svfloat64_t, svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxvv_atan2pi (svfloat64_t, svfloat64_t, svbool_t);
@@ -12,6 +12,7 @@
 #define TEST_ULP_NONNEAREST(f, l)
 
 #define TEST_INTERVAL(f, lo, hi, n)
+#define TEST_INTERVAL_ABS(f, lo, hi, n, lim)
 #define TEST_SYM_INTERVAL(f, lo, hi, n)
 #define TEST_INTERVAL2(f, xlo, xhi, ylo, yhi, n)
 
@@ -0,0 +1,129 @@
+/*
+ * Integer-only single-precision atan2 function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* pi and pi/2 with 62 fraction bits.  */
+#define Pi 0xc90fdaa22168c235ULL
+#define PiOver2 0x6487ed5110b4611aULL
+
+/* atan(i/16) with 62 fraction bits.  */
+static const uint64_t AtanTab[17] = {
+  0x0000000000000000, 0x03feab76e59fbd39, 0x07f56ea6ab0bdb72,
+  0x0bdcbda5e72d8113, 0x0fadbafc96406eb1, 0x1362773707ebcbcd,
+  0x16f61941e4def08e, 0x1a64eec3cc23fcb7, 0x1dac670561bb4f69,
+  0x20cafd29b6619f8b, 0x23c01757bdfd67e7, 0x268be0399c6f7688,
+  0x292f1f464d3dc249, 0x2bab130e2d363020, 0x2e014f8af08c679d,
+  0x3033a16e2b149990, 0x3243f6a8885a308d,
+};
+
+/* Return 1 + u h(u), with 31 fraction bits, for the atan Taylor series
+   atan(t) = t (1 + t^2 h(t^2)) up to the t^7 term, where u = t^2 has 32
+   fraction bits and is at most 2^-10.  */
+static inline uint32_t
+atan_poly (uint32_t u)
+{
+  int32_t h = -0x12492492;
+  h = 0x1999999a + softf_smul (h, u);
+  h = -0x2aaaaaab + softf_smul (h, u);
+  return 0x80000000 + softf_smul (h, u);
+}
+
+/* atan2(y, x) for targets without an FPU.  t = min(|x|,|y|)/max(|x|,|y|) is
+   computed by integer division, and atan(t) = atan(c) + atan((t-c)/(1+tc))
+   with c = i/16 the nearest multiple of 1/16 to t.  Small t uses a series
+   directly, keeping the relative accuracy of tiny results.  */
+float
+arm_math_soft_atan2f (float y, float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t iy = asuint (y);
+  uint32_t iax = ix & 0x7fffffff;
+  uint32_t iay = iy & 0x7fffffff;
+  uint32_t sign = iy & 0x80000000;
+
+  if (unlikely (iax - 1 >= 0x7f7fffff || iay - 1 >= 0x7f7fffff))
+    {
+      /* x or y is zero, infinite or nan.  */
+      if (iay > 0x7f800000)
+	return softf_nan (iy);
+      if (iax > 0x7f800000)
+	return softf_nan (ix);
+      if (iay == 0)
+	/* atan2(+-0, x) is +-0 for x > 0 or x = +0, and +-pi otherwise.  */
+	return asfloat (sign | (ix >> 31 ? 0x40490fdb : 0));
+      if (iax == 0x7f800000)
+	{
+	  if (iay == 0x7f800000)
+	    /* atan2(+-inf, +-inf) is +-pi/4 or +-3pi/4.  */
+	    return asfloat (sign | (ix >> 31 ? 0x4016cbe4 : 0x3f490fdb));
+	  /* atan2(y, +-inf) for finite y is +-0 or +-pi.  */
+	  return asfloat (sign | (ix >> 31 ? 0x40490fdb : 0));
+	}
+      /* x is zero or y is infinite: the result is +-pi/2.  */
+      return asfloat (sign | 0x3fc90fdb);
+    }
+
+  /* Divide the smaller magnitude by the larger: t = q * 2^te, with q in
+     [2^31, 2^32) and t <= 1.  */
+  int swap = iay > iax;
+  int en, ed;
+  uint32_t mn = softf_unpack (swap ? iax : iay, &en);
+  uint32_t md = softf_unpack (swap ? iay : iax, &ed);
+  int te = en - ed - 32;
+  uint64_t num = (uint64_t) mn << 32;
+  if (mn >= md)
+    {
+      num >>= 1;
+      te++;
+    }
+  uint32_t q = num / md;
+
+  /* t with 58 fraction bits, and i = round(16 t).  */
+  uint64_t t58 = softf_shift64 (q, te + 58);
+  uint32_t i = (t58 + (1ULL << 53)) >> 54;
+  uint64_t res;
+  if (i == 0)
+    {
+      /* t < 1/32: atan(t) = t (1 + t^2 h(t^2)) = q' * 2^(te+1).  */
+      uint32_t u = softf_shr64 (softf_mulhi (q, q), -(2 * te + 64));
+      uint32_t a = softf_mulhi (q, atan_poly (u));
+      if (!swap && !(ix >> 31))
+	return softf_pack (sign, te + 1, a);
+      res = softf_shift64 (a, te + 63);
+    }
+  else
+    {
+      /* d = (t - c)/(1 + tc) = (16t - i)/(16 + ti), with 36 fraction bits.
+	 |d| <= 1/32.  */
+      int64_t dn = (t58 << 4) - ((uint64_t) i << 58);
+      uint64_t dd = (16ULL << 58) + i * t58;
+      uint64_t an = dn < 0 ? -(uint64_t) dn : (uint64_t) dn;
+      uint32_t d = (an << 6) / (dd >> 30);
+
+      /* atan(d) = d (1 + d^2 h(d^2)), with 62 fraction bits.  */
+      uint32_t u = ((uint64_t) d * d) >> 40;
+      uint64_t a = ((uint64_t) softf_mulhi (d, atan_poly (u)) << 27);
+      res = AtanTab[i] + (dn < 0 ? -a : a);
+    }
+
+  /* atan(1/t) = pi/2 - atan(t), and atan2(y, x) = pi - atan2(y, -x).  */
+  if (swap)
+    res = PiOver2 - res;
+  if (ix >> 31)
+    res = Pi - res;
+  return softf_pack (sign, -62, res);
+}
+
+TEST_ULP (arm_math_soft_atan2f, 0.05)
+TEST_INTERVAL2 (arm_math_soft_atan2f, -10.0, 10.0, -10.0, 10.0, 50000)
+TEST_INTERVAL2 (arm_math_soft_atan2f, -1.0, 1.0, -1.0, 1.0, 50000)
+TEST_INTERVAL2 (arm_math_soft_atan2f, 0, 0x1p-100, 0x1p20, inf, 10000)
+TEST_INTERVAL2 (arm_math_soft_atan2f, -0x1p80, 0x1p80, -inf, inf, 10000)
@@ -0,0 +1,22 @@
+/*
+ * Integer-only single-precision cos function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* cos(x) for targets without an FPU, computed as in arm_math_soft_sinf.  */
+float
+arm_math_soft_cosf (float x)
+{
+  return softf_sincos (asuint (x), 1);
+}
+
+TEST_ULP (arm_math_soft_cosf, 0.05)
+TEST_INTERVAL (arm_math_soft_cosf, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_soft_cosf, 0x1p-14, 0x1p54, 50000)
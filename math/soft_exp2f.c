@@ -0,0 +1,54 @@
+/*
+ * Integer-only single-precision 2^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* ln2 with 64 fraction bits.  */
+#define Ln2 0xb17217f7d1cf79acULL
+
+/* 2^x for targets without an FPU, using the exp2f table.  x is converted
+   exactly to fixed point, with 37 fraction bits, for 0x1p-7 <= |x| < 160.
+   Smaller |x| are handled as e^(x ln2) by a separate series, since 2^x is
+   then close to 1 and needs more absolute accuracy.  */
+float
+arm_math_soft_exp2f (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t iax = ix & 0x7fffffff;
+  if (unlikely (iax >= 0x43200000))
+    {
+      /* |x| >= 160 or x is nan.  */
+      if (iax > 0x7f800000)
+	return softf_nan (ix);
+      return asfloat (ix & 0x80000000 ? 0 : 0x7f800000);
+    }
+  if (iax == 0)
+    return 1.0f;
+
+  int e;
+  uint32_t m = softf_unpack (iax, &e);
+  if (iax < 0x3c000000)
+    {
+      /* |x| < 0x1p-7: (m * Ln2) >> 32 = x ln2 * 2^(32 - e).  */
+      uint64_t y = (uint64_t) m * (uint32_t) (Ln2 >> 32)
+		   + (((uint64_t) m * (uint32_t) Ln2) >> 32);
+      y = softf_shift64 (y, e + 30);
+      return softf_exp_small (ix & 0x80000000 ? -y : y);
+    }
+  uint64_t t = softf_shift64 (m, e + 37);
+  if (ix & 0x80000000)
+    t = -t;
+  return softf_exp2 (t);
+}
+
+TEST_ULP (arm_math_soft_exp2f, 0.01)
+TEST_INTERVAL (arm_math_soft_exp2f, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_soft_exp2f, 0x1p-14, 0x1p8, 500000)
+TEST_SYM_INTERVAL (arm_math_soft_exp2f, 0x1p-30, 0x1p-7, 100000)
@@ -0,0 +1,56 @@
+/*
+ * Integer-only single-precision e^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* 1/ln2 with 63 fraction bits.  */
+#define InvLn2 0xb8aa3b295c17f0bcULL
+
+/* e^x for targets without an FPU, computed as 2^(x/ln2) using the exp2f
+   table.  x/ln2 is formed in fixed point with 37 fraction bits, using a
+   64-bit 1/ln2 so that its error is negligible even for the largest x.
+   |x| < 0x1p-7 is handled by a separate series, since e^x is then close to
+   1 and needs more absolute accuracy.  */
+float
+arm_math_soft_expf (float x)
+{
+  uint32_t ix = asuint (x);
+  uint32_t iax = ix & 0x7fffffff;
+  if (unlikely (iax >= 0x42e00000))
+    {
+      /* |x| >= 112 or x is nan.  */
+      if (iax > 0x7f800000)
+	return softf_nan (ix);
+      return asfloat (ix & 0x80000000 ? 0 : 0x7f800000);
+    }
+  if (iax == 0)
+    return 1.0f;
+
+  /* x = m * 2^e, and (m * InvLn2) >> 32 = x/ln2 * 2^(31 - e).  */
+  int e;
+  uint32_t m = softf_unpack (iax, &e);
+  if (iax < 0x3c000000)
+    {
+      /* |x| < 0x1p-7.  */
+      uint64_t y = softf_shift64 (m, e + 62);
+      return softf_exp_small (ix & 0x80000000 ? -y : y);
+    }
+  uint64_t t = (uint64_t) m * (uint32_t) (InvLn2 >> 32)
+	       + (((uint64_t) m * (uint32_t) InvLn2) >> 32);
+  t = softf_shift64 (t, e + 6);
+  if (ix & 0x80000000)
+    t = -t;
+  return softf_exp2 (t);
+}
+
+TEST_ULP (arm_math_soft_expf, 0.01)
+TEST_INTERVAL (arm_math_soft_expf, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_soft_expf, 0x1p-14, 0x1p8, 500000)
+TEST_SYM_INTERVAL (arm_math_soft_expf, 0x1p-30, 0x1p-7, 100000)
@@ -0,0 +1,283 @@
+/*
+ * Helpers for the integer-only single-precision routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef _SOFT_FLOAT_H
+#define _SOFT_FLOAT_H
+
+#include <stdint.h>
+#include "math_config.h"
+
+/* The arm_math_soft_* routines are intended for targets without an FPU, where
+   every floating-point operation is a call into the soft-float library (and
+   on such targets the double-precision arithmetic used by expf, logf and sinf
+   is particularly slow).  They only look at the representation of their
+   arguments, and do all the work in 32- and 64-bit integer and fixed-point
+   arithmetic.  The result is rounded to nearest from a fixed-point value with
+   at least 30 correct bits, whatever the current rounding mode, and no
+   floating-point exceptions or errno values are raised.  */
+
+/* Return a quiet NaN for NaN input X.  */
+static inline float
+softf_nan (uint32_t ix)
+{
+  return asfloat (ix | 0x00400000);
+}
+
+static inline uint32_t
+softf_mulhi (uint32_t a, uint32_t b)
+{
+  return ((uint64_t) a * b) >> 32;
+}
+
+/* Signed fixed-point multiply: A has 31 fraction bits and U has 32, and the
+   result has 31.  */
+static inline int32_t
+softf_smul (int32_t a, uint32_t u)
+{
+  return ((int64_t) a * u) >> 32;
+}
+
+/* Shift right, allowing shift counts of 64 or more.  */
+static inline uint64_t
+softf_shr64 (uint64_t x, int n)
+{
+  return n < 64 ? x >> n : 0;
+}
+
+/* Shift left if N is positive and right if N is negative.  */
+static inline uint64_t
+softf_shift64 (uint64_t x, int n)
+{
+  return n >= 0 ? x << n : softf_shr64 (x, -n);
+}
+
+/* Split finite nonzero |x|, given as its representation without the sign
+   bit, into a mantissa in [2^23, 2^24) and an exponent E, so that
+   |x| = m * 2^E.  */
+static inline uint32_t
+softf_unpack (uint32_t iax, int *e)
+{
+  if (likely (iax >= 0x00800000))
+    {
+      *e = (int) (iax >> 23) - 150;
+      return (iax & 0x007fffff) | 0x00800000;
+    }
+  int n = __builtin_clz (iax) - 8;
+  *e = -149 - n;
+  return iax << n;
+}
+
+/* Return the float nearest to m * 2^E, with the sign bit SIGN (0 or
+   0x80000000).  M must be nonzero.  Ties are rounded to even, and values too
+   large or too small to represent become infinity or zero.  */
+static inline float
+softf_pack (uint32_t sign, int e, uint64_t m)
+{
+  int n = __builtin_clzll (m);
+  m <<= n;
+  /* Biased exponent of the result, if it is a normal number.  */
+  e += 190 - n;
+  if (e >= 255)
+    return asfloat (sign | 0x7f800000);
+  /* The leading bit of m ends up as bit 23 of the result, so adding it to
+     (e - 1) << 23 gives the right exponent field, and carries into it if
+     rounding overflows the mantissa.  A subnormal result has a smaller
+     mantissa, added to an exponent field of 0.  */
+  int sh = 40;
+  if (e <= 0)
+    {
+      sh += 1 - e;
+      e = 1;
+    }
+  if (sh > 64)
+    return asfloat (sign);
+  uint32_t mant = softf_shr64 (m, sh);
+  uint64_t rem = sh == 64 ? m : m << (64 - sh);
+  if (rem > (1ULL << 63) || (rem == (1ULL << 63) && (mant & 1)))
+    mant++;
+  return asfloat (sign | (((uint32_t) (e - 1) << 23) + mant));
+}
+
+/* Convert the double with representation D to fixed point with FBITS
+   fraction bits, truncating towards zero.  |d| must be below 2^(62-FBITS).  */
+static inline int64_t
+softf_fixed (uint64_t d, int fbits)
+{
+  int e = (d >> 52) & 0x7ff;
+  if (e == 0)
+    return 0;
+  uint64_t m = (d & 0x000fffffffffffff) | 0x0010000000000000;
+  int64_t y = softf_shift64 (m, e - 1075 + fbits);
+  return d >> 63 ? -y : y;
+}
+
+/* Return log(1+r) for |r| < 0x1p-5, with r and the result in fixed point
+   with 62 and 55 fraction bits respectively.  */
+static inline int64_t
+softf_log1p (int64_t r)
+{
+  /* log(1+r) = r + r^2 h(r), where h is the Taylor series
+     -1/2 + r/3 - r^2/4 + r^3/5 - r^4/6, evaluated with 31 fraction bits.
+     The omitted terms are below 2^-32 relative to the result.  */
+  int32_t r35 = r >> 27;
+  int32_t h = -0x15555555;
+  h = 0x1999999a + (((int64_t) r35 * h) >> 35);
+  h = -0x20000000 + (((int64_t) r35 * h) >> 35);
+  h = 0x2aaaaaab + (((int64_t) r35 * h) >> 35);
+  h = -0x40000000 + (((int64_t) r35 * h) >> 35);
+  int32_t g = ((int64_t) r35 * h) >> 31;
+  return (r >> 7) + (((int64_t) r35 * g) >> 15);
+}
+
+/* Return sin(x), or cos(x) if COS is 1, for x with representation IX.  */
+static inline float
+softf_sincos (uint32_t ix, int cos)
+{
+  uint32_t iax = ix & 0x7fffffff;
+  uint32_t sign = cos ? 0 : ix & 0x80000000;
+  uint32_t rm, rsign = 0;
+  int re, n = 0;
+
+  if (unlikely (iax >= 0x7f800000))
+    return iax > 0x7f800000 ? softf_nan (ix) : asfloat (0x7fc00000);
+  if (iax < 0x39800000)
+    /* |x| < 0x1p-12.  */
+    return cos ? 1.0f : asfloat (ix);
+
+  /* Reduce |x| to r = rm * 2^re, with rm in [2^31, 2^32), and sign RSIGN, so
+     that |x| = n*pi/2 + r and |r| <= pi/4.  */
+  if (iax <= 0x3f490fdb)
+    {
+      /* |x| <= pi/4 rounded up, and r = |x| exactly.  */
+      rm = softf_unpack (iax, &re) << 8;
+      re -= 8;
+    }
+  else
+    {
+      /* As reduce_large in sincosf.h, but extended to smaller |x| by reading
+	 leading zero bits of 2/pi in place of __inv_pio4[-1].  The result is
+	 |x| * 2/pi modulo 4, with 62 fraction bits, accurate to 2^-61.  */
+      int e = iax >> 23;
+      int idx = (e >> 3) - 16;
+      uint32_t m = ((iax & 0x007fffff) | 0x00800000) << (e & 7);
+      uint32_t hi = 0, mid, lo;
+      if (idx < 0)
+	{
+	  mid = __inv_pio4[3];
+	  lo = __inv_pio4[7];
+	}
+      else
+	{
+	  hi = __inv_pio4[idx];
+	  mid = __inv_pio4[idx + 4];
+	  lo = __inv_pio4[idx + 8];
+	}
+      uint64_t res = ((uint64_t) (m * hi) << 32) + (uint64_t) m * mid
+		     + (((uint64_t) m * lo) >> 32);
+      n = (res + (1ULL << 61)) >> 62;
+      int64_t d = res - ((uint64_t) n << 62);
+      rsign = d < 0;
+      /* Setting the low bit, which is below the accuracy of the reduction,
+	 keeps the value nonzero.  */
+      uint64_t a = (d < 0 ? -(uint64_t) d : (uint64_t) d) | 1;
+      int sh = __builtin_clzll (a);
+      rm = softf_mulhi ((a << sh) >> 32, 0xc90fdaa2); /* pi/2 * 2^31.  */
+      re = -29 - sh;
+      if (!(rm >> 31))
+	{
+	  rm <<= 1;
+	  re--;
+	}
+    }
+
+  /* r^2 with 32 fraction bits.  */
+  uint32_t u = softf_shr64 (softf_mulhi (rm, rm), -(2 * re + 64));
+  uint32_t mant;
+  int e;
+  n += cos;
+  if (n & 1)
+    {
+      /* cos(r) = 1 + r^2 h(r^2), with the Taylor series of h up to the r^10
+	 term, evaluated with 31 fraction bits.  */
+      int32_t h = 0x4;
+      h = -0x250 + softf_smul (h, u);
+      h = 0xd00d + softf_smul (h, u);
+      h = -0x2d82d8 + softf_smul (h, u);
+      h = 0x5555555 + softf_smul (h, u);
+      h = -0x40000000 + softf_smul (h, u);
+      mant = 0x80000000 + softf_smul (h, u);
+      e = -31;
+    }
+  else
+    {
+      /* sin(r) = r (1 + r^2 h(r^2)), similarly.  */
+      int32_t h = -0x36;
+      h = 0x171e + softf_smul (h, u);
+      h = -0x68068 + softf_smul (h, u);
+      h = 0x1111111 + softf_smul (h, u);
+      h = -0x15555555 + softf_smul (h, u);
+      mant = softf_mulhi (rm, 0x80000000 + softf_smul (h, u));
+      e = re + 1;
+      sign ^= rsign << 31;
+    }
+  sign ^= (n & 2) << 30;
+  return softf_pack (sign, e, mant);
+}
+
+/* Return 2^x for x given in fixed point with 37 fraction bits, as a two's
+   complement 64-bit value, for |x| < 256.  */
+static inline float
+softf_exp2 (uint64_t t)
+{
+  /* x*32 = n + f, with n an integer and f in [0,1), and n = k*32 + j with j
+     in [0,32).  Then 2^x = 2^k * 2^(j/32) * 2^(f/32).  */
+  int32_t n = (int32_t) (t >> 32);
+  uint32_t f = (uint32_t) t;
+  uint32_t j = n & 31;
+  int k = (n - (int32_t) j) >> 5;
+
+  /* The exp2f table holds 2^(j/32) as a double with j<<47 subtracted; take
+     its mantissa rounded to 32 bits, with 31 fraction bits.  */
+  uint64_t s = __exp2f_data.tab[j] + ((uint64_t) j << 47);
+  s = ((s & 0x000fffffffffffff) | 0x0010000000000000) + (1 << 20);
+  uint32_t sm = s >> 21;
+
+  /* 2^(f/32) - 1 with 37 fraction bits, from the Taylor series of
+     e^(f ln2/32) up to the 5th order term.  */
+  uint32_t p = 0x5;
+  p = 0x4ed + softf_mulhi (f, p);
+  p = 0x38d61 + softf_mulhi (f, p);
+  p = 0x1ebfbe0 + softf_mulhi (f, p);
+  p = 0xb17217f8 + softf_mulhi (f, p);
+  p = softf_mulhi (f, p);
+
+  /* The mantissa of the result, with 36 fraction bits.  */
+  uint64_t m = ((uint64_t) sm << 5) + softf_mulhi (sm, p);
+  return softf_pack (0, k - 36, m);
+}
+
+/* Return e^y for y in fixed point with 62 fraction bits, |y| < 2^-7.  For
+   small negative y the result is just below 1, where it can be very close to
+   the rounding boundary 1 - 2^-25, so it is computed with an absolute error
+   of a few times 2^-55 rather than via softf_exp2.  */
+static inline float
+softf_exp_small (int64_t y)
+{
+  /* e^y = 1 + y + y^2 h(y), where h is the Taylor series
+     1/2 + y/6 + y^2/24 + y^3/120 + y^4/720, evaluated as in softf_log1p.  */
+  int32_t r35 = y >> 27;
+  int32_t h = 0x2d82d8;
+  h = 0x1111111 + (((int64_t) r35 * h) >> 35);
+  h = 0x5555555 + (((int64_t) r35 * h) >> 35);
+  h = 0x15555555 + (((int64_t) r35 * h) >> 35);
+  h = 0x40000000 + (((int64_t) r35 * h) >> 35);
+  int32_t g = ((int64_t) r35 * h) >> 31;
+  int64_t m = (1LL << 55) + (y >> 7) + (((int64_t) r35 * g) >> 15);
+  return softf_pack (0, -55, m);
+}
+
+#endif
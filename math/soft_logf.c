@@ -0,0 +1,68 @@
+/*
+ * Integer-only single-precision log function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+#define T __logf_data.tab
+#define OFF 0x3f330000
+/* ln2 with 55 fraction bits.  */
+#define Ln2 0x58b90bfbe8e7bdLL
+
+/* log(x) for targets without an FPU.  The argument is split as in logf,
+   using the same table, but log(c) + log1p(z/c - 1) is evaluated in fixed
+   point with 55 fraction bits.  z/c - 1 is exact when c is 1, so the result
+   is accurate near x = 1 too.  */
+float
+arm_math_soft_logf (float x)
+{
+  uint32_t ix = asuint (x);
+  if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
+    {
+      /* x < 0x1p-126 or inf or nan.  */
+      if (ix * 2 == 0)
+	return asfloat (0xff800000);
+      if (ix == 0x7f800000) /* log(inf) == inf.  */
+	return x;
+      if (ix * 2 > 0xff000000)
+	return softf_nan (ix);
+      if (ix & 0x80000000)
+	return asfloat (0x7fc00000);
+      /* x is subnormal, normalize it, leaving the exponent field negative.  */
+      int n = __builtin_clz (ix) - 8;
+      ix = (ix << n) - (n << 23);
+    }
+
+  /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.
+     The range is split into N subintervals.
+     The ith subinterval contains z and c is near its center.  */
+  uint32_t tmp = ix - OFF;
+  int i = (tmp >> (23 - LOGF_TABLE_BITS)) % (1 << LOGF_TABLE_BITS);
+  int k = (int32_t) tmp >> 23; /* arithmetic shift */
+  uint32_t iz = ix - (tmp & 0xff800000);
+
+  /* r = z/c - 1 with 62 fraction bits, from z with 24 and 1/c with 38.  */
+  uint64_t z = ((iz & 0x007fffff) | 0x00800000) << ((iz >> 23) - 126);
+  uint64_t invc = softf_fixed (asuint64 (T[i].invc), 38);
+  int64_t r = z * invc - (1ULL << 62);
+
+  /* log(x) = log1p(z/c-1) + log(c) + k*Ln2.  */
+  int64_t y = softf_log1p (r) + softf_fixed (asuint64 (T[i].logc), 55)
+	      + k * Ln2;
+  if (y == 0)
+    return 0;
+  if (y < 0)
+    return softf_pack (0x80000000, -55, -(uint64_t) y);
+  return softf_pack (0, -55, y);
+}
+
+TEST_ULP (arm_math_soft_logf, 0.01)
+TEST_INTERVAL (arm_math_soft_logf, 0, 0xffff0000, 10000)
+TEST_INTERVAL (arm_math_soft_logf, 0x1p-4, 0x1p4, 500000)
+TEST_INTERVAL (arm_math_soft_logf, 0, inf, 50000)
@@ -0,0 +1,24 @@
+/*
+ * Integer-only single-precision sin function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* sin(x) for targets without an FPU.  x is reduced modulo pi/2 with the
+   __inv_pio4 table used by sinf, for all |x| > pi/4, and sin or cos of the
+   reduced argument is evaluated in fixed point.  */
+float
+arm_math_soft_sinf (float x)
+{
+  return softf_sincos (asuint (x), 0);
+}
+
+TEST_ULP (arm_math_soft_sinf, 0.05)
+TEST_INTERVAL (arm_math_soft_sinf, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_soft_sinf, 0x1p-14, 0x1p54, 50000)
@@ -0,0 +1,63 @@
+/*
+ * Integer-only single-precision square root.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include "math_config.h"
+#include "soft_float.h"
+#include "test_defs.h"
+
+/* Correctly rounded square root for targets without an FPU.  The square root
+   of the mantissa is computed to 25 bits one bit at a time, and the
+   remainder is used to round.  */
+float
+arm_math_soft_sqrtf (float x)
+{
+  uint32_t ix = asuint (x);
+  if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
+    {
+      /* x < 0x1p-126 or inf or nan.  */
+      if (ix * 2 == 0 || ix == 0x7f800000)
+	return x;
+      if (ix * 2 > 0xff000000)
+	return softf_nan (ix);
+      if (ix & 0x80000000)
+	return asfloat (0x7fc00000);
+    }
+
+  /* x = m * 2^e.  Make e odd, so that sqrt(x) = sqrt(m * 2^25) * 2^k with
+     k = (e - 25) / 2, and m * 2^25 is in [2^48, 2^50).  */
+  int e;
+  uint32_t m = softf_unpack (ix, &e);
+  if (!(e & 1))
+    {
+      m <<= 1;
+      e--;
+    }
+
+  /* q = floor(sqrt(m * 2^25)), which has 25 bits.  m is left holding the
+     remainder, shifted left, which is zero if and only if q is exact.  */
+  uint32_t q = 0, s = 0;
+  m <<= 1;
+  for (uint32_t b = 0x01000000; b != 0; b >>= 1)
+    {
+      uint32_t t = s + b;
+      if (t <= m)
+	{
+	  s = t + b;
+	  m -= t;
+	  q += b;
+	}
+      m <<= 1;
+    }
+
+  return softf_pack (0, (e - 25) / 2 - 1, ((uint64_t) q << 1) | (m != 0));
+}
+
+TEST_ULP (arm_math_soft_sqrtf, 0.0)
+TEST_INTERVAL (arm_math_soft_sqrtf, 0, 0xffff0000, 10000)
+TEST_INTERVAL (arm_math_soft_sqrtf, 0, inf, 100000)
+TEST_INTERVAL (arm_math_soft_sqrtf, 0x1p-4, 0x1p4, 100000)
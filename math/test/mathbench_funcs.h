@@ -1,7 +1,7 @@
 /*
  * Function entries for mathbench.
  *
- * Copyright (c) 2022-2025, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 /* clang-format off */
@@ -17,6 +17,14 @@ F (ypowf, -9.9, 9.9)
 {"sincosf", 'f', 0, 3.3, 33.3, {.f = sincosf_wrap}},
 {"sincosf", 'f', 0, 100, 1000, {.f = sincosf_wrap}},
 {"sincosf", 'f', 0, 1e6, 1e32, {.f = sincosf_wrap}},
+F (arm_math_soft_cosf, -3.1, 3.1)
+F (arm_math_soft_exp2f, -9.9, 9.9)
+F (arm_math_soft_expf, -9.9, 9.9)
+F (arm_math_soft_log2f, 0.01, 11.1)
+F (arm_math_soft_logf, 0.01, 11.1)
+F (arm_math_soft_sinf, -3.1, 3.1)
+F (arm_math_soft_sqrtf, 0.01, 11.1)
+{"arm_math_soft_atan2f", 'f', 0, -10.0, 10.0, {.f = arm_math_soft_atan2f_wrap}},
 #if WANT_C23_TESTS
 F (arm_math_cospif, -0.9, 0.9)
 D (arm_math_cospi, -0.9, 0.9)
@@ -65,6 +73,8 @@ F (arm_math_erff, -4.0, 4.0)
 {"_ZGVnN2v_cexpi", 'd', 'n', -3.1, 3.1, {.vnd = _Z_cexpi_wrap}},
 VNF (_ZGVnN4v_expf_1u, -9.9, 9.9)
 VNF (_ZGVnN4v_exp2f_1u, -9.9, 9.9)
+VNF (_ZGVnN4v_lgammaf, -9.9, 9.9)
+VND (_ZGVnN2v_lgamma, -9.9, 9.9)
 # if WANT_EXPERIMENTAL_MATH
 VNF (arm_math_advsimd_fast_cosf, -3.1, 3.1)
 VNF (arm_math_advsimd_fast_sinf, -3.1, 3.1)
@@ -124,6 +134,8 @@ VND (_ZGVnN2v_tanpi, -0.9, 0.9)
 {"_ZGVsMxvl8l8_sincos", 'd', 's', -3.1, 3.1, {.svd = _Z_sv_sincos_wrap}},
 {"_ZGVsMxv_cexpif", 'f', 's', -3.1, 3.1, {.svf = _Z_sv_cexpif_wrap}},
 {"_ZGVsMxv_cexpi", 'd', 's', -3.1, 3.1, {.svd = _Z_sv_cexpi_wrap}},
+SVF (_ZGVsMxv_lgammaf, -9.9, 9.9)
+SVD (_ZGVsMxv_lgamma, -9.9, 9.9)
 # if WANT_C23_TESTS
 SVF (_ZGVsMxv_acospif, -0.9, 0.9)
 SVD (_ZGVsMxv_acospi, -0.9, 0.9)
@@ -1,10 +1,16 @@
 /*
  * Function wrappers for mathbench.
  *
- * Copyright (c) 2022-2025, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
+static float
+arm_math_soft_atan2f_wrap (float x)
+{
+  return arm_math_soft_atan2f (5.0f, x);
+}
+
 #if WANT_EXPERIMENTAL_MATH
 #ifndef M_PIl
 #  define M_PIl 3.141592653589793238462643383279502884l
@@ -10,6 +10,9 @@
 #define TEST_ULP_NONNEAREST(f, l) TEST_ULP_NONNEAREST f l
 
 #define TEST_INTERVAL(f, lo, hi, n) TEST_INTERVAL f lo hi n
+/* As TEST_INTERVAL, but where the result is smaller than lim in magnitude the
+   error is measured in ulps of lim, i.e. against an absolute error bound.  */
+#define TEST_INTERVAL_ABS(f, lo, hi, n, lim) TEST_INTERVAL f lo hi n -a lim
 #define TEST_SYM_INTERVAL(f, lo, hi, n)                                       \
   TEST_INTERVAL (f, lo, hi, n)                                                \
   TEST_INTERVAL (f, -lo, -hi, n)
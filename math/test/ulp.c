@@ -254,6 +254,7 @@ struct conf
   unsigned long long n;
   double softlim;
   double errlim;
+  double abslim;
   int ignore_zero_sign;
 #if WANT_SVE_TESTS
   svbool_t *pg;
@@ -597,8 +598,8 @@ call_mpfr_d2 (mpfr_t y, const struct fun *f, struct args_d2 a, mpfr_rnd_t r)
 static void
 usage (void)
 {
-  puts ("./ulp [-q] [-m] [-f] [-r {n|u|d|z}] [-l soft-ulplimit] [-e ulplimit] func "
-	"lo [hi [x lo2 hi2] [count]]");
+  puts ("./ulp [-q] [-m] [-f] [-r {n|u|d|z}] [-l soft-ulplimit] [-e ulplimit] "
+	"[-a abslimit] func lo [hi [x lo2 hi2] [count]]");
   puts ("Compares func against a higher precision implementation in [lo; hi].");
   puts ("-q: quiet.");
   puts ("-m: use mpfr even if faster method is available.");
@@ -614,6 +615,9 @@ usage (void)
 	"are ignored). Default is UINT64_MAX (ptrue).");
 #endif
   puts ("-z: ignore sign of 0.");
+  puts ("-a: measure errors in ulps of abslimit when the correct result is "
+	"smaller than\n    abslimit in magnitude, i.e. check an absolute "
+	"error bound there. Default is 0.");
   puts ("Supported func:");
   for (const struct fun *f = fun; f->name; f++)
     printf ("\t%s\n", f->name);
@@ -757,6 +761,7 @@ main (int argc, char *argv[])
   conf.fenv = 1;
   conf.softlim = 0;
   conf.errlim = INFINITY;
+  conf.abslim = 0;
   conf.ignore_zero_sign = 0;
 #if WANT_SVE_TESTS
   uint64_t pg_int = UINT64_MAX;
@@ -771,6 +776,13 @@ main (int argc, char *argv[])
 	break;
       switch (argv[0][1])
 	{
+	case 'a':
+	  argc--;
+	  argv++;
+	  if (argc < 1)
+	    usage ();
+	  conf.abslim = strtod (argv[0], 0);
+	  break;
 	case 'e':
 	  argc--;
 	  argv++;
@@ -36,13 +36,24 @@ static int RT(ulpscale_mpfr) (mpfr_t x, int t)
 
 /* Difference between exact result and closest real number that
    gets rounded to got, i.e. error before rounding, for a correctly
-   rounded result the difference is 0.  */
+   rounded result the difference is 0.  If want is smaller than abslim in
+   magnitude, the error is measured in ulps of abslim instead, so that it
+   bounds the absolute error, and got may have the opposite sign.  */
 static double RT (ulperr) (RT (float) got, const struct RT (ret) * p, int r,
-			   int ignore_zero_sign)
+			   int ignore_zero_sign, double abslim)
 {
   RT(float) want = p->y;
   RT(float) d;
   double e;
+  int ulpexp = p->ulpexp;
+  double tail = p->tail;
+  int use_abslim = RT(fabs) (want) < abslim;
+
+  if (use_abslim)
+    {
+      ulpexp = RT(ulpscale) ((RT(float)) abslim);
+      tail = scalbn (tail, p->ulpexp - ulpexp);
+    }
 
   if (RT(asuint) (got) == RT(asuint) (want))
     return 0.0;
@@ -59,7 +70,7 @@ static double RT (ulperr) (RT (float) got, const struct RT (ret) * p, int r,
 	 exactly one of want and got is non-zero.  */
       if (ignore_zero_sign && want == got)
 	return 0.0;
-      if (!ignore_zero_sign || (want != 0 && got != 0))
+      if (!use_abslim && (!ignore_zero_sign || (want != 0 && got != 0)))
 	return INFINITY;
     }
   if (!isfinite (want) || !isfinite (got))
@@ -86,7 +97,7 @@ static double RT (ulperr) (RT (float) got, const struct RT (ret) * p, int r,
 	      ? got - want - tail ulp - 0.5 ulp
 	      : got - want - tail ulp + 0.5 ulp.  */
       d = got - want;
-      e = d > 0 ? -p->tail - 0.5 : -p->tail + 0.5;
+      e = d > 0 ? -tail - 0.5 : -tail + 0.5;
     }
   else
     {
@@ -94,9 +105,14 @@ static double RT (ulperr) (RT (float) got, const struct RT (ret) * p, int r,
 	  || (r == FE_TOWARDZERO && fabs (got) < fabs (want)))
 	got = RT(nextafter) (got, want);
       d = got - want;
-      e = -p->tail;
+      e = -tail;
     }
-  return RT(scalbn) (d, -p->ulpexp) + e;
+  e += RT(scalbn) (d, -ulpexp);
+  /* In ulps of abslim, got may be less than 1 ulp away from want, so the
+     0.5 ulp rounding error must not change the sign of the error.  */
+  if (use_abslim && r == FE_TONEAREST && (e > 0) != (d > 0))
+    return 0.0;
+  return e;
 }
 
 static int RT(isok) (RT(float) ygot, int exgot, RT(float) ywant, int exwant,
@@ -178,6 +194,8 @@ static inline int T(call_long_nofenv) (const struct fun *f, struct T(args) a,
     fesetround (r);
   RT(double) yl = T(call_long) (f, a);
   p->y = (RT(float)) yl;
+  /* Exceptions are not checked.  */
+  p->ex = p->ex_may = 0;
   if (r != FE_TONEAREST)
     fesetround (FE_TONEAREST);
   if (RT(isok_nofenv) (ygot, p->y))
@@ -312,7 +330,8 @@ static int T(cmp) (const struct fun *f, struct gen *gen,
       if (!ok)
 	{
 	  int print = 0;
-	  double err = RT (ulperr) (ygot, &want, r, conf->ignore_zero_sign);
+	  double err = RT (ulperr) (ygot, &want, r, conf->ignore_zero_sign,
+				    conf->abslim);
 	  double abserr = fabs (err);
 	  // TODO: count errors below accuracy limit.
 	  if (abserr > 0)
@@ -9,9 +9,19 @@
  F (sincosf_cosf, sincosf_cosf, sincos_cos, sincos_mpfr_cos, 1, 1, f1, 0)
  F2 (pow)
  D2 (pow)
+ F (arm_math_soft_atan2f, arm_math_soft_atan2f, atan2, mpfr_atan2, 2, 1, f2, 0)
+ F (arm_math_soft_cosf, arm_math_soft_cosf, cos, mpfr_cos, 1, 1, f1, 0)
+ F (arm_math_soft_exp2f, arm_math_soft_exp2f, exp2, mpfr_exp2, 1, 1, f1, 0)
+ F (arm_math_soft_expf, arm_math_soft_expf, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_soft_log2f, arm_math_soft_log2f, log2, mpfr_log2, 1, 1, f1, 0)
+ F (arm_math_soft_logf, arm_math_soft_logf, log, mpfr_log, 1, 1, f1, 0)
+ F (arm_math_soft_sinf, arm_math_soft_sinf, sin, mpfr_sin, 1, 1, f1, 0)
+ F (arm_math_soft_sqrtf, arm_math_soft_sqrtf, sqrt, mpfr_sqrt, 1, 1, f1, 0)
 #if __aarch64__ && __linux__
  F (_ZGVnN4v_expf_1u, Z_expf_1u, exp, mpfr_exp, 1, 1, f1, 1)
  F (_ZGVnN4v_exp2f_1u, Z_exp2f_1u, exp2, mpfr_exp2, 1, 1, f1, 1)
+ F (_ZGVnN4v_lgammaf, Z_lgammaf, lgamma, wrap_mpfr_lgamma, 1, 1, f1, 0)
+ F (_ZGVnN2v_lgamma, Z_lgamma, lgammal, wrap_mpfr_lgamma, 1, 0, d1, 0)
  F (_ZGVnN4vv_powf, Z_powf, pow, mpfr_pow, 2, 1, f2, 1)
  F (_ZGVnN2vv_pow, Z_pow, powl, mpfr_pow, 2, 0, d2, 1)
  F (_ZGVnN4vl4l4_sincosf_sin, v_sincosf_sin, sin, mpfr_sin, 1, 1, f1, 0)
@@ -33,6 +43,8 @@
 #endif
 
 #if WANT_SVE_TESTS
+SVF (_ZGVsMxv_lgammaf, Z_sv_lgammaf, lgamma, wrap_mpfr_lgamma, 1, 1, f1, 0)
+SVF (_ZGVsMxv_lgamma, Z_sv_lgamma, lgammal, wrap_mpfr_lgamma, 1, 0, d1, 0)
 SVF (_ZGVsMxvl4l4_sincosf_sin, sv_sincosf_sin, sin, mpfr_sin, 1, 1, f1, 0)
 SVF (_ZGVsMxvl4l4_sincosf_cos, sv_sincosf_cos, cos, mpfr_cos, 1, 1, f1, 0)
 SVF (_ZGVsMxv_cexpif_sin, sv_cexpif_sin, sin, mpfr_sin, 1, 1, f1, 0)
@@ -37,6 +37,19 @@ mpfr_cr_exp (mpfr_t ret, const mpfr_t arg, mpfr_rnd_t rnd)
   return mpfr_exp (ret, arg, rnd);
 }
 
+static int
+mpfr_tgamma (mpfr_t ret, const mpfr_t arg, mpfr_rnd_t rnd)
+{
+  return mpfr_gamma (ret, arg, rnd);
+}
+
+static int
+wrap_mpfr_lgamma (mpfr_t ret, const mpfr_t arg, mpfr_rnd_t rnd)
+{
+  int sign;
+  return mpfr_lgamma (ret, &sign, arg, rnd);
+}
+
 # if MPFR_VERSION < MPFR_VERSION_NUM(4, 2, 0)
 static int mpfr_acospi (mpfr_t ret, const mpfr_t arg, mpfr_rnd_t rnd) {
   MPFR_DECL_INIT (frd, 1080);
@@ -334,6 +347,11 @@ v_cexpipif_cos (float x)
 }
 #endif // WANT_C23_TESTS
 
+/* lgamma is not registered by TEST_SIG, as mpfr_lgamma also returns the sign
+   of Gamma.  */
+ZVNF1_WRAP (lgamma)
+ZVND1_WRAP (lgamma)
+
 float
 v_sincosf_sin (float x)
 {
@@ -530,6 +548,9 @@ sv_cexpipif_cos (svbool_t pg, float x)
 }
 #endif // WANT_C23_TESTS
 
+ZSVNF1_WRAP (lgamma)
+ZSVND1_WRAP (lgamma)
+
 float
 sv_sincosf_sin (svbool_t pg, float x)
 {
@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2025, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 S := $(srcdir)/networking
@@ -22,7 +22,10 @@ networking-libs := \
 	build/lib/libnetworking.a \
 
 networking-tools := \
-	build/bin/test/chksum
+	build/bin/test/chksum \
+	build/bin/test/crc32 \
+	build/bin/test/fletcher \
+	build/bin/test/toeplitz
 
 networking-lib-objs := $(patsubst $(S)/%,$(B)/%.o,$(basename $(networking-lib-srcs)))
 networking-test-objs := $(patsubst $(S)/%,$(B)/%.o,$(basename $(networking-test-srcs)))
@@ -64,6 +67,20 @@ check-networking: $(networking-tools)
 	$(EMULATOR) build/bin/test/chksum -i simple
 	$(EMULATOR) build/bin/test/chksum -i scalar
 	$(EMULATOR) build/bin/test/chksum -i simd || true # simd is not always available
+	$(EMULATOR) build/bin/test/chksum -i sve || true # sve is not always available
+	$(EMULATOR) build/bin/test/chksum -i sve2 || true # sve2 is not always available
+	$(EMULATOR) build/bin/test/chksum -i sse2 || true # sse2 is only built on x86_64
+	$(EMULATOR) build/bin/test/chksum -i avx2 || true # avx2 is not always available
+	$(EMULATOR) build/bin/test/crc32 -i simple
+	$(EMULATOR) build/bin/test/crc32 -i scalar
+	$(EMULATOR) build/bin/test/crc32 -i hw || true # CRC instructions are not always available
+	$(EMULATOR) build/bin/test/fletcher -i simple
+	$(EMULATOR) build/bin/test/fletcher -i scalar
+	$(EMULATOR) build/bin/test/fletcher -i simd || true # simd is not always available
+	$(EMULATOR) build/bin/test/fletcher -i sve || true # sve is not always available
+	$(EMULATOR) build/bin/test/toeplitz -i simple
+	$(EMULATOR) build/bin/test/toeplitz -i scalar
+	$(EMULATOR) build/bin/test/toeplitz -i simd || true # simd is not always available
 
 install-networking: \
  $(networking-libs:build/lib/%=$(libdir)/%) \
@@ -1,7 +1,7 @@
 /*
  * AArch64-specific checksum implementation using NEON
  *
- * Copyright (c) 2020, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -13,6 +13,9 @@
 #endif
 
 #include <arm_neon.h>
+#if !defined (_WIN32)
+#include <sys/uio.h>
+#endif
 
 always_inline
 static inline uint64_t
@@ -55,25 +58,41 @@ slurp_tail64(uint64_t sum, const void *ptr, uint32_t nbytes)
     return sum;
 }
 
-unsigned short
-__chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
+/* Sum NBYTES bytes at PTR without folding.  *SWAP is set if the bytes were
+   summed swapped.  If COPY is true, also copy them to DST, reusing the
+   loaded data.  */
+always_inline
+static inline uint64_t
+chksum_simd(void *dst, const void *ptr, uint32_t nbytes, bool copy,
+	    bool *swap)
 {
-    bool swap = (uintptr_t) ptr & 1;
     uint64_t sum;
 
+    *swap = (uintptr_t) ptr & 1;
     if (unlikely(nbytes < 50))
     {
-	sum = slurp_small(ptr, nbytes);
-	swap = false;
-	goto fold;
+	if (copy)
+	{
+	    memcpy(dst, ptr, nbytes);
+	}
+	*swap = false;
+	return slurp_small(ptr, nbytes);
     }
 
     /* 8-byte align pointer */
     Assert(nbytes >= 8);
+    if (copy)
+    {
+	/* Copy the unaligned head with an overlapping 8-byte store */
+	uint32_t head = -(uintptr_t) ptr % 8;
+	vst1_u8(dst, vld1_u8(ptr));
+	dst = (char *) dst + head;
+    }
     sum = slurp_head64(&ptr, &nbytes);
     Assert(((uintptr_t) ptr & 7) == 0);
 
     const uint32_t *may_alias ptr32 = ptr;
+    uint8_t *dst8 = dst;
 
     uint64x2_t vsum0 = { 0, 0 };
     uint64x2_t vsum1 = { 0, 0 };
@@ -87,6 +106,14 @@ __chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
 	uint32x4_t vtmp1 = vld1q_u32(ptr32 + 4);
 	uint32x4_t vtmp2 = vld1q_u32(ptr32 + 8);
 	uint32x4_t vtmp3 = vld1q_u32(ptr32 + 12);
+	if (copy)
+	{
+	    vst1q_u8(dst8, vreinterpretq_u8_u32(vtmp0));
+	    vst1q_u8(dst8 + 16, vreinterpretq_u8_u32(vtmp1));
+	    vst1q_u8(dst8 + 32, vreinterpretq_u8_u32(vtmp2));
+	    vst1q_u8(dst8 + 48, vreinterpretq_u8_u32(vtmp3));
+	    dst8 += 64;
+	}
 	vsum0 = vpadalq_u32(vsum0, vtmp0);
 	vsum1 = vpadalq_u32(vsum1, vtmp1);
 	vsum2 = vpadalq_u32(vsum2, vtmp2);
@@ -104,6 +131,12 @@ __chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
     {
 	uint32x4_t vtmp0 = vld1q_u32(ptr32);
 	uint32x4_t vtmp1 = vld1q_u32(ptr32 + 4);
+	if (copy)
+	{
+	    vst1q_u8(dst8, vreinterpretq_u8_u32(vtmp0));
+	    vst1q_u8(dst8 + 16, vreinterpretq_u8_u32(vtmp1));
+	    dst8 += 32;
+	}
 	vsum0 = vpadalq_u32(vsum0, vtmp0);
 	vsum1 = vpadalq_u32(vsum1, vtmp1);
 	ptr32 += 8;
@@ -118,6 +151,11 @@ __chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
     if (nbytes & 16)
     {
 	uint32x4_t vtmp = vld1q_u32(ptr32);
+	if (copy)
+	{
+	    vst1q_u8(dst8, vreinterpretq_u8_u32(vtmp));
+	    dst8 += 16;
+	}
 	vsum0 = vpadalq_u32(vsum0, vtmp);
 	ptr32 += 4;
 	nbytes -= 16;
@@ -128,6 +166,11 @@ __chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
     if (nbytes & 8)
     {
 	uint32x2_t vtmp = vld1_u32(ptr32);
+	if (copy)
+	{
+	    vst1_u8(dst8, vreinterpret_u8_u32(vtmp));
+	    dst8 += 8;
+	}
 	vsum0 = vaddw_u32(vsum0, vtmp);
 	ptr32 += 2;
 	nbytes -= 8;
@@ -138,9 +181,52 @@ __chksum_aarch64_simd(const void *ptr, unsigned int nbytes)
     sum += val >> 32;
     sum += (uint32_t) val;
 
+    /* Copy any trailing 0..7 bytes with an overlapping 8-byte store */
+    if (copy)
+    {
+	const uint8_t *end = (const uint8_t *) ptr32 + nbytes;
+	vst1_u8(dst8 + nbytes - 8, vld1_u8(end - 8));
+    }
+
     /* Handle any trailing 0..7 bytes */
-    sum = slurp_tail64(sum, ptr32, nbytes);
+    return slurp_tail64(sum, ptr32, nbytes);
+}
 
-fold:
-    return fold_and_swap(sum, swap);
+/* Sum the first NBYTES bytes of four buffers, NBYTES being a multiple of
+   16.  Each buffer has its own accumulator so the loads and additions of
+   the four buffers overlap, which matters for short packets where a
+   single buffer does not provide enough independent work.  */
+always_inline
+static inline void
+slurp_batch4(const void *const *ptrs, uint32_t nbytes, uint64_t sums[4])
+{
+    const uint8_t *ptr0 = ptrs[0];
+    const uint8_t *ptr1 = ptrs[1];
+    const uint8_t *ptr2 = ptrs[2];
+    const uint8_t *ptr3 = ptrs[3];
+
+    uint64x2_t vsum0 = { 0, 0 };
+    uint64x2_t vsum1 = { 0, 0 };
+    uint64x2_t vsum2 = { 0, 0 };
+    uint64x2_t vsum3 = { 0, 0 };
+
+    Assert(nbytes % 16 == 0);
+    for (uint32_t off = 0; off < nbytes; off += 16)
+    {
+	uint8x16_t vtmp0 = vld1q_u8(ptr0 + off);
+	uint8x16_t vtmp1 = vld1q_u8(ptr1 + off);
+	uint8x16_t vtmp2 = vld1q_u8(ptr2 + off);
+	uint8x16_t vtmp3 = vld1q_u8(ptr3 + off);
+	vsum0 = vpadalq_u32(vsum0, vreinterpretq_u32_u8(vtmp0));
+	vsum1 = vpadalq_u32(vsum1, vreinterpretq_u32_u8(vtmp1));
+	vsum2 = vpadalq_u32(vsum2, vreinterpretq_u32_u8(vtmp2));
+	vsum3 = vpadalq_u32(vsum3, vreinterpretq_u32_u8(vtmp3));
+    }
+
+    vst1q_u64(sums, vpaddq_u64(vsum0, vsum1));
+    vst1q_u64(sums + 2, vpaddq_u64(vsum2, vsum3));
 }
+
+#define CHKSUM_SIMD(name) name##_aarch64_simd
+#define fold_simd fold_and_swap
+#include "../chksum_neon_common.h"
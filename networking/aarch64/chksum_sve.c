@@ -0,0 +1,105 @@
+/*
+ * AArch64-specific checksum implementation using SVE
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../chksum_common.h"
+
+/* To build the SVE2 version, define BUILD_SVE2 before compiling this file.
+   Note, because the target attribute is 'pushed' in clang, it has to be
+   popped at the end of the file with CLOSE_SVE_ATTR.  */
+#if BUILD_SVE2
+# define FUNC __chksum_aarch64_sve2
+# ifdef __clang__
+#  pragma clang attribute push(__attribute__((target("sve2"))),		\
+			       apply_to = any(function))
+# else
+#  pragma GCC target("+sve2")
+# endif
+#else
+# define FUNC __chksum_aarch64_sve
+# ifdef __clang__
+#  pragma clang attribute push(__attribute__((target("sve"))),		\
+			       apply_to = any(function))
+# else
+#  pragma GCC target("+sve")
+# endif
+#endif
+#ifdef __clang__
+# define CLOSE_SVE_ATTR _Pragma("clang attribute pop")
+#else
+# define CLOSE_SVE_ATTR
+#endif
+
+#include <arm_sve.h>
+
+/* Add the 32-bit words of DATA to the 64-bit lanes of VSUM.  SVE2 has a
+   widening pairwise add, with SVE the low and high words of each 64-bit
+   lane are added separately.  */
+always_inline
+static inline svuint64_t
+accumulate(svuint64_t vsum, svuint8_t data)
+{
+    svbool_t pall = svptrue_b64();
+#if BUILD_SVE2
+    return svadalp_u64_x(pall, vsum, svreinterpret_u32_u8(data));
+#else
+    svuint64_t vtmp = svreinterpret_u64_u8(data);
+    vsum = svadd_u64_x(pall, vsum, svextw_u64_x(pall, vtmp));
+    return svadd_u64_x(pall, vsum, svlsr_n_u64_x(pall, vtmp, 32));
+#endif
+}
+
+/* The buffer is not aligned: the sum of 16-bit words does not depend on
+   alignment, and a predicated load of zeros after the end of the buffer
+   replaces both the small buffer code and the masked tail load of the
+   AdvSIMD version.  Each 64-bit lane accumulates at most 2^33 per vector
+   of data, so the lanes cannot overflow for buffers below 4GiB.  */
+unsigned short
+FUNC(const void *ptr, unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint64_t vl = svcntb();
+    svbool_t pall = svptrue_b8();
+
+    svuint64_t vsum0 = svdup_n_u64(0);
+    svuint64_t vsum1 = svdup_n_u64(0);
+    svuint64_t vsum2 = svdup_n_u64(0);
+    svuint64_t vsum3 = svdup_n_u64(0);
+
+    /* Sum groups of four vectors */
+    uint64_t i = 0;
+    for (; i + 4 * vl <= nbytes; i += 4 * vl)
+    {
+	svuint8_t vtmp0 = svld1_vnum_u8(pall, cptr + i, 0);
+	svuint8_t vtmp1 = svld1_vnum_u8(pall, cptr + i, 1);
+	svuint8_t vtmp2 = svld1_vnum_u8(pall, cptr + i, 2);
+	svuint8_t vtmp3 = svld1_vnum_u8(pall, cptr + i, 3);
+	vsum0 = accumulate(vsum0, vtmp0);
+	vsum1 = accumulate(vsum1, vtmp1);
+	vsum2 = accumulate(vsum2, vtmp2);
+	vsum3 = accumulate(vsum3, vtmp3);
+    }
+
+    /* Add the remaining vectors, the last one partial */
+    for (; i < nbytes; i += vl)
+    {
+	svbool_t pg = svwhilelt_b8_u64(i, nbytes);
+	svuint8_t vtmp = svld1_u8(pg, cptr + i);
+	vsum0 = accumulate(vsum0, vtmp);
+    }
+
+    /* Add the accumulators and their lanes */
+    svbool_t pall64 = svptrue_b64();
+    vsum0 = svadd_u64_x(pall64, vsum0, vsum1);
+    vsum2 = svadd_u64_x(pall64, vsum2, vsum3);
+    vsum0 = svadd_u64_x(pall64, vsum0, vsum2);
+    uint64_t sum = svaddv_u64(pall64, vsum0);
+
+    return fold_and_swap(sum, false);
+}
+
+CLOSE_SVE_ATTR
@@ -0,0 +1,9 @@
+/*
+ * AArch64-specific checksum implementation using SVE2
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define BUILD_SVE2 1
+#include "chksum_sve.c"
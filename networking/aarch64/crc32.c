@@ -0,0 +1,159 @@
+/*
+ * CRC32 and CRC32C using the Armv8 CRC32 and PMULL instructions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../crc32_common.h"
+
+#if !__ARM_FEATURE_CRC32 || !__ARM_FEATURE_AES
+#pragma GCC target("+crc+aes")
+#endif
+
+#include <arm_acle.h>
+#include <arm_neon.h>
+
+/* Bytes per stream when three streams are interleaved */
+#define BLOCK 256
+
+/* The CRC instructions have a latency of several cycles but can issue
+   every cycle, so a single dependency chain runs well below peak.  Large
+   buffers are split in three streams of BLOCK bytes which are processed
+   interleaved, the second and third starting from a zero CRC.  The CRC of
+   the first stream is then advanced over 2 * BLOCK zero bytes, that of the
+   second over BLOCK zero bytes, and the three are XORed.  Advancing a CRC
+   over N zero bytes is a multiplication by x^(8N) modulo the polynomial:
+   a carry-less multiply (PMULL) by a constant K followed by a reduction
+   with the CRC instruction, crc32x(0, clmul(crc, K)).  */
+struct crc32_consts
+{
+    uint64_t k1;	/* Advance over BLOCK bytes.  */
+    uint64_t k2;	/* Advance over 2 * BLOCK bytes.  */
+};
+
+static const struct crc32_consts crc32_consts = { 0xe95c1271, 0x0c30f51d };
+static const struct crc32_consts crc32c_consts = { 0xb9e02b86, 0xdd7e3b0c };
+
+always_inline
+static inline uint32_t
+crc_u64(bool castagnoli, uint32_t crc, uint64_t val)
+{
+    return castagnoli ? __crc32cd(crc, val) : __crc32d(crc, val);
+}
+
+always_inline
+static inline uint32_t
+crc_u32(bool castagnoli, uint32_t crc, uint32_t val)
+{
+    return castagnoli ? __crc32cw(crc, val) : __crc32w(crc, val);
+}
+
+always_inline
+static inline uint32_t
+crc_u16(bool castagnoli, uint32_t crc, uint16_t val)
+{
+    return castagnoli ? __crc32ch(crc, val) : __crc32h(crc, val);
+}
+
+always_inline
+static inline uint32_t
+crc_u8(bool castagnoli, uint32_t crc, uint8_t val)
+{
+    return castagnoli ? __crc32cb(crc, val) : __crc32b(crc, val);
+}
+
+always_inline
+static inline uint64_t
+clmul(uint32_t a, uint64_t b)
+{
+    poly128_t prod = vmull_p64(a, b);
+    return vgetq_lane_u64(vreinterpretq_u64_p128(prod), 0);
+}
+
+always_inline
+static inline uint32_t
+crc32_hw(bool castagnoli, uint32_t crc, const void *ptr, uint32_t nbytes)
+{
+    const struct crc32_consts *k = castagnoli ? &crc32c_consts : &crc32_consts;
+    const unsigned char *cptr = ptr;
+
+    /* 8-byte align pointer */
+    if (unlikely(((uintptr_t) cptr & 7) != 0 && nbytes >= 8))
+    {
+	if ((uintptr_t) cptr & 1)
+	{
+	    crc = crc_u8(castagnoli, crc, *cptr);
+	    cptr += 1;
+	    nbytes -= 1;
+	}
+	if ((uintptr_t) cptr & 2)
+	{
+	    crc = crc_u16(castagnoli, crc, load16(cptr));
+	    cptr += 2;
+	    nbytes -= 2;
+	}
+	if ((uintptr_t) cptr & 4)
+	{
+	    crc = crc_u32(castagnoli, crc, load32(cptr));
+	    cptr += 4;
+	    nbytes -= 4;
+	}
+    }
+
+    /* Three interleaved streams */
+    while (nbytes >= 3 * BLOCK)
+    {
+	uint32_t crc1 = 0;
+	uint32_t crc2 = 0;
+	for (uint32_t i = 0; i < BLOCK; i += 8)
+	{
+	    crc = crc_u64(castagnoli, crc, load64(cptr + i));
+	    crc1 = crc_u64(castagnoli, crc1, load64(cptr + BLOCK + i));
+	    crc2 = crc_u64(castagnoli, crc2, load64(cptr + 2 * BLOCK + i));
+	}
+	uint64_t val = clmul(crc, k->k2) ^ clmul(crc1, k->k1);
+	crc = crc_u64(castagnoli, 0, val) ^ crc2;
+	cptr += 3 * BLOCK;
+	nbytes -= 3 * BLOCK;
+    }
+
+    /* Sum any remaining 8-byte chunks */
+    while (nbytes >= 8)
+    {
+	crc = crc_u64(castagnoli, crc, load64(cptr));
+	cptr += 8;
+	nbytes -= 8;
+    }
+    Assert(nbytes < 8);
+
+    /* Handle any trailing 0..7 bytes */
+    if (nbytes & 4)
+    {
+	crc = crc_u32(castagnoli, crc, load32(cptr));
+	cptr += 4;
+    }
+    if (nbytes & 2)
+    {
+	crc = crc_u16(castagnoli, crc, load16(cptr));
+	cptr += 2;
+    }
+    if (nbytes & 1)
+    {
+	crc = crc_u8(castagnoli, crc, *cptr);
+    }
+    return crc;
+}
+
+unsigned int
+__crc32_aarch64(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return ~crc32_hw(false, ~crc, ptr, nbytes);
+}
+
+unsigned int
+__crc32c_aarch64(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return ~crc32_hw(true, ~crc, ptr, nbytes);
+}
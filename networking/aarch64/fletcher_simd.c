@@ -0,0 +1,236 @@
+/*
+ * Adler-32 and Fletcher-64 checksums using AdvSIMD
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../fletcher_common.h"
+
+#ifndef __ARM_NEON
+#pragma GCC target("+simd")
+#endif
+
+#include <arm_neon.h>
+
+/* Blocks of 64 bytes per reduction modulo ADLER_BASE */
+#define ADLER_BLOCKS (ADLER_NMAX / 64)
+/* Blocks of 64 bytes per reduction modulo 2^32 - 1.  The running sums of
+   the previous blocks then stay below 2^59 per lane.  */
+#define FLETCHER_BLOCKS 4096
+
+/* Weight of each byte of a 64-byte block in B */
+static const uint8_t adler_weights[64] =
+{
+    64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+    48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+    16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1
+};
+
+/* Weight of each word of a 64-byte block in B */
+static const uint32_t fletcher_weights[16] =
+{
+    16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+};
+
+#if __ARM_FEATURE_DOTPROD
+/* With the dot product instructions, UDOT sums groups of four bytes, with
+   weights of one for A and with the byte weights for B.  */
+always_inline
+static inline void
+adler32_blocks(const uint8_t *cptr, uint32_t nblocks, uint64_t *s1,
+	       uint64_t *s2)
+{
+    uint8x16_t w0 = vld1q_u8(adler_weights);
+    uint8x16_t w1 = vld1q_u8(adler_weights + 16);
+    uint8x16_t w2 = vld1q_u8(adler_weights + 32);
+    uint8x16_t w3 = vld1q_u8(adler_weights + 48);
+    uint8x16_t ones = vdupq_n_u8(1);
+    uint32x4_t vs1 = vdupq_n_u32(0);
+    uint32x4_t vs1p = vdupq_n_u32(0);
+    uint32x4_t vs2a = vdupq_n_u32(0);
+    uint32x4_t vs2b = vdupq_n_u32(0);
+
+    for (uint32_t i = 0; i < nblocks; i++)
+    {
+	uint8x16_t vtmp0 = vld1q_u8(cptr);
+	uint8x16_t vtmp1 = vld1q_u8(cptr + 16);
+	uint8x16_t vtmp2 = vld1q_u8(cptr + 32);
+	uint8x16_t vtmp3 = vld1q_u8(cptr + 48);
+	vs1p = vaddq_u32(vs1p, vs1);
+	vs1 = vdotq_u32(vs1, vtmp0, ones);
+	vs2a = vdotq_u32(vs2a, vtmp0, w0);
+	vs2b = vdotq_u32(vs2b, vtmp1, w1);
+	vs1 = vdotq_u32(vs1, vtmp1, ones);
+	vs2a = vdotq_u32(vs2a, vtmp2, w2);
+	vs2b = vdotq_u32(vs2b, vtmp3, w3);
+	vs1 = vdotq_u32(vs1, vtmp2, ones);
+	vs1 = vdotq_u32(vs1, vtmp3, ones);
+	cptr += 64;
+    }
+    *s1 = vaddvq_u32(vs1);
+    *s2 = 64 * (uint64_t) vaddvq_u32(vs1p)
+	+ vaddvq_u32(vaddq_u32(vs2a, vs2b));
+}
+#else
+/* Without them, the bytes at each position of the blocks are summed in
+   16-bit columns, then multiplied by their weights with UMLAL.  A is
+   summed with widening pairwise adds.  */
+always_inline
+static inline void
+adler32_blocks(const uint8_t *cptr, uint32_t nblocks, uint64_t *s1,
+	       uint64_t *s2)
+{
+    uint16x8_t col0 = vdupq_n_u16(0);
+    uint16x8_t col1 = vdupq_n_u16(0);
+    uint16x8_t col2 = vdupq_n_u16(0);
+    uint16x8_t col3 = vdupq_n_u16(0);
+    uint16x8_t col4 = vdupq_n_u16(0);
+    uint16x8_t col5 = vdupq_n_u16(0);
+    uint16x8_t col6 = vdupq_n_u16(0);
+    uint16x8_t col7 = vdupq_n_u16(0);
+    uint32x4_t vs1 = vdupq_n_u32(0);
+    uint32x4_t vs1p = vdupq_n_u32(0);
+
+    for (uint32_t i = 0; i < nblocks; i++)
+    {
+	uint8x16_t vtmp0 = vld1q_u8(cptr);
+	uint8x16_t vtmp1 = vld1q_u8(cptr + 16);
+	uint8x16_t vtmp2 = vld1q_u8(cptr + 32);
+	uint8x16_t vtmp3 = vld1q_u8(cptr + 48);
+	vs1p = vaddq_u32(vs1p, vs1);
+	uint16x8_t vsum = vpaddlq_u8(vtmp0);
+	vsum = vpadalq_u8(vsum, vtmp1);
+	vsum = vpadalq_u8(vsum, vtmp2);
+	vsum = vpadalq_u8(vsum, vtmp3);
+	vs1 = vpadalq_u16(vs1, vsum);
+	col0 = vaddw_u8(col0, vget_low_u8(vtmp0));
+	col1 = vaddw_high_u8(col1, vtmp0);
+	col2 = vaddw_u8(col2, vget_low_u8(vtmp1));
+	col3 = vaddw_high_u8(col3, vtmp1);
+	col4 = vaddw_u8(col4, vget_low_u8(vtmp2));
+	col5 = vaddw_high_u8(col5, vtmp2);
+	col6 = vaddw_u8(col6, vget_low_u8(vtmp3));
+	col7 = vaddw_high_u8(col7, vtmp3);
+	cptr += 64;
+    }
+
+    uint16x8_t w0 = vmovl_u8(vld1_u8(adler_weights));
+    uint16x8_t w1 = vmovl_u8(vld1_u8(adler_weights + 8));
+    uint16x8_t w2 = vmovl_u8(vld1_u8(adler_weights + 16));
+    uint16x8_t w3 = vmovl_u8(vld1_u8(adler_weights + 24));
+    uint16x8_t w4 = vmovl_u8(vld1_u8(adler_weights + 32));
+    uint16x8_t w5 = vmovl_u8(vld1_u8(adler_weights + 40));
+    uint16x8_t w6 = vmovl_u8(vld1_u8(adler_weights + 48));
+    uint16x8_t w7 = vmovl_u8(vld1_u8(adler_weights + 56));
+    uint32x4_t vs2 = vmull_u16(vget_low_u16(col0), vget_low_u16(w0));
+    vs2 = vmlal_high_u16(vs2, col0, w0);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col1), vget_low_u16(w1));
+    vs2 = vmlal_high_u16(vs2, col1, w1);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col2), vget_low_u16(w2));
+    vs2 = vmlal_high_u16(vs2, col2, w2);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col3), vget_low_u16(w3));
+    vs2 = vmlal_high_u16(vs2, col3, w3);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col4), vget_low_u16(w4));
+    vs2 = vmlal_high_u16(vs2, col4, w4);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col5), vget_low_u16(w5));
+    vs2 = vmlal_high_u16(vs2, col5, w5);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col6), vget_low_u16(w6));
+    vs2 = vmlal_high_u16(vs2, col6, w6);
+    vs2 = vmlal_u16(vs2, vget_low_u16(col7), vget_low_u16(w7));
+    vs2 = vmlal_high_u16(vs2, col7, w7);
+    *s1 = vaddvq_u32(vs1);
+    *s2 = 64 * (uint64_t) vaddvq_u32(vs1p) + vaddvq_u32(vs2);
+}
+#endif
+
+/* Unaligned loads are used, the sums depend on the position of each byte
+   in the data and not on its alignment.  Blocks of 64 bytes are summed in
+   vectors and reduced every ADLER_BLOCKS blocks, the tail is summed in
+   scalar code.  */
+unsigned int
+__adler32_aarch64_simd(unsigned int adler, const void *ptr,
+		       unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+
+    while (nbytes >= 64)
+    {
+	uint32_t nblocks = nbytes / 64;
+	if (nblocks > ADLER_BLOCKS)
+	{
+	    nblocks = ADLER_BLOCKS;
+	}
+	uint64_t s1, s2;
+	adler32_blocks(cptr, nblocks, &s1, &s2);
+	b = (b + (uint64_t) a * nblocks * 64 + s2) % ADLER_BASE;
+	a = (a + s1) % ADLER_BASE;
+	cptr += nblocks * 64;
+	nbytes -= nblocks * 64;
+    }
+
+    return adler32_update(b << 16 | a, cptr, nbytes);
+}
+
+/* The words of each block are added to A with widening pairwise adds and
+   multiplied by their weights for B with UMLAL, in 64-bit lanes.  */
+unsigned long long
+__fletcher64_aarch64_simd(unsigned long long fletcher, const void *ptr,
+			  unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint64_t a = fletcher & FLETCHER_MOD;
+    uint64_t b = fletcher >> 32;
+
+    uint32x4_t w0 = vld1q_u32(fletcher_weights);
+    uint32x4_t w1 = vld1q_u32(fletcher_weights + 4);
+    uint32x4_t w2 = vld1q_u32(fletcher_weights + 8);
+    uint32x4_t w3 = vld1q_u32(fletcher_weights + 12);
+    while (nbytes >= 64)
+    {
+	uint32_t nblocks = nbytes / 64;
+	if (nblocks > FLETCHER_BLOCKS)
+	{
+	    nblocks = FLETCHER_BLOCKS;
+	}
+	uint64x2_t vs1 = vdupq_n_u64(0);
+	uint64x2_t vs1p = vdupq_n_u64(0);
+	uint64x2_t vs2a = vdupq_n_u64(0);
+	uint64x2_t vs2b = vdupq_n_u64(0);
+	for (uint32_t i = 0; i < nblocks; i++)
+	{
+	    uint32x4_t vtmp0 = vld1q_u32((const uint32_t *) cptr);
+	    uint32x4_t vtmp1 = vld1q_u32((const uint32_t *) (cptr + 16));
+	    uint32x4_t vtmp2 = vld1q_u32((const uint32_t *) (cptr + 32));
+	    uint32x4_t vtmp3 = vld1q_u32((const uint32_t *) (cptr + 48));
+	    vs1p = vaddq_u64(vs1p, vs1);
+	    uint64x2_t vsum = vpaddlq_u32(vtmp0);
+	    vsum = vpadalq_u32(vsum, vtmp1);
+	    vsum = vpadalq_u32(vsum, vtmp2);
+	    vsum = vpadalq_u32(vsum, vtmp3);
+	    vs1 = vaddq_u64(vs1, vsum);
+	    vs2a = vmlal_u32(vs2a, vget_low_u32(vtmp0), vget_low_u32(w0));
+	    vs2b = vmlal_high_u32(vs2b, vtmp0, w0);
+	    vs2a = vmlal_u32(vs2a, vget_low_u32(vtmp1), vget_low_u32(w1));
+	    vs2b = vmlal_high_u32(vs2b, vtmp1, w1);
+	    vs2a = vmlal_u32(vs2a, vget_low_u32(vtmp2), vget_low_u32(w2));
+	    vs2b = vmlal_high_u32(vs2b, vtmp2, w2);
+	    vs2a = vmlal_u32(vs2a, vget_low_u32(vtmp3), vget_low_u32(w3));
+	    vs2b = vmlal_high_u32(vs2b, vtmp3, w3);
+	    cptr += 64;
+	}
+	uint64_t s1 = fletcher_mod(vaddvq_u64(vs1));
+	uint64_t s1p = fletcher_mod(vaddvq_u64(vs1p));
+	uint64_t s2 = fletcher_mod(vaddvq_u64(vs2a))
+		    + fletcher_mod(vaddvq_u64(vs2b));
+	b = fletcher_mod(b + fletcher_mod(a * nblocks * 16) + 16 * s1p + s2);
+	a = fletcher_mod(a + s1);
+	nbytes -= nblocks * 64;
+    }
+
+    return fletcher64_update(b << 32 | a, cptr, nbytes);
+}
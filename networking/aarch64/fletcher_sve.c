@@ -0,0 +1,147 @@
+/*
+ * Adler-32 and Fletcher-64 checksums using SVE
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../fletcher_common.h"
+
+#ifdef __clang__
+# pragma clang attribute push(__attribute__((target("sve"))),		\
+			       apply_to = any(function))
+#else
+# pragma GCC target("+sve")
+#endif
+
+#include <arm_sve.h>
+
+/* Vectors per reduction modulo 2^32 - 1, as for AdvSIMD the running sums
+   of the previous vectors stay below 2^56 per lane.  */
+#define FLETCHER_VECTORS 4096
+
+/* Blocks are single vectors of VL bytes, the weights of the bytes of a
+   vector, VL down to 1, do not fit in bytes for 2048-bit vectors.  The
+   weights VL - 1 down to 0 are used instead, adding A of the vector once
+   more.  A partial last vector of M bytes is loaded with zeros after the
+   data, which have weight 0 for A but VL - M for B: that much of A of the
+   vector is subtracted.  UDOT is part of SVE.  */
+unsigned int
+__adler32_aarch64_sve(unsigned int adler, const void *ptr,
+		      unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint64_t vl = svcntb();
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    svbool_t pall = svptrue_b8();
+    svuint8_t ones = svdup_n_u8(1);
+    svuint8_t weights = svindex_u8(vl - 1, -1);
+
+    while (nbytes != 0)
+    {
+	uint32_t n = nbytes < ADLER_NMAX ? nbytes : ADLER_NMAX;
+	svuint32_t vs1 = svdup_n_u32(0);
+	svuint32_t vs1p = svdup_n_u32(0);
+	svuint32_t vs2 = svdup_n_u32(0);
+	uint64_t nvec = 0;
+	uint64_t i = 0;
+	for (; i + vl <= n; i += vl)
+	{
+	    svuint8_t vtmp = svld1_u8(pall, cptr + i);
+	    vs1p = svadd_u32_x(pall, vs1p, vs1);
+	    vs1 = svdot_u32(vs1, vtmp, ones);
+	    vs2 = svdot_u32(vs2, vtmp, weights);
+	    nvec++;
+	}
+	uint64_t s1 = svaddv_u32(pall, vs1);
+	uint64_t s2 = vl * svaddv_u32(pall, vs1p) + svaddv_u32(pall, vs2) + s1;
+	if (i < n)
+	{
+	    /* The partial vector follows all the others */
+	    svbool_t pg = svwhilelt_b8_u64(i, n);
+	    svuint8_t vtmp = svld1_u8(pg, cptr + i);
+	    uint64_t t1 = svaddv_u32(pall, svdot_u32(svdup_n_u32(0), vtmp,
+						     ones));
+	    uint64_t t2 = svaddv_u32(pall, svdot_u32(svdup_n_u32(0), vtmp,
+						     weights));
+	    s2 += (n - i) * s1 + t2 + t1 - (vl - (n - i)) * t1;
+	    s1 += t1;
+	}
+	b = (b + (uint64_t) a * n + s2) % ADLER_BASE;
+	a = (a + s1) % ADLER_BASE;
+	cptr += n;
+	nbytes -= n;
+    }
+    return b << 16 | a;
+}
+
+/* Words are loaded zero-extended to 64-bit lanes and multiplied by their
+   weights with MLA.  As for Adler-32, a partial last vector is loaded with
+   zero words after the data and its weights corrected.  A last partial
+   word is added in scalar code.  */
+unsigned long long
+__fletcher64_aarch64_sve(unsigned long long fletcher, const void *ptr,
+			 unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint64_t vlw = svcntd();
+    uint64_t a = fletcher & FLETCHER_MOD;
+    uint64_t b = fletcher >> 32;
+    svbool_t pall = svptrue_b64();
+    svuint64_t weights = svindex_u64(vlw, -1);
+    uint64_t nwords = nbytes / 4;
+    const uint32_t *wptr = (const uint32_t *) cptr;
+
+    while (nwords != 0)
+    {
+	uint64_t n = nwords;
+	if (n > FLETCHER_VECTORS * vlw)
+	{
+	    n = FLETCHER_VECTORS * vlw;
+	}
+	svuint64_t vs1 = svdup_n_u64(0);
+	svuint64_t vs1p = svdup_n_u64(0);
+	svuint64_t vs2 = svdup_n_u64(0);
+	uint64_t i = 0;
+	for (; i + vlw <= n; i += vlw)
+	{
+	    svuint64_t vtmp = svld1uw_u64(pall, wptr + i);
+	    vs1p = svadd_u64_x(pall, vs1p, vs1);
+	    vs1 = svadd_u64_x(pall, vs1, vtmp);
+	    vs2 = svmla_u64_x(pall, vs2, vtmp, weights);
+	}
+	uint64_t s1 = fletcher_mod(svaddv_u64(pall, vs1));
+	uint64_t s2 = fletcher_mod(vlw * fletcher_mod(svaddv_u64(pall, vs1p))
+				   + fletcher_mod(svaddv_u64(pall, vs2)));
+	if (i < n)
+	{
+	    /* The partial vector follows all the others */
+	    uint64_t m = n - i;
+	    svbool_t pg = svwhilelt_b64_u64(i, n);
+	    svuint64_t vtmp = svld1uw_u64(pg, wptr + i);
+	    uint64_t t1 = svaddv_u64(pall, vtmp);
+	    uint64_t t2 = svaddv_u64(pall, svmul_u64_x(pall, vtmp, weights));
+	    t2 -= (vlw - m) * t1;
+	    s2 = fletcher_mod(s2 + fletcher_mod(m * s1) + fletcher_mod(t2));
+	    s1 = fletcher_mod(s1 + t1);
+	}
+	b = fletcher_mod(b + fletcher_mod(a * n) + s2);
+	a = fletcher_mod(a + s1);
+	wptr += n;
+	nwords -= n;
+    }
+
+    if (nbytes % 4 != 0)
+    {
+	a = fletcher_mod(a + fletcher_tail((const uint8_t *) wptr,
+					   nbytes % 4));
+	b = fletcher_mod(b + a);
+    }
+    return b << 32 | a;
+}
+
+#ifdef __clang__
+# pragma clang attribute pop
+#endif
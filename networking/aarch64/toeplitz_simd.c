@@ -0,0 +1,210 @@
+/*
+ * Toeplitz hash for receive side scaling (RSS) using PMULL
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../toeplitz_common.h"
+
+#if !__ARM_FEATURE_AES
+#pragma GCC target("+aes")
+#endif
+
+#include <arm_neon.h>
+
+/* Data bytes for which the batch function precomputes the key windows */
+#define MAXBATCH 64
+
+/* Key windows for the four 32-bit words of the 16-byte chunk at OFFSET */
+always_inline
+static inline void
+chunk_keys(uint64x2_t k[2], const uint8_t *key, uint32_t keylen,
+	   uint32_t offset)
+{
+    k[0] = vcombine_u64(vcreate_u64(key_window(key, keylen, offset)),
+			vcreate_u64(key_window(key, keylen, offset + 4)));
+    k[1] = vcombine_u64(vcreate_u64(key_window(key, keylen, offset + 8)),
+			vcreate_u64(key_window(key, keylen, offset + 12)));
+}
+
+/* Load 1..15 bytes, zero-extended to a vector */
+always_inline
+static inline uint8x16_t
+load_partial(const uint8_t *cptr, uint32_t nbytes)
+{
+    Assert(nbytes != 0 && nbytes < 16);
+    uint64_t lo = 0;
+    uint64_t tail = 0;
+    uint32_t shift = 0;
+    if (nbytes & 8)
+    {
+	lo = load64(cptr);
+	cptr += 8;
+    }
+    if (nbytes & 4)
+    {
+	tail = load32(cptr);
+	cptr += 4;
+	shift = 32;
+    }
+    if (nbytes & 2)
+    {
+	tail |= (uint64_t) load16(cptr) << shift;
+	cptr += 2;
+	shift += 16;
+    }
+    if (nbytes & 1)
+    {
+	tail |= (uint64_t) *cptr << shift;
+    }
+    uint64_t hi = 0;
+    if (nbytes & 8)
+    {
+	hi = tail;
+    }
+    else
+    {
+	lo = tail;
+    }
+    return vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(lo),
+					     vcreate_u64(hi)));
+}
+
+/* Reversing the bits of each data byte makes data bit M (most significant
+   bit first) bit M of its little-endian 32-bit word.  The carry-less
+   product of the zero-extended word and its key window is then the XOR of
+   the window shifted left by each set bit, and its bits 32 to 63 are the
+   contribution of the word to the hash.  */
+always_inline
+static inline uint64x2_t
+hash_chunk(uint64x2_t acc, uint8x16_t data, const uint64x2_t k[2])
+{
+    uint32x4_t words = vreinterpretq_u32_u8(vrbitq_u8(data));
+    uint64x2_t lo = vmovl_u32(vget_low_u32(words));
+    uint64x2_t hi = vmovl_high_u32(words);
+    poly128_t p0 = vmull_p64(vgetq_lane_u64(lo, 0), vgetq_lane_u64(k[0], 0));
+    poly128_t p1 = vmull_high_p64(vreinterpretq_p64_u64(lo),
+				  vreinterpretq_p64_u64(k[0]));
+    poly128_t p2 = vmull_p64(vgetq_lane_u64(hi, 0), vgetq_lane_u64(k[1], 0));
+    poly128_t p3 = vmull_high_p64(vreinterpretq_p64_u64(hi),
+				  vreinterpretq_p64_u64(k[1]));
+    uint64x2_t x01 = veorq_u64(vreinterpretq_u64_p128(p0),
+			       vreinterpretq_u64_p128(p1));
+    uint64x2_t x23 = veorq_u64(vreinterpretq_u64_p128(p2),
+			       vreinterpretq_u64_p128(p3));
+    return veorq_u64(acc, veorq_u64(x01, x23));
+}
+
+always_inline
+static inline uint32_t
+hash_final(uint64x2_t acc)
+{
+    return vgetq_lane_u64(acc, 0) >> 32;
+}
+
+always_inline
+static inline uint32_t
+toeplitz(const uint8_t *key, uint32_t keylen, const uint8_t *cptr,
+	 uint32_t nbytes)
+{
+    Assert(nbytes + 4 <= keylen);
+    uint64x2_t acc = vdupq_n_u64(0);
+    uint64x2_t k[2];
+    uint32_t off = 0;
+    for (; off + 16 <= nbytes; off += 16)
+    {
+	chunk_keys(k, key, keylen, off);
+	acc = hash_chunk(acc, vld1q_u8(cptr + off), k);
+    }
+    if (off < nbytes)
+    {
+	chunk_keys(k, key, keylen, off);
+	acc = hash_chunk(acc, load_partial(cptr + off, nbytes - off), k);
+    }
+    return hash_final(acc);
+}
+
+unsigned int
+__toeplitz_hash_aarch64_simd(const void *key, unsigned int keylen,
+			     const void *ptr, unsigned int nbytes)
+{
+    return toeplitz(key, keylen, ptr, nbytes);
+}
+
+/* The key windows are computed once per batch and kept in registers */
+void
+__toeplitz_hash_batch_aarch64_simd(const void *key, unsigned int keylen,
+				   const void *const *ptrs,
+				   unsigned int nbytes,
+				   unsigned int *hashes, unsigned int n)
+{
+    if (unlikely(nbytes > MAXBATCH))
+    {
+	for (uint32_t i = 0; i < n; i++)
+	{
+	    hashes[i] = toeplitz(key, keylen, ptrs[i], nbytes);
+	}
+	return;
+    }
+    Assert(nbytes + 4 <= keylen);
+
+    uint64x2_t k[MAXBATCH / 16][2];
+    uint32_t nfull = nbytes / 16;
+    uint32_t ntail = nbytes % 16;
+    for (uint32_t c = 0; c < (nbytes + 15) / 16; c++)
+    {
+	chunk_keys(k[c], key, keylen, 16 * c);
+    }
+    for (uint32_t i = 0; i < n; i++)
+    {
+	const uint8_t *cptr = ptrs[i];
+	uint64x2_t acc = vdupq_n_u64(0);
+	for (uint32_t c = 0; c < nfull; c++)
+	{
+	    acc = hash_chunk(acc, vld1q_u8(cptr + 16 * c), k[c]);
+	}
+	if (ntail != 0)
+	{
+	    acc = hash_chunk(acc, load_partial(cptr + 16 * nfull, ntail),
+			     k[nfull]);
+	}
+	hashes[i] = hash_final(acc);
+    }
+}
+
+/* The tuples are built in vector registers */
+unsigned int
+__toeplitz_hash_ipv4_aarch64_simd(const void *key, unsigned int keylen,
+				  unsigned int saddr, unsigned int daddr,
+				  unsigned short sport, unsigned short dport)
+{
+    Assert(IPV4_TUPLE + 4 <= keylen);
+    uint64x2_t k[2];
+    chunk_keys(k, key, keylen, 0);
+    uint64_t lo = saddr | (uint64_t) daddr << 32;
+    uint64_t hi = sport | (uint32_t) dport << 16;
+    uint8x16_t data = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(lo),
+							vcreate_u64(hi)));
+    return hash_final(hash_chunk(vdupq_n_u64(0), data, k));
+}
+
+unsigned int
+__toeplitz_hash_ipv6_aarch64_simd(const void *key, unsigned int keylen,
+				  const void *saddr, const void *daddr,
+				  unsigned short sport, unsigned short dport)
+{
+    Assert(IPV6_TUPLE + 4 <= keylen);
+    uint64x2_t k[2];
+    uint64x2_t acc = vdupq_n_u64(0);
+    chunk_keys(k, key, keylen, 0);
+    acc = hash_chunk(acc, vld1q_u8(saddr), k);
+    chunk_keys(k, key, keylen, 16);
+    acc = hash_chunk(acc, vld1q_u8(daddr), k);
+    chunk_keys(k, key, keylen, 32);
+    uint64_t ports = sport | (uint32_t) dport << 16;
+    uint8x16_t data = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(ports),
+							vcreate_u64(0)));
+    return hash_final(hash_chunk(acc, data, k));
+}
@@ -1,7 +1,7 @@
 /*
  * Armv7-A specific checksum implementation using NEON
  *
- * Copyright (c) 2020, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -13,23 +13,41 @@
 #endif
 
 #include <arm_neon.h>
+#if !defined (_WIN32)
+#include <sys/uio.h>
+#endif
 
-unsigned short
-__chksum_arm_simd(const void *ptr, unsigned int nbytes)
+/* Sum NBYTES bytes at PTR without folding.  *SWAP is set if the
+   bytes were summed swapped.  If COPY is true, also copy them to DST,
+   reusing the loaded data.  */
+always_inline
+static inline uint64_t
+chksum_simd(void *dst, const void *ptr, uint32_t nbytes, bool copy,
+	    bool *swap)
 {
-    bool swap = (uintptr_t) ptr & 1;
     uint64x1_t vsum = { 0 };
 
+    *swap = (uintptr_t) ptr & 1;
     if (unlikely(nbytes < 40))
     {
-	uint64_t sum = slurp_small(ptr, nbytes);
-	return fold_and_swap(sum, false);
+	if (copy)
+	{
+	    memcpy(dst, ptr, nbytes);
+	}
+	*swap = false;
+	return slurp_small(ptr, nbytes);
     }
 
     /* 8-byte align pointer */
     /* Inline slurp_head-like code since we use NEON here */
     Assert(nbytes >= 8);
     uint32_t off = (uintptr_t) ptr & 7;
+    if (copy)
+    {
+	/* Copy the unaligned head with an overlapping 8-byte store */
+	vst1_u8(dst, vld1_u8(ptr));
+	dst = (char *) dst + (8 - off) % 8;
+    }
     if (likely(off != 0))
     {
 	const uint64_t *may_alias ptr64 = align_ptr(ptr, 8);
@@ -54,12 +72,21 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
     uint64x2_t vsum2 = { 0, 0 };
     uint64x2_t vsum3 = { 0, 0 };
     const uint32_t *may_alias ptr32 = ptr;
+    uint8_t *dst8 = dst;
     for (uint32_t i = 0; i < nbytes / 64; i++)
     {
 	uint32x4_t vtmp0 = vld1q_u32(ptr32);
 	uint32x4_t vtmp1 = vld1q_u32(ptr32 + 4);
 	uint32x4_t vtmp2 = vld1q_u32(ptr32 + 8);
 	uint32x4_t vtmp3 = vld1q_u32(ptr32 + 12);
+	if (copy)
+	{
+	    vst1q_u8(dst8, vreinterpretq_u8_u32(vtmp0));
+	    vst1q_u8(dst8 + 16, vreinterpretq_u8_u32(vtmp1));
+	    vst1q_u8(dst8 + 32, vreinterpretq_u8_u32(vtmp2));
+	    vst1q_u8(dst8 + 48, vreinterpretq_u8_u32(vtmp3));
+	    dst8 += 64;
+	}
 	vsum0 = vpadalq_u32(vsum0, vtmp0);
 	vsum1 = vpadalq_u32(vsum1, vtmp1);
 	vsum2 = vpadalq_u32(vsum2, vtmp2);
@@ -77,6 +104,11 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
     while (likely(nbytes >= 16))
     {
 	uint32x4_t vtmp0 = vld1q_u32(ptr32);
+	if (copy)
+	{
+	    vst1q_u8(dst8, vreinterpretq_u8_u32(vtmp0));
+	    dst8 += 16;
+	}
 	vsum0 = vpadalq_u32(vsum0, vtmp0);
 	ptr32 += 4;
 	nbytes -= 16;
@@ -101,6 +133,11 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
     if (nbytes & 8)
     {
 	uint32x2_t vtmp = vld1_u32(ptr32);
+	if (copy)
+	{
+	    vst1_u8(dst8, vreinterpret_u8_u32(vtmp));
+	    dst8 += 8;
+	}
 	/* Add to accumulator */
 	vsum = vpadal_u32(vsum, vtmp);
 	ptr32 += 2;
@@ -108,6 +145,13 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
     }
     Assert(nbytes < 8);
 
+    /* Copy any trailing 0..7 bytes with an overlapping 8-byte store */
+    if (copy)
+    {
+	const uint8_t *end = (const uint8_t *) ptr32 + nbytes;
+	vst1_u8(dst8 + nbytes - 8, vld1_u8(end - 8));
+    }
+
     /* Handle any trailing 1..7 bytes */
     if (likely(nbytes != 0))
     {
@@ -125,6 +169,57 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
 	vsum = vpadal_u32(vsum, vreinterpret_u32_u64(vword64));
     }
 
+    return vget_lane_u64(vsum, 0);
+}
+
+/* Sum the first NBYTES bytes of four buffers, NBYTES being a multiple of
+   16.  Each buffer has its own accumulator so the loads and additions of
+   the four buffers overlap, which matters for short packets where a
+   single buffer does not provide enough independent work.  */
+always_inline
+static inline void
+slurp_batch4(const void *const *ptrs, uint32_t nbytes, uint64_t sums[4])
+{
+    const uint8_t *ptr0 = ptrs[0];
+    const uint8_t *ptr1 = ptrs[1];
+    const uint8_t *ptr2 = ptrs[2];
+    const uint8_t *ptr3 = ptrs[3];
+
+    uint64x2_t vsum0 = { 0, 0 };
+    uint64x2_t vsum1 = { 0, 0 };
+    uint64x2_t vsum2 = { 0, 0 };
+    uint64x2_t vsum3 = { 0, 0 };
+
+    Assert(nbytes % 16 == 0);
+    for (uint32_t off = 0; off < nbytes; off += 16)
+    {
+	uint8x16_t vtmp0 = vld1q_u8(ptr0 + off);
+	uint8x16_t vtmp1 = vld1q_u8(ptr1 + off);
+	uint8x16_t vtmp2 = vld1q_u8(ptr2 + off);
+	uint8x16_t vtmp3 = vld1q_u8(ptr3 + off);
+	vsum0 = vpadalq_u32(vsum0, vreinterpretq_u32_u8(vtmp0));
+	vsum1 = vpadalq_u32(vsum1, vreinterpretq_u32_u8(vtmp1));
+	vsum2 = vpadalq_u32(vsum2, vreinterpretq_u32_u8(vtmp2));
+	vsum3 = vpadalq_u32(vsum3, vreinterpretq_u32_u8(vtmp3));
+    }
+
+    sums[0] = vget_lane_u64(vadd_u64(vget_low_u64(vsum0),
+				     vget_high_u64(vsum0)), 0);
+    sums[1] = vget_lane_u64(vadd_u64(vget_low_u64(vsum1),
+				     vget_high_u64(vsum1)), 0);
+    sums[2] = vget_lane_u64(vadd_u64(vget_low_u64(vsum2),
+				     vget_high_u64(vsum2)), 0);
+    sums[3] = vget_lane_u64(vadd_u64(vget_low_u64(vsum3),
+				     vget_high_u64(vsum3)), 0);
+}
+
+/* NEON version of fold_and_swap() */
+always_inline
+static inline uint16_t
+fold_and_swap_simd(uint64_t sum64, bool swap)
+{
+    uint64x1_t vsum = vdup_n_u64(sum64);
+
     /* Fold 64-bit vsum to 32 bits */
     vsum = vpaddl_u32(vreinterpret_u32_u64(vsum));
     vsum = vpaddl_u32(vreinterpret_u32_u64(vsum));
@@ -147,3 +242,7 @@ __chksum_arm_simd(const void *ptr, unsigned int nbytes)
     }
     return sum;
 }
+
+#define CHKSUM_SIMD(name) name##_arm_simd
+#define fold_simd fold_and_swap_simd
+#include "../chksum_neon_common.h"
@@ -2,12 +2,15 @@
  * Compute 16-bit sum in ones' complement arithmetic (with end-around carry).
  * This sum is often used as a simple checksum in networking.
  *
- * Copyright (c) 2020, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
 #include "networking.h"
 #include "chksum_common.h"
+#if !defined (_WIN32)
+#include <sys/uio.h>
+#endif
 
 always_inline
 static inline uint32_t
@@ -28,17 +31,28 @@ slurp_head32(const void **pptr, uint32_t *nbytes)
     return sum;
 }
 
-/* Additional loop unrolling would help when not auto-vectorizing */
-unsigned short
-__chksum(const void *ptr, unsigned int nbytes)
+/* Sum NBYTES bytes at PTR without folding.  *SWAP is set if the bytes were
+   summed swapped.  If COPY is true, also copy them to DST, reusing the
+   loaded data.
+   Additional loop unrolling would help when not auto-vectorizing */
+always_inline
+static inline uint64_t
+chksum(void *dst, const void *ptr, uint32_t nbytes, bool copy, bool *swap)
 {
-    bool swap = false;
     uint64_t sum = 0;
+    char *cdst = dst;
 
+    *swap = false;
     if (nbytes > 300)
     {
 	/* 4-byte align pointer */
-	swap = (uintptr_t) ptr & 1;
+	*swap = (uintptr_t) ptr & 1;
+	if (copy)
+	{
+	    /* Copy the unaligned head with an overlapping 4-byte store */
+	    store32(cdst, load32(ptr));
+	    cdst += -(uintptr_t) ptr % 4;
+	}
 	sum = slurp_head32(&ptr, &nbytes);
     }
     /* Else benefit of aligning not worth the overhead */
@@ -51,6 +65,14 @@ __chksum(const void *ptr, unsigned int nbytes)
 	uint64_t h1 = load32(cptr + 4);
 	uint64_t h2 = load32(cptr + 8);
 	uint64_t h3 = load32(cptr + 12);
+	if (copy)
+	{
+	    store32(cdst + 0, h0);
+	    store32(cdst + 4, h1);
+	    store32(cdst + 8, h2);
+	    store32(cdst + 12, h3);
+	    cdst += 16;
+	}
 	sum += h0 + h1 + h2 + h3;
 	cptr += 16;
     }
@@ -60,7 +82,13 @@ __chksum(const void *ptr, unsigned int nbytes)
     /* Handle any trailing 4-byte chunks */
     while (nbytes >= 4)
     {
-	sum += load32(cptr);
+	uint32_t h = load32(cptr);
+	if (copy)
+	{
+	    store32(cdst, h);
+	    cdst += 4;
+	}
+	sum += h;
 	cptr += 4;
 	nbytes -= 4;
     }
@@ -68,14 +96,178 @@ __chksum(const void *ptr, unsigned int nbytes)
 
     if (nbytes & 2)
     {
-	sum += load16(cptr);
+	uint16_t h = load16(cptr);
+	if (copy)
+	{
+	    store16(cdst, h);
+	    cdst += 2;
+	}
+	sum += h;
 	cptr += 2;
     }
 
     if (nbytes & 1)
     {
+	if (copy)
+	{
+	    *cdst = *cptr;
+	}
 	sum += *(uint8_t *)cptr;
     }
 
+    return sum;
+}
+
+unsigned short
+__chksum(const void *ptr, unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum(NULL, ptr, nbytes, false, &swap);
     return fold_and_swap(sum, swap);
 }
+
+unsigned short
+__chksum_copy(void *dst, const void *src, unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum(dst, src, nbytes, true, &swap);
+    return fold_and_swap(sum, swap);
+}
+
+void
+__chksum_init(struct chksum_state *state)
+{
+    state->sum = 0;
+    state->odd = 0;
+}
+
+void
+__chksum_update(struct chksum_state *state, const void *ptr,
+		unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(state, sum, swap, nbytes);
+}
+
+unsigned short
+__chksum_final(const struct chksum_state *state)
+{
+    return fold_and_swap(state->sum, false);
+}
+
+/* Checksum N independent buffers, PTRS[i] of LENS[i] bytes, into OUT[i] */
+void
+__chksum_batch(const void *const *ptrs, const unsigned int *lens,
+	       unsigned short *out, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; i++)
+    {
+	bool swap;
+	uint64_t sum = chksum(NULL, ptrs[i], lens[i], false, &swap);
+	out[i] = fold_and_swap(sum, swap);
+    }
+}
+
+unsigned short
+__chksum_ipv4_header(const void *iph)
+{
+    return (unsigned short) ~fold_and_swap(ipv4_header_sum(iph), false);
+}
+
+/* The pseudo-header sum seeds the accumulation of the payload, so there is
+   a single fold for the whole TCP or UDP checksum.  */
+unsigned short
+__chksum_tcpudp_ipv4(unsigned int saddr, unsigned int daddr,
+		     unsigned char proto, const void *ptr,
+		     unsigned int nbytes)
+{
+    uint64_t pseudo = pseudo_ipv4_sum(saddr, daddr, proto, nbytes);
+    struct chksum_state state = { pseudo, 0 };
+    bool swap;
+    uint64_t sum = chksum(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(&state, sum, swap, nbytes);
+    return (unsigned short) ~fold_and_swap(state.sum, false);
+}
+
+unsigned short
+__chksum_tcpudp_ipv6(const void *saddr, const void *daddr,
+		     unsigned char proto, const void *ptr,
+		     unsigned int nbytes)
+{
+    uint64_t pseudo = pseudo_ipv6_sum(saddr, daddr, proto, nbytes);
+    struct chksum_state state = { pseudo, 0 };
+    bool swap;
+    uint64_t sum = chksum(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(&state, sum, swap, nbytes);
+    return (unsigned short) ~fold_and_swap(state.sum, false);
+}
+
+unsigned short
+__chksum_replace16(unsigned short csum, unsigned short old,
+		   unsigned short new)
+{
+    return update_csum(csum, (uint64_t) (uint16_t) ~old + new);
+}
+
+unsigned short
+__chksum_replace32(unsigned short csum, unsigned int old, unsigned int new)
+{
+    return update_csum(csum, replace_delta32(old, new));
+}
+
+unsigned short
+__chksum_replace128(unsigned short csum, const void *old, const void *new)
+{
+    const char *optr = old;
+    const char *nptr = new;
+    uint64_t delta = 0;
+    for (int i = 0; i < 16; i += 4)
+    {
+	delta += replace_delta32(load32(optr + i), load32(nptr + i));
+    }
+    return update_csum(csum, delta);
+}
+
+void
+__chksum_rewrite32_batch(void *const *pkts, unsigned int n,
+			 unsigned int field, unsigned int value,
+			 const unsigned int *csums, unsigned int ncsums,
+			 unsigned int udp)
+{
+    for (unsigned int i = 0; i < n; i++)
+    {
+	char *pkt = pkts[i];
+	uint64_t delta = replace_delta32(load32(pkt + field), value);
+	store32(pkt + field, value);
+	for (unsigned int c = 0; c < ncsums; c++)
+	{
+	    uint16_t csum = load16(pkt + csums[c]);
+	    if (udp & (1u << c))
+	    {
+		csum = update_udp_csum(csum, delta);
+	    }
+	    else
+	    {
+		csum = update_csum(csum, delta);
+	    }
+	    store16(pkt + csums[c], csum);
+	}
+    }
+}
+
+#if !defined (_WIN32)
+unsigned short
+__chksum_iov(const struct iovec *iov, int cnt)
+{
+    struct chksum_state state = { 0, 0 };
+    for (int i = 0; i < cnt; i++)
+    {
+	bool swap;
+	uint64_t sum = chksum(NULL, iov[i].iov_base, iov[i].iov_len, false,
+			      &swap);
+	chksum_state_add(&state, sum, swap, iov[i].iov_len);
+    }
+    return fold_and_swap(state.sum, false);
+}
+#endif
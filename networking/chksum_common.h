@@ -1,7 +1,7 @@
 /*
  * Common code for checksum implementations
  *
- * Copyright (c) 2020, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -16,6 +16,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "networking.h"
 
 /* Assertions must be explicitly enabled */
 #if WANT_ASSERT
@@ -37,6 +38,8 @@
 #define no_unroll_loops  __attribute__((optimize("no-unroll-loops")))
 #endif
 #define bswap16(x)    __builtin_bswap16((x))
+#define bswap32(x)    __builtin_bswap32((x))
+#define bswap64(x)    __builtin_bswap64((x))
 #else
 #define likely(x)     (x)
 #define unlikely(x)   (x)
@@ -44,6 +47,10 @@
 #define always_inline
 #define no_unroll_loops
 #define bswap16(x)    ((uint8_t)((x) >> 8) | ((uint8_t)(x) << 8))
+#define bswap32(x)    ((uint32_t) bswap16((uint16_t) (x)) << 16 \
+		       | bswap16((uint16_t) ((x) >> 16)))
+#define bswap64(x)    ((uint64_t) bswap32((uint32_t) (x)) << 32 \
+		       | bswap32((uint32_t) ((x) >> 32)))
 #endif
 
 #define ALL_ONES ~UINT64_C(0)
@@ -75,6 +82,18 @@ uint16_t load16(const void *ptr)
     return v;
 }
 
+static inline
+void store32(void *ptr, uint32_t v)
+{
+    memcpy(ptr, &v, sizeof v);
+}
+
+static inline
+void store16(void *ptr, uint16_t v)
+{
+    memcpy(ptr, &v, sizeof v);
+}
+
 /* slurp_small() is for small buffers, don't waste cycles on alignment */
 no_unroll_loops
 always_inline
@@ -129,4 +148,114 @@ fold_and_swap(uint64_t sum, bool swap)
     return (uint16_t) sum;
 }
 
+/* Byte swap each 16-bit word of a ones' complement sum.  Rotating by 8 bits
+   multiplies by 2^8 modulo 2^64-1, which is a byte swap modulo 2^16-1.  */
+static inline uint64_t
+swap_sum(uint64_t sum)
+{
+    return (sum >> 8) | (sum << 56);
+}
+
+/* Add two 64-bit sums in ones' complement arithmetic (end-around carry) */
+static inline uint64_t
+add_sum(uint64_t a, uint64_t b)
+{
+    uint64_t sum = a + b;
+    return sum + (sum < a);
+}
+
+/* Add the sum of an NBYTES segment to STATE.  SWAP is set if SUM was
+   accumulated with the bytes of the segment swapped.  The segment's sum
+   must be swapped again if it starts at an odd offset in the stream.  */
+always_inline
+static inline void
+chksum_state_add(struct chksum_state *state, uint64_t sum, bool swap,
+		 uint32_t nbytes)
+{
+    if (swap ^ state->odd)
+    {
+	sum = swap_sum(sum);
+    }
+    state->sum = add_sum(state->sum, sum);
+    state->odd ^= nbytes & 1;
+}
+
+/* Unfolded sum of a 20-byte IPv4 header (IHL = 5).  No loops or branches,
+   the caller is expected to check IHL.  */
+always_inline
+static inline uint64_t
+ipv4_header_sum(const void *iph)
+{
+    const char *cptr = iph;
+    uint64_t sum0 = (uint64_t) load32(cptr) + load32(cptr + 4);
+    uint64_t sum1 = (uint64_t) load32(cptr + 8) + load32(cptr + 12);
+    return sum0 + sum1 + load32(cptr + 16);
+}
+
+/* Unfolded sum of the IPv4 pseudo-header.  SADDR and DADDR are in network
+   byte order, PROTO and NBYTES (the TCP or UDP length) in host byte order.
+   Protocol and length form the big-endian words 0:PROTO and NBYTES, which
+   are PROTO << 8 and bswap16(NBYTES) when loaded little-endian.  */
+always_inline
+static inline uint64_t
+pseudo_ipv4_sum(uint32_t saddr, uint32_t daddr, uint8_t proto,
+		uint32_t nbytes)
+{
+    uint64_t sum = (uint64_t) saddr + daddr;
+    return sum + ((uint32_t) proto << 8) + bswap16((uint16_t) nbytes);
+}
+
+/* Unfolded sum of the IPv6 pseudo-header.  SADDR and DADDR point to
+   16-byte addresses in network byte order.  The 32-bit length and the
+   three zero bytes followed by the next header are big-endian.  */
+always_inline
+static inline uint64_t
+pseudo_ipv6_sum(const void *saddr, const void *daddr, uint8_t proto,
+		uint32_t nbytes)
+{
+    const char *sptr = saddr;
+    const char *dptr = daddr;
+    uint64_t sum0 = (uint64_t) load32(sptr) + load32(sptr + 4);
+    uint64_t sum1 = (uint64_t) load32(sptr + 8) + load32(sptr + 12);
+    sum0 += (uint64_t) load32(dptr) + load32(dptr + 4);
+    sum1 += (uint64_t) load32(dptr + 8) + load32(dptr + 12);
+    sum0 += bswap32(nbytes);
+    sum1 += (uint32_t) proto << 24;
+    return sum0 + sum1;
+}
+
+/* Update the checksum field CSUM for a change of the covered data whose
+   sum changes by DELTA, which is ~m + m' for old and new fields m and m'.
+   This is RFC 1624 eqn. 3, HC' = ~(~HC + ~m + m'), which never produces
+   the -0 of a recomputed checksum.  */
+always_inline
+static inline uint16_t
+update_csum(uint16_t csum, uint64_t delta)
+{
+    return (uint16_t) ~fold_and_swap((uint16_t) ~csum + delta, false);
+}
+
+/* As update_csum, for a UDP checksum field.  A UDP checksum of 0 means
+   that none was computed, so it stays 0, and a computed checksum of 0 is
+   transmitted as 0xffff instead (RFC 768).  */
+always_inline
+static inline uint16_t
+update_udp_csum(uint16_t csum, uint64_t delta)
+{
+    if (csum == 0)
+    {
+	return 0;
+    }
+    csum = update_csum(csum, delta);
+    return csum == 0 ? 0xffff : csum;
+}
+
+/* Sum difference ~m + m' for a 32-bit field changing from OLD to NEW */
+always_inline
+static inline uint64_t
+replace_delta32(uint32_t old, uint32_t new)
+{
+    return (uint64_t) ~old + new;
+}
+
 #endif
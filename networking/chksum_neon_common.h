@@ -0,0 +1,195 @@
+/*
+ * Checksum functions shared by the Armv7-A and AArch64 NEON implementations
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* This file is included at the end of arm/chksum_simd.c and
+   aarch64/chksum_simd.c, after arm_neon.h.  The including file provides:
+
+   chksum_simd (DST, PTR, NBYTES, COPY, SWAP): sum NBYTES bytes at PTR
+   without folding, as chksum() in chksum.c.
+   slurp_batch4 (PTRS, NBYTES, SUMS): sum the first NBYTES bytes of four
+   buffers, NBYTES being a multiple of 16.
+   fold_simd (SUM, SWAP): fold a sum to 16 bits, as fold_and_swap().
+   CHKSUM_SIMD (NAME): the name of the function NAME for this target.  */
+
+unsigned short
+CHKSUM_SIMD(__chksum)(const void *ptr, unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum_simd(NULL, ptr, nbytes, false, &swap);
+    return fold_simd(sum, swap);
+}
+
+unsigned short
+CHKSUM_SIMD(__chksum_copy)(void *dst, const void *src, unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum_simd(dst, src, nbytes, true, &swap);
+    return fold_simd(sum, swap);
+}
+
+void
+CHKSUM_SIMD(__chksum_update)(struct chksum_state *state, const void *ptr,
+			     unsigned int nbytes)
+{
+    bool swap;
+    uint64_t sum = chksum_simd(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(state, sum, swap, nbytes);
+}
+
+/* Checksum N independent buffers, four at a time.  The length of the
+   shortest buffer of a group, rounded down to a multiple of 16, is summed
+   interleaved and the rest of each buffer is summed on its own.  */
+void
+CHKSUM_SIMD(__chksum_batch)(const void *const *ptrs, const unsigned int *lens,
+			    unsigned short *out, unsigned int n)
+{
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+	uint32_t common = lens[i];
+	for (int j = 1; j < 4; j++)
+	{
+	    common = lens[i + j] < common ? lens[i + j] : common;
+	}
+	common &= ~15U;
+
+	uint64_t sums[4];
+	slurp_batch4(ptrs + i, common, sums);
+	for (int j = 0; j < 4; j++)
+	{
+	    /* COMMON is even so the tail does not change byte order */
+	    struct chksum_state state = { sums[j], 0 };
+	    const char *tail = (const char *) ptrs[i + j] + common;
+	    bool swap;
+	    uint64_t sum = chksum_simd(NULL, tail, lens[i + j] - common,
+				       false, &swap);
+	    chksum_state_add(&state, sum, swap, 0);
+	    out[i + j] = fold_simd(state.sum, false);
+	}
+    }
+    for (; i < n; i++)
+    {
+	bool swap;
+	uint64_t sum = chksum_simd(NULL, ptrs[i], lens[i], false, &swap);
+	out[i] = fold_simd(sum, swap);
+    }
+}
+
+unsigned short
+CHKSUM_SIMD(__chksum_tcpudp_ipv4)(unsigned int saddr, unsigned int daddr,
+				  unsigned char proto, const void *ptr,
+				  unsigned int nbytes)
+{
+    uint64_t pseudo = pseudo_ipv4_sum(saddr, daddr, proto, nbytes);
+    struct chksum_state state = { pseudo, 0 };
+    bool swap;
+    uint64_t sum = chksum_simd(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(&state, sum, swap, nbytes);
+    return (unsigned short) ~fold_simd(state.sum, false);
+}
+
+unsigned short
+CHKSUM_SIMD(__chksum_tcpudp_ipv6)(const void *saddr, const void *daddr,
+				  unsigned char proto, const void *ptr,
+				  unsigned int nbytes)
+{
+    uint64_t pseudo = pseudo_ipv6_sum(saddr, daddr, proto, nbytes);
+    struct chksum_state state = { pseudo, 0 };
+    bool swap;
+    uint64_t sum = chksum_simd(NULL, ptr, nbytes, false, &swap);
+    chksum_state_add(&state, sum, swap, nbytes);
+    return (unsigned short) ~fold_simd(state.sum, false);
+}
+
+/* Rewrite four packets at a time.  The field loads and stores are scalar,
+   the checksum updates of the four packets are done in the lanes of one
+   vector: the sum of the halves of ~m + m' is at most 18 bits, adding ~HC
+   keeps it within 19 bits, so two 16-bit folds suffice.  */
+void
+CHKSUM_SIMD(__chksum_rewrite32_batch)(void *const *pkts, unsigned int n,
+				      unsigned int field, unsigned int value,
+				      const unsigned int *csums,
+				      unsigned int ncsums, unsigned int udp)
+{
+    uint32_t vnew = (value & 0xffff) + (value >> 16);
+    uint32x4_t vmask = vdupq_n_u32(0xffff);
+    uint16x4_t vzero = vdup_n_u16(0);
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+	uint8_t *pkt[4] = { pkts[i], pkts[i + 1], pkts[i + 2], pkts[i + 3] };
+	uint32_t old[4];
+	for (int j = 0; j < 4; j++)
+	{
+	    old[j] = load32(pkt[j] + field);
+	    store32(pkt[j] + field, value);
+	}
+	/* ~m + m' per packet, summed as 16-bit halves */
+	uint16x8_t vold = vreinterpretq_u16_u32(vmvnq_u32(vld1q_u32(old)));
+	uint32x4_t vdelta = vaddq_u32(vpaddlq_u16(vold), vdupq_n_u32(vnew));
+	for (unsigned int c = 0; c < ncsums; c++)
+	{
+	    uint16_t hc[4];
+	    for (int j = 0; j < 4; j++)
+	    {
+		hc[j] = load16(pkt[j] + csums[c]);
+	    }
+	    uint16x4_t vhc = vld1_u16(hc);
+	    uint32x4_t vsum = vaddw_u16(vdelta, vmvn_u16(vhc));
+	    vsum = vaddq_u32(vandq_u32(vsum, vmask), vshrq_n_u32(vsum, 16));
+	    vsum = vaddq_u32(vandq_u32(vsum, vmask), vshrq_n_u32(vsum, 16));
+	    vhc = vmvn_u16(vmovn_u32(vsum));
+	    if (udp & (1u << c))
+	    {
+		/* As update_udp_csum: a 0 result becomes 0xffff, and lanes
+		   whose old checksum was 0 go back to 0.  */
+		vhc = vorr_u16(vhc, vceq_u16(vhc, vzero));
+		vhc = vbic_u16(vhc, vceq_u16(vld1_u16(hc), vzero));
+	    }
+	    vst1_u16(hc, vhc);
+	    for (int j = 0; j < 4; j++)
+	    {
+		store16(pkt[j] + csums[c], hc[j]);
+	    }
+	}
+    }
+    for (; i < n; i++)
+    {
+	char *pkt = pkts[i];
+	uint64_t delta = replace_delta32(load32(pkt + field), value);
+	store32(pkt + field, value);
+	for (unsigned int c = 0; c < ncsums; c++)
+	{
+	    uint16_t csum = load16(pkt + csums[c]);
+	    if (udp & (1u << c))
+	    {
+		csum = update_udp_csum(csum, delta);
+	    }
+	    else
+	    {
+		csum = update_csum(csum, delta);
+	    }
+	    store16(pkt + csums[c], csum);
+	}
+    }
+}
+
+#if !defined (_WIN32)
+unsigned short
+CHKSUM_SIMD(__chksum_iov)(const struct iovec *iov, int cnt)
+{
+    struct chksum_state state = { 0, 0 };
+    for (int i = 0; i < cnt; i++)
+    {
+	bool swap;
+	uint64_t sum = chksum_simd(NULL, iov[i].iov_base, iov[i].iov_len,
+				   false, &swap);
+	chksum_state_add(&state, sum, swap, iov[i].iov_len);
+    }
+    return fold_simd(state.sum, false);
+}
+#endif
@@ -0,0 +1,21 @@
+/*
+ * Table-driven CRC32 (IEEE 802.3) and CRC32C (Castagnoli).
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "crc32_common.h"
+
+unsigned int
+__crc32(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return ~crc32_table_update(~crc, ptr, nbytes, __crc32_table);
+}
+
+unsigned int
+__crc32c(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return ~crc32_table_update(~crc, ptr, nbytes, __crc32c_table);
+}
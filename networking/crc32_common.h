@@ -0,0 +1,54 @@
+/*
+ * Common code for CRC32 and CRC32C implementations
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef CRC32_COMMON_H
+#define CRC32_COMMON_H
+
+#include "chksum_common.h"
+
+#ifdef __GNUC__
+#define HIDDEN __attribute__ ((__visibility__ ("hidden")))
+#else
+#define HIDDEN
+#endif
+
+/* All CRCs are bit-reflected, as used by Ethernet, zlib and iSCSI.  The
+   public functions take and return the final (inverted) CRC, so a CRC can
+   be continued over several buffers, starting from 0.  The helpers below
+   work on the CRC register, without inversion.  */
+
+HIDDEN extern const uint32_t __crc32_table[8][256];
+HIDDEN extern const uint32_t __crc32c_table[8][256];
+
+/* Table-driven CRC of NBYTES bytes at PTR, 8 bytes per step (slicing-by-8).
+   TABLE is __crc32_table or __crc32c_table.  */
+always_inline
+static inline uint32_t
+crc32_table_update(uint32_t crc, const void *ptr, uint32_t nbytes,
+		   const uint32_t table[8][256])
+{
+    const unsigned char *cptr = ptr;
+    while (nbytes >= 8)
+    {
+	uint64_t val = load64(cptr) ^ crc;
+	crc = table[7][val & 0xff] ^ table[6][(val >> 8) & 0xff]
+	    ^ table[5][(val >> 16) & 0xff] ^ table[4][(val >> 24) & 0xff]
+	    ^ table[3][(val >> 32) & 0xff] ^ table[2][(val >> 40) & 0xff]
+	    ^ table[1][(val >> 48) & 0xff] ^ table[0][val >> 56];
+	cptr += 8;
+	nbytes -= 8;
+    }
+    while (nbytes != 0)
+    {
+	crc = table[0][(crc ^ *cptr) & 0xff] ^ (crc >> 8);
+	cptr++;
+	nbytes--;
+    }
+    return crc;
+}
+
+#endif
@@ -0,0 +1,22 @@
+/*
+ * Adler-32 and Fletcher-64 checksums
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "fletcher_common.h"
+
+unsigned int
+__adler32(unsigned int adler, const void *ptr, unsigned int nbytes)
+{
+    return adler32_update(adler, ptr, nbytes);
+}
+
+unsigned long long
+__fletcher64(unsigned long long fletcher, const void *ptr,
+	     unsigned int nbytes)
+{
+    return fletcher64_update(fletcher, ptr, nbytes);
+}
@@ -0,0 +1,132 @@
+/*
+ * Common code for Adler-32 and Fletcher-64 implementations
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef FLETCHER_COMMON_H
+#define FLETCHER_COMMON_H
+
+#include "chksum_common.h"
+
+/* Both checksums keep a sum A of the data and a sum B of the successive
+   values of A.  For a block of N elements D[0..N-1] added to (A, B):
+
+     A' = A + sum D[i]
+     B' = B + N * A + sum (N - i) * D[i]
+
+   Vector implementations compute the weighted sum with weight vectors and
+   add the running sums of the previous blocks, scaled by the block size,
+   for the position of each block.  */
+
+/* Adler-32 (RFC 1950) sums bytes modulo the largest prime below 2^16.
+   ADLER_NMAX is the largest N for which 255 N (N + 1) / 2 +
+   (N + 1) (ADLER_BASE - 1) fits in 32 bits, as in zlib.  */
+#define ADLER_BASE 65521
+#define ADLER_NMAX 5552
+
+/* Fletcher-64 sums little-endian 32-bit words, the last one zero-padded,
+   modulo 2^32 - 1.  With 64-bit sums, B does not overflow for
+   FLETCHER_NMAX words.  */
+#define FLETCHER_MOD 0xffffffff
+#define FLETCHER_NMAX 32768
+
+always_inline
+static inline uint32_t
+adler32_update(uint32_t adler, const uint8_t *cptr, uint32_t nbytes)
+{
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    while (nbytes != 0)
+    {
+	uint32_t n = nbytes < ADLER_NMAX ? nbytes : ADLER_NMAX;
+	nbytes -= n;
+	for (; n >= 4; n -= 4)
+	{
+	    a += cptr[0];
+	    b += a;
+	    a += cptr[1];
+	    b += a;
+	    a += cptr[2];
+	    b += a;
+	    a += cptr[3];
+	    b += a;
+	    cptr += 4;
+	}
+	for (; n != 0; n--)
+	{
+	    a += *cptr++;
+	    b += a;
+	}
+	a %= ADLER_BASE;
+	b %= ADLER_BASE;
+    }
+    return b << 16 | a;
+}
+
+/* Reduce modulo 2^32 - 1, returning 0 rather than 2^32 - 1 */
+always_inline
+static inline uint64_t
+fletcher_mod(uint64_t x)
+{
+    x = (x & FLETCHER_MOD) + (x >> 32);
+    x = (x & FLETCHER_MOD) + (x >> 32);
+    return x >= FLETCHER_MOD ? x - FLETCHER_MOD : x;
+}
+
+/* Load the last 1..3 bytes of the data as a zero-padded word */
+always_inline
+static inline uint32_t
+fletcher_tail(const uint8_t *cptr, uint32_t nbytes)
+{
+    Assert(nbytes != 0 && nbytes < 4);
+    uint32_t word = cptr[0];
+    if (nbytes >= 2)
+    {
+	word |= (uint32_t) cptr[1] << 8;
+    }
+    if (nbytes == 3)
+    {
+	word |= (uint32_t) cptr[2] << 16;
+    }
+    return word;
+}
+
+always_inline
+static inline uint64_t
+fletcher64_update(uint64_t fletcher, const uint8_t *cptr, uint32_t nbytes)
+{
+    uint64_t a = fletcher & FLETCHER_MOD;
+    uint64_t b = fletcher >> 32;
+    uint32_t nwords = nbytes / 4;
+    while (nwords != 0)
+    {
+	uint32_t n = nwords < FLETCHER_NMAX ? nwords : FLETCHER_NMAX;
+	nwords -= n;
+	for (; n >= 2; n -= 2)
+	{
+	    a += load32(cptr);
+	    b += a;
+	    a += load32(cptr + 4);
+	    b += a;
+	    cptr += 8;
+	}
+	if (n != 0)
+	{
+	    a += load32(cptr);
+	    b += a;
+	    cptr += 4;
+	}
+	a = fletcher_mod(a);
+	b = fletcher_mod(b);
+    }
+    if (nbytes % 4 != 0)
+    {
+	a = fletcher_mod(a + fletcher_tail(cptr, nbytes % 4));
+	b = fletcher_mod(b + a);
+    }
+    return b << 32 | a;
+}
+
+#endif
@@ -1,14 +1,173 @@
 /*
  * Public API.
  *
- * Copyright (c) 2020, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
+#ifndef _NETWORKING_H
+#define _NETWORKING_H
+
+/* State for checksumming data given in several segments.  The sum is not
+   folded between segments, and segments may have any length.  */
+struct chksum_state
+{
+  unsigned long long sum;
+  unsigned int odd;	/* Odd number of bytes so far.  */
+};
+
+struct iovec;
+
 unsigned short __chksum (const void *, unsigned int);
+unsigned short __chksum_copy (void *, const void *, unsigned int);
+void __chksum_init (struct chksum_state *);
+void __chksum_update (struct chksum_state *, const void *, unsigned int);
+unsigned short __chksum_final (const struct chksum_state *);
+unsigned short __chksum_iov (const struct iovec *, int);
+void __chksum_batch (const void *const *, const unsigned int *,
+		     unsigned short *, unsigned int);
+
+/* IP checksums return the value of the checksum field, the ones' complement
+   of the sum, which is 0 when checking a correct checksum.  Addresses are
+   in network byte order, protocol and TCP or UDP length in host byte
+   order.  */
+unsigned short __chksum_ipv4_header (const void *);
+unsigned short __chksum_tcpudp_ipv4 (unsigned int, unsigned int,
+				     unsigned char, const void *,
+				     unsigned int);
+unsigned short __chksum_tcpudp_ipv6 (const void *, const void *,
+				     unsigned char, const void *,
+				     unsigned int);
+
+/* Incremental update of a checksum field (RFC 1624) for a change of a
+   16-bit, 32-bit or 16-byte field, from the old to the new value.  Fields
+   are in network byte order at an even offset in the checksummed data.
+   A UDP checksum of 0 means no checksum and must not be updated.  */
+unsigned short __chksum_replace16 (unsigned short, unsigned short,
+				   unsigned short);
+unsigned short __chksum_replace32 (unsigned short, unsigned int,
+				   unsigned int);
+unsigned short __chksum_replace128 (unsigned short, const void *,
+				    const void *);
+/* For N packets, store a 32-bit value at the given offset and update the
+   checksum fields at NCSUMS offsets, e.g. for source NAT.  Bit C of the
+   last argument is set if the field at the C-th offset is a UDP checksum,
+   which is then left alone if it is 0, and written as 0xffff instead of 0
+   otherwise.  NCSUMS is at most 32.  */
+void __chksum_rewrite32_batch (void *const *, unsigned int, unsigned int,
+			       unsigned int, const unsigned int *,
+			       unsigned int, unsigned int);
 #if __aarch64__ && __ARM_NEON
 unsigned short __chksum_aarch64_simd (const void *, unsigned int);
+unsigned short __chksum_copy_aarch64_simd (void *, const void *, unsigned int);
+void __chksum_update_aarch64_simd (struct chksum_state *, const void *,
+				   unsigned int);
+unsigned short __chksum_iov_aarch64_simd (const struct iovec *, int);
+void __chksum_batch_aarch64_simd (const void *const *, const unsigned int *,
+				  unsigned short *, unsigned int);
+unsigned short __chksum_tcpudp_ipv4_aarch64_simd (unsigned int, unsigned int,
+						  unsigned char, const void *,
+						  unsigned int);
+unsigned short __chksum_tcpudp_ipv6_aarch64_simd (const void *, const void *,
+						  unsigned char, const void *,
+						  unsigned int);
+void __chksum_rewrite32_batch_aarch64_simd (void *const *, unsigned int,
+					    unsigned int, unsigned int,
+					    const unsigned int *,
+					    unsigned int, unsigned int);
+#endif
+#if __aarch64__
+unsigned short __chksum_aarch64_sve (const void *, unsigned int);
+unsigned short __chksum_aarch64_sve2 (const void *, unsigned int);
+#endif
+#if __x86_64__
+/* As with SVE above, __chksum does not select these at run time: callers
+   that know AVX2 is available call __chksum_x86_64_avx2 directly.  */
+unsigned short __chksum_x86_64_simd (const void *, unsigned int);
+unsigned short __chksum_x86_64_avx2 (const void *, unsigned int);
 #endif
 #if __arm__ && __ARM_NEON
 unsigned short __chksum_arm_simd (const void *, unsigned int);
+unsigned short __chksum_copy_arm_simd (void *, const void *, unsigned int);
+void __chksum_update_arm_simd (struct chksum_state *, const void *,
+			       unsigned int);
+unsigned short __chksum_iov_arm_simd (const struct iovec *, int);
+void __chksum_batch_arm_simd (const void *const *, const unsigned int *,
+			      unsigned short *, unsigned int);
+unsigned short __chksum_tcpudp_ipv4_arm_simd (unsigned int, unsigned int,
+					      unsigned char, const void *,
+					      unsigned int);
+unsigned short __chksum_tcpudp_ipv6_arm_simd (const void *, const void *,
+					      unsigned char, const void *,
+					      unsigned int);
+void __chksum_rewrite32_batch_arm_simd (void *const *, unsigned int,
+					unsigned int, unsigned int,
+					const unsigned int *, unsigned int,
+					unsigned int);
+#endif
+
+/* Bit-reflected CRC32 (IEEE 802.3) and CRC32C (Castagnoli).  The first
+   argument is the CRC of the preceding data, 0 initially.  */
+unsigned int __crc32 (unsigned int, const void *, unsigned int);
+unsigned int __crc32c (unsigned int, const void *, unsigned int);
+#if __aarch64__
+unsigned int __crc32_aarch64 (unsigned int, const void *, unsigned int);
+unsigned int __crc32c_aarch64 (unsigned int, const void *, unsigned int);
+#endif
+#if __x86_64__
+unsigned int __crc32_x86_64 (unsigned int, const void *, unsigned int);
+unsigned int __crc32c_x86_64 (unsigned int, const void *, unsigned int);
+#endif
+
+/* Adler-32 (RFC 1950) as in zlib, and Fletcher-64 of little-endian 32-bit
+   words, the last one zero-padded, with the second sum in the upper half.
+   The first argument is the checksum of the preceding data, 1 initially
+   for Adler-32 and 0 for Fletcher-64, whose preceding data must be a
+   multiple of 4 bytes.  */
+unsigned int __adler32 (unsigned int, const void *, unsigned int);
+unsigned long long __fletcher64 (unsigned long long, const void *,
+				 unsigned int);
+#if __aarch64__
+unsigned int __adler32_aarch64_simd (unsigned int, const void *,
+				     unsigned int);
+unsigned long long __fletcher64_aarch64_simd (unsigned long long,
+					      const void *, unsigned int);
+unsigned int __adler32_aarch64_sve (unsigned int, const void *,
+				    unsigned int);
+unsigned long long __fletcher64_aarch64_sve (unsigned long long,
+					     const void *, unsigned int);
+#endif
+
+/* Toeplitz hash for receive side scaling (RSS) of NBYTES bytes with a key
+   of KEYLEN bytes, at least NBYTES + 4, e.g. the usual 40-byte key for
+   TCP/UDP over IPv4 and IPv6 or a 52-byte key.  The tuple functions hash
+   the source and destination addresses and ports, in network byte order,
+   which needs a key of at least 16 bytes for IPv4 and 40 bytes for
+   IPv6.  */
+unsigned int __toeplitz_hash (const void *, unsigned int, const void *,
+			      unsigned int);
+void __toeplitz_hash_batch (const void *, unsigned int, const void *const *,
+			    unsigned int, unsigned int *, unsigned int);
+unsigned int __toeplitz_hash_ipv4 (const void *, unsigned int, unsigned int,
+				   unsigned int, unsigned short,
+				   unsigned short);
+unsigned int __toeplitz_hash_ipv6 (const void *, unsigned int, const void *,
+				   const void *, unsigned short,
+				   unsigned short);
+#if __aarch64__
+unsigned int __toeplitz_hash_aarch64_simd (const void *, unsigned int,
+					   const void *, unsigned int);
+void __toeplitz_hash_batch_aarch64_simd (const void *, unsigned int,
+					 const void *const *, unsigned int,
+					 unsigned int *, unsigned int);
+unsigned int __toeplitz_hash_ipv4_aarch64_simd (const void *, unsigned int,
+						unsigned int, unsigned int,
+						unsigned short,
+						unsigned short);
+unsigned int __toeplitz_hash_ipv6_aarch64_simd (const void *, unsigned int,
+						const void *, const void *,
+						unsigned short,
+						unsigned short);
+#endif
+
 #endif
@@ -1,7 +1,7 @@
 /*
  * Ones' complement checksum test & benchmark
  *
- * Copyright (c) 2016-2020, Arm Limited.
+ * Copyright (c) 2016-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -14,11 +14,16 @@
 #include <string.h>
 #if !defined (_WIN32)
 #  include <sys/mman.h>
+#  include <sys/uio.h>
 #else
 #  include <windows.h>
 #endif
 #include <time.h>
 #include <unistd.h>
+#if defined (__linux__)
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#endif
 #include "../include/networking.h"
 
 #if WANT_ASSERT
@@ -70,20 +75,120 @@ checksum_simple(const void *ptr, uint32_t nbytes)
     return (uint16_t) sum;
 }
 
+static uint16_t
+checksum_copy_simple(void *dst, const void *src, uint32_t nbytes)
+{
+    memcpy(dst, src, nbytes);
+    return checksum_simple(src, nbytes);
+}
+
+static void
+checksum_batch_simple(const void *const *ptrs, const unsigned int *lens,
+		      unsigned short *out, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; i++)
+    {
+	out[i] = checksum_simple(ptrs[i], lens[i]);
+    }
+}
+
+#define MAXPAYLOAD 9000
+static uint8_t pseudo_buf[40 + MAXPAYLOAD];
+
+/* Checksum of a copy of the pseudo-header followed by the payload */
+static uint16_t
+checksum_pseudo_simple(uint32_t hdrlen, const void *ptr, uint32_t nbytes)
+{
+    memcpy(pseudo_buf + hdrlen, ptr, nbytes);
+    return (uint16_t) ~checksum_simple(pseudo_buf, hdrlen + nbytes);
+}
+
+static unsigned short
+checksum_tcpudp_ipv4_simple(unsigned int saddr, unsigned int daddr,
+			    unsigned char proto, const void *ptr,
+			    unsigned int nbytes)
+{
+    memcpy(pseudo_buf, &saddr, 4);
+    memcpy(pseudo_buf + 4, &daddr, 4);
+    pseudo_buf[8] = 0;
+    pseudo_buf[9] = proto;
+    pseudo_buf[10] = (uint8_t) (nbytes >> 8);
+    pseudo_buf[11] = (uint8_t) nbytes;
+    return checksum_pseudo_simple(12, ptr, nbytes);
+}
+
+static unsigned short
+checksum_tcpudp_ipv6_simple(const void *saddr, const void *daddr,
+			    unsigned char proto, const void *ptr,
+			    unsigned int nbytes)
+{
+    memcpy(pseudo_buf, saddr, 16);
+    memcpy(pseudo_buf + 16, daddr, 16);
+    for (int i = 0; i < 4; i++)
+    {
+	pseudo_buf[32 + i] = (uint8_t) (nbytes >> (24 - 8 * i));
+    }
+    pseudo_buf[36] = pseudo_buf[37] = pseudo_buf[38] = 0;
+    pseudo_buf[39] = proto;
+    return checksum_pseudo_simple(40, ptr, nbytes);
+}
+
+#if !defined (_WIN32)
+#define IOV(x) x
+#else
+#define IOV(x) NULL
+#endif
+
 static struct
 {
     uint16_t (*cksum_fp)(const void *, uint32_t);
+    uint16_t (*cksum_copy_fp)(void *, const void *, uint32_t);
+    void (*cksum_update_fp)(struct chksum_state *, const void *, uint32_t);
+    uint16_t (*cksum_iov_fp)(const struct iovec *, int);
+    void (*cksum_batch_fp)(const void *const *, const unsigned int *,
+			   unsigned short *, unsigned int);
+    unsigned short (*cksum_ipv4_fp)(unsigned int, unsigned int,
+				    unsigned char, const void *,
+				    unsigned int);
+    unsigned short (*cksum_ipv6_fp)(const void *, const void *,
+				    unsigned char, const void *,
+				    unsigned int);
+    void (*cksum_rewrite_fp)(void *const *, unsigned int, unsigned int,
+			     unsigned int, const unsigned int *,
+			     unsigned int, unsigned int);
     const char *name;
 } implementations[] =
 {
-    { checksum_simple, "simple"},
-    { __chksum, "scalar"},
+    { checksum_simple, checksum_copy_simple, NULL, NULL,
+      checksum_batch_simple, checksum_tcpudp_ipv4_simple,
+      checksum_tcpudp_ipv6_simple, NULL, "simple"},
+    { __chksum, __chksum_copy, __chksum_update, IOV(__chksum_iov),
+      __chksum_batch, __chksum_tcpudp_ipv4, __chksum_tcpudp_ipv6,
+      __chksum_rewrite32_batch, "scalar"},
 #if __arm__ && __ARM_NEON
-    { __chksum_arm_simd, "simd" },
+    { __chksum_arm_simd, __chksum_copy_arm_simd, __chksum_update_arm_simd,
+      IOV(__chksum_iov_arm_simd), __chksum_batch_arm_simd,
+      __chksum_tcpudp_ipv4_arm_simd, __chksum_tcpudp_ipv6_arm_simd,
+      __chksum_rewrite32_batch_arm_simd, "simd" },
 #elif __aarch64__ && __ARM_NEON
-    { __chksum_aarch64_simd, "simd" },
+    { __chksum_aarch64_simd, __chksum_copy_aarch64_simd,
+      __chksum_update_aarch64_simd, IOV(__chksum_iov_aarch64_simd),
+      __chksum_batch_aarch64_simd, __chksum_tcpudp_ipv4_aarch64_simd,
+      __chksum_tcpudp_ipv6_aarch64_simd, __chksum_rewrite32_batch_aarch64_simd,
+      "simd" },
+#endif
+#if __aarch64__
+    { __chksum_aarch64_sve, NULL, NULL, NULL, NULL, NULL, NULL, NULL, "sve" },
+    { __chksum_aarch64_sve2, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+      "sve2" },
+#endif
+#if __x86_64__
+    { __chksum_x86_64_simd, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+      "sse2" },
+    { __chksum_x86_64_avx2, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+      "avx2" },
 #endif
-    { NULL, NULL}
+    { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}
 };
 
 static int
@@ -100,6 +205,11 @@ find_impl(const char *name)
 }
 
 static uint16_t (*CKSUM_FP)(const void *, uint32_t);
+static uint16_t (*CKSUM_COPY_FP)(void *, const void *, uint32_t);
+static void (*CKSUM_BATCH_FP)(const void *const *, const unsigned int *,
+			      unsigned short *, unsigned int);
+static bool COPY = false;
+static uint8_t *DSTBASE;
 static volatile uint16_t SINK;
 
 static bool
@@ -124,6 +234,329 @@ verify(const void *data, uint32_t offset, uint32_t size)
     return true;
 }
 
+#define GUARD 16
+
+/* Copy to DST and check that exactly SIZE bytes are written */
+static bool
+verify_copy(uint8_t *dst, const void *data, uint32_t offset, uint32_t size)
+{
+    memset(dst - GUARD, 0x5a, size + 2 * GUARD);
+    uint16_t csum_expected = checksum_simple(data, size);
+    uint16_t csum_actual = CKSUM_COPY_FP(dst, data, size);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid copy checksum for offset %u size %u: "
+		"actual %04x expected %04x (valid)",
+		offset, size, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < GUARD; i++)
+    {
+	if (dst[-1 - (int) i] != 0x5a || dst[size + i] != 0x5a)
+	{
+	    fprintf(stderr, "\nCopy for offset %u size %u writes outside "
+		    "destination", offset, size);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    if (memcmp(dst, data, size) != 0)
+    {
+	fprintf(stderr, "\nInvalid copy for offset %u size %u", offset, size);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+#define MAXSEGS 8
+#define MAXSEGLEN 1024
+
+/* Checksum random segments of the pool, given one at a time and as an
+   iovec, and compare with the checksum of their concatenation */
+static bool
+verify_segments(const uint8_t *base, size_t poolsize, uint32_t impl)
+{
+    static uint8_t concat[MAXSEGS * MAXSEGLEN];
+    const uint8_t *segs[MAXSEGS];
+    uint32_t lens[MAXSEGS];
+    int nsegs = 1 + rand() % MAXSEGS;
+    uint32_t total = 0;
+
+    for (int i = 0; i < nsegs; i++)
+    {
+	/* Mostly short segments, so odd lengths and offsets are common */
+	lens[i] = rand() % (rand() % 4 == 0 ? MAXSEGLEN : 64);
+	segs[i] = &base[rand() % (poolsize - MAXSEGLEN)];
+	memcpy(concat + total, segs[i], lens[i]);
+	total += lens[i];
+    }
+    uint16_t csum_expected = checksum_simple(concat, total);
+
+    struct chksum_state state;
+    __chksum_init(&state);
+    for (int i = 0; i < nsegs; i++)
+    {
+	implementations[impl].cksum_update_fp(&state, segs[i], lens[i]);
+    }
+    uint16_t csum_actual = __chksum_final(&state);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid checksum for %d segments size %u: "
+		"actual %04x expected %04x (valid)",
+		nsegs, total, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+
+#if !defined (_WIN32)
+    struct iovec iov[MAXSEGS];
+    for (int i = 0; i < nsegs; i++)
+    {
+	iov[i].iov_base = (void *) segs[i];
+	iov[i].iov_len = lens[i];
+    }
+    csum_actual = implementations[impl].cksum_iov_fp(iov, nsegs);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid iovec checksum for %d segments size %u: "
+		"actual %04x expected %04x (valid)",
+		nsegs, total, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+#endif
+    return true;
+}
+
+#define MAXBURST 64
+
+/* Checksum a burst of random buffers in one call.  Lengths are mostly
+   equal within a burst, as for a burst of packets of one flow */
+static bool
+verify_batch(const uint8_t *base, size_t poolsize)
+{
+    const void *ptrs[MAXBURST];
+    unsigned int lens[MAXBURST];
+    unsigned short out[MAXBURST + 1];
+    unsigned int n = rand() % (MAXBURST + 1);
+    unsigned int len = rand() % 300;
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+	lens[i] = rand() % 4 == 0 ? (unsigned) rand() % 300 : len;
+	ptrs[i] = &base[rand() % (poolsize - 300)];
+    }
+    out[n] = 0x5a5a;
+    CKSUM_BATCH_FP(ptrs, lens, out, n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+	uint16_t csum_expected = checksum_simple(ptrs[i], lens[i]);
+	if (out[i] != csum_expected)
+	{
+	    fprintf(stderr, "\nInvalid batch checksum for buffer %u of %u "
+		    "size %u: actual %04x expected %04x (valid)",
+		    i, n, lens[i], out[i], csum_expected);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    if (out[n] != 0x5a5a)
+    {
+	fprintf(stderr, "\nBatch of %u writes outside output", n);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+/* Check the IPv4 header checksum and the TCP/UDP checksums over a random
+   pseudo-header and payload */
+static bool
+verify_ip(const uint8_t *base, size_t poolsize, uint32_t impl)
+{
+    uint8_t hdr[20];
+    uint32_t nbytes = rand() % 8 == 0 ? rand() % MAXPAYLOAD : rand() % 1500;
+    const uint8_t *addrs = &base[rand() % (poolsize - 32)];
+    const uint8_t *payload = &base[rand() % (poolsize - MAXPAYLOAD)];
+    unsigned char proto = rand() % 2 ? 6 : 17;
+
+    /* A header with its checksum field set verifies as 0 */
+    memcpy(hdr, &base[rand() % (poolsize - 20)], 20);
+    hdr[10] = hdr[11] = 0;
+    uint16_t csum_expected = (uint16_t) ~checksum_simple(hdr, 20);
+    uint16_t csum_actual = __chksum_ipv4_header(hdr);
+    memcpy(&hdr[10], &csum_actual, 2);
+    if (csum_actual != csum_expected || __chksum_ipv4_header(hdr) != 0)
+    {
+	fprintf(stderr, "\nInvalid IPv4 header checksum: "
+		"actual %04x expected %04x (valid)",
+		csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+
+    uint32_t saddr, daddr;
+    memcpy(&saddr, addrs, 4);
+    memcpy(&daddr, addrs + 4, 4);
+    csum_expected = checksum_tcpudp_ipv4_simple(saddr, daddr, proto,
+						payload, nbytes);
+    csum_actual = implementations[impl].cksum_ipv4_fp(saddr, daddr, proto,
+						      payload, nbytes);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid IPv4 TCP/UDP checksum for size %u: "
+		"actual %04x expected %04x (valid)",
+		nbytes, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+
+    csum_expected = checksum_tcpudp_ipv6_simple(addrs, addrs + 16, proto,
+						payload, nbytes);
+    csum_actual = implementations[impl].cksum_ipv6_fp(addrs, addrs + 16,
+						      proto, payload, nbytes);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid IPv6 TCP/UDP checksum for size %u: "
+		"actual %04x expected %04x (valid)",
+		nbytes, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+#define PKTLEN 64
+
+/* Checksum field value for LEN bytes at PKT + OFF, with the checksum field
+   at PKT + CSUM taken as zero */
+static uint16_t
+checksum_field_simple(const uint8_t *pkt, uint32_t off, uint32_t len,
+		      uint32_t csum)
+{
+    uint8_t tmp[PKTLEN];
+    memcpy(tmp, pkt + off, len);
+    tmp[csum - off] = tmp[csum - off + 1] = 0;
+    return (uint16_t) ~checksum_simple(tmp, len);
+}
+
+/* Change a random 16-bit, 32-bit or 16-byte field of a packet and compare
+   the incrementally updated checksum with a full recomputation */
+static bool
+verify_replace(const uint8_t *base, size_t poolsize)
+{
+    static const uint32_t widths[] = { 2, 4, 16 };
+    uint8_t pkt[PKTLEN];
+    uint8_t new[16];
+    uint32_t width = widths[rand() % 3];
+    uint32_t csum = 2 * (rand() % (PKTLEN / 2));
+    uint32_t field;
+
+    do
+    {
+	field = 2 * (rand() % ((PKTLEN - width) / 2 + 1));
+    }
+    while (field <= csum + 1 && csum < field + width);
+    memcpy(pkt, &base[rand() % (poolsize - PKTLEN)], PKTLEN);
+    memcpy(new, &base[rand() % (poolsize - 16)], width);
+
+    uint16_t csum_old = checksum_field_simple(pkt, 0, PKTLEN, csum);
+    uint16_t csum_actual;
+    if (width == 2)
+    {
+	uint16_t old16, new16;
+	memcpy(&old16, pkt + field, 2);
+	memcpy(&new16, new, 2);
+	csum_actual = __chksum_replace16(csum_old, old16, new16);
+    }
+    else if (width == 4)
+    {
+	uint32_t old32, new32;
+	memcpy(&old32, pkt + field, 4);
+	memcpy(&new32, new, 4);
+	csum_actual = __chksum_replace32(csum_old, old32, new32);
+    }
+    else
+    {
+	csum_actual = __chksum_replace128(csum_old, pkt + field, new);
+    }
+    memcpy(pkt + field, new, width);
+    uint16_t csum_expected = checksum_field_simple(pkt, 0, PKTLEN, csum);
+    if (csum_actual != csum_expected)
+    {
+	fprintf(stderr, "\nInvalid incremental checksum for %u-byte field: "
+		"actual %04x expected %04x (valid)",
+		width, csum_actual, csum_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+/* Rewrite the source or destination address of a burst of packets with an
+   IPv4-like header checksum over bytes 0..19 at offset 10, and a TCP-like
+   or UDP-like checksum over bytes 12..63 at offset 28.  For UDP, some
+   packets have no checksum (0), which must stay 0, and some are adjusted so
+   that the new checksum comes out as 0, which must be written as 0xffff.  */
+static bool
+verify_rewrite(const uint8_t *base, size_t poolsize, uint32_t impl)
+{
+    static uint8_t pkts[MAXBURST][PKTLEN];
+    static uint8_t expected[MAXBURST][PKTLEN];
+    static const unsigned int csums[] = { 10, 28 };
+    void *ptrs[MAXBURST];
+    unsigned int n = rand() % (MAXBURST + 1);
+    unsigned int field = rand() % 2 ? 12 : 16;
+    unsigned int udp = rand() % 2 ? 2 : 0;
+    uint32_t value;
+
+    memcpy(&value, &base[rand() % (poolsize - 4)], 4);
+    for (unsigned int i = 0; i < n; i++)
+    {
+	uint8_t *pkt = pkts[i];
+	unsigned int kind = udp ? rand() % 4 : 0;
+	memcpy(pkt, &base[rand() % (poolsize - PKTLEN)], PKTLEN);
+	memcpy(expected[i], pkt, PKTLEN);
+	memcpy(expected[i] + field, &value, 4);
+	uint16_t csum1 = checksum_field_simple(expected[i], 12, PKTLEN - 12, 28);
+	if (kind == 1 && csum1 != 0)
+	{
+	    /* Add the new checksum to a word of data that is not rewritten,
+	       so that the new sum is all ones and its checksum is 0 */
+	    uint16_t word;
+	    memcpy(&word, pkt + 32, 2);
+	    uint32_t sum = (uint32_t) word + csum1;
+	    word = (uint16_t) (sum + (sum >> 16));
+	    memcpy(pkt + 32, &word, 2);
+	    memcpy(expected[i] + 32, &word, 2);
+	}
+	uint16_t csum0 = checksum_field_simple(pkt, 0, 20, 10);
+	csum1 = kind == 2 ? 0 : checksum_field_simple(pkt, 12, PKTLEN - 12, 28);
+	if (udp && kind != 2 && csum1 == 0)
+	{
+	    csum1 = 0xffff;
+	}
+	memcpy(pkt + 10, &csum0, 2);
+	memcpy(pkt + 28, &csum1, 2);
+
+	csum0 = checksum_field_simple(expected[i], 0, 20, 10);
+	if (kind != 2)
+	{
+	    csum1 = checksum_field_simple(expected[i], 12, PKTLEN - 12, 28);
+	    if (udp && csum1 == 0)
+	    {
+		csum1 = 0xffff;
+	    }
+	}
+	memcpy(expected[i] + 10, &csum0, 2);
+	memcpy(expected[i] + 28, &csum1, 2);
+	ptrs[i] = pkt;
+    }
+    implementations[impl].cksum_rewrite_fp(ptrs, n, field, value, csums, 2,
+					   udp);
+    for (unsigned int i = 0; i < n; i++)
+    {
+	if (memcmp(pkts[i], expected[i], PKTLEN) != 0)
+	{
+	    fprintf(stderr, "\nInvalid rewrite of %s packet %u of %u",
+		    udp ? "UDP" : "TCP", i, n);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    return true;
+}
+
 static uint64_t
 clock_get_ns(void)
 {
@@ -132,6 +565,113 @@ clock_get_ns(void)
     return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
 }
 
+/* CPU cycles of this thread in user space from the perf cycle counter,
+   where available.  The AArch64 generic timer (CNTVCT_EL0) is not used as
+   it counts at a fixed frequency, not in cycles of the core.  */
+static int PERF_FD = -1;
+
+static bool
+cycles_open(void)
+{
+#if defined (__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof attr;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    PERF_FD = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    return PERF_FD >= 0;
+}
+
+static uint64_t
+cycles_get(void)
+{
+    uint64_t count = 0;
+    if (PERF_FD >= 0 && read(PERF_FD, &count, sizeof count) != sizeof count)
+    {
+	perror("read"), exit(EXIT_FAILURE);
+    }
+    return count;
+}
+
+/* Packet sizes to replay, in proportion to a histogram given with -s */
+#define NUMSIZES 4096
+#define MAXBUCKETS 64
+static uint16_t SIZES[NUMSIZES];
+static bool DIST = false;
+/* Stream through the pool instead of reading random packets from it */
+static bool COLD = false;
+
+/* Simple IMIX: 7 parts 40-byte, 4 parts 576-byte, 1 part 1500-byte */
+static const char IMIX[] = "40:7,576:4,1500:1";
+
+/* Parse a histogram of the form size:weight,size:weight,... (a missing
+   weight is 1) into SIZES, and return the average size or 0 if invalid */
+static uint32_t
+parse_sizes(const char *spec, uint32_t maxsize)
+{
+    uint32_t sizes[MAXBUCKETS];
+    uint64_t weights[MAXBUCKETS];
+    uint32_t nbuckets = 0;
+    uint64_t total = 0;
+
+    if (strcmp(spec, "imix") == 0)
+    {
+	spec = IMIX;
+    }
+    while (*spec != '\0')
+    {
+	char *end;
+	unsigned long size = strtoul(spec, &end, 10);
+	unsigned long weight = 1;
+	if (end != spec && *end == ':')
+	{
+	    weight = strtoul(end + 1, &end, 10);
+	}
+	if (size == 0 || size > maxsize || size > UINT16_MAX ||
+	    weight == 0 || weight > 1000000 ||
+	    nbuckets == MAXBUCKETS || (*end != ',' && *end != '\0'))
+	{
+	    return 0;
+	}
+	sizes[nbuckets] = size;
+	weights[nbuckets] = weight;
+	total += weight;
+	nbuckets++;
+	spec = *end == ',' ? end + 1 : end;
+    }
+    if (nbuckets == 0)
+    {
+	return 0;
+    }
+
+    /* Fill SIZES in proportion to the weights, then shuffle it */
+    uint64_t sumsizes = 0;
+    uint64_t cumulative = weights[0];
+    for (uint32_t i = 0, b = 0; i < NUMSIZES; i++)
+    {
+	while (i * total >= cumulative * NUMSIZES)
+	{
+	    cumulative += weights[++b];
+	}
+	SIZES[i] = sizes[b];
+	sumsizes += sizes[b];
+    }
+    for (uint32_t i = NUMSIZES - 1; i > 0; i--)
+    {
+	uint32_t j = rand() % (i + 1);
+	uint16_t tmp = SIZES[i];
+	SIZES[i] = SIZES[j];
+	SIZES[j] = tmp;
+    }
+    return sumsizes / NUMSIZES;
+}
+
+/* Measure checksumming NUMOPS packets of BLKSIZE bytes, or of the sizes
+   in SIZES.  If CPUFREQ is 0, cycles are read from the cycle counter */
 static void
 benchmark(const uint8_t *base,
 	  size_t poolsize,
@@ -139,55 +679,157 @@ benchmark(const uint8_t *base,
 	  uint32_t numops,
 	  uint64_t cpufreq)
 {
-    printf("%11u ", (unsigned int) blksize); fflush(stdout);
+    if (DIST)
+    {
+	printf("%11s ", "mix");
+    }
+    else
+    {
+	printf("%11u ", (unsigned int) blksize);
+    }
+    fflush(stdout);
 
+    uint64_t accbytes = 0;
+    size_t stream = 0;
     uint64_t start = clock_get_ns();
+    uint64_t start_cycles = cycles_get();
     for (uint32_t i = 0; i < numops; i ++)
     {
+	uint32_t size = DIST ? SIZES[i % NUMSIZES] : blksize;
+	size_t offset;
+	if (COLD)
+	{
+	    /* Each packet starts at a new cache line */
+	    if (stream + size > poolsize)
+	    {
+		stream = 0;
+	    }
+	    offset = stream;
+	    stream += ALIGN(size, CACHE_LINE);
+	}
+	else
+	{
+	    /* Read a random value from the pool */
+	    uint32_t random = ((uint32_t *) base)[i % (poolsize / 4)];
+	    /* Generate a random starting address */
+	    offset = random % (poolsize - size);
+	}
+	const void *data = &base[offset];
+	if (COPY)
+	{
+	    /* Copy to a cache line aligned destination */
+	    uint8_t *dst = COLD ? &DSTBASE[offset]
+			       : &DSTBASE[(i * CACHE_LINE) % (poolsize - size)];
+	    SINK = CKSUM_COPY_FP(dst, data, size);
+	}
+	else
+	{
+	    SINK = CKSUM_FP(data, size);
+	}
+	accbytes += size;
+    }
+    uint64_t elapsed_cycles = cycles_get() - start_cycles;
+    uint64_t elapsed_ns = clock_get_ns() - start;
+    if (cpufreq != 0)
+    {
+	elapsed_cycles = (double) elapsed_ns * cpufreq / 1000000000;
+    }
+
+    elapsed_ns += elapsed_ns == 0;
+    printf("%11ju ", (uintmax_t) (accbytes * 1000 / elapsed_ns));
+    printf("%11ju ", (uintmax_t) (elapsed_cycles / numops));
+    if (accbytes != 0)
+    {
+	uint64_t cyc_per_byte = 1000 * elapsed_cycles / accbytes;
+	printf("%7ju.%03u ",
+		(uintmax_t) cyc_per_byte / 1000,
+		(unsigned int) (cyc_per_byte % 1000));
+    }
+    printf("\n");
+}
+
+#define NUMPTRS 4096
+
+/* Measure the packet rate of checksumming bursts of BURST packets of
+   BLKSIZE bytes or of the sizes in SIZES, one call per packet and one call
+   per burst */
+static void
+benchmark_batch(const uint8_t *base,
+		size_t poolsize,
+		uint32_t blksize,
+		uint32_t burst,
+		uint32_t numops)
+{
+    static const void *ptrs[NUMPTRS];
+    static unsigned int lens[NUMPTRS];
+    unsigned short out[MAXBURST];
+
+    if (DIST)
+    {
+	printf("%11s %11u ", "mix", (unsigned int) burst);
+    }
+    else
+    {
+	printf("%11u %11u ", (unsigned int) blksize, (unsigned int) burst);
+    }
+    fflush(stdout);
+    for (uint32_t i = 0; i < NUMPTRS; i++)
+    {
+	lens[i] = DIST ? SIZES[i % NUMSIZES] : blksize;
 	/* Read a random value from the pool */
 	uint32_t random = ((uint32_t *) base)[i % (poolsize / 4)];
 	/* Generate a random starting address */
-	const void *data = &base[random % (poolsize - blksize)];
-	SINK = CKSUM_FP(data, blksize);
+	ptrs[i] = &base[random % (poolsize - lens[i])];
+    }
+    numops -= numops % burst;
+
+    uint64_t start = clock_get_ns();
+    for (uint32_t i = 0; i < numops; i += burst)
+    {
+	uint32_t first = i % (NUMPTRS - MAXBURST);
+	for (uint32_t j = 0; j < burst; j++)
+	{
+	    out[j] = CKSUM_FP(ptrs[first + j], lens[first + j]);
+	}
+	SINK = out[burst - 1];
     }
-    uint64_t end = clock_get_ns();
+    uint64_t elapsed_single = clock_get_ns() - start;
 
-#define MEGABYTE 1000000 /* Decimal megabyte (MB) */
-    uint64_t elapsed_ns = end - start;
-    uint64_t elapsed_ms = elapsed_ns / 1000000;
-    uint32_t blks_per_s = (uint32_t) ((numops / elapsed_ms) * 1000);
-    uint64_t accbytes = (uint64_t) numops * blksize;
-    printf("%11ju ", (uintmax_t) ((accbytes / elapsed_ms) * 1000) / MEGABYTE);
-    unsigned int cyc_per_blk = cpufreq / blks_per_s;
-    printf("%11u ", cyc_per_blk);
-    if (blksize != 0)
+    start = clock_get_ns();
+    for (uint32_t i = 0; i < numops; i += burst)
     {
-	unsigned int cyc_per_byte = 1000 * cyc_per_blk / blksize;
-	printf("%7u.%03u ",
-		cyc_per_byte / 1000, cyc_per_byte % 1000);
+	uint32_t first = i % (NUMPTRS - MAXBURST);
+	CKSUM_BATCH_FP(&ptrs[first], &lens[first], out, burst);
+	SINK = out[burst - 1];
     }
-    printf("\n");
+    uint64_t elapsed_batch = clock_get_ns() - start;
+
+    /* Packets per microsecond is million packets per second */
+    printf("%11.2f %11.2f\n",
+	   numops * 1000.0 / elapsed_single, numops * 1000.0 / elapsed_batch);
 }
 
 int main(int argc, char *argv[])
 {
     int c;
     bool DUMP = false;
+    bool MPPS = false;
     uint32_t IMPL = 0;/* Simple implementation */
     uint64_t CPUFREQ = 0;
     uint32_t BLKSIZE = 0;
     uint32_t NUMOPS = 1000000;
-    uint32_t POOLSIZE = 512 * 1024;/* Typical ARM L2 cache size */
+    uint32_t POOLSIZE = 0;
+    const char *SIZESPEC = NULL;
 
     setvbuf(stdout, NULL, _IOLBF, 160);
-    while ((c = getopt(argc, argv, "b:df:i:n:p:")) != -1)
+    while ((c = getopt(argc, argv, "b:cCdf:i:mn:p:s:")) != -1)
     {
 	switch (c)
 	{
 	    case 'b' :
 		{
 		    int blksize = atoi(optarg);
-		    if (blksize < 1 || blksize > POOLSIZE / 2)
+		    if (blksize < 1)
 		    {
 			fprintf(stderr, "Invalid block size %d\n", blksize);
 			exit(EXIT_FAILURE);
@@ -195,6 +837,12 @@ int main(int argc, char *argv[])
 		    BLKSIZE = (unsigned) blksize;
 		    break;
 		}
+	    case 'c' :
+		COPY = true;
+		break;
+	    case 'C' :
+		COLD = true;
+		break;
 	    case 'd' :
 		DUMP = true;
 		break;
@@ -221,6 +869,9 @@ int main(int argc, char *argv[])
 		    IMPL = (unsigned) impl;
 		    break;
 		}
+	    case 'm' :
+		MPPS = true;
+		break;
 	    case 'n' :
 		{
 		    int numops = atoi(optarg);
@@ -255,15 +906,24 @@ int main(int argc, char *argv[])
 		    }
 		    break;
 		}
+	    case 's' :
+		SIZESPEC = optarg;
+		break;
 	    default :
 usage :
 		fprintf(stderr, "Usage: checksum <options>\n"
 			"-b <blksize>    Block size\n"
+			"-c              Benchmark checksum and copy\n"
+			"-C              Cache-cold: stream through the pool\n"
 			"-d              Dump first 96 bytes of data\n"
-			"-f <cpufreq>    CPU frequency (Hz)\n"
+			"-f <cpufreq>    CPU frequency (Hz), instead of\n"
+			"                reading the cycle counter\n"
 			"-i <impl>       Implementation\n"
+			"-m              Benchmark packet rate of bursts\n"
 			"-n <numops>     Number of operations\n"
 			"-p <poolsize>   Pool size (K or M suffix)\n"
+			"-s <sizes>      Packet sizes, imix or\n"
+			"                size:weight,size:weight,...\n"
 		       );
 		printf("Implementations:");
 		for (int i = 0; implementations[i].name != NULL; i++)
@@ -280,7 +940,36 @@ usage :
     }
 
     CKSUM_FP = implementations[IMPL].cksum_fp;
+    CKSUM_COPY_FP = implementations[IMPL].cksum_copy_fp;
+    CKSUM_BATCH_FP = implementations[IMPL].cksum_batch_fp;
+    if ((COPY && CKSUM_COPY_FP == NULL) || (MPPS && CKSUM_BATCH_FP == NULL))
+    {
+	fprintf(stderr, "%s not supported by implementation %s\n",
+		COPY ? "Copy" : "Batch", implementations[IMPL].name);
+	exit(EXIT_FAILURE);
+    }
+    if (POOLSIZE == 0)
+    {
+	/* Typical ARM L2 cache size, or larger than the last level cache */
+	POOLSIZE = COLD ? 256 * 1024 * 1024 : 512 * 1024;
+    }
     POOLSIZE = ALIGN(POOLSIZE, CACHE_LINE);
+    if (BLKSIZE > POOLSIZE / 2)
+    {
+	fprintf(stderr, "Invalid block size %u\n", BLKSIZE);
+	exit(EXIT_FAILURE);
+    }
+    uint32_t avgsize = 0;
+    if (SIZESPEC != NULL)
+    {
+	avgsize = parse_sizes(SIZESPEC, POOLSIZE / 2);
+	if (avgsize == 0)
+	{
+	    fprintf(stderr, "Invalid packet sizes %s\n", SIZESPEC);
+	    exit(EXIT_FAILURE);
+	}
+	DIST = true;
+    }
 #if !defined (_WIN32)
     uint8_t *base = mmap(0, POOLSIZE, PROT_READ|PROT_WRITE,
 			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
@@ -300,6 +989,12 @@ usage :
     {
 	((uint32_t *) base)[i] = rand();
     }
+    uint8_t *dstbuf = malloc(POOLSIZE + 2 * CACHE_LINE);
+    if (dstbuf == NULL)
+    {
+	perror("malloc"), exit(EXIT_FAILURE);
+    }
+    DSTBASE = (uint8_t *) ALIGN((uintptr_t) dstbuf, CACHE_LINE) + CACHE_LINE;
 
     printf("Implementation: %s\n", implementations[IMPL].name);
     printf("numops %u, poolsize ", NUMOPS);
@@ -315,8 +1010,14 @@ usage :
     {
 	printf("%uB", POOLSIZE);
     }
-    printf(", blocksize %u, CPU frequency %juMHz\n",
-	   BLKSIZE, (uintmax_t) (CPUFREQ / 1000000));
+    printf(", blocksize %u, CPU frequency %juMHz%s%s\n",
+	   BLKSIZE, (uintmax_t) (CPUFREQ / 1000000), COPY ? ", copy" : "",
+	   COLD ? ", cold" : "");
+    if (DIST)
+    {
+	printf("Packet sizes %s, average %u\n",
+	       strcmp(SIZESPEC, "imix") == 0 ? IMIX : SIZESPEC, avgsize);
+    }
 #if WANT_ASSERT
     printf("Warning: assertions are enabled\n");
 #endif
@@ -356,35 +1057,116 @@ usage :
     }
     /* Check the full size, this can detect accumulator overflows */
     success &= verify(base, 0, POOLSIZE);
-    printf("%s\n", success ? "OK" : "failure");
-
-    /* Print throughput in decimal megabyte (1000000B) per second */
-    if (CPUFREQ != 0)
+    /* Check checksum and copy for all (relevant) source and destination
+       offsets */
+    if (CKSUM_COPY_FP != NULL)
     {
-	printf("%11s %11s %11s %11s\n",
-	       "block size", "MB/s", "cycles/blk", "cycles/byte");
+	for (int size = 0; size <= 256; size++)
+	{
+	    for (int offset = 0; offset < 64; offset++)
+	    {
+		uint8_t *dst = DSTBASE + (offset * 7) % 16;
+		success &= verify_copy(dst, &base[offset], offset, size);
+		uint8_t *p = base + POOLSIZE - (size + offset);
+		success &= verify_copy(dst, p, (uintptr_t) p % 64, size);
+	    }
+	}
+	for (size_t size = 1; size < POOLSIZE - CACHE_LINE; size *= 2)
+	{
+	    success &= verify_copy(DSTBASE + 3, base + 1, 1, size);
+	}
     }
-    else
+    /* Check segmented checksums */
+    if (implementations[IMPL].cksum_update_fp != NULL)
     {
-	printf("%11s %11s %11s %11s\n",
-	       "block size", "MB/s", "ns/blk", "ns/byte");
-	CPUFREQ = 1000000000;
+	for (int i = 0; i < 100000; i++)
+	{
+	    success &= verify_segments(base, POOLSIZE, IMPL);
+	}
+    }
+    /* Check batched checksums */
+    if (CKSUM_BATCH_FP != NULL)
+    {
+	for (int i = 0; i < 10000; i++)
+	{
+	    success &= verify_batch(base, POOLSIZE);
+	}
     }
-    if (BLKSIZE != 0)
+    /* Check IP header and pseudo-header checksums */
+    if (implementations[IMPL].cksum_ipv4_fp != NULL)
     {
-	benchmark(base, POOLSIZE, BLKSIZE, NUMOPS, CPUFREQ);
+	for (int i = 0; i < 10000; i++)
+	{
+	    success &= verify_ip(base, POOLSIZE, IMPL);
+	}
+    }
+    /* Check incremental checksum updates */
+    for (int i = 0; i < 100000; i++)
+    {
+	success &= verify_replace(base, POOLSIZE);
+    }
+    if (implementations[IMPL].cksum_rewrite_fp != NULL)
+    {
+	for (int i = 0; i < 10000; i++)
+	{
+	    success &= verify_rewrite(base, POOLSIZE, IMPL);
+	}
+    }
+    printf("%s\n", success ? "OK" : "failure");
+
+    if (MPPS)
+    {
+	/* Print packet rate in million packets per second */
+	static const uint16_t bursts[] = { 8, 32, 64, 0 };
+	static const uint16_t sizes[] = { 64, 128, 0 };
+	printf("%11s %11s %11s %11s\n",
+	       "block size", "burst", "Mpps", "Mpps batch");
+	for (int i = 0; (BLKSIZE != 0 || DIST ? i < 1 : sizes[i] != 0); i++)
+	{
+	    for (int j = 0; bursts[j] != 0; j++)
+	    {
+		benchmark_batch(base, POOLSIZE,
+				BLKSIZE != 0 ? BLKSIZE : sizes[i], bursts[j],
+				NUMOPS * 10);
+	    }
+	}
     }
     else
     {
-	static const uint16_t sizes[] =
-	    { 20, 42, 102, 250, 612, 1500, 3674, 9000, 0 };
-	for (int i = 0; sizes[i] != 0; i++)
+	/* Print throughput in decimal megabyte (1000000B) per second */
+	if (CPUFREQ != 0 || cycles_open())
+	{
+	    printf("%11s %11s %11s %11s\n",
+		   "block size", "MB/s", "cycles/blk", "cycles/byte");
+	}
+	else
+	{
+	    printf("%11s %11s %11s %11s\n",
+		   "block size", "MB/s", "ns/blk", "ns/byte");
+	    CPUFREQ = 1000000000;
+	}
+	if (DIST)
+	{
+	    uint32_t numops = NUMOPS * 10000 / (40 + avgsize);
+	    benchmark(base, POOLSIZE, 0, numops, CPUFREQ);
+	}
+	else if (BLKSIZE != 0)
+	{
+	    benchmark(base, POOLSIZE, BLKSIZE, NUMOPS, CPUFREQ);
+	}
+	else
 	{
-	    uint32_t numops = NUMOPS * 10000 / (40 + sizes[i]);
-	    benchmark(base, POOLSIZE, sizes[i], numops, CPUFREQ);
+	    static const uint16_t sizes[] =
+		{ 20, 42, 102, 250, 612, 1500, 3674, 9000, 0 };
+	    for (int i = 0; sizes[i] != 0; i++)
+	    {
+		uint32_t numops = NUMOPS * 10000 / (40 + sizes[i]);
+		benchmark(base, POOLSIZE, sizes[i], numops, CPUFREQ);
+	    }
 	}
     }
 
+    free(dstbuf);
 #if !defined (_WIN32)
     if (munmap(base, POOLSIZE) != 0)
     {
@@ -0,0 +1,419 @@
+/*
+ * CRC32 and CRC32C test & benchmark
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined (_WIN32)
+#  include <sys/mman.h>
+#else
+#  include <windows.h>
+#endif
+#include <time.h>
+#include <unistd.h>
+#include "../include/networking.h"
+
+#define CACHE_LINE 64
+#define ALIGN(x, y) (((x) + (y) - 1) & ~((y) - 1))
+
+/* Reference implementation - do not modify! */
+static uint32_t
+crc_simple(uint32_t poly, uint32_t crc, const void *ptr, uint32_t nbytes)
+{
+    const uint8_t *cptr = ptr;
+
+    crc = ~crc;
+    while (nbytes-- != 0)
+    {
+	crc ^= *cptr++;
+	for (int i = 0; i < 8; i++)
+	{
+	    crc = (crc >> 1) ^ (crc & 1 ? poly : 0);
+	}
+    }
+    return ~crc;
+}
+
+static unsigned int
+crc32_simple(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return crc_simple(0xedb88320, crc, ptr, nbytes);
+}
+
+static unsigned int
+crc32c_simple(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    return crc_simple(0x82f63b78, crc, ptr, nbytes);
+}
+
+static struct
+{
+    unsigned int (*crc32_fp)(unsigned int, const void *, unsigned int);
+    unsigned int (*crc32c_fp)(unsigned int, const void *, unsigned int);
+    const char *name;
+} implementations[] =
+{
+    { crc32_simple, crc32c_simple, "simple"},
+    { __crc32, __crc32c, "scalar"},
+#if __aarch64__
+    { __crc32_aarch64, __crc32c_aarch64, "hw" },
+#elif __x86_64__
+    { __crc32_x86_64, __crc32c_x86_64, "hw" },
+#endif
+    { NULL, NULL, NULL}
+};
+
+static int
+find_impl(const char *name)
+{
+    for (int i = 0; implementations[i].name != NULL; i++)
+    {
+	if (strcmp(implementations[i].name, name) == 0)
+	{
+	    return i;
+	}
+    }
+    return -1;
+}
+
+static unsigned int (*CRC32_FP)(unsigned int, const void *, unsigned int);
+static unsigned int (*CRC32C_FP)(unsigned int, const void *, unsigned int);
+static volatile uint32_t SINK;
+
+static bool
+verify(const void *data, uint32_t offset, uint32_t size)
+{
+    uint32_t init = offset * 0x9e3779b9;
+    uint32_t crc_expected = crc32_simple(init, data, size);
+    uint32_t crc_actual = CRC32_FP(init, data, size);
+    if (crc_actual != crc_expected)
+    {
+	fprintf(stderr, "\nInvalid CRC32 for offset %u size %u: "
+		"actual %08x expected %08x (valid)",
+		offset, size, crc_actual, crc_expected);
+	exit(EXIT_FAILURE);
+    }
+    crc_expected = crc32c_simple(init, data, size);
+    crc_actual = CRC32C_FP(init, data, size);
+    if (crc_actual != crc_expected)
+    {
+	fprintf(stderr, "\nInvalid CRC32C for offset %u size %u: "
+		"actual %08x expected %08x (valid)",
+		offset, size, crc_actual, crc_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+/* The CRC of a buffer split in two must be the CRC of the whole buffer */
+static bool
+verify_split(const void *data, uint32_t size, uint32_t split)
+{
+    uint32_t crc_expected = CRC32_FP(0, data, size);
+    uint32_t crc_actual = CRC32_FP(CRC32_FP(0, data, split),
+				   (const char *) data + split, size - split);
+    if (crc_actual != crc_expected)
+    {
+	fprintf(stderr, "\nInvalid CRC32 for size %u split at %u: "
+		"actual %08x expected %08x (valid)",
+		size, split, crc_actual, crc_expected);
+	exit(EXIT_FAILURE);
+    }
+    crc_expected = CRC32C_FP(0, data, size);
+    crc_actual = CRC32C_FP(CRC32C_FP(0, data, split),
+			   (const char *) data + split, size - split);
+    if (crc_actual != crc_expected)
+    {
+	fprintf(stderr, "\nInvalid CRC32C for size %u split at %u: "
+		"actual %08x expected %08x (valid)",
+		size, split, crc_actual, crc_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+static uint64_t
+clock_get_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t
+benchmark_fp(unsigned int (*fp)(unsigned int, const void *, unsigned int),
+	     const uint8_t *base, size_t poolsize, uint32_t blksize,
+	     uint32_t numops)
+{
+    uint32_t crc = 0;
+    uint64_t start = clock_get_ns();
+    for (uint32_t i = 0; i < numops; i ++)
+    {
+	/* Read a random value from the pool */
+	uint32_t random = ((uint32_t *) base)[i % (poolsize / 4)];
+	/* Generate a random starting address */
+	const void *data = &base[random % (poolsize - blksize)];
+	crc = fp(crc, data, blksize);
+    }
+    SINK = crc;
+    return clock_get_ns() - start;
+}
+
+static void
+benchmark(const uint8_t *base,
+	  size_t poolsize,
+	  uint32_t blksize,
+	  uint32_t numops,
+	  uint64_t cpufreq)
+{
+    printf("%11u ", (unsigned int) blksize); fflush(stdout);
+
+#define MEGABYTE 1000000 /* Decimal megabyte (MB) */
+    uint64_t accbytes = (uint64_t) numops * blksize;
+    for (int c = 0; c < 2; c++)
+    {
+	uint64_t elapsed_ns = benchmark_fp(c == 0 ? CRC32_FP : CRC32C_FP,
+					   base, poolsize, blksize, numops);
+	uint64_t elapsed_ms = elapsed_ns / 1000000 + 1;
+	printf("%11ju ",
+	       (uintmax_t) ((accbytes / elapsed_ms) * 1000) / MEGABYTE);
+	unsigned int cyc_per_byte =
+	    (double) cpufreq * elapsed_ns / 1000000 / accbytes;
+	printf("%7u.%03u ", cyc_per_byte / 1000, cyc_per_byte % 1000);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+    uint32_t IMPL = 0;/* Simple implementation */
+    uint64_t CPUFREQ = 0;
+    uint32_t BLKSIZE = 0;
+    uint32_t NUMOPS = 1000000;
+    uint32_t POOLSIZE = 512 * 1024;/* Typical ARM L2 cache size */
+
+    setvbuf(stdout, NULL, _IOLBF, 160);
+    while ((c = getopt(argc, argv, "b:f:i:n:p:")) != -1)
+    {
+	switch (c)
+	{
+	    case 'b' :
+		{
+		    int blksize = atoi(optarg);
+		    if (blksize < 1 || blksize > POOLSIZE / 2)
+		    {
+			fprintf(stderr, "Invalid block size %d\n", blksize);
+			exit(EXIT_FAILURE);
+		    }
+		    BLKSIZE = (unsigned) blksize;
+		    break;
+		}
+	    case 'f' :
+		{
+		    int64_t cpufreq = atoll(optarg);
+		    if (cpufreq < 1)
+		    {
+			fprintf(stderr, "Invalid CPU frequency %"PRId64"\n",
+				cpufreq);
+			exit(EXIT_FAILURE);
+		    }
+		    CPUFREQ = cpufreq;
+		    break;
+		}
+	    case 'i' :
+		{
+		    int impl = find_impl(optarg);
+		    if (impl < 0)
+		    {
+			fprintf(stderr, "Invalid implementation %s\n", optarg);
+			goto usage;
+		    }
+		    IMPL = (unsigned) impl;
+		    break;
+		}
+	    case 'n' :
+		{
+		    int numops = atoi(optarg);
+		    if (numops < 1)
+		    {
+			fprintf(stderr, "Invalid number of operations %d\n", numops);
+			exit(EXIT_FAILURE);
+		    }
+		    NUMOPS = (unsigned) numops;
+		    break;
+		}
+	    case 'p' :
+		{
+		    int poolsize = atoi(optarg);
+		    if (poolsize < 4096)
+		    {
+			fprintf(stderr, "Invalid pool size %d\n", poolsize);
+			exit(EXIT_FAILURE);
+		    }
+		    char c = optarg[strlen(optarg) - 1];
+		    if (c == 'M')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024 * 1024;
+		    }
+		    else if (c == 'K')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024;
+		    }
+		    else
+		    {
+			POOLSIZE = (unsigned) poolsize;
+		    }
+		    break;
+		}
+	    default :
+usage :
+		fprintf(stderr, "Usage: crc32 <options>\n"
+			"-b <blksize>    Block size\n"
+			"-f <cpufreq>    CPU frequency (Hz)\n"
+			"-i <impl>       Implementation\n"
+			"-n <numops>     Number of operations\n"
+			"-p <poolsize>   Pool size (K or M suffix)\n"
+		       );
+		printf("Implementations:");
+		for (int i = 0; implementations[i].name != NULL; i++)
+		{
+		    printf(" %s", implementations[i].name);
+		}
+		printf("\n");
+		exit(EXIT_FAILURE);
+	}
+    }
+    if (optind > argc)
+    {
+	goto usage;
+    }
+
+    CRC32_FP = implementations[IMPL].crc32_fp;
+    CRC32C_FP = implementations[IMPL].crc32c_fp;
+    POOLSIZE = ALIGN(POOLSIZE, CACHE_LINE);
+#if !defined (_WIN32)
+    uint8_t *base = mmap(0, POOLSIZE, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+	perror("aligned_alloc"), exit(EXIT_FAILURE);
+    }
+#else
+    uint8_t *base = VirtualAlloc(0, POOLSIZE, MEM_RESERVE|MEM_COMMIT,
+				 PAGE_READWRITE);
+    if (base == 0)
+    {
+	perror("VirtualAlloc"), exit(EXIT_FAILURE);
+    }
+#endif
+    for (size_t i = 0; i < POOLSIZE / 4; i++)
+    {
+	((uint32_t *) base)[i] = rand();
+    }
+
+    printf("Implementation: %s\n", implementations[IMPL].name);
+    printf("numops %u, poolsize ", NUMOPS);
+    if (POOLSIZE % (1024 * 1024) == 0)
+    {
+	printf("%uMiB", POOLSIZE / (1024 * 1024));
+    }
+    else if (POOLSIZE % 1024 == 0)
+    {
+	printf("%uKiB", POOLSIZE / 1024);
+    }
+    else
+    {
+	printf("%uB", POOLSIZE);
+    }
+    printf(", blocksize %u, CPU frequency %juMHz\n",
+	   BLKSIZE, (uintmax_t) (CPUFREQ / 1000000));
+
+    printf("Verifying..."); fflush(stdout);
+    bool success = true;
+    /* Check the standard check values */
+    success &= CRC32_FP(0, "123456789", 9) == 0xcbf43926;
+    success &= CRC32C_FP(0, "123456789", 9) == 0xe3069283;
+    /* Check all (relevant) combinations of size and offset */
+    for (int size = 0; size <= 256; size++)
+    {
+	for (int offset = 0; offset < 64; offset++)
+	{
+	    /* Check at start of mapped memory */
+	    success &= verify(&base[offset], offset, size);
+	    /* Check at end of mapped memory */
+	    uint8_t *p = base + POOLSIZE - (size + offset);
+	    success &= verify(p, (uintptr_t) p % 64, size);
+	}
+    }
+    /* Check sizes around the interleaved block sizes */
+    for (int size = 700; size <= 2400; size += 5)
+    {
+	success &= verify(base + size % 16, size % 16, size);
+    }
+    /* Check increasingly larger sizes */
+    for (size_t size = 1; size < POOLSIZE; size *= 2)
+    {
+	success &= verify(base, 0, size);
+    }
+    success &= verify(base, 0, POOLSIZE);
+    /* Check continuing a CRC */
+    for (int i = 0; i < 1000; i++)
+    {
+	uint32_t size = rand() % 8192;
+	uint32_t split = size != 0 ? rand() % size : 0;
+	success &= verify_split(base + rand() % 64, size, split);
+    }
+    printf("%s\n", success ? "OK" : "failure");
+
+    /* Print throughput in decimal megabyte (1000000B) per second */
+    if (CPUFREQ != 0)
+    {
+	printf("%11s %11s %11s %11s %11s\n",
+	       "block size", "CRC32 MB/s", "cycles/byte", "CRC32C MB/s",
+	       "cycles/byte");
+    }
+    else
+    {
+	printf("%11s %11s %11s %11s %11s\n",
+	       "block size", "CRC32 MB/s", "ns/byte", "CRC32C MB/s",
+	       "ns/byte");
+	CPUFREQ = 1000000000;
+    }
+    if (BLKSIZE != 0)
+    {
+	benchmark(base, POOLSIZE, BLKSIZE, NUMOPS, CPUFREQ);
+    }
+    else
+    {
+	static const uint16_t sizes[] =
+	    { 20, 64, 256, 1024, 4096, 16384, 0 };
+	for (int i = 0; sizes[i] != 0; i++)
+	{
+	    uint32_t numops = NUMOPS * 100 / (40 + sizes[i]);
+	    benchmark(base, POOLSIZE, sizes[i], numops, CPUFREQ);
+	}
+    }
+
+#if !defined (_WIN32)
+    if (munmap(base, POOLSIZE) != 0)
+    {
+	perror("munmap"), exit(EXIT_FAILURE);
+    }
+#else
+
+    if (VirtualFree(base, POOLSIZE, MEM_RELEASE) == 0)
+    {
+	perror("VirtualFree"), exit(EXIT_FAILURE);
+    }
+#endif
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,443 @@
+/*
+ * Adler-32 and Fletcher-64 test & benchmark
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined (_WIN32)
+#  include <sys/mman.h>
+#else
+#  include <windows.h>
+#endif
+#include <time.h>
+#include <unistd.h>
+#include "../include/networking.h"
+
+#define CACHE_LINE 64
+#define ALIGN(x, y) (((x) + (y) - 1) & ~((y) - 1))
+
+/* Reference implementations - do not modify! */
+static unsigned int
+adler32_simple(unsigned int adler, const void *ptr, unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+
+    while (nbytes-- != 0)
+    {
+	a = (a + *cptr++) % 65521;
+	b = (b + a) % 65521;
+    }
+    return b << 16 | a;
+}
+
+static unsigned long long
+fletcher64_simple(unsigned long long fletcher, const void *ptr,
+		  unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+    uint64_t a = fletcher & 0xffffffff;
+    uint64_t b = fletcher >> 32;
+
+    for (uint32_t i = 0; i < nbytes; i += 4)
+    {
+	uint32_t word = 0;
+	for (uint32_t j = 0; j < 4 && i + j < nbytes; j++)
+	{
+	    word |= (uint32_t) cptr[i + j] << (8 * j);
+	}
+	a = (a + word) % 0xffffffff;
+	b = (b + a) % 0xffffffff;
+    }
+    return b << 32 | a;
+}
+
+static struct
+{
+    unsigned int (*adler32_fp)(unsigned int, const void *, unsigned int);
+    unsigned long long (*fletcher64_fp)(unsigned long long, const void *,
+					unsigned int);
+    const char *name;
+} implementations[] =
+{
+    { adler32_simple, fletcher64_simple, "simple"},
+    { __adler32, __fletcher64, "scalar"},
+#if __aarch64__
+    { __adler32_aarch64_simd, __fletcher64_aarch64_simd, "simd" },
+    { __adler32_aarch64_sve, __fletcher64_aarch64_sve, "sve" },
+#endif
+    { NULL, NULL, NULL}
+};
+
+static int
+find_impl(const char *name)
+{
+    for (int i = 0; implementations[i].name != NULL; i++)
+    {
+	if (strcmp(implementations[i].name, name) == 0)
+	{
+	    return i;
+	}
+    }
+    return -1;
+}
+
+static unsigned int (*ADLER32_FP)(unsigned int, const void *, unsigned int);
+static unsigned long long (*FLETCHER64_FP)(unsigned long long, const void *,
+					   unsigned int);
+static volatile uint64_t SINK;
+
+static bool
+verify(const void *data, uint32_t offset, uint32_t size)
+{
+    uint32_t adler_init = (offset * 0x9e3779b9) % 65521;
+    uint32_t adler_expected = adler32_simple(adler_init, data, size);
+    uint32_t adler_actual = ADLER32_FP(adler_init, data, size);
+    if (adler_actual != adler_expected)
+    {
+	fprintf(stderr, "\nInvalid Adler-32 for offset %u size %u: "
+		"actual %08x expected %08x (valid)",
+		offset, size, adler_actual, adler_expected);
+	exit(EXIT_FAILURE);
+    }
+    uint64_t fletcher_init = (uint64_t) (offset * 0x9e3779b9) << 32 | offset;
+    uint64_t fletcher_expected = fletcher64_simple(fletcher_init, data, size);
+    uint64_t fletcher_actual = FLETCHER64_FP(fletcher_init, data, size);
+    if (fletcher_actual != fletcher_expected)
+    {
+	fprintf(stderr, "\nInvalid Fletcher-64 for offset %u size %u: "
+		"actual %016jx expected %016jx (valid)",
+		offset, size, (uintmax_t) fletcher_actual,
+		(uintmax_t) fletcher_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+/* The checksum of a buffer split in two must be the checksum of the whole
+   buffer, for Fletcher-64 the first part being a multiple of 4 bytes */
+static bool
+verify_split(const void *data, uint32_t size, uint32_t split)
+{
+    uint32_t adler_expected = ADLER32_FP(1, data, size);
+    uint32_t adler_actual = ADLER32_FP(ADLER32_FP(1, data, split),
+				       (const char *) data + split,
+				       size - split);
+    if (adler_actual != adler_expected)
+    {
+	fprintf(stderr, "\nInvalid Adler-32 for size %u split at %u: "
+		"actual %08x expected %08x (valid)",
+		size, split, adler_actual, adler_expected);
+	exit(EXIT_FAILURE);
+    }
+    split &= ~3;
+    uint64_t fletcher_expected = FLETCHER64_FP(0, data, size);
+    uint64_t fletcher_actual = FLETCHER64_FP(FLETCHER64_FP(0, data, split),
+					     (const char *) data + split,
+					     size - split);
+    if (fletcher_actual != fletcher_expected)
+    {
+	fprintf(stderr, "\nInvalid Fletcher-64 for size %u split at %u: "
+		"actual %016jx expected %016jx (valid)",
+		size, split, (uintmax_t) fletcher_actual,
+		(uintmax_t) fletcher_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+static uint64_t
+clock_get_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t
+benchmark_fp(bool fletcher, const uint8_t *base, size_t poolsize,
+	     uint32_t blksize, uint32_t numops)
+{
+    uint64_t sum = 0;
+    uint64_t start = clock_get_ns();
+    for (uint32_t i = 0; i < numops; i ++)
+    {
+	/* Read a random value from the pool */
+	uint32_t random = ((uint32_t *) base)[i % (poolsize / 4)];
+	/* Generate a random starting address */
+	const void *data = &base[random % (poolsize - blksize)];
+	if (fletcher)
+	{
+	    sum += FLETCHER64_FP(0, data, blksize);
+	}
+	else
+	{
+	    sum += ADLER32_FP(1, data, blksize);
+	}
+    }
+    SINK = sum;
+    return clock_get_ns() - start;
+}
+
+static void
+benchmark(const uint8_t *base,
+	  size_t poolsize,
+	  uint32_t blksize,
+	  uint32_t numops,
+	  uint64_t cpufreq)
+{
+    printf("%11u ", (unsigned int) blksize); fflush(stdout);
+
+#define MEGABYTE 1000000 /* Decimal megabyte (MB) */
+    uint64_t accbytes = (uint64_t) numops * blksize;
+    for (int c = 0; c < 2; c++)
+    {
+	uint64_t elapsed_ns = benchmark_fp(c != 0, base, poolsize, blksize,
+					   numops);
+	uint64_t elapsed_ms = elapsed_ns / 1000000 + 1;
+	printf("%11ju ",
+	       (uintmax_t) ((accbytes / elapsed_ms) * 1000) / MEGABYTE);
+	unsigned int cyc_per_byte =
+	    (double) cpufreq * elapsed_ns / 1000000 / accbytes;
+	printf("%7u.%03u ", cyc_per_byte / 1000, cyc_per_byte % 1000);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+    uint32_t IMPL = 0;/* Simple implementation */
+    uint64_t CPUFREQ = 0;
+    uint32_t BLKSIZE = 0;
+    uint32_t NUMOPS = 1000000;
+    uint32_t POOLSIZE = 512 * 1024;/* Typical ARM L2 cache size */
+
+    setvbuf(stdout, NULL, _IOLBF, 160);
+    while ((c = getopt(argc, argv, "b:f:i:n:p:")) != -1)
+    {
+	switch (c)
+	{
+	    case 'b' :
+		{
+		    int blksize = atoi(optarg);
+		    if (blksize < 1 || blksize > POOLSIZE / 2)
+		    {
+			fprintf(stderr, "Invalid block size %d\n", blksize);
+			exit(EXIT_FAILURE);
+		    }
+		    BLKSIZE = (unsigned) blksize;
+		    break;
+		}
+	    case 'f' :
+		{
+		    int64_t cpufreq = atoll(optarg);
+		    if (cpufreq < 1)
+		    {
+			fprintf(stderr, "Invalid CPU frequency %"PRId64"\n",
+				cpufreq);
+			exit(EXIT_FAILURE);
+		    }
+		    CPUFREQ = cpufreq;
+		    break;
+		}
+	    case 'i' :
+		{
+		    int impl = find_impl(optarg);
+		    if (impl < 0)
+		    {
+			fprintf(stderr, "Invalid implementation %s\n", optarg);
+			goto usage;
+		    }
+		    IMPL = (unsigned) impl;
+		    break;
+		}
+	    case 'n' :
+		{
+		    int numops = atoi(optarg);
+		    if (numops < 1)
+		    {
+			fprintf(stderr, "Invalid number of operations %d\n", numops);
+			exit(EXIT_FAILURE);
+		    }
+		    NUMOPS = (unsigned) numops;
+		    break;
+		}
+	    case 'p' :
+		{
+		    int poolsize = atoi(optarg);
+		    if (poolsize < 4096)
+		    {
+			fprintf(stderr, "Invalid pool size %d\n", poolsize);
+			exit(EXIT_FAILURE);
+		    }
+		    char c = optarg[strlen(optarg) - 1];
+		    if (c == 'M')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024 * 1024;
+		    }
+		    else if (c == 'K')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024;
+		    }
+		    else
+		    {
+			POOLSIZE = (unsigned) poolsize;
+		    }
+		    break;
+		}
+	    default :
+usage :
+		fprintf(stderr, "Usage: fletcher <options>\n"
+			"-b <blksize>    Block size\n"
+			"-f <cpufreq>    CPU frequency (Hz)\n"
+			"-i <impl>       Implementation\n"
+			"-n <numops>     Number of operations\n"
+			"-p <poolsize>   Pool size (K or M suffix)\n"
+		       );
+		printf("Implementations:");
+		for (int i = 0; implementations[i].name != NULL; i++)
+		{
+		    printf(" %s", implementations[i].name);
+		}
+		printf("\n");
+		exit(EXIT_FAILURE);
+	}
+    }
+    if (optind > argc)
+    {
+	goto usage;
+    }
+
+    ADLER32_FP = implementations[IMPL].adler32_fp;
+    FLETCHER64_FP = implementations[IMPL].fletcher64_fp;
+    POOLSIZE = ALIGN(POOLSIZE, CACHE_LINE);
+#if !defined (_WIN32)
+    uint8_t *base = mmap(0, POOLSIZE, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+	perror("aligned_alloc"), exit(EXIT_FAILURE);
+    }
+#else
+    uint8_t *base = VirtualAlloc(0, POOLSIZE, MEM_RESERVE|MEM_COMMIT,
+				 PAGE_READWRITE);
+    if (base == 0)
+    {
+	perror("VirtualAlloc"), exit(EXIT_FAILURE);
+    }
+#endif
+    for (size_t i = 0; i < POOLSIZE / 4; i++)
+    {
+	((uint32_t *) base)[i] = rand();
+    }
+
+    printf("Implementation: %s\n", implementations[IMPL].name);
+    printf("numops %u, poolsize ", NUMOPS);
+    if (POOLSIZE % (1024 * 1024) == 0)
+    {
+	printf("%uMiB", POOLSIZE / (1024 * 1024));
+    }
+    else if (POOLSIZE % 1024 == 0)
+    {
+	printf("%uKiB", POOLSIZE / 1024);
+    }
+    else
+    {
+	printf("%uB", POOLSIZE);
+    }
+    printf(", blocksize %u, CPU frequency %juMHz\n",
+	   BLKSIZE, (uintmax_t) (CPUFREQ / 1000000));
+
+    printf("Verifying..."); fflush(stdout);
+    bool success = true;
+    /* Check the standard check values */
+    success &= ADLER32_FP(1, "123456789", 9) == 0x091e01de;
+    success &= ADLER32_FP(1, "Wikipedia", 9) == 0x11e60398;
+    success &= FLETCHER64_FP(0, "abcde", 5) == 0xc8c6c527646362c6;
+    success &= FLETCHER64_FP(0, "abcdef", 6) == 0xc8c72b276463c8c6;
+    success &= FLETCHER64_FP(0, "abcdefgh", 8) == 0x312e2b28cccac8c6;
+    /* Check all (relevant) combinations of size and offset */
+    for (int size = 0; size <= 256; size++)
+    {
+	for (int offset = 0; offset < 64; offset++)
+	{
+	    /* Check at start of mapped memory */
+	    success &= verify(&base[offset], offset, size);
+	    /* Check at end of mapped memory */
+	    uint8_t *p = base + POOLSIZE - (size + offset);
+	    success &= verify(p, (uintptr_t) p % 64, size);
+	}
+    }
+    /* Check sizes around the reduction intervals */
+    for (int size = 5400; size <= 11200; size += 7)
+    {
+	success &= verify(base + size % 16, size % 16, size);
+    }
+    /* Check increasingly larger sizes */
+    for (size_t size = 1; size < POOLSIZE; size *= 2)
+    {
+	success &= verify(base, 0, size);
+    }
+    success &= verify(base, 0, POOLSIZE);
+    /* Check continuing a checksum */
+    for (int i = 0; i < 1000; i++)
+    {
+	uint32_t size = rand() % 8192;
+	uint32_t split = size != 0 ? rand() % size : 0;
+	success &= verify_split(base + rand() % 64, size, split);
+    }
+    printf("%s\n", success ? "OK" : "failure");
+
+    /* Print throughput in decimal megabyte (1000000B) per second */
+    if (CPUFREQ != 0)
+    {
+	printf("%11s %11s %11s %11s %11s\n",
+	       "block size", "Adler MB/s", "cycles/byte", "Fletch MB/s",
+	       "cycles/byte");
+    }
+    else
+    {
+	printf("%11s %11s %11s %11s %11s\n",
+	       "block size", "Adler MB/s", "ns/byte", "Fletch MB/s",
+	       "ns/byte");
+	CPUFREQ = 1000000000;
+    }
+    if (BLKSIZE != 0)
+    {
+	benchmark(base, POOLSIZE, BLKSIZE, NUMOPS, CPUFREQ);
+    }
+    else
+    {
+	static const uint16_t sizes[] =
+	    { 20, 64, 256, 1024, 4096, 16384, 0 };
+	for (int i = 0; sizes[i] != 0; i++)
+	{
+	    uint32_t numops = NUMOPS * 100 / (40 + sizes[i]);
+	    benchmark(base, POOLSIZE, sizes[i], numops, CPUFREQ);
+	}
+    }
+
+#if !defined (_WIN32)
+    if (munmap(base, POOLSIZE) != 0)
+    {
+	perror("munmap"), exit(EXIT_FAILURE);
+    }
+#else
+
+    if (VirtualFree(base, POOLSIZE, MEM_RELEASE) == 0)
+    {
+	perror("VirtualFree"), exit(EXIT_FAILURE);
+    }
+#endif
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
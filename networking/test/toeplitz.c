@@ -0,0 +1,550 @@
+/*
+ * Toeplitz hash test & benchmark
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined (_WIN32)
+#  include <sys/mman.h>
+#else
+#  include <windows.h>
+#endif
+#include <time.h>
+#include <unistd.h>
+#include "../include/networking.h"
+
+#define CACHE_LINE 64
+#define ALIGN(x, y) (((x) + (y) - 1) & ~((y) - 1))
+
+/* Reference implementation - do not modify! */
+static unsigned int
+toeplitz_simple(const void *key, unsigned int keylen,
+		const void *ptr, unsigned int nbytes)
+{
+    const uint8_t *kptr = key;
+    const uint8_t *cptr = ptr;
+    uint32_t hash = 0;
+    uint32_t window = (uint32_t) kptr[0] << 24 | kptr[1] << 16
+		    | kptr[2] << 8 | kptr[3];
+
+    for (uint32_t i = 0; i < nbytes * 8; i++)
+    {
+	if (cptr[i / 8] & (0x80 >> (i % 8)))
+	{
+	    hash ^= window;
+	}
+	/* Shift in the next bit of the key */
+	uint32_t bit = i + 32;
+	uint32_t next = 0;
+	if (bit < keylen * 8)
+	{
+	    next = (kptr[bit / 8] >> (7 - bit % 8)) & 1;
+	}
+	window = window << 1 | next;
+    }
+    return hash;
+}
+
+static struct
+{
+    unsigned int (*hash_fp)(const void *, unsigned int,
+			    const void *, unsigned int);
+    void (*batch_fp)(const void *, unsigned int, const void *const *,
+		     unsigned int, unsigned int *, unsigned int);
+    unsigned int (*ipv4_fp)(const void *, unsigned int, unsigned int,
+			    unsigned int, unsigned short, unsigned short);
+    unsigned int (*ipv6_fp)(const void *, unsigned int, const void *,
+			    const void *, unsigned short, unsigned short);
+    const char *name;
+} implementations[] =
+{
+    { toeplitz_simple, NULL, NULL, NULL, "simple"},
+    { __toeplitz_hash, __toeplitz_hash_batch,
+      __toeplitz_hash_ipv4, __toeplitz_hash_ipv6, "scalar"},
+#if __aarch64__
+    { __toeplitz_hash_aarch64_simd, __toeplitz_hash_batch_aarch64_simd,
+      __toeplitz_hash_ipv4_aarch64_simd, __toeplitz_hash_ipv6_aarch64_simd,
+      "simd" },
+#endif
+    { NULL, NULL, NULL, NULL, NULL}
+};
+
+static int
+find_impl(const char *name)
+{
+    for (int i = 0; implementations[i].name != NULL; i++)
+    {
+	if (strcmp(implementations[i].name, name) == 0)
+	{
+	    return i;
+	}
+    }
+    return -1;
+}
+
+static unsigned int (*HASH_FP)(const void *, unsigned int,
+			       const void *, unsigned int);
+static void (*BATCH_FP)(const void *, unsigned int, const void *const *,
+			unsigned int, unsigned int *, unsigned int);
+static volatile uint32_t SINK;
+
+/* The key and test vectors of the Microsoft RSS verification suite */
+static const uint8_t RSSKEY[40] =
+{
+    0x6d, 0x5a, 0x56, 0xda, 0x25, 0x5b, 0x0e, 0xc2,
+    0x41, 0x67, 0x25, 0x3d, 0x43, 0xa3, 0x8f, 0xb0,
+    0xd0, 0xca, 0x2b, 0xcb, 0xae, 0x7b, 0x30, 0xb4,
+    0x77, 0xcb, 0x2d, 0xa3, 0x80, 0x30, 0xf2, 0x0c,
+    0x6a, 0x42, 0xb7, 0x3b, 0xbe, 0xac, 0x01, 0xfa
+};
+
+static const struct
+{
+    uint8_t saddr[4];
+    uint8_t daddr[4];
+    uint16_t sport;
+    uint16_t dport;
+    uint32_t hash;	/* Addresses only */
+    uint32_t hash_ports;
+} ipv4_vectors[] =
+{
+    { { 66, 9, 149, 187 }, { 161, 142, 100, 80 }, 2794, 1766,
+      0x323e8fc2, 0x51ccc178 },
+    { { 199, 92, 111, 2 }, { 65, 69, 140, 83 }, 14230, 4739,
+      0xd718262a, 0xc626b0ea },
+    { { 24, 19, 198, 95 }, { 12, 22, 207, 184 }, 12898, 38024,
+      0xd2d0a5de, 0x5c2b394a },
+    { { 38, 27, 205, 30 }, { 209, 142, 163, 6 }, 48228, 2217,
+      0x82989176, 0xafc7327f },
+    { { 153, 39, 163, 191 }, { 202, 188, 127, 2 }, 44251, 1303,
+      0x5d1809c5, 0x10e828a2 },
+};
+
+static const struct
+{
+    uint8_t saddr[16];
+    uint8_t daddr[16];
+    uint16_t sport;
+    uint16_t dport;
+    uint32_t hash;	/* Addresses only */
+    uint32_t hash_ports;
+} ipv6_vectors[] =
+{
+    { { 0x3f, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x1f, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07 },
+      { 0x3f, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+      2794, 1766, 0x2cc18cd5, 0x40207d3d },
+    { { 0x3f, 0xfe, 0x05, 0x01, 0x00, 0x08, 0x00, 0x00,
+	0x02, 0x60, 0x97, 0xff, 0xfe, 0x40, 0xef, 0xab },
+      { 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+      14230, 4739, 0x0f0c461c, 0xdde51bbf },
+    { { 0x3f, 0xfe, 0x19, 0x00, 0x45, 0x45, 0x00, 0x03,
+	0x02, 0x00, 0xf8, 0xff, 0xfe, 0x21, 0x67, 0xcf },
+      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0xf8, 0xff, 0xfe, 0x21, 0x67, 0xcf },
+      44251, 38024, 0x4b61e985, 0x02d1feef },
+};
+
+static uint16_t
+htons16(uint16_t x)
+{
+    return (uint16_t) (x << 8 | x >> 8);
+}
+
+/* Check the verification suite, hashing tuples of addresses and of
+   addresses and ports */
+static bool
+verify_vectors(uint32_t impl)
+{
+    bool success = true;
+    unsigned int (*ipv4_fp)(const void *, unsigned int, unsigned int,
+			    unsigned int, unsigned short, unsigned short) =
+	implementations[impl].ipv4_fp;
+    unsigned int (*ipv6_fp)(const void *, unsigned int, const void *,
+			    const void *, unsigned short, unsigned short) =
+	implementations[impl].ipv6_fp;
+
+    for (size_t i = 0; i < sizeof ipv4_vectors / sizeof ipv4_vectors[0]; i++)
+    {
+	uint8_t tuple[12];
+	memcpy(tuple, ipv4_vectors[i].saddr, 4);
+	memcpy(tuple + 4, ipv4_vectors[i].daddr, 4);
+	tuple[8] = ipv4_vectors[i].sport >> 8;
+	tuple[9] = ipv4_vectors[i].sport & 0xff;
+	tuple[10] = ipv4_vectors[i].dport >> 8;
+	tuple[11] = ipv4_vectors[i].dport & 0xff;
+	uint32_t hash = HASH_FP(RSSKEY, sizeof RSSKEY, tuple, 8);
+	uint32_t hash_ports = HASH_FP(RSSKEY, sizeof RSSKEY, tuple, 12);
+	if (ipv4_fp != NULL)
+	{
+	    uint32_t saddr, daddr;
+	    memcpy(&saddr, ipv4_vectors[i].saddr, 4);
+	    memcpy(&daddr, ipv4_vectors[i].daddr, 4);
+	    uint32_t hash_tuple =
+		ipv4_fp(RSSKEY, sizeof RSSKEY, saddr, daddr,
+			htons16(ipv4_vectors[i].sport),
+			htons16(ipv4_vectors[i].dport));
+	    if (hash_tuple != hash_ports)
+	    {
+		fprintf(stderr, "\nInvalid IPv4 tuple hash %zu: "
+			"actual %08x expected %08x", i, hash_tuple, hash_ports);
+		success = false;
+	    }
+	}
+	if (hash != ipv4_vectors[i].hash ||
+	    hash_ports != ipv4_vectors[i].hash_ports)
+	{
+	    fprintf(stderr, "\nInvalid IPv4 hash %zu: "
+		    "actual %08x %08x expected %08x %08x", i, hash,
+		    hash_ports, ipv4_vectors[i].hash,
+		    ipv4_vectors[i].hash_ports);
+	    success = false;
+	}
+    }
+    for (size_t i = 0; i < sizeof ipv6_vectors / sizeof ipv6_vectors[0]; i++)
+    {
+	uint8_t tuple[36];
+	memcpy(tuple, ipv6_vectors[i].saddr, 16);
+	memcpy(tuple + 16, ipv6_vectors[i].daddr, 16);
+	tuple[32] = ipv6_vectors[i].sport >> 8;
+	tuple[33] = ipv6_vectors[i].sport & 0xff;
+	tuple[34] = ipv6_vectors[i].dport >> 8;
+	tuple[35] = ipv6_vectors[i].dport & 0xff;
+	uint32_t hash = HASH_FP(RSSKEY, sizeof RSSKEY, tuple, 32);
+	uint32_t hash_ports = HASH_FP(RSSKEY, sizeof RSSKEY, tuple, 36);
+	if (ipv6_fp != NULL)
+	{
+	    uint32_t hash_tuple =
+		ipv6_fp(RSSKEY, sizeof RSSKEY, ipv6_vectors[i].saddr,
+			ipv6_vectors[i].daddr, htons16(ipv6_vectors[i].sport),
+			htons16(ipv6_vectors[i].dport));
+	    if (hash_tuple != hash_ports)
+	    {
+		fprintf(stderr, "\nInvalid IPv6 tuple hash %zu: "
+			"actual %08x expected %08x", i, hash_tuple, hash_ports);
+		success = false;
+	    }
+	}
+	if (hash != ipv6_vectors[i].hash ||
+	    hash_ports != ipv6_vectors[i].hash_ports)
+	{
+	    fprintf(stderr, "\nInvalid IPv6 hash %zu: "
+		    "actual %08x %08x expected %08x %08x", i, hash,
+		    hash_ports, ipv6_vectors[i].hash,
+		    ipv6_vectors[i].hash_ports);
+	    success = false;
+	}
+    }
+    return success;
+}
+
+static bool
+verify(const uint8_t *key, uint32_t keylen, const void *data,
+       uint32_t nbytes)
+{
+    uint32_t hash_expected = toeplitz_simple(key, keylen, data, nbytes);
+    uint32_t hash_actual = HASH_FP(key, keylen, data, nbytes);
+    if (hash_actual != hash_expected)
+    {
+	fprintf(stderr, "\nInvalid hash for key size %u size %u: "
+		"actual %08x expected %08x (valid)",
+		keylen, nbytes, hash_actual, hash_expected);
+	exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+#define MAXBURST 64
+
+/* A batch must hash as many single calls */
+static bool
+verify_batch(const uint8_t *key, uint32_t keylen, const uint8_t *base,
+	     size_t poolsize, uint32_t nbytes)
+{
+    const void *ptrs[MAXBURST];
+    unsigned int hashes[MAXBURST];
+    uint32_t n = rand() % (MAXBURST + 1);
+    for (uint32_t i = 0; i < n; i++)
+    {
+	ptrs[i] = &base[rand() % (poolsize - nbytes)];
+    }
+    BATCH_FP(key, keylen, ptrs, nbytes, hashes, n);
+    for (uint32_t i = 0; i < n; i++)
+    {
+	uint32_t hash_expected = toeplitz_simple(key, keylen, ptrs[i], nbytes);
+	if (hashes[i] != hash_expected)
+	{
+	    fprintf(stderr, "\nInvalid batch hash %u of %u for size %u: "
+		    "actual %08x expected %08x (valid)",
+		    i, n, nbytes, hashes[i], hash_expected);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    return true;
+}
+
+static uint64_t
+clock_get_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
+}
+
+#define NUMPTRS 4096
+
+/* Measure the hash rate of tuples of BLKSIZE bytes, one call per tuple
+   and, if available, one call per burst of 32 */
+static void
+benchmark(const uint8_t *key, uint32_t keylen, const uint8_t *base,
+	  size_t poolsize, uint32_t blksize, uint32_t numops)
+{
+    static const void *ptrs[NUMPTRS];
+    unsigned int hashes[32];
+
+    printf("%11u ", (unsigned int) blksize); fflush(stdout);
+    for (uint32_t i = 0; i < NUMPTRS; i++)
+    {
+	/* Read a random value from the pool */
+	uint32_t random = ((uint32_t *) base)[i % (poolsize / 4)];
+	/* Generate a random starting address */
+	ptrs[i] = &base[random % (poolsize - blksize)];
+    }
+    numops -= numops % 32;
+
+    uint32_t hash = 0;
+    uint64_t start = clock_get_ns();
+    for (uint32_t i = 0; i < numops; i++)
+    {
+	hash ^= HASH_FP(key, keylen, ptrs[i % NUMPTRS], blksize);
+    }
+    SINK = hash;
+    uint64_t elapsed = clock_get_ns() - start + 1;
+    /* Hashes per microsecond is million hashes per second */
+    printf("%11.2f ", numops * 1000.0 / elapsed);
+
+    if (BATCH_FP != NULL)
+    {
+	start = clock_get_ns();
+	for (uint32_t i = 0; i < numops; i += 32)
+	{
+	    BATCH_FP(key, keylen, &ptrs[i % NUMPTRS], blksize, hashes, 32);
+	    SINK = hashes[31];
+	}
+	elapsed = clock_get_ns() - start + 1;
+	printf("%11.2f", numops * 1000.0 / elapsed);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+    uint32_t IMPL = 0;/* Simple implementation */
+    uint32_t BLKSIZE = 0;
+    uint32_t NUMOPS = 1000000;
+    uint32_t POOLSIZE = 512 * 1024;/* Typical ARM L2 cache size */
+    uint8_t KEY[52];
+    uint32_t KEYLEN = sizeof KEY;
+
+    setvbuf(stdout, NULL, _IOLBF, 160);
+    while ((c = getopt(argc, argv, "b:i:n:p:")) != -1)
+    {
+	switch (c)
+	{
+	    case 'b' :
+		{
+		    int blksize = atoi(optarg);
+		    if (blksize < 1 || blksize + 4 > (int) KEYLEN)
+		    {
+			fprintf(stderr, "Invalid block size %d\n", blksize);
+			exit(EXIT_FAILURE);
+		    }
+		    BLKSIZE = (unsigned) blksize;
+		    break;
+		}
+	    case 'i' :
+		{
+		    int impl = find_impl(optarg);
+		    if (impl < 0)
+		    {
+			fprintf(stderr, "Invalid implementation %s\n", optarg);
+			goto usage;
+		    }
+		    IMPL = (unsigned) impl;
+		    break;
+		}
+	    case 'n' :
+		{
+		    int numops = atoi(optarg);
+		    if (numops < 1)
+		    {
+			fprintf(stderr, "Invalid number of operations %d\n", numops);
+			exit(EXIT_FAILURE);
+		    }
+		    NUMOPS = (unsigned) numops;
+		    break;
+		}
+	    case 'p' :
+		{
+		    int poolsize = atoi(optarg);
+		    if (poolsize < 4096)
+		    {
+			fprintf(stderr, "Invalid pool size %d\n", poolsize);
+			exit(EXIT_FAILURE);
+		    }
+		    char c = optarg[strlen(optarg) - 1];
+		    if (c == 'M')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024 * 1024;
+		    }
+		    else if (c == 'K')
+		    {
+			POOLSIZE = (unsigned) poolsize * 1024;
+		    }
+		    else
+		    {
+			POOLSIZE = (unsigned) poolsize;
+		    }
+		    break;
+		}
+	    default :
+usage :
+		fprintf(stderr, "Usage: toeplitz <options>\n"
+			"-b <blksize>    Block size (at most 48)\n"
+			"-i <impl>       Implementation\n"
+			"-n <numops>     Number of operations\n"
+			"-p <poolsize>   Pool size (K or M suffix)\n"
+		       );
+		printf("Implementations:");
+		for (int i = 0; implementations[i].name != NULL; i++)
+		{
+		    printf(" %s", implementations[i].name);
+		}
+		printf("\n");
+		exit(EXIT_FAILURE);
+	}
+    }
+    if (optind > argc)
+    {
+	goto usage;
+    }
+
+    HASH_FP = implementations[IMPL].hash_fp;
+    BATCH_FP = implementations[IMPL].batch_fp;
+    POOLSIZE = ALIGN(POOLSIZE, CACHE_LINE);
+#if !defined (_WIN32)
+    uint8_t *base = mmap(0, POOLSIZE, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+	perror("aligned_alloc"), exit(EXIT_FAILURE);
+    }
+#else
+    uint8_t *base = VirtualAlloc(0, POOLSIZE, MEM_RESERVE|MEM_COMMIT,
+				 PAGE_READWRITE);
+    if (base == 0)
+    {
+	perror("VirtualAlloc"), exit(EXIT_FAILURE);
+    }
+#endif
+    for (size_t i = 0; i < POOLSIZE / 4; i++)
+    {
+	((uint32_t *) base)[i] = rand();
+    }
+    for (uint32_t i = 0; i < KEYLEN; i++)
+    {
+	KEY[i] = rand();
+    }
+
+    printf("Implementation: %s\n", implementations[IMPL].name);
+    printf("numops %u, poolsize ", NUMOPS);
+    if (POOLSIZE % (1024 * 1024) == 0)
+    {
+	printf("%uMiB", POOLSIZE / (1024 * 1024));
+    }
+    else if (POOLSIZE % 1024 == 0)
+    {
+	printf("%uKiB", POOLSIZE / 1024);
+    }
+    else
+    {
+	printf("%uB", POOLSIZE);
+    }
+    printf(", blocksize %u, key size %u\n", BLKSIZE, KEYLEN);
+
+    printf("Verifying..."); fflush(stdout);
+    bool success = verify_vectors(IMPL);
+    /* Check all sizes and offsets for 40-byte and 52-byte keys, and for
+       keys just long enough */
+    for (uint32_t size = 0; size <= KEYLEN - 4; size++)
+    {
+	for (uint32_t offset = 0; offset < 16; offset++)
+	{
+	    /* Check at start of mapped memory */
+	    success &= verify(KEY, 40, &base[offset], size <= 36 ? size : 36);
+	    success &= verify(KEY, KEYLEN, &base[offset], size);
+	    success &= verify(KEY, size + 4, &base[offset], size);
+	    /* Check at end of mapped memory */
+	    uint8_t *p = base + POOLSIZE - (size + offset);
+	    success &= verify(KEY, KEYLEN, p, size);
+	}
+    }
+    /* Check longer data and keys */
+    for (uint32_t size = 0; size < 200; size++)
+    {
+	uint8_t *key = base + POOLSIZE / 2;
+	success &= verify(key, size + 4 + rand() % 8, base + size, size);
+    }
+    if (BATCH_FP != NULL)
+    {
+	for (int i = 0; i < 1000; i++)
+	{
+	    uint32_t size = 1 + rand() % (KEYLEN - 4);
+	    success &= verify_batch(KEY, KEYLEN, base, POOLSIZE, size);
+	}
+	uint8_t *key = base + POOLSIZE / 2;
+	success &= verify_batch(key, 200, base, POOLSIZE, 196);
+    }
+    printf("%s\n", success ? "OK" : "failure");
+
+    /* Print hash rate in million hashes per second */
+    printf("%11s %11s %11s\n", "tuple size", "Mhash/s", "Mhash/s batch");
+    if (BLKSIZE != 0)
+    {
+	benchmark(KEY, KEYLEN, base, POOLSIZE, BLKSIZE, NUMOPS);
+    }
+    else
+    {
+	/* IPv4 and IPv6 TCP/UDP tuples, and a 48-byte input */
+	static const uint8_t sizes[] = { 12, 36, 48, 0 };
+	for (int i = 0; sizes[i] != 0; i++)
+	{
+	    benchmark(KEY, KEYLEN, base, POOLSIZE, sizes[i], NUMOPS);
+	}
+    }
+
+#if !defined (_WIN32)
+    if (munmap(base, POOLSIZE) != 0)
+    {
+	perror("munmap"), exit(EXIT_FAILURE);
+    }
+#else
+
+    if (VirtualFree(base, POOLSIZE, MEM_RELEASE) == 0)
+    {
+	perror("VirtualFree"), exit(EXIT_FAILURE);
+    }
+#endif
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
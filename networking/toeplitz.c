@@ -0,0 +1,68 @@
+/*
+ * Toeplitz hash for receive side scaling (RSS)
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "toeplitz_common.h"
+
+/* Branch-free bit-serial hash, one 64-bit key window per data byte */
+always_inline
+static inline uint32_t
+toeplitz(const uint8_t *key, uint32_t keylen, const uint8_t *cptr,
+	 uint32_t nbytes)
+{
+    Assert(nbytes + 4 <= keylen);
+    uint32_t hash = 0;
+    for (uint32_t i = 0; i < nbytes; i++)
+    {
+	uint64_t window = key_window(key, keylen, i);
+	uint32_t byte = cptr[i];
+	for (uint32_t k = 0; k < 8; k++)
+	{
+	    uint32_t mask = -((byte >> (7 - k)) & 1);
+	    hash ^= (uint32_t) (window >> (32 - k)) & mask;
+	}
+    }
+    return hash;
+}
+
+unsigned int
+__toeplitz_hash(const void *key, unsigned int keylen,
+		const void *ptr, unsigned int nbytes)
+{
+    return toeplitz(key, keylen, ptr, nbytes);
+}
+
+void
+__toeplitz_hash_batch(const void *key, unsigned int keylen,
+		      const void *const *ptrs, unsigned int nbytes,
+		      unsigned int *hashes, unsigned int n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+	hashes[i] = toeplitz(key, keylen, ptrs[i], nbytes);
+    }
+}
+
+unsigned int
+__toeplitz_hash_ipv4(const void *key, unsigned int keylen,
+		     unsigned int saddr, unsigned int daddr,
+		     unsigned short sport, unsigned short dport)
+{
+    uint8_t tuple[IPV4_TUPLE];
+    ipv4_tuple(tuple, saddr, daddr, sport, dport);
+    return toeplitz(key, keylen, tuple, IPV4_TUPLE);
+}
+
+unsigned int
+__toeplitz_hash_ipv6(const void *key, unsigned int keylen,
+		     const void *saddr, const void *daddr,
+		     unsigned short sport, unsigned short dport)
+{
+    uint8_t tuple[IPV6_TUPLE];
+    ipv6_tuple(tuple, saddr, daddr, sport, dport);
+    return toeplitz(key, keylen, tuple, IPV6_TUPLE);
+}
@@ -0,0 +1,61 @@
+/*
+ * Common code for Toeplitz hash implementations
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef TOEPLITZ_COMMON_H
+#define TOEPLITZ_COMMON_H
+
+#include "chksum_common.h"
+
+/* The Toeplitz hash XORs, for each bit set in the data, the 32 bits of the
+   key starting at the same bit position, both taken most significant bit
+   first.  Bit K of the data byte at offset I thus selects bits 32 - K to
+   63 - K of the big-endian 64-bit window of the key at byte I.  Key bytes
+   past KEYLEN read as zero.  */
+always_inline
+static inline uint64_t
+key_window(const uint8_t *key, uint32_t keylen, uint32_t offset)
+{
+    if (likely(offset + 8 <= keylen))
+    {
+	return bswap64(load64(key + offset));
+    }
+    uint64_t window = 0;
+    for (uint32_t i = 0; i < 8; i++)
+    {
+	window = window << 8 | (offset + i < keylen ? key[offset + i] : 0);
+    }
+    return window;
+}
+
+/* The RSS input for TCP/UDP: source address, destination address, source
+   port and destination port, all in network byte order.  */
+#define IPV4_TUPLE 12
+#define IPV6_TUPLE 36
+
+always_inline
+static inline void
+ipv4_tuple(uint8_t *tuple, uint32_t saddr, uint32_t daddr,
+	   uint16_t sport, uint16_t dport)
+{
+    store32(tuple, saddr);
+    store32(tuple + 4, daddr);
+    store16(tuple + 8, sport);
+    store16(tuple + 10, dport);
+}
+
+always_inline
+static inline void
+ipv6_tuple(uint8_t *tuple, const void *saddr, const void *daddr,
+	   uint16_t sport, uint16_t dport)
+{
+    memcpy(tuple, saddr, 16);
+    memcpy(tuple + 16, daddr, 16);
+    store16(tuple + 32, sport);
+    store16(tuple + 34, dport);
+}
+
+#endif
@@ -0,0 +1,9 @@
+/*
+ * x86_64-specific checksum implementation using AVX2
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define BUILD_AVX2 1
+#include "chksum_simd.c"
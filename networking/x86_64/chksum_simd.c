@@ -0,0 +1,128 @@
+/*
+ * x86_64-specific checksum implementation using SSE2 or AVX2
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../chksum_common.h"
+
+/* To build the AVX2 version, define BUILD_AVX2 before compiling this file.
+   SSE2 is part of the x86_64 baseline.  Note, because the target attribute
+   is 'pushed' in clang, it has to be popped at the end of the file with
+   CLOSE_AVX2_ATTR.  */
+#if BUILD_AVX2
+# define FUNC __chksum_x86_64_avx2
+# ifdef __clang__
+#  pragma clang attribute push(__attribute__((target("avx2"))),		\
+			       apply_to = any(function))
+#  define CLOSE_AVX2_ATTR _Pragma("clang attribute pop")
+# else
+#  pragma GCC target("avx2")
+# endif
+# include <immintrin.h>
+# define VLEN 32
+typedef __m256i vec_t;
+# define vload(p)	_mm256_loadu_si256((const __m256i *) (p))
+# define vzero()	_mm256_setzero_si256()
+# define vdup64(x)	_mm256_set1_epi64x(x)
+# define vadd64(a, b)	_mm256_add_epi64(a, b)
+# define vand(a, b)	_mm256_and_si256(a, b)
+# define vshr64(a, n)	_mm256_srli_epi64(a, n)
+#else
+# define FUNC __chksum_x86_64_simd
+# include <emmintrin.h>
+# define VLEN 16
+typedef __m128i vec_t;
+# define vload(p)	_mm_loadu_si128((const __m128i *) (p))
+# define vzero()	_mm_setzero_si128()
+# define vdup64(x)	_mm_set1_epi64x(x)
+# define vadd64(a, b)	_mm_add_epi64(a, b)
+# define vand(a, b)	_mm_and_si128(a, b)
+# define vshr64(a, n)	_mm_srli_epi64(a, n)
+#endif
+#ifndef CLOSE_AVX2_ATTR
+# define CLOSE_AVX2_ATTR
+#endif
+
+/* Add the 32-bit words of DATA to the 64-bit lanes of VSUM.  There is no
+   widening pairwise add as in AdvSIMD, so the low and high words of each
+   64-bit lane are added separately.  */
+always_inline
+static inline vec_t
+accumulate(vec_t vsum, vec_t data, vec_t mask)
+{
+    vsum = vadd64(vsum, vand(data, mask));
+    return vadd64(vsum, vshr64(data, 32));
+}
+
+always_inline
+static inline uint64_t
+vsum_lanes(vec_t vsum)
+{
+    uint64_t lanes[VLEN / 8];
+    memcpy(lanes, &vsum, sizeof lanes);
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < VLEN / 8; i++)
+    {
+	sum += lanes[i];
+    }
+    return sum;
+}
+
+/* Unaligned loads are cheap, and the sum of 16-bit words does not depend
+   on alignment, so the buffer is summed from its start.  As for AArch64,
+   four accumulators hide the latency of the additions.  Each 64-bit lane
+   accumulates at most 2^33 per vector of data, so the lanes cannot
+   overflow for buffers below 4GiB.  */
+unsigned short
+FUNC(const void *ptr, unsigned int nbytes)
+{
+    const uint8_t *cptr = ptr;
+
+    if (unlikely(nbytes < 50))
+    {
+	return fold_and_swap(slurp_small(ptr, nbytes), false);
+    }
+
+    vec_t mask = vdup64(0xffffffff);
+    vec_t vsum0 = vzero();
+    vec_t vsum1 = vzero();
+    vec_t vsum2 = vzero();
+    vec_t vsum3 = vzero();
+
+    /* Sum groups of four vectors */
+    for (; nbytes >= 4 * VLEN; nbytes -= 4 * VLEN)
+    {
+	vec_t vtmp0 = vload(cptr);
+	vec_t vtmp1 = vload(cptr + VLEN);
+	vec_t vtmp2 = vload(cptr + 2 * VLEN);
+	vec_t vtmp3 = vload(cptr + 3 * VLEN);
+	vsum0 = accumulate(vsum0, vtmp0, mask);
+	vsum1 = accumulate(vsum1, vtmp1, mask);
+	vsum2 = accumulate(vsum2, vtmp2, mask);
+	vsum3 = accumulate(vsum3, vtmp3, mask);
+	cptr += 4 * VLEN;
+    }
+
+    /* Fold vsum1, vsum2 and vsum3 into vsum0 */
+    vsum0 = vadd64(vsum0, vsum1);
+    vsum2 = vadd64(vsum2, vsum3);
+    vsum0 = vadd64(vsum0, vsum2);
+
+    /* Add the remaining whole vectors */
+    for (; nbytes >= VLEN; nbytes -= VLEN)
+    {
+	vsum0 = accumulate(vsum0, vload(cptr), mask);
+	cptr += VLEN;
+    }
+    Assert(nbytes < VLEN);
+
+    /* Handle any trailing bytes */
+    uint64_t sum = vsum_lanes(vsum0);
+    sum += slurp_small(cptr, nbytes);
+    return fold_and_swap(sum, false);
+}
+
+CLOSE_AVX2_ATTR
@@ -0,0 +1,152 @@
+/*
+ * CRC32 and CRC32C using the x86_64 SSE4.2 CRC32 and PCLMULQDQ instructions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "networking.h"
+#include "../crc32_common.h"
+
+#pragma GCC target("sse4.2,pclmul")
+
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+
+/* Bytes per stream when three streams are interleaved */
+#define BLOCK 256
+
+always_inline
+static inline uint64_t
+clmul(uint32_t a, uint64_t b)
+{
+    __m128i prod = _mm_clmulepi64_si128(_mm_cvtsi32_si128(a),
+					_mm_cvtsi64_si128(b), 0x00);
+    return _mm_cvtsi128_si64(prod);
+}
+
+/* The SSE4.2 CRC32 instruction only computes CRC32C.  As for AArch64,
+   three streams of BLOCK bytes are processed interleaved and combined
+   with a carry-less multiply by x^(8 * BLOCK) and x^(16 * BLOCK) modulo
+   the polynomial, followed by a reduction with the CRC instruction.  */
+unsigned int
+__crc32c_x86_64(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    const unsigned char *cptr = ptr;
+    uint64_t crc64 = (uint32_t) ~crc;
+
+    while (nbytes >= 3 * BLOCK)
+    {
+	uint64_t crc1 = 0;
+	uint64_t crc2 = 0;
+	for (uint32_t i = 0; i < BLOCK; i += 8)
+	{
+	    crc64 = _mm_crc32_u64(crc64, load64(cptr + i));
+	    crc1 = _mm_crc32_u64(crc1, load64(cptr + BLOCK + i));
+	    crc2 = _mm_crc32_u64(crc2, load64(cptr + 2 * BLOCK + i));
+	}
+	uint64_t val = clmul(crc64, 0xdd7e3b0c) ^ clmul(crc1, 0xb9e02b86);
+	crc64 = _mm_crc32_u64(0, val) ^ crc2;
+	cptr += 3 * BLOCK;
+	nbytes -= 3 * BLOCK;
+    }
+
+    while (nbytes >= 8)
+    {
+	crc64 = _mm_crc32_u64(crc64, load64(cptr));
+	cptr += 8;
+	nbytes -= 8;
+    }
+    uint32_t crc32 = crc64;
+    while (nbytes != 0)
+    {
+	crc32 = _mm_crc32_u8(crc32, *cptr);
+	cptr++;
+	nbytes--;
+    }
+    return ~crc32;
+}
+
+/* Fold 64-byte blocks into four 128-bit accumulators with PCLMULQDQ, as
+   described in "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+   Instruction" (Intel, 2009), then fold those into one and reduce it to
+   32 bits with a Barrett reduction.  The constants are bit-reflected
+   x^n mod P(x), shifted left by one.  */
+static const uint64_t k1k2[2] = { 0x154442bd4, 0x1c6e41596 };
+static const uint64_t k3k4[2] = { 0x1751997d0, 0x0ccaa009e };
+static const uint64_t k5k0[2] = { 0x163cd6124, 0x000000000 };
+static const uint64_t poly[2] = { 0x1db710641, 0x1f7011641 };
+
+always_inline
+static inline __m128i
+fold128(__m128i acc, __m128i k, __m128i data)
+{
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+unsigned int
+__crc32_x86_64(unsigned int crc, const void *ptr, unsigned int nbytes)
+{
+    const unsigned char *cptr = ptr;
+    uint32_t crc32 = ~crc;
+
+    if (nbytes >= 64)
+    {
+	const __m128i *vptr = (const __m128i *) cptr;
+	__m128i x0 = _mm_loadu_si128((const __m128i *) k1k2);
+	__m128i x1 = _mm_loadu_si128(vptr);
+	__m128i x2 = _mm_loadu_si128(vptr + 1);
+	__m128i x3 = _mm_loadu_si128(vptr + 2);
+	__m128i x4 = _mm_loadu_si128(vptr + 3);
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc32));
+	vptr += 4;
+	nbytes -= 64;
+
+	/* Fold 64-byte blocks */
+	while (nbytes >= 64)
+	{
+	    x1 = fold128(x1, x0, _mm_loadu_si128(vptr));
+	    x2 = fold128(x2, x0, _mm_loadu_si128(vptr + 1));
+	    x3 = fold128(x3, x0, _mm_loadu_si128(vptr + 2));
+	    x4 = fold128(x4, x0, _mm_loadu_si128(vptr + 3));
+	    vptr += 4;
+	    nbytes -= 64;
+	}
+
+	/* Fold the four accumulators into one */
+	x0 = _mm_loadu_si128((const __m128i *) k3k4);
+	x1 = fold128(x1, x0, x2);
+	x1 = fold128(x1, x0, x3);
+	x1 = fold128(x1, x0, x4);
+
+	/* Fold any remaining 16-byte blocks */
+	while (nbytes >= 16)
+	{
+	    x1 = fold128(x1, x0, _mm_loadu_si128(vptr));
+	    vptr++;
+	    nbytes -= 16;
+	}
+
+	/* Fold 128 bits to 64 bits */
+	__m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x0 = _mm_loadl_epi64((const __m128i *) k5k0);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	/* Barrett reduction to 32 bits */
+	x0 = _mm_loadu_si128((const __m128i *) poly);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	crc32 = _mm_extract_epi32(x1, 1);
+	cptr = (const unsigned char *) vptr;
+    }
+
+    /* Handle any trailing 0..15 bytes, or a short buffer */
+    return ~crc32_table_update(crc32, cptr, nbytes, __crc32_table);
+}
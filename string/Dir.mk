@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2025, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 S := $(srcdir)/string
@@ -31,7 +31,11 @@ string-tests := \
 	build/bin/test/memset \
 	build/bin/test/memchr \
 	build/bin/test/memrchr \
+	build/bin/test/memchr2 \
+	build/bin/test/memrchr2 \
 	build/bin/test/memcmp \
+	build/bin/test/bcmp \
+	build/bin/test/memmem \
 	build/bin/test/__mtag_tag_region \
 	build/bin/test/__mtag_tag_zero_region \
 	build/bin/test/strcpy \
@@ -42,12 +46,15 @@ string-tests := \
 	build/bin/test/strchrnul \
 	build/bin/test/strlen \
 	build/bin/test/strnlen \
-	build/bin/test/strncmp
+	build/bin/test/strncmp \
+	build/bin/test/strstr
 
 string-benches := \
 	build/bin/bench/memcpy \
 	build/bin/bench/memset \
-	build/bin/bench/strlen
+	build/bin/bench/strlen \
+	build/bin/bench/memmem \
+	build/bin/bench/bcmp
 
 string-lib-objs := $(patsubst $(S)/%,$(B)/%.o,$(basename $(string-lib-srcs)))
 string-test-objs := $(patsubst $(S)/%,$(B)/%.o,$(basename $(string-test-srcs)))
@@ -106,6 +113,8 @@ bench-string: $(string-benches)
 	$(EMULATOR) build/bin/bench/strlen
 	$(EMULATOR) build/bin/bench/memcpy
 	$(EMULATOR) build/bin/bench/memset
+	$(EMULATOR) build/bin/bench/memmem
+	$(EMULATOR) build/bin/bench/bcmp
 
 install-string: \
  $(string-libs:build/lib/%=$(libdir)/%) \
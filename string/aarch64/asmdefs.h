@@ -1,7 +1,7 @@
 /*
  * Macros for asm code.  AArch64 version.
  *
- * Copyright (c) 2019-2025, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -88,4 +88,11 @@ GNU_PROPERTY (FEATURE_1_AND, FEATURE_1_BTI|FEATURE_1_PAC)
 
 #define L(l) .L ## l
 
+/* Name of a C function referenced from asm, e.g. for a tail call.  */
+#if defined (__APPLE__)
+# define CSYM(name) _ ## name
+#else
+# define CSYM(name) name
+#endif
+
 #endif
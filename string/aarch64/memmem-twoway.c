@@ -0,0 +1,146 @@
+/*
+ * memmem - two-way fallback used by the SIMD implementations.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+/* The SIMD memmem routines filter candidate positions by the first and last
+   needle bytes and then verify each candidate.  Inputs with many partial
+   matches make that quadratic, so once verification work exceeds a bound
+   the remaining haystack is handed to this Crochemore-Perrin two-way
+   search, which runs in O(hlen + nlen) time and O(1) space.  */
+
+/* Return the start of the maximal suffix of N[0..M) for the byte order
+   given by INV (0 for the natural order, 0xff for the reverse order) and
+   set *PERIOD to the period of that suffix.  */
+static size_t
+max_suffix (const unsigned char *n, size_t m, unsigned inv, size_t *period)
+{
+  size_t i = 0, j = 1, k = 0, p = 1;
+
+  while (j + k < m)
+    {
+      unsigned a = n[j + k] ^ inv;
+      unsigned b = n[i + k] ^ inv;
+      if (a < b)
+	{
+	  j += k + 1;
+	  k = 0;
+	  p = j - i;
+	}
+      else if (a == b)
+	{
+	  if (k + 1 == p)
+	    {
+	      j += p;
+	      k = 0;
+	    }
+	  else
+	    k++;
+	}
+      else
+	{
+	  i = j++;
+	  k = 0;
+	  p = 1;
+	}
+    }
+  *period = p;
+  return i;
+}
+
+/* Critical factorization of N[0..M): the needle is split into N[0..ell)
+   and N[ell..M) such that the local period at ELL equals the global
+   period *PERIOD.  */
+static size_t
+critical_factorization (const unsigned char *n, size_t m, size_t *period)
+{
+  size_t p1, p2, s1, s2;
+
+  if (m < 3)
+    {
+      *period = 1;
+      return m - 1;
+    }
+  s1 = max_suffix (n, m, 0, &p1);
+  s2 = max_suffix (n, m, 0xff, &p2);
+  if (s1 >= s2)
+    {
+      *period = p1;
+      return s1;
+    }
+  *period = p2;
+  return s2;
+}
+
+void *__memmem_twoway_aarch64 (const void *, size_t, const void *, size_t)
+  __attribute__ ((__visibility__ ("hidden")));
+
+void *
+__memmem_twoway_aarch64 (const void *hay, size_t hlen, const void *ndl,
+			 size_t nlen)
+{
+  const unsigned char *h = hay;
+  const unsigned char *n = ndl;
+  size_t ell, p, i, j;
+
+  if (nlen == 0)
+    return (void *) h;
+  if (nlen > hlen)
+    return NULL;
+
+  ell = critical_factorization (n, nlen, &p);
+
+  if (memcmp (n, n + p, ell) == 0)
+    {
+      /* Periodic needle: after a full match of the right half a shift by
+	 the period keeps NLEN - P bytes of the right half known to match,
+	 so remember them in MEM to avoid rescanning.  */
+      size_t mem = 0;
+      for (j = 0; j <= hlen - nlen;)
+	{
+	  i = ell > mem ? ell : mem;
+	  while (i < nlen && n[i] == h[i + j])
+	    i++;
+	  if (i < nlen)
+	    {
+	      j += i - ell + 1;
+	      mem = 0;
+	      continue;
+	    }
+	  for (i = ell; i > mem && n[i - 1] == h[i - 1 + j]; i--)
+	    ;
+	  if (i <= mem)
+	    return (void *) (h + j);
+	  j += p;
+	  mem = nlen - p;
+	}
+    }
+  else
+    {
+      /* Non-periodic needle: any mismatch in the left half allows a shift
+	 past the larger of the two halves.  */
+      p = (ell > nlen - ell ? ell : nlen - ell) + 1;
+      for (j = 0; j <= hlen - nlen;)
+	{
+	  i = ell;
+	  while (i < nlen && n[i] == h[i + j])
+	    i++;
+	  if (i < nlen)
+	    {
+	      j += i - ell + 1;
+	      continue;
+	    }
+	  for (i = ell; i > 0 && n[i - 1] == h[i - 1 + j]; i--)
+	    ;
+	  if (i == 0)
+	    return (void *) (h + j);
+	  j += p;
+	}
+    }
+  return NULL;
+}
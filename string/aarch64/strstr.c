@@ -0,0 +1,55 @@
+/*
+ * strstr - find a substring in a string
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "stringlib.h"
+
+/* The haystack length is not known up front, and the memmem filter loads
+   haystack bytes up to nlen - 1 past each candidate, so it cannot be run
+   directly on a NUL-terminated string.  Instead the haystack is measured
+   lazily in chunks of at least twice the needle length with the MTE-safe
+   strnlen, and each chunk is searched with memmem.  Consecutive chunks
+   overlap by nlen - 1 bytes, so every position is checked, and each step
+   advances by at least half a chunk, so the search stays linear.  */
+
+#define CHUNK 4096
+
+static inline __attribute__ ((always_inline)) char *
+strstr_chunked (const char *hay, const char *ndl,
+		size_t (*strlen_fn) (const char *),
+		size_t (*strnlen_fn) (const char *, size_t),
+		void *(*memmem_fn) (const void *, size_t, const void *, size_t))
+{
+  size_t nlen = strlen_fn (ndl);
+  size_t chunk = nlen < CHUNK / 2 ? CHUNK : 2 * nlen;
+
+  if (nlen == 0)
+    return (char *) hay;
+  for (;;)
+    {
+      size_t len = strnlen_fn (hay, chunk);
+      char *res = memmem_fn (hay, len, ndl, nlen);
+      if (res != NULL || len < chunk)
+	return res;
+      hay += len - nlen + 1;
+    }
+}
+
+char *
+__strstr_aarch64 (const char *hay, const char *ndl)
+{
+  return strstr_chunked (hay, ndl, __strlen_aarch64, __strnlen_aarch64,
+			 __memmem_aarch64);
+}
+
+#if __ARM_FEATURE_SVE
+char *
+__strstr_aarch64_sve (const char *hay, const char *ndl)
+{
+  return strstr_chunked (hay, ndl, __strlen_aarch64_sve,
+			 __strnlen_aarch64_sve, __memmem_aarch64_sve);
+}
+#endif
@@ -0,0 +1,153 @@
+/*
+ * bcmp benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS_RANDOM	5000
+#define ITERS_FIXED	20000000
+
+#define NUM_TESTS 16384
+#define MAX_KEYLEN 256
+#define BUF_SIZE (512 * 1024)
+
+static uint8_t a[BUF_SIZE + MAX_KEYLEN] __attribute__((__aligned__(4096)));
+static uint8_t b[BUF_SIZE + MAX_KEYLEN] __attribute__((__aligned__(4096)));
+
+#define DOTEST(STR,TESTFN)			\
+  printf (STR);					\
+  RUN (TESTFN, memcmp);				\
+  RUN (TESTFN, bcmp);				\
+  RUNA64 (TESTFN, __memcmp_aarch64);		\
+  RUNA64 (TESTFN, __bcmp_aarch64);		\
+  RUNA64 (TESTFN, __memeq_aarch64);		\
+  RUNSVE (TESTFN, __memcmp_aarch64_sve);	\
+  RUNSVE (TESTFN, __bcmp_aarch64_sve);		\
+  RUNSVE (TESTFN, __memeq_aarch64_sve);		\
+  printf ("\n");
+
+typedef struct { uint32_t offset1, offset2, len; } bcmp_test_t;
+static bcmp_test_t tests[NUM_TESTS];
+
+typedef struct { uint16_t size; uint16_t freq; } freq_data_t;
+
+#define SIZE_NUM 65536
+#define SIZE_MASK (SIZE_NUM - 1)
+static uint16_t keylen_arr[SIZE_NUM];
+
+/* Key length distribution of hash table lookups: mostly short identifiers
+   and integer or pointer keys, with a tail of path and URL keys.  */
+static freq_data_t keylen_freq[] =
+{
+  {  8,11140}, {  4, 6554}, { 16, 6554}, { 12, 3932}, { 10, 3277}, { 24, 3277},
+  {  6, 2621}, { 32, 2621}, { 14, 2621}, { 20, 2621}, {  7, 1966}, {  9, 1966},
+  { 11, 1966}, { 13, 1966}, { 15, 1311}, { 18, 1311}, { 22, 1311}, { 28, 1311},
+  {  5, 1311}, {  3,  655}, {  2,  655}, {  1,  328}, { 40,  655}, { 48,  655},
+  { 36,  328}, { 44,  328}, { 56,  328}, { 64,  655}, { 80,  328}, { 96,  328},
+  {128,  328}, {160,  131}, {192,  131}, {256,   66}, {  0,    0}
+};
+
+static void
+init_keylen_distribution (void)
+{
+  int i, j, freq, size, n;
+
+  for (n = i = 0; (freq = keylen_freq[i].freq) != 0; i++)
+    for (j = 0, size = keylen_freq[i].size; j < freq; j++)
+      keylen_arr[n++] = size;
+  assert (n == SIZE_NUM);
+}
+
+/* Most lookups of an existing key compare equal; a quarter of the keys
+   differ at a random position, as for a hash collision.  */
+static void
+init_bcmp_tests (void)
+{
+  for (int i = 0; i < BUF_SIZE + MAX_KEYLEN; i++)
+    a[i] = b[i] = rand32 (0);
+
+  for (int n = 0; n < NUM_TESTS; n++)
+    {
+      uint32_t len = keylen_arr[rand32 (0) & SIZE_MASK];
+      uint32_t off1 = rand32 (0) & (BUF_SIZE - 1) & -8;
+      uint32_t off2 = rand32 (0) & (BUF_SIZE - 1);
+
+      memcpy (b + off2, a + off1, len);
+      if (len > 0 && (rand32 (0) & 3) == 0)
+	b[off2 + rand32 (0) % len] ^= 1;
+      tests[n] = (bcmp_test_t) { off1, off2, len };
+    }
+}
+
+static volatile size_t maskv = 0;
+
+static void inline __attribute ((always_inline))
+bcmp_random (const char *name, int (*fn)(const void *, const void *, size_t))
+{
+  size_t res = 0, mask = maskv;
+  uint64_t bcmp_size = 0;
+  printf ("%22s ", name);
+
+  for (int c = 0; c < NUM_TESTS; c++)
+    bcmp_size += tests[c].len;
+  bcmp_size *= ITERS_RANDOM;
+
+  /* Measure throughput.  */
+  uint64_t t = clock_get_ns ();
+  for (int i = 0; i < ITERS_RANDOM; i++)
+    for (int c = 0; c < NUM_TESTS; c++)
+      res += fn (a + tests[c].offset1, b + tests[c].offset2, tests[c].len);
+  t = clock_get_ns () - t;
+  printf ("tp: %.3f ", (double)bcmp_size / t);
+
+  /* Measure latency with a dependency on the previous result.  */
+  t = clock_get_ns ();
+  for (int i = 0; i < ITERS_RANDOM; i++)
+    for (int c = 0; c < NUM_TESTS; c++)
+      res += fn (a + tests[c].offset1 + (res & mask), b + tests[c].offset2,
+		 tests[c].len);
+  t = clock_get_ns () - t;
+  printf ("lat: %.3f\n", (double)bcmp_size / t);
+  maskv = res & mask;
+}
+
+static void inline __attribute ((always_inline))
+bcmp_fixed (const char *name, int (*fn)(const void *, const void *, size_t))
+{
+  printf ("%22s ", name);
+
+  size_t res = 0, mask = maskv;
+  memcpy (b + 3, a, MAX_KEYLEN);
+  for (int size = 4; size <= MAX_KEYLEN; size *= 2)
+    {
+      uint64_t t = clock_get_ns ();
+      for (int i = 0; i < ITERS_FIXED; i++)
+	res += fn (a + (i & mask), b + 3, size);
+      t = clock_get_ns () - t;
+      printf ("%dB: %5.2f ", size, (double)size * ITERS_FIXED / t);
+    }
+  maskv = res & mask;
+  printf ("\n");
+}
+
+int main (void)
+{
+  rand32 (0x12345678);
+  init_keylen_distribution ();
+  init_bcmp_tests ();
+
+  DOTEST ("Random key compare (bytes/ns):\n", bcmp_random);
+  DOTEST ("Equal keys, unaligned (bytes/ns):\n", bcmp_fixed);
+
+  return 0;
+}
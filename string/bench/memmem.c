@@ -0,0 +1,107 @@
+/*
+ * memmem benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS_LARGE	200
+#define ITERS_SMALL	2000000
+
+#define HAY_SIZE (256 * 1024)
+#define MAX_NLEN 64
+
+static char hay[HAY_SIZE + MAX_NLEN] __attribute__((__aligned__(4096)));
+static char ndl[MAX_NLEN + 1];
+
+#define DOTEST(STR,TESTFN)			\
+  printf (STR);					\
+  RUN (TESTFN, memmem);				\
+  RUNA64 (TESTFN, __memmem_aarch64);		\
+  RUNSVE (TESTFN, __memmem_aarch64_sve);	\
+  printf ("\n");
+
+/* Text-like haystack: lowercase words separated by spaces, roughly matching
+   the byte distribution of log files.  */
+static void
+init_hay (void)
+{
+  for (int i = 0; i < HAY_SIZE; i++)
+    {
+      uint32_t r = rand32 (0);
+      hay[i] = (r & 7) == 0 ? ' ' : 'a' + (r >> 8) % 26;
+    }
+}
+
+/* Needle of length N whose first and last bytes occur often in the
+   haystack but which never matches.  */
+static void
+init_ndl (int n)
+{
+  for (int i = 0; i < n; i++)
+    ndl[i] = 'a' + (i * 7) % 26;
+  ndl[n / 2] = '#';
+  ndl[n] = 0;
+}
+
+static volatile size_t maskv = 0;
+
+static void inline __attribute ((always_inline))
+memmem_large (const char *name,
+	      void *(*fn)(const void *, size_t, const void *, size_t))
+{
+  printf ("%22s ", name);
+
+  size_t res = 0, mask = maskv;
+  for (int n = 2; n <= MAX_NLEN; n *= 2)
+    {
+      init_ndl (n);
+      uint64_t t = clock_get_ns ();
+      for (int i = 0; i < ITERS_LARGE; i++)
+	res += (size_t) fn (hay + (i & mask), HAY_SIZE, ndl, n);
+      t = clock_get_ns () - t;
+      printf ("%dB: %5.2f ", n, (double) HAY_SIZE * ITERS_LARGE / t);
+    }
+  maskv = res & mask;
+  printf ("\n");
+}
+
+/* Short haystacks with the match at the end, as when scanning log lines for
+   a keyword.  */
+static void inline __attribute ((always_inline))
+memmem_small (const char *name,
+	      void *(*fn)(const void *, size_t, const void *, size_t))
+{
+  printf ("%22s ", name);
+
+  size_t res = 0, mask = maskv;
+  for (int size = 16; size <= 256; size *= 2)
+    {
+      memcpy (ndl, hay + size - 8, 8);
+      uint64_t t = clock_get_ns ();
+      for (int i = 0; i < ITERS_SMALL; i++)
+	res += (size_t) fn (hay + (i & mask), size, ndl, 8);
+      t = clock_get_ns () - t;
+      printf ("%dB: %5.2f ", size, (double) size * ITERS_SMALL / t);
+    }
+  maskv = res & mask;
+  printf ("\n");
+}
+
+int main (void)
+{
+  rand32 (0x12345678);
+  init_hay ();
+
+  DOTEST ("Large memmem, no match (bytes/ns):\n", memmem_large);
+  DOTEST ("Small memmem, match at end (bytes/ns):\n", memmem_small);
+
+  return 0;
+}
@@ -1,7 +1,7 @@
 /*
  * Public API.
  *
- * Copyright (c) 2019-2023, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -20,7 +20,15 @@ void *__memset_scalar (void *, int, size_t);
 void *__memchr_aarch64 (const void *, int, size_t);
 void *__memchr_scalar (const void *, int, size_t);
 void *__memrchr_aarch64 (const void *, int, size_t);
+void *__memchr2_aarch64 (const void *, int, int, size_t);
+void *__memchr3_aarch64 (const void *, int, int, int, size_t);
+void *__memrchr2_aarch64 (const void *, int, int, size_t);
+void *__memrchr3_aarch64 (const void *, int, int, int, size_t);
 int __memcmp_aarch64 (const void *, const void *, size_t);
+int __bcmp_aarch64 (const void *, const void *, size_t);
+int __memeq_aarch64 (const void *, const void *, size_t);
+void *__memmem_aarch64 (const void *, size_t, const void *, size_t);
+char *__strstr_aarch64 (const char *, const char *);
 char *__strcpy_aarch64 (char *__restrict, const char *__restrict);
 char *__stpcpy_aarch64 (char *__restrict, const char *__restrict);
 int __strcmp_aarch64 (const char *, const char *);
@@ -43,6 +51,10 @@ void *__memmove_aarch64_sve (void *__restrict, const void *__restrict, size_t);
 void *__memset_aarch64_sve (void *, int, size_t);
 void *__memchr_aarch64_sve (const void *, int, size_t);
 int __memcmp_aarch64_sve (const void *, const void *, size_t);
+int __bcmp_aarch64_sve (const void *, const void *, size_t);
+int __memeq_aarch64_sve (const void *, const void *, size_t);
+void *__memmem_aarch64_sve (const void *, size_t, const void *, size_t);
+char *__strstr_aarch64_sve (const char *, const char *);
 char *__strchr_aarch64_sve (const char *, int);
 char *__strrchr_aarch64_sve (const char *, int);
 char *__strchrnul_aarch64_sve (const char *, int );
@@ -56,6 +68,10 @@ int __strncmp_aarch64_sve (const char *, const char *, size_t);
 # if __ARM_FEATURE_SVE2
 char *__strchr_aarch64_sve2 (const char *, int);
 char *__strchrnul_aarch64_sve2 (const char *, int );
+void *__memchr2_aarch64_sve2 (const void *, int, int, size_t);
+void *__memchr3_aarch64_sve2 (const void *, int, int, int, size_t);
+void *__memrchr2_aarch64_sve2 (const void *, int, int, size_t);
+void *__memrchr3_aarch64_sve2 (const void *, int, int, int, size_t);
 # endif
 # if __ARM_FEATURE_SME
 /* These are used to test functionality in streaming mode */
@@ -0,0 +1,118 @@
+/*
+ * memchr2 and memchr3 test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "mte.h"
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F2(x, mte) {#x, x, 0, mte},
+#define F3(x, mte) {#x, 0, x, mte},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun2) (const void *s, int c1, int c2, size_t n);
+  void *(*fun3) (const void *s, int c1, int c2, int c3, size_t n);
+  int test_mte;
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F2(__memchr2_aarch64, 1)
+  F3(__memchr3_aarch64, 1)
+# if __ARM_FEATURE_SVE2
+  F2(__memchr2_aarch64_sve2, 1)
+  F3(__memchr3_aarch64_sve2, 1)
+# endif
+#endif
+  {0, 0, 0, 0}
+  // clang-format on
+};
+#undef F2
+#undef F3
+
+#define ALIGN 32
+#define LEN 512
+static char *sbuf;
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + ALIGN - 1) & -ALIGN);
+}
+
+/* The characters searched for are 1, 2 and, for memchr3, 3.  */
+static void
+test (const struct fun *fun, int align, size_t seekpos, size_t len,
+      size_t maxlen)
+{
+  char *src = alignup (sbuf);
+  char *s = src + align;
+  char *f = seekpos < maxlen ? s + seekpos : NULL;
+  int nchr = fun->fun3 ? 3 : 2;
+  int seekchar = 1 + (seekpos + align) % nchr;
+  void *p;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (len > LEN || seekpos > LEN || align > ALIGN)
+    abort ();
+
+  for (int i = 0; src + i < s; i++)
+    src[i] = 1 + i % nchr;
+  for (int i = 0; i <= ALIGN; i++)
+    s[len + i] = 1 + i % nchr;
+  for (int i = 0; i < len; i++)
+    s[i] = 'a' + (i & 31);
+
+  s[seekpos] = seekchar;
+  /* A later occurrence of another character must not be returned.  */
+  s[((len ^ align) & 1) ? seekpos + 1 : len] = 1 + seekchar % nchr;
+
+  int mte_len = seekpos != -1 ? seekpos + 1 : maxlen;
+  s = tag_buffer (s, mte_len, fun->test_mte);
+  if (fun->fun3)
+    p = fun->fun3 (s, 1, 2, 3 | 0x100, maxlen);
+  else
+    p = fun->fun2 (s, 1 | 0x100, 2, maxlen);
+  untag_buffer (s, mte_len, fun->test_mte);
+  p = untag_pointer (p);
+
+  if (p != f)
+    {
+      ERR ("%s (%p, ..., %zu) returned %p, expected %p\n", fun->name, s,
+	   maxlen, p, f);
+      quote ("input", s, len);
+    }
+}
+
+int
+main (void)
+{
+  sbuf = mte_mmap (LEN + 3 * ALIGN);
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a < ALIGN; a++)
+	for (int n = 0; n < LEN; n++)
+	  {
+	    for (int sp = 0; sp < LEN; sp++)
+	      test (funtab + i, a, sp, n, n);
+	    test (funtab + i, a, n, n, SIZE_MAX - a);
+	  }
+      char *pass = funtab[i].test_mte && mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
@@ -0,0 +1,195 @@
+/*
+ * memmem test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mte.h"
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x, mte) {#x, x, mte},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun) (const void *h, size_t hlen, const void *n, size_t nlen);
+  int test_mte;
+} funtab[] = {
+  // clang-format off
+#if !defined (_WIN32)
+  F(memmem, 0)
+#endif
+#if __aarch64__
+  F(__memmem_aarch64, 1)
+# if __ARM_FEATURE_SVE
+  F(__memmem_aarch64_sve, 1)
+# endif
+#endif
+  {0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+#define ALIGN 32
+#define LEN 160
+#define NLEN 40
+#define BIGLEN 8192
+static char *hbuf;
+static char *nbuf;
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + ALIGN - 1) & -ALIGN);
+}
+
+static const char *
+ref_memmem (const char *h, size_t hlen, const char *n, size_t nlen)
+{
+  for (size_t i = 0; i + nlen <= hlen; i++)
+    if (memcmp (h + i, n, nlen) == 0)
+      return h + i;
+  return NULL;
+}
+
+static void
+check (const struct fun *fun, char *h, size_t hlen, char *n, size_t nlen)
+{
+  const char *f = ref_memmem (h, hlen, n, nlen);
+  void *p;
+
+  /* Anything found past the end of the haystack is an overread.  */
+  memcpy (h + hlen, n, nlen);
+
+  h = tag_buffer (h, hlen, fun->test_mte);
+  n = tag_buffer (n, nlen, fun->test_mte);
+  p = fun->fun (h, hlen, n, nlen);
+  untag_buffer (h, hlen, fun->test_mte);
+  untag_buffer (n, nlen, fun->test_mte);
+  p = untag_pointer (p);
+  h = untag_pointer (h);
+  n = untag_pointer (n);
+
+  if (p != f)
+    {
+      ERR ("%s (%p, %zu, %p, %zu) returned %p, expected %p\n", fun->name, h,
+	   hlen, n, nlen, p, f);
+      quote ("hay", h, hlen);
+      quote ("ndl", n, nlen);
+    }
+}
+
+/* The haystack alternates the first and last needle bytes, so nearly every
+   position is a candidate that only fails verification, unless the needle
+   is planted at SEEKPOS.  */
+static void
+test (const struct fun *fun, int align, size_t hlen, size_t nlen,
+      size_t seekpos)
+{
+  char *h = (char *) alignup (hbuf) + align;
+  char *n = alignup (nbuf);
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (hlen > LEN || nlen > NLEN || align >= ALIGN)
+    abort ();
+
+  for (size_t i = 0; i < nlen; i++)
+    n[i] = 'a' + (i % 7);
+  if (nlen > 0)
+    {
+      n[0] = 'f';
+      n[nlen - 1] = 'l';
+    }
+  for (size_t i = 0; i < hlen; i++)
+    h[i] = (i ^ nlen) & 1 ? 'l' : 'f';
+  if (seekpos <= hlen && nlen <= hlen - seekpos)
+    memcpy (h + seekpos, n, nlen);
+  check (fun, h, hlen, n, nlen);
+}
+
+/* Random haystacks over a small alphabet.  */
+static void
+test_random (const struct fun *fun, int iters)
+{
+  uint64_t state = 0x12345678;
+
+  for (int i = 0; i < iters && err_count < ERR_LIMIT; i++)
+    {
+      char *h = (char *) alignup (hbuf) + i % ALIGN;
+      char *n = alignup (nbuf);
+      state = state * 6364136223846793005ULL + 1;
+      size_t hlen = (state >> 33) % LEN;
+      size_t nlen = (state >> 45) % (NLEN / 2);
+      int alpha = 1 + (state >> 60) % 3;
+
+      for (size_t j = 0; j < hlen; j++)
+	{
+	  state = state * 6364136223846793005ULL + 1;
+	  h[j] = 'a' + (state >> 40) % alpha;
+	}
+      if (nlen <= hlen && (state >> 32) & 1)
+	memcpy (n, h + (state >> 35) % (hlen - nlen + 1), nlen);
+      else
+	for (size_t j = 0; j < nlen; j++)
+	  n[j] = 'a' + (j * 5 + i) % alpha;
+      check (fun, h, hlen, n, nlen);
+    }
+}
+
+/* Long runs of partial matches exercise the linear-time fallback.  */
+static void
+test_periodic (const struct fun *fun, size_t hlen, size_t nlen)
+{
+  char *h = alignup (hbuf);
+  char *n = alignup (nbuf);
+
+  memset (h, 'a', hlen);
+  memset (n, 'a', nlen);
+  n[nlen / 2] = 'b';
+  h[hlen - nlen + nlen / 2] = 'b';
+  check (fun, h, hlen, n, nlen);
+  h[hlen - nlen + nlen / 2] = 'a';
+  check (fun, h, hlen, n, nlen);
+}
+
+int
+main (void)
+{
+  hbuf = mte_mmap (2 * BIGLEN + 2 * ALIGN);
+  nbuf = mte_mmap (BIGLEN + 2 * ALIGN);
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a < ALIGN; a++)
+	for (size_t hl = 0; hl < LEN; hl++)
+	  {
+	    test (funtab + i, a, hl, 0, 0);
+	    for (size_t nl = 1; nl < NLEN; nl++)
+	      {
+		test (funtab + i, a, hl, nl, -1);
+		test (funtab + i, a, hl, nl, hl / 3);
+		test (funtab + i, a, hl, nl, hl - nl);
+	      }
+	  }
+      test_random (funtab + i, 100000);
+      for (size_t nl = 3; nl < 1024; nl *= 2)
+	test_periodic (funtab + i, BIGLEN, nl);
+      char *pass = funtab[i].test_mte && mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
@@ -0,0 +1,173 @@
+/*
+ * strstr test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mte.h"
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x, mte) {#x, x, mte},
+
+static const struct fun
+{
+  const char *name;
+  char *(*fun) (const char *h, const char *n);
+  int test_mte;
+} funtab[] = {
+  // clang-format off
+  F(strstr, 0)
+#if __aarch64__
+  F(__strstr_aarch64, 1)
+# if __ARM_FEATURE_SVE
+  F(__strstr_aarch64_sve, 1)
+# endif
+#endif
+  {0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+#define ALIGN 32
+#define LEN 160
+#define NLEN 40
+#define BIGLEN 10000
+static char *hbuf;
+static char *nbuf;
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + ALIGN - 1) & -ALIGN);
+}
+
+static const char *
+ref_strstr (const char *h, const char *n)
+{
+  size_t hlen = strlen (h);
+  size_t nlen = strlen (n);
+  for (size_t i = 0; i + nlen <= hlen; i++)
+    if (memcmp (h + i, n, nlen) == 0)
+      return h + i;
+  return NULL;
+}
+
+static void
+check (const struct fun *fun, char *h, size_t hlen, char *n, size_t nlen)
+{
+  const char *f;
+  char *p;
+
+  h[hlen] = '\0';
+  n[nlen] = '\0';
+  f = ref_strstr (h, n);
+
+  /* Anything found past the terminator is an overread.  */
+  memcpy (h + hlen + 1, n, nlen);
+
+  h = tag_buffer (h, hlen + 1, fun->test_mte);
+  n = tag_buffer (n, nlen + 1, fun->test_mte);
+  p = fun->fun (h, n);
+  untag_buffer (h, hlen + 1, fun->test_mte);
+  untag_buffer (n, nlen + 1, fun->test_mte);
+  p = untag_pointer (p);
+  h = untag_pointer (h);
+  n = untag_pointer (n);
+
+  if (p != f)
+    {
+      ERR ("%s (%p, %p) hlen %zu nlen %zu returned %p, expected %p\n",
+	   fun->name, h, n, hlen, nlen, p, f);
+      quote ("hay", h, hlen);
+      quote ("ndl", n, nlen);
+    }
+}
+
+/* As in the memmem test, nearly every position of the haystack is a
+   candidate that only fails verification, unless the needle is planted at
+   SEEKPOS.  */
+static void
+test (const struct fun *fun, int align, size_t hlen, size_t nlen,
+      size_t seekpos)
+{
+  char *h = (char *) alignup (hbuf) + align;
+  char *n = alignup (nbuf);
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (hlen > LEN || nlen > NLEN || align >= ALIGN)
+    abort ();
+
+  for (size_t i = 0; i < nlen; i++)
+    n[i] = 'a' + (i % 7);
+  if (nlen > 0)
+    {
+      n[0] = 'f';
+      n[nlen - 1] = 'l';
+    }
+  for (size_t i = 0; i < hlen; i++)
+    h[i] = (i ^ nlen) & 1 ? 'l' : 'f';
+  if (seekpos <= hlen && nlen <= hlen - seekpos)
+    memcpy (h + seekpos, n, nlen);
+  check (fun, h, hlen, n, nlen);
+}
+
+/* Haystacks longer than the internal chunk size, with the needle planted
+   across chunk boundaries.  */
+static void
+test_long (const struct fun *fun, size_t hlen, size_t nlen, size_t seekpos)
+{
+  char *h = alignup (hbuf);
+  char *n = alignup (nbuf);
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  memset (h, 'a', hlen);
+  memset (n, 'a', nlen);
+  n[nlen - 1] = 'b';
+  if (seekpos <= hlen && nlen <= hlen - seekpos)
+    h[seekpos + nlen - 1] = 'b';
+  check (fun, h, hlen, n, nlen);
+}
+
+int
+main (void)
+{
+  hbuf = mte_mmap (2 * BIGLEN + 2 * ALIGN);
+  nbuf = mte_mmap (BIGLEN + 2 * ALIGN);
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a < ALIGN; a++)
+	for (size_t hl = 0; hl < LEN; hl++)
+	  {
+	    test (funtab + i, a, hl, 0, 0);
+	    for (size_t nl = 1; nl < NLEN; nl++)
+	      {
+		test (funtab + i, a, hl, nl, -1);
+		test (funtab + i, a, hl, nl, hl / 3);
+		test (funtab + i, a, hl, nl, hl - nl);
+	      }
+	  }
+      for (size_t nl = 1; nl < 5000; nl = nl * 3 + 1)
+	{
+	  test_long (funtab + i, BIGLEN, nl, 4096 - nl);
+	  test_long (funtab + i, BIGLEN, nl, 4096 - nl / 2);
+	  test_long (funtab + i, BIGLEN, nl, 4095);
+	  test_long (funtab + i, BIGLEN, nl, BIGLEN - nl);
+	  test_long (funtab + i, BIGLEN, nl, -1);
+	}
+      char *pass = funtab[i].test_mte && mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}